@@ -219,7 +219,9 @@ typedef enum {
 typedef enum {
     NO_RESIZE = 0,    //!< "No resize" mode
     RESIZE_BILINEAR,  //!< "Bilinear resize" mode
-    RESIZE_AREA       //!< "Area resize" mode
+    RESIZE_AREA,      //!< "Area resize" mode
+    RESIZE_BICUBIC,   //!< "Bicubic resize" mode
+    RESIZE_LETTERBOX  //!< "Letterbox resize" mode: bilinear resize keeping the aspect ratio, padded with zeros
 } resize_alg_e;
 
 /**
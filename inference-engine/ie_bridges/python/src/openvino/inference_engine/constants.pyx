@@ -72,6 +72,8 @@ class ResizeAlgorithm(Enum):
     NO_RESIZE = 0
     RESIZE_BILINEAR = 1
     RESIZE_AREA = 2
+    RESIZE_BICUBIC = 3
+    RESIZE_LETTERBOX = 4
 
 
 class ColorFormat(Enum):
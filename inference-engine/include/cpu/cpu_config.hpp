@@ -0,0 +1,81 @@
+// Copyright (C) 2018-2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+/**
+ * @brief A header that defines advanced related properties for CPU plugin.
+ * These properties should be used in SetConfig() and LoadNetwork() methods of plugins
+ *
+ * @file cpu_config.hpp
+ */
+
+#pragma once
+
+#include <map>
+#include <string>
+
+#include "ie_plugin_config.hpp"
+
+namespace InferenceEngine {
+
+/**
+ * @brief CPU plugin configuration
+ */
+namespace CPUConfigParams {
+
+/**
+ * @def CPU_CONFIG_KEY(name)
+ * @brief Shortcut for defining configuration keys
+ */
+#define CPU_CONFIG_KEY(name) InferenceEngine::CPUConfigParams::_CONFIG_KEY(CPU_##name)
+/**
+ * @def CPU_CONFIG_VALUE(name)
+ * @brief Shortcut for defining configuration values
+ */
+#define CPU_CONFIG_VALUE(name) InferenceEngine::CPUConfigParams::CPU_##name
+
+#define DECLARE_CPU_CONFIG_KEY(name) DECLARE_CONFIG_KEY(CPU_##name)
+#define DECLARE_CPU_CONFIG_VALUE(name) DECLARE_CONFIG_VALUE(CPU_##name)
+
+/**
+ * @brief The key enables concurrent execution of independent graph branches inside one stream.
+ * Nodes that do not depend on each other are dispatched to the stream threads at the same time,
+ * which reduces latency of multi-branch topologies at small batch sizes.
+ * Supported values are PluginConfigParams::YES and PluginConfigParams::NO (default).
+ * The option takes effect only when the plugin is built with TBB threading.
+ */
+DECLARE_CPU_CONFIG_KEY(INTER_OP_PARALLELISM);
+
+/**
+ * @brief The key defines how intermediate tensors of the network are packed into the shared memory workspace.
+ * Supported values:
+ * - CPU_CONFIG_VALUE(FIRST_FIT) (default) - the biggest tensors are placed first at the lowest free offset
+ * - CPU_CONFIG_VALUE(BEST_FIT) - every tensor is placed into the smallest gap it fits
+ * - CPU_CONFIG_VALUE(AUTO) - both strategies are tried on network loading and the smallest workspace is kept
+ */
+DECLARE_CPU_CONFIG_KEY(MEMORY_REUSE_STRATEGY);
+DECLARE_CPU_CONFIG_VALUE(FIRST_FIT);
+DECLARE_CPU_CONFIG_VALUE(BEST_FIT);
+DECLARE_CPU_CONFIG_VALUE(AUTO);
+
+}  // namespace CPUConfigParams
+
+namespace Metrics {
+
+/**
+ * @def CPU_METRIC_KEY(name)
+ * @brief Shortcut for defining CPU specific metrics
+ */
+#define CPU_METRIC_KEY(name) METRIC_KEY(CPU_##name)
+#define DECLARE_CPU_METRIC_KEY(name, ...) DECLARE_METRIC_KEY(CPU_##name, __VA_ARGS__)
+
+/**
+ * @brief Metric of the executable network with memory usage of one stream graph, in bytes:
+ * "WORKSPACE_SIZE" - size of the memory shared by intermediate tensors,
+ * "WORKSPACE_LOWER_BOUND" - maximal total size of tensors alive at the same time, the smallest possible workspace,
+ * "STREAMS" - number of stream graphs, each of them allocates its own workspace.
+ */
+DECLARE_CPU_METRIC_KEY(MEMORY_STATISTICS, std::map<std::string, uint64_t>);
+
+}  // namespace Metrics
+}  // namespace InferenceEngine
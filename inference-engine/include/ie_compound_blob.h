@@ -311,4 +311,60 @@ class INFERENCE_ENGINE_API_CLASS(BatchedBlob) : public CompoundBlob {
      */
     explicit BatchedBlob(std::vector<Blob::Ptr>&& blobs);
 };
+
+/**
+ * @brief This class represents a batch of regions of interest cut from a single image
+ * @details Each item of the batch is a ROI blob created with Blob::createROI() on the same image,
+ * i.e. no image data is copied. ROIs may have different sizes: the blob is intended to be used as
+ * an input which is resized to the network input size by the preprocessing, so a resize algorithm
+ * must be set for the corresponding input.
+ */
+class INFERENCE_ENGINE_API_CLASS(BatchedROIBlob) : public CompoundBlob {
+public:
+    /**
+     * @brief A smart pointer to the BatchedROIBlob object
+     */
+    using Ptr = std::shared_ptr<BatchedROIBlob>;
+
+    /**
+     * @brief A smart pointer to the const BatchedROIBlob object
+     */
+    using CPtr = std::shared_ptr<const BatchedROIBlob>;
+
+    /**
+     * @brief Constructs a batched ROI blob from an image and a vector of regions of interest
+     * @details The image should be a memory blob in NCHW or NHWC layout, an NV12Blob or an I420Blob.
+     * All regions should be non-empty and lie within the image, ROI::id selects the image batch item
+     * the region is cut from.
+     * Resulting blob's tensor descriptor is the tensor descriptor of the image with
+     * batch dimension set to rois.size()
+     *
+     * @param image A blob the regions are cut from
+     * @param rois A vector of regions of interest, one per batch item
+     */
+    BatchedROIBlob(const Blob::Ptr& image, const std::vector<ROI>& rois);
+
+    /**
+     * @brief Returns the image the regions are cut from
+     * @return shared pointer to the image blob
+     */
+    const Blob::Ptr& getImage() const noexcept;
+
+    /**
+     * @brief Returns the regions of interest, one per batch item
+     * @return constant reference to the vector of regions
+     */
+    const std::vector<ROI>& getROIs() const noexcept;
+
+protected:
+    /**
+     * @brief The image the regions are cut from
+     */
+    Blob::Ptr _image;
+
+    /**
+     * @brief The regions of interest
+     */
+    std::vector<ROI> _rois;
+};
 }  // namespace InferenceEngine
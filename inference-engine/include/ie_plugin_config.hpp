@@ -10,6 +10,8 @@
  */
 #pragma once
 
+#include <cstdint>
+#include <map>
 #include <string>
 #include <tuple>
 #include <vector>
@@ -168,6 +170,18 @@ DECLARE_METRIC_KEY(DEVICE_THERMAL, float);
  */
 DECLARE_EXEC_NETWORK_METRIC_KEY(OPTIMAL_NUMBER_OF_INFER_REQUESTS, unsigned int);
 
+/**
+ * @brief Metric to get statistics of the compiled networks cache enabled with CONFIG_KEY(CACHE_DIR).
+ *
+ * The metric is provided by Core::GetMetric for any device name and contains the following counters:
+ * "HITS" and "MISSES" - number of cache lookups which found / did not find a cached network,
+ * "WRITES" - number of stored networks, "EVICTIONS" - number of entries removed to fit CONFIG_KEY(CACHE_SIZE_LIMIT),
+ * "SIZE" - total size of cached networks in bytes, "READ_TIME_US" and "WRITE_TIME_US" - total time in microseconds
+ * spent on reading (including import) and writing (including export) of cache entries.
+ * The map is empty if caching is disabled.
+ */
+DECLARE_METRIC_KEY(CACHE_STATISTICS, std::map<std::string, uint64_t>);
+
 }  // namespace Metrics
 
 /**
@@ -392,5 +406,17 @@ DECLARE_CONFIG_KEY(ENFORCE_BF16);
  */
 DECLARE_CONFIG_KEY(CACHE_DIR);
 
+/**
+ * @brief This key defines the maximum total size in bytes of compiled networks stored in CONFIG_KEY(CACHE_DIR).
+ *
+ * When a new network is stored and the limit is exceeded, the least recently used entries are removed.
+ * Value "0" (default) means the size of the cache is not limited.
+ *
+ * @code
+ * ie.SetConfig({{CONFIG_KEY(CACHE_DIR), "cache/"}, {CONFIG_KEY(CACHE_SIZE_LIMIT), "1073741824"}});
+ * @endcode
+ */
+DECLARE_CONFIG_KEY(CACHE_SIZE_LIMIT);
+
 }  // namespace PluginConfigParams
 }  // namespace InferenceEngine
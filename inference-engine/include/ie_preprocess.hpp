@@ -46,8 +46,11 @@ enum MeanVariant {
 /**
  * @enum ResizeAlgorithm
  * @brief Represents the list of supported resize algorithms.
+ *
+ * RESIZE_LETTERBOX is a bilinear resize which keeps the aspect ratio of the input image:
+ * the resized image is centered in the network's input and the remaining border is filled with zeros.
  */
-enum ResizeAlgorithm { NO_RESIZE = 0, RESIZE_BILINEAR, RESIZE_AREA };
+enum ResizeAlgorithm { NO_RESIZE = 0, RESIZE_BILINEAR, RESIZE_AREA, RESIZE_BICUBIC, RESIZE_LETTERBOX };
 
 /**
  * @brief This class stores pre-process information for the input
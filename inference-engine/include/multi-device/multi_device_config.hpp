@@ -11,6 +11,9 @@
 
 #pragma once
 
+#include <map>
+#include <string>
+
 #include "ie_plugin_config.hpp"
 
 namespace InferenceEngine {
@@ -34,5 +37,45 @@ namespace MultiDeviceConfigParams {
  */
 DECLARE_MULTI_CONFIG_KEY(DEVICE_PRIORITIES);
 
+/**
+ * @brief Scheduling policy config option, defines how inference requests are distributed among the devices:
+ * - MULTI_CONFIG_VALUE(PRIORITY) (default) - a request goes to the first device in the DEVICE_PRIORITIES order
+ *   which has an idle request
+ * - MULTI_CONFIG_VALUE(THROUGHPUT) - a request goes to the idle device with the minimal expected completion time
+ *   estimated from moving average latency of the device. A device without statistics gets a single request
+ *   to measure its latency. A request is queued only if all devices are busy
+ *
+ * The policy can also be changed with ExecutableNetwork::SetConfig
+ */
+DECLARE_MULTI_CONFIG_KEY(SCHEDULING_POLICY);
+
+/**
+ * @def MULTI_CONFIG_VALUE(name)
+ * @brief A macro which provides a MULTI-mangled name for configuration value with name `name`
+ */
+#define MULTI_CONFIG_VALUE(name) InferenceEngine::MultiDeviceConfigParams::MULTI_##name
+
+DECLARE_MULTI_CONFIG_VALUE(PRIORITY);
+DECLARE_MULTI_CONFIG_VALUE(THROUGHPUT);
+
 }  // namespace MultiDeviceConfigParams
+
+namespace Metrics {
+
+/**
+ * @def MULTI_METRIC_KEY(name)
+ * @brief A macro which provides a MULTI-mangled name for metric with name `name`
+ */
+#define MULTI_METRIC_KEY(name) METRIC_KEY(MULTI_##name)
+#define DECLARE_MULTI_METRIC_KEY(name, ...) DECLARE_METRIC_KEY(MULTI_##name, __VA_ARGS__)
+
+/**
+ * @brief Metric of the executable network with per-device scheduling statistics, device name is a key of the outer map.
+ * Statistics of a device: "AVERAGE_LATENCY_MS" - moving average latency of requests, "COMPLETED_REQUESTS" - number
+ * of completed requests, "BUSY_REQUESTS" - number of requests running at the moment, "UTILIZATION" - part of time
+ * the device requests were busy since the network was loaded (from 0 to 1).
+ */
+DECLARE_MULTI_METRIC_KEY(DEVICE_STATISTICS, std::map<std::string, std::map<std::string, double>>);
+
+}  // namespace Metrics
 }  // namespace InferenceEngine
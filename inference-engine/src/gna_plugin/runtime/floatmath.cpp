@@ -1,13 +1,17 @@
 // Copyright (C) 2018-2020 Intel Corporation
 // SPDX-License-Identifier: Apache-2.0
 //
-// floatmath.cpp : unoptimized floating point math routines (for reference)
+// floatmath.cpp : floating point math routines, matrix products use the blocked kernel from floatmath_gemm.cpp
 //
 
+#include <algorithm>
 #include <cstdint>
 #include <cstdio>
 
 #include "floatmath.h"
+#include "floatmath_gemm.hpp"
+
+using GNAPluginNS::runtime::XARCH::sgemm_accumulate;
 
 #ifdef __cplusplus
 extern "C" {  // API uses C linkage so that it can be used by C and C++ applications
@@ -27,15 +31,12 @@ void cblas_sgemm1(const CBLAS_LAYOUT Layout, const CBLAS_TRANSPOSE TransA,
     }
 
     if ((TransA == CblasNoTrans) && (TransB == CblasNoTrans)) {
-        for (i = 0; i < M; i++) {
-            for (j = 0; j < N; j++) {
-                float sum = (beta == 1.0) ? C[i * ldc + j] : 0;
-                for (k = 0; k < K; k++) {
-                    sum += A[i * lda + k] * B[k * ldb + j];
-                }
-                C[i * ldc + j] = sum;
+        if (beta != 1.0) {
+            for (i = 0; i < M; i++) {
+                std::fill_n(C + i * ldc, N, 0.0f);
             }
         }
+        sgemm_accumulate(M, N, K, A, lda, B, ldb, C, ldc, nullptr, 0);
     } else if ((TransA == CblasNoTrans) && (TransB == CblasTrans)) {
         for (i = 0; i < M; i++) {
             for (j = 0; j < N; j++) {
@@ -105,16 +106,12 @@ void cblas_sgemm_subset(const CBLAS_LAYOUT Layout, const CBLAS_TRANSPOSE TransA,
     }
 
     if ((TransA == CblasNoTrans) && (TransB == CblasNoTrans)) {
-        for (l = 0; l < L; l++) {
-            i = OutputList[l];
-            for (j = 0; j < N; j++) {
-                float sum = (beta == 1.0) ? C[l * ldc + j] : 0;
-                for (k = 0; k < K; k++) {
-                    sum += A[i * lda + k] * B[k * ldb + j];
-                }
-                C[l * ldc + j] = sum;
+        if (beta != 1.0) {
+            for (l = 0; l < L; l++) {
+                std::fill_n(C + l * ldc, N, 0.0f);
             }
         }
+        sgemm_accumulate(M, N, K, A, lda, B, ldb, C, ldc, OutputList, L);
     } else if ((TransA == CblasNoTrans) && (TransB == CblasTrans)) {
         for (i = 0; i < M; i++) {
             for (l = 0; l < L; l++) {
@@ -154,19 +151,10 @@ void sgemv_split(const uint32_t N,
                  const float *B,
                  float *C) {
     uint32_t num_columns = K1 + K2;
-    uint32_t num_rows = N;
-    uint32_t i, j;
-
-    for (i = 0; i < num_rows; i++) {
-        float sum = B[i];
-        for (j = 0; j < K1; j++) {
-            sum += A1[j] * X[i * num_columns + j];
-        }
-        for (j = K1; j < num_columns; j++) {
-            sum += A2[j - K1] * X[i * num_columns + j];
-        }
-        C[i] = sum;
-    }
+    std::copy_n(B, N, C);
+    // rows of X are multiplied by the column vectors A1 and A2
+    sgemm_accumulate(N, 1, K1, X, num_columns, A1, 1, C, 1, nullptr, 0);
+    sgemm_accumulate(N, 1, K2, X + K1, num_columns, A2, 1, C, 1, nullptr, 0);
 }
 
 #ifdef __cplusplus
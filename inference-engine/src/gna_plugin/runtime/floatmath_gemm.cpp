@@ -0,0 +1,113 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+// floatmath_gemm.cpp : cache blocked matrix multiplication for the float runtime
+//
+
+#include "floatmath_gemm.hpp"
+
+#include <algorithm>
+#include <vector>
+
+#include <ie_parallel.hpp>
+
+#include "floatmath_simd.hpp"
+
+namespace GNAPluginNS {
+namespace runtime {
+namespace XARCH {
+
+namespace {
+
+// Rows of A which share loads of B in the inner kernel
+constexpr int row_block = 4;
+// Columns of A processed at once, keeps the rows of A in L1 while they are reused for each column of B
+constexpr int k_block = 1024;
+// Multiply-add count below which threading overhead is not worth it
+constexpr size_t parallel_threshold = 1 << 16;
+
+/**
+ * @brief Accumulates dot products of R rows of A with N packed columns of B
+ * @param a R pointers to rows of A
+ * @param bt N columns of B stored contiguously with the ldbt stride
+ * @param c R pointers to rows of C
+ */
+template <int R>
+void dot_rows(const float* const* a, const float* bt, int ldbt, int N, int k, float* const* c) {
+    for (int n = 0; n < N; n++) {
+        const float* b = bt + static_cast<size_t>(n) * ldbt;
+        vec_t acc[R];
+        for (int r = 0; r < R; r++)
+            acc[r] = vec_zero();
+
+        int i = 0;
+        for (; i + vec_len <= k; i += vec_len) {
+            const vec_t vb = vec_load(b + i);
+            for (int r = 0; r < R; r++)
+                acc[r] = vec_fmadd(vec_load(a[r] + i), vb, acc[r]);
+        }
+        for (int r = 0; r < R; r++) {
+            float sum = vec_sum(acc[r]);
+            for (int j = i; j < k; j++)
+                sum += a[r][j] * b[j];
+            c[r][n] += sum;
+        }
+    }
+}
+
+}  // namespace
+
+void sgemm_accumulate(int M, int N, int K, const float* A, int lda, const float* B, int ldb,
+                      float* C, int ldc, const uint32_t* rows, int L) {
+    if (N <= 0 || K <= 0)
+        return;
+
+    // Columns of B are packed to be contiguous, a single column is used as is
+    std::vector<float> packed;
+    const float* bt = B;
+    int ldbt = 1;
+    if (N > 1 || ldb != 1) {
+        packed.resize(static_cast<size_t>(N) * K);
+        for (int k = 0; k < K; k++) {
+            for (int n = 0; n < N; n++) {
+                packed[static_cast<size_t>(n) * K + k] = B[static_cast<size_t>(k) * ldb + n];
+            }
+        }
+        bt = packed.data();
+        ldbt = K;
+    }
+
+    const int num_rows = rows == nullptr ? M : L;
+    const int num_blocks = (num_rows + row_block - 1) / row_block;
+    auto process_block = [&](int block) {
+        const int first = block * row_block;
+        const int count = std::min(row_block, num_rows - first);
+        const float* a[row_block];
+        float* c[row_block];
+        for (int kb = 0; kb < K; kb += k_block) {
+            const int k = std::min(k_block, K - kb);
+            for (int r = 0; r < count; r++) {
+                const size_t row = rows == nullptr ? first + r : rows[first + r];
+                a[r] = A + row * lda + kb;
+                c[r] = C + static_cast<size_t>(first + r) * ldc;
+            }
+            if (count == row_block) {
+                dot_rows<row_block>(a, bt + kb, ldbt, N, k, c);
+            } else {
+                for (int r = 0; r < count; r++)
+                    dot_rows<1>(a + r, bt + kb, ldbt, N, k, c + r);
+            }
+        }
+    };
+
+    if (static_cast<size_t>(num_rows) * N * K < parallel_threshold) {
+        for (int block = 0; block < num_blocks; block++)
+            process_block(block);
+    } else {
+        InferenceEngine::parallel_for(num_blocks, process_block);
+    }
+}
+
+}  // namespace XARCH
+}  // namespace runtime
+}  // namespace GNAPluginNS
@@ -0,0 +1,23 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <cstdint>
+
+namespace GNAPluginNS {
+namespace runtime {
+namespace XARCH {
+
+/**
+ * @brief Computes C += A * B for row-major matrices, A is M x K, B is K x N and C is M x N
+ * @note If the rows list is not null, only L rows of A listed in it are multiplied,
+ * the result for rows[l] is accumulated into the l-th row of C
+ */
+void sgemm_accumulate(int M, int N, int K, const float* A, int lda, const float* B, int ldb,
+                      float* C, int ldc, const uint32_t* rows, int L);
+
+}  // namespace XARCH
+}  // namespace runtime
+}  // namespace GNAPluginNS
@@ -0,0 +1,104 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+// floatmath_simd.hpp : vector primitives for the float runtime kernels, only for cross compiled sources
+//
+
+#pragma once
+
+#if defined(HAVE_SSE42) || defined(HAVE_AVX2) || defined(HAVE_AVX512F)
+#include <immintrin.h>
+#endif
+
+namespace GNAPluginNS {
+namespace runtime {
+namespace XARCH {
+
+#if defined(HAVE_AVX512F)
+constexpr int vec_len = 16;
+typedef __m512 vec_t;
+
+static inline vec_t vec_zero() { return _mm512_setzero_ps(); }
+static inline vec_t vec_set1(float value) { return _mm512_set1_ps(value); }
+static inline vec_t vec_load(const float* ptr) { return _mm512_loadu_ps(ptr); }
+static inline void vec_store(float* ptr, vec_t v) { _mm512_storeu_ps(ptr, v); }
+static inline vec_t vec_fmadd(vec_t a, vec_t b, vec_t c) { return _mm512_fmadd_ps(a, b, c); }
+static inline vec_t vec_min(vec_t a, vec_t b) { return _mm512_min_ps(a, b); }
+static inline vec_t vec_max(vec_t a, vec_t b) { return _mm512_max_ps(a, b); }
+static inline vec_t vec_mul(vec_t a, vec_t b) { return _mm512_mul_ps(a, b); }
+static inline float vec_sum(vec_t v) { return _mm512_reduce_add_ps(v); }
+#elif defined(HAVE_AVX2)
+constexpr int vec_len = 8;
+typedef __m256 vec_t;
+
+static inline vec_t vec_zero() { return _mm256_setzero_ps(); }
+static inline vec_t vec_set1(float value) { return _mm256_set1_ps(value); }
+static inline vec_t vec_load(const float* ptr) { return _mm256_loadu_ps(ptr); }
+static inline void vec_store(float* ptr, vec_t v) { _mm256_storeu_ps(ptr, v); }
+static inline vec_t vec_fmadd(vec_t a, vec_t b, vec_t c) { return _mm256_fmadd_ps(a, b, c); }
+static inline vec_t vec_min(vec_t a, vec_t b) { return _mm256_min_ps(a, b); }
+static inline vec_t vec_max(vec_t a, vec_t b) { return _mm256_max_ps(a, b); }
+static inline vec_t vec_mul(vec_t a, vec_t b) { return _mm256_mul_ps(a, b); }
+static inline float vec_sum(vec_t v) {
+    __m128 sum = _mm_add_ps(_mm256_castps256_ps128(v), _mm256_extractf128_ps(v, 1));
+    sum = _mm_hadd_ps(sum, sum);
+    sum = _mm_hadd_ps(sum, sum);
+    return _mm_cvtss_f32(sum);
+}
+#elif defined(HAVE_SSE42)
+constexpr int vec_len = 4;
+typedef __m128 vec_t;
+
+static inline vec_t vec_zero() { return _mm_setzero_ps(); }
+static inline vec_t vec_set1(float value) { return _mm_set1_ps(value); }
+static inline vec_t vec_load(const float* ptr) { return _mm_loadu_ps(ptr); }
+static inline void vec_store(float* ptr, vec_t v) { _mm_storeu_ps(ptr, v); }
+static inline vec_t vec_fmadd(vec_t a, vec_t b, vec_t c) { return _mm_add_ps(_mm_mul_ps(a, b), c); }
+static inline vec_t vec_min(vec_t a, vec_t b) { return _mm_min_ps(a, b); }
+static inline vec_t vec_max(vec_t a, vec_t b) { return _mm_max_ps(a, b); }
+static inline vec_t vec_mul(vec_t a, vec_t b) { return _mm_mul_ps(a, b); }
+static inline float vec_sum(vec_t v) {
+    __m128 sum = _mm_hadd_ps(v, v);
+    sum = _mm_hadd_ps(sum, sum);
+    return _mm_cvtss_f32(sum);
+}
+#else
+// Portable emulation of a short vector, independent lanes let the compiler overlap the operations
+constexpr int vec_len = 4;
+struct vec_t {
+    float v[vec_len];
+};
+
+static inline vec_t vec_set1(float value) { return vec_t{{value, value, value, value}}; }
+static inline vec_t vec_zero() { return vec_set1(0.0f); }
+static inline vec_t vec_load(const float* ptr) { return vec_t{{ptr[0], ptr[1], ptr[2], ptr[3]}}; }
+static inline void vec_store(float* ptr, vec_t a) {
+    for (int i = 0; i < vec_len; i++)
+        ptr[i] = a.v[i];
+}
+static inline vec_t vec_fmadd(vec_t a, vec_t b, vec_t c) {
+    for (int i = 0; i < vec_len; i++)
+        c.v[i] += a.v[i] * b.v[i];
+    return c;
+}
+static inline vec_t vec_min(vec_t a, vec_t b) {
+    for (int i = 0; i < vec_len; i++)
+        a.v[i] = a.v[i] < b.v[i] ? a.v[i] : b.v[i];
+    return a;
+}
+static inline vec_t vec_max(vec_t a, vec_t b) {
+    for (int i = 0; i < vec_len; i++)
+        a.v[i] = a.v[i] > b.v[i] ? a.v[i] : b.v[i];
+    return a;
+}
+static inline vec_t vec_mul(vec_t a, vec_t b) {
+    for (int i = 0; i < vec_len; i++)
+        a.v[i] *= b.v[i];
+    return a;
+}
+static inline float vec_sum(vec_t a) { return (a.v[0] + a.v[1]) + (a.v[2] + a.v[3]); }
+#endif
+
+}  // namespace XARCH
+}  // namespace runtime
+}  // namespace GNAPluginNS
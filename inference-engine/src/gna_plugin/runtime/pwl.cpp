@@ -26,6 +26,7 @@
 #endif
 
 #include "pwl.h"
+#include "pwl_kernels.hpp"
 #include "gna_plugin_log.hpp"
 #include "backend/dnn_types.h"
 #include "gna_slope_scale.h"
@@ -951,11 +952,47 @@ void PwlApply32(intel_dnn_component_t *component, uint32_t num_subset_size) {
     }
 }
 
+// Evaluates piecewise linear activations with vector instructions, returns false for other activations
+static bool PwlApplyLinear32(intel_dnn_component_t *component,
+                             uint32_t num_row_start,
+                             uint32_t num_row_end,
+                             uint32_t num_col_start,
+                             uint32_t num_col_end) {
+    const auto &func_id = component->op.pwl.func_id;
+    float low = 0.0f, high = 0.0f;
+    if (func_id.type == kActRelu) {
+        low = func_id.args.lrelu.negative_slope;
+    } else if (func_id.type == kActKaldiLstmClipping) {
+        low = func_id.args.clamp.low;
+        high = func_id.args.clamp.high;
+    }
+    float *ptr_in = reinterpret_cast<float *>(component->ptr_inputs);
+    float *ptr_out = reinterpret_cast<float *>(component->ptr_outputs);
+    uint32_t num_columns = component->num_columns_in;
+    if (num_col_start == 0 && num_col_end + 1 == num_columns) {
+        // whole rows are contiguous in memory
+        size_t offset = static_cast<size_t>(num_row_start) * num_columns;
+        size_t size = static_cast<size_t>(num_row_end - num_row_start + 1) * num_columns;
+        return GNAPluginNS::runtime::XARCH::pwl_apply_linear(func_id.type, ptr_in + offset, ptr_out + offset, size, low, high);
+    }
+    for (uint32_t i = num_row_start; i <= num_row_end; i++) {
+        size_t offset = static_cast<size_t>(i) * num_columns + num_col_start;
+        if (!GNAPluginNS::runtime::XARCH::pwl_apply_linear(func_id.type, ptr_in + offset, ptr_out + offset,
+                                                           num_col_end - num_col_start + 1, low, high)) {
+            return false;
+        }
+    }
+    return true;
+}
+
 void PwlApply32(intel_dnn_component_t *component,
                 uint32_t num_row_start,
                 uint32_t num_row_end,
                 uint32_t num_col_start,
                 uint32_t num_col_end) {
+    if (PwlApplyLinear32(component, num_row_start, num_row_end, num_col_start, num_col_end)) {
+        return;
+    }
     intel_piecewiselinear_t *transform = reinterpret_cast<intel_piecewiselinear_t *>(&component->op.pwl);
     float *ptr_in = reinterpret_cast<float *>(component->ptr_inputs);
     float *ptr_out = reinterpret_cast<float *>(component->ptr_outputs);
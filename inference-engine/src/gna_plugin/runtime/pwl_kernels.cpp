@@ -0,0 +1,67 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+// pwl_kernels.cpp : vectorized evaluation of piecewise linear activations for the float runtime
+//
+
+#include "pwl_kernels.hpp"
+
+#include <cmath>
+#include <cstring>
+
+#include "floatmath_simd.hpp"
+
+namespace GNAPluginNS {
+namespace runtime {
+namespace XARCH {
+
+namespace {
+
+template <typename VecOp, typename ScalarOp>
+void apply(const float* in, float* out, size_t size, VecOp vec_op, ScalarOp scalar_op) {
+    size_t i = 0;
+    for (; i + vec_len <= size; i += vec_len)
+        vec_store(out + i, vec_op(vec_load(in + i)));
+    for (; i < size; i++)
+        out[i] = scalar_op(in[i]);
+}
+
+}  // namespace
+
+bool pwl_apply_linear(DnnActivationType type, const float* in, float* out, size_t size, float low, float high) {
+    switch (type) {
+        case kActRelu: {
+            const vec_t zero = vec_zero();
+            const vec_t slope = vec_set1(low);
+            apply(in, out, size,
+                  [&](vec_t x) { return vec_fmadd(vec_min(x, zero), slope, vec_max(x, zero)); },
+                  [&](float x) { return x < 0.0f ? x * low : x; });
+            return true;
+        }
+        case kActIdentity:
+            if (in != out)
+                std::memmove(out, in, size * sizeof(float));
+            return true;
+        case kActKaldiLstmClipping: {
+            const vec_t lower = vec_set1(low);
+            const vec_t upper = vec_set1(high);
+            apply(in, out, size,
+                  [&](vec_t x) { return vec_min(vec_max(x, lower), upper); },
+                  [&](float x) { return x > high ? high : (x < low ? low : x); });
+            return true;
+        }
+        case kActAbs: {
+            const vec_t minus_one = vec_set1(-1.0f);
+            apply(in, out, size,
+                  [&](vec_t x) { return vec_max(x, vec_mul(x, minus_one)); },
+                  [](float x) { return std::fabs(x); });
+            return true;
+        }
+        default:
+            return false;
+    }
+}
+
+}  // namespace XARCH
+}  // namespace runtime
+}  // namespace GNAPluginNS
@@ -0,0 +1,25 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <cstddef>
+
+#include "backend/dnn_types.h"
+
+namespace GNAPluginNS {
+namespace runtime {
+namespace XARCH {
+
+/**
+ * @brief Applies a piecewise linear activation to a contiguous block of values
+ * @param low negative slope of ReLU or lower limit of clipping
+ * @param high upper limit of clipping
+ * @return false if the activation is not supported and has to be computed by the caller
+ */
+bool pwl_apply_linear(DnnActivationType type, const float* in, float* out, size_t size, float low, float high);
+
+}  // namespace XARCH
+}  // namespace runtime
+}  // namespace GNAPluginNS
@@ -0,0 +1,135 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "arm_neon/precision_utils_neon.hpp"
+
+#include <arm_neon.h>
+
+namespace InferenceEngine {
+namespace PrecisionUtils {
+
+namespace {
+
+constexpr size_t lanes = 4;
+
+inline uint32x4_t set1(uint32_t v) {
+    return vdupq_n_u32(v);
+}
+
+inline float32x4_t set1_bits(uint32_t v) {
+    return vreinterpretq_f32_u32(vdupq_n_u32(v));
+}
+
+// Hardware conversion needs FP16 extension which isn't there on all ARMv7 targets, so conversions are done
+// with integer arithmetic following the scalar f16tof32: normals are rebiased, INF/NAN keep max exponent
+// with NAN made quiet, denormals are exact as mantissa * 2^-24
+inline float32x4_t cvt_f16_f32(uint16x4_t h) {
+    const uint32x4_t u = vmovl_u16(h);
+    const uint32x4_t sign = vshlq_n_u32(vandq_u32(u, set1(0x8000)), 16);
+    const uint32x4_t exp = vandq_u32(u, set1(0x7C00));
+    const uint32x4_t mant = vandq_u32(u, set1(0x03FF));
+
+    const uint32x4_t normal = vaddq_u32(vshlq_n_u32(vandq_u32(u, set1(0x7FFF)), 13), set1((127 - 15) << 23));
+    const uint32x4_t quiet = vbicq_u32(set1(0x00400000), vceqq_u32(mant, set1(0)));
+    const uint32x4_t special = vorrq_u32(vorrq_u32(vshlq_n_u32(mant, 13), set1(0x7F800000)), quiet);
+    const uint32x4_t denorm = vreinterpretq_u32_f32(vmulq_f32(vcvtq_f32_u32(mant), set1_bits((127 - 24) << 23)));
+
+    uint32x4_t r = vbslq_u32(vceqq_u32(exp, set1(0x7C00)), special, normal);
+    r = vbslq_u32(vceqq_u32(exp, set1(0)), denorm, r);
+    return vreinterpretq_f32_u32(vorrq_u32(r, sign));
+}
+
+// Follows the scalar f32tof16: rounding by adding half of f16 ULP, denormals are flushed,
+// overflow saturates to the maximal f16 value
+inline uint16x4_t cvt_f32_f16(float32x4_t x) {
+    const uint32x4_t u = vreinterpretq_u32_f32(x);
+    const uint32x4_t sign = vandq_u32(vshrq_n_u32(u, 16), set1(0x8000));
+    const uint32x4_t abs = vandq_u32(u, set1(0x7FFFFFFF));
+    const uint32x4_t exp = vandq_u32(abs, set1(0x7F800000));
+
+    // NAN and INF, only lower 16 bits of the result are stored
+    const uint32x4_t is_inf = vceqq_u32(vandq_u32(abs, set1(0x007FFFFF)), set1(0));
+    const uint32x4_t special = vbslq_u32(is_inf, set1(0x7C00), vorrq_u32(vshrq_n_u32(abs, 23 - 10), set1(0x0200)));
+
+    const float32x4_t half_ulp = vmulq_f32(vreinterpretq_f32_u32(exp), set1_bits((127 - 11) << 23));
+    const float32x4_t v = vaddq_f32(vreinterpretq_f32_u32(abs), half_ulp);
+    const float32x4_t min16 = set1_bits((127 - 14) << 23);
+
+    uint32x4_t r = vshrq_n_u32(vsubq_u32(vreinterpretq_u32_f32(v), set1((127 - 15) << 23)), 23 - 10);
+    r = vbslq_u32(vcgeq_f32(v, set1_bits(((127 + 15) << 23) | 0x007FE000)), set1(((15 + 15) << 10) | 0x3FF), r);
+    r = vbslq_u32(vcltq_f32(v, min16), set1(1 << 10), r);
+    r = vbslq_u32(vcltq_f32(v, vmulq_n_f32(min16, 0.5f)), set1(0), r);
+    r = vbslq_u32(vceqq_u32(exp, set1(0x7F800000)), special, r);
+
+    return vmovn_u32(vorrq_u32(r, sign));
+}
+
+inline float32x4_t cvt_bf16_f32(uint16x4_t h) {
+    return vreinterpretq_f32_u32(vshlq_n_u32(vmovl_u16(h), 16));
+}
+
+// Rounding to nearest even, NAN is made quiet
+inline uint16x4_t cvt_f32_bf16(float32x4_t x) {
+    const uint32x4_t u = vreinterpretq_u32_f32(x);
+    const uint32x4_t lsb = vandq_u32(vshrq_n_u32(u, 16), set1(1));
+    const uint32x4_t rounded = vaddq_u32(u, vaddq_u32(lsb, set1(0x7FFF)));
+    const uint32x4_t nan = vorrq_u32(u, set1(0x00400000));
+
+    return vshrn_n_u32(vbslq_u32(vceqq_f32(x, x), rounded, nan), 16);
+}
+
+inline float32x4_t load_f32(const float* src, float scale, float bias) {
+    return vmlaq_n_f32(vdupq_n_f32(bias), vld1q_f32(src), scale);
+}
+
+inline void store_f32(float* dst, float32x4_t v, float scale, float bias) {
+    vst1q_f32(dst, vmlaq_n_f32(vdupq_n_f32(bias), v, scale));
+}
+
+template <typename T>
+inline uint16x4_t load_16(const T* src) {
+    return vld1_u16(reinterpret_cast<const uint16_t*>(src));
+}
+
+template <typename T>
+inline void store_16(T* dst, uint16x4_t v) {
+    vst1_u16(reinterpret_cast<uint16_t*>(dst), v);
+}
+
+}  // namespace
+
+size_t f16tof32Arrays_neon(float* dst, const ie_fp16* src, size_t nelem, float scale, float bias) {
+    size_t i = 0;
+    for (; i + lanes <= nelem; i += lanes) {
+        store_f32(dst + i, cvt_f16_f32(load_16(src + i)), scale, bias);
+    }
+    return i;
+}
+
+size_t f32tof16Arrays_neon(ie_fp16* dst, const float* src, size_t nelem, float scale, float bias) {
+    size_t i = 0;
+    for (; i + lanes <= nelem; i += lanes) {
+        store_16(dst + i, cvt_f32_f16(load_f32(src + i, scale, bias)));
+    }
+    return i;
+}
+
+size_t bf16tof32Arrays_neon(float* dst, const ie_bf16* src, size_t nelem, float scale, float bias) {
+    size_t i = 0;
+    for (; i + lanes <= nelem; i += lanes) {
+        store_f32(dst + i, cvt_bf16_f32(load_16(src + i)), scale, bias);
+    }
+    return i;
+}
+
+size_t f32tobf16Arrays_neon(ie_bf16* dst, const float* src, size_t nelem, float scale, float bias) {
+    size_t i = 0;
+    for (; i + lanes <= nelem; i += lanes) {
+        store_16(dst + i, cvt_f32_bf16(load_f32(src + i, scale, bias)));
+    }
+    return i;
+}
+
+}  // namespace PrecisionUtils
+}  // namespace InferenceEngine
@@ -0,0 +1,36 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include "precision_utils.h"
+
+#include <stdint.h>
+#include <stdlib.h>
+
+namespace InferenceEngine {
+namespace PrecisionUtils {
+
+//------------------------------------------------------------------------
+//
+// FP16/BF16 <-> FP32 array conversions manually vectored for NEON (w/o threads)
+//
+// Results are bit-exact to the scalar f16tof32/f32tof16/bf16tof32/f32tobf16
+// functions except of denormal FP32 values which are flushed by ARMv7 NEON,
+// `scale` and `bias` are applied with multiply-add. Functions
+// process some leading part of arrays and return number of processed elements,
+// the rest of arrays is up to a caller.
+//
+//------------------------------------------------------------------------
+
+size_t f16tof32Arrays_neon(float* dst, const ie_fp16* src, size_t nelem, float scale, float bias);
+
+size_t f32tof16Arrays_neon(ie_fp16* dst, const float* src, size_t nelem, float scale, float bias);
+
+size_t bf16tof32Arrays_neon(float* dst, const ie_bf16* src, size_t nelem, float scale, float bias);
+
+size_t f32tobf16Arrays_neon(ie_bf16* dst, const float* src, size_t nelem, float scale, float bias);
+
+}  // namespace PrecisionUtils
+}  // namespace InferenceEngine
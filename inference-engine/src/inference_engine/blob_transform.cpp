@@ -4,11 +4,19 @@
 
 #include "blob_transform.hpp"
 
+#include "ie_parallel.hpp"
 #include "ie_system_conf.h"
 #ifdef HAVE_SSE
 #include "cpu_x86_sse42/blob_transform_sse42.hpp"
 #endif
+#ifdef HAVE_AVX2
+#include "cpu_x86_avx2/blob_transform_avx2.hpp"
+#endif
+#ifdef HAVE_AVX512
+#include "cpu_x86_avx512/blob_transform_avx512.hpp"
+#endif
 
+#include <algorithm>
 #include <cstdint>
 #include <cstdlib>
 
@@ -16,271 +24,176 @@
 
 namespace InferenceEngine {
 
-template <InferenceEngine::Precision::ePrecision PRC>
-static void blob_copy_4d_t(Blob::Ptr src, Blob::Ptr dst) {
-    using data_t = typename InferenceEngine::PrecisionTrait<PRC>::value_type;
-
-    auto* src_ptr = src->buffer().as<data_t*>();
-    auto* dst_ptr = dst->buffer().as<data_t*>();
-
-    SizeVector dims = src->getTensorDesc().getDims();
-
-    size_t N = dims[0];
-    size_t C = dims[1];
-    size_t H = dims[2];
-    size_t W = dims[3];
-
-    const Layout src_l = src->getTensorDesc().getLayout();
-    const auto& src_blk_dsc = src->getTensorDesc().getBlockingDesc();
-    const auto& src_strides = src_blk_dsc.getStrides();
-    const auto N_src_stride = src_strides[0];
-    const auto C_src_stride = src_l == NHWC ? src_strides[3] : src_strides[1];
-    const auto H_src_stride = src_l == NHWC ? src_strides[1] : src_strides[2];
-    const auto W_src_stride = src_l == NHWC ? src_strides[2] : src_strides[3];
-    src_ptr += src_blk_dsc.getOffsetPadding();
+namespace {
 
-    const Layout dst_l = dst->getTensorDesc().getLayout();
-    const auto& dst_blk_desc = dst->getTensorDesc().getBlockingDesc();
-    const auto& dst_strides = dst_blk_desc.getStrides();
-    const auto N_dst_stride = dst_strides[0];
-    const auto C_dst_stride = dst_l == NHWC ? dst_strides[3] : dst_strides[1];
-    const auto H_dst_stride = dst_l == NHWC ? dst_strides[1] : dst_strides[2];
-    const auto W_dst_stride = dst_l == NHWC ? dst_strides[2] : dst_strides[3];
+// Vectorized row primitives are chosen once per blob_copy call
+struct RowKernels {
+    bool sse42 = false;
+    bool avx2 = false;
+    bool avx512 = false;
 
-    src_ptr += dst_blk_desc.getOffsetPadding();
+    RowKernels() {
+#ifdef HAVE_SSE
+        sse42 = with_cpu_x86_sse42();
+#endif
+#ifdef HAVE_AVX2
+        avx2 = with_cpu_x86_avx2();
+#endif
+#ifdef HAVE_AVX512
+        avx512 = with_cpu_x86_avx512f();
+#endif
+    }
 
+    // Interleaved row of W pixels to C planes, returns number of processed pixels
+    size_t split(const void* src, void* dst, size_t elem_size, size_t C, size_t W, size_t C_dst_stride) const {
 #ifdef HAVE_SSE
-    if (src->getTensorDesc().getLayout() == NHWC && dst->getTensorDesc().getLayout() == NCHW && C == 3 &&
-        C_src_stride == 1 && W_src_stride == 3 && W_dst_stride == 1 && with_cpu_x86_sse42()) {
-        if (PRC == Precision::U8) {
-            blob_copy_4d_split_u8c3(reinterpret_cast<const uint8_t*>(src_ptr), reinterpret_cast<uint8_t*>(dst_ptr),
-                                    N_src_stride, H_src_stride, N_dst_stride, H_dst_stride, C_dst_stride,
-                                    static_cast<int>(N), static_cast<int>(H), static_cast<int>(W));
-            return;
+        if (sse42 && C == 3 && elem_size == 1) {
+            blob_copy_4d_split_u8c3(reinterpret_cast<const uint8_t*>(src), reinterpret_cast<uint8_t*>(dst),
+                                    0, 0, 0, 0, C_dst_stride, 1, 1, static_cast<int>(W));
+            return W;
         }
-
-        if (PRC == Precision::FP32) {
-            blob_copy_4d_split_f32c3(reinterpret_cast<const float*>(src_ptr), reinterpret_cast<float*>(dst_ptr),
-                                     N_src_stride, H_src_stride, N_dst_stride, H_dst_stride, C_dst_stride,
-                                     static_cast<int>(N), static_cast<int>(H), static_cast<int>(W));
-            return;
+        if (sse42 && C == 3 && elem_size == 4) {
+            blob_copy_4d_split_f32c3(reinterpret_cast<const float*>(src), reinterpret_cast<float*>(dst),
+                                     0, 0, 0, 0, C_dst_stride, 1, 1, static_cast<int>(W));
+            return W;
         }
+#endif
+#ifdef HAVE_AVX512
+        if (avx512) return blob_copy_row_split_avx512(src, dst, elem_size, C, W, C_dst_stride);
+#endif
+#ifdef HAVE_AVX2
+        if (avx2) return blob_copy_row_split_avx2(src, dst, elem_size, C, W, C_dst_stride);
+#endif
+        return 0;
     }
 
-    if (src->getTensorDesc().getLayout() == NCHW && dst->getTensorDesc().getLayout() == NHWC && C == 3 &&
-        C_dst_stride == 1 && W_dst_stride == 3 && W_src_stride == 1 && with_cpu_x86_sse42()) {
-        if (PRC == Precision::U8) {
-            blob_copy_4d_merge_u8c3(reinterpret_cast<const uint8_t*>(src_ptr), reinterpret_cast<uint8_t*>(dst_ptr),
-                                    N_src_stride, H_src_stride, C_src_stride, N_dst_stride, H_dst_stride,
-                                    static_cast<int>(N), static_cast<int>(H), static_cast<int>(W));
-            return;
+    // C planes to interleaved row of W pixels, returns number of processed pixels
+    size_t merge(const void* src, void* dst, size_t elem_size, size_t C, size_t W, size_t C_src_stride) const {
+#ifdef HAVE_SSE
+        if (sse42 && C == 3 && elem_size == 1) {
+            blob_copy_4d_merge_u8c3(reinterpret_cast<const uint8_t*>(src), reinterpret_cast<uint8_t*>(dst),
+                                    0, 0, C_src_stride, 0, 0, 1, 1, static_cast<int>(W));
+            return W;
         }
-
-        if (PRC == Precision::FP32) {
-            blob_copy_4d_merge_f32c3(reinterpret_cast<const float*>(src_ptr), reinterpret_cast<float*>(dst_ptr),
-                                     N_src_stride, H_src_stride, C_src_stride, N_dst_stride, H_dst_stride,
-                                     static_cast<int>(N), static_cast<int>(H), static_cast<int>(W));
-            return;
+        if (sse42 && C == 3 && elem_size == 4) {
+            blob_copy_4d_merge_f32c3(reinterpret_cast<const float*>(src), reinterpret_cast<float*>(dst),
+                                     0, 0, C_src_stride, 0, 0, 1, 1, static_cast<int>(W));
+            return W;
         }
+#endif
+#ifdef HAVE_AVX512
+        if (avx512) return blob_copy_row_merge_avx512(src, dst, elem_size, C, W, C_src_stride);
+#endif
+#ifdef HAVE_AVX2
+        if (avx2) return blob_copy_row_merge_avx2(src, dst, elem_size, C, W, C_src_stride);
+#endif
+        return 0;
     }
-#else
-    (void)H_dst_stride;
-#endif  // HAVE_SSE
-
-    if (src->getTensorDesc().getLayout() == NHWC && dst->getTensorDesc().getLayout() == NCHW) {
-        for (size_t n = 0; n < N; n++) {
-            for (size_t c = 0; c < C; c++) {
-                data_t* dst_ptr_l = dst_ptr + n * N_dst_stride + c * C_dst_stride;
-                data_t* src_ptr_l = src_ptr + n * N_src_stride + c * C_src_stride;
-                for (size_t h = 0; h < H; h++) {
-                    data_t* src_ptr_l_l = src_ptr_l + h * H_src_stride;
-                    for (size_t w = 0; w < W; w++) {
-                        *dst_ptr_l = *src_ptr_l_l;
-                        src_ptr_l_l += W_src_stride;
-                        dst_ptr_l++;
-                    }
-                }
-            }
-        }
-    } else if (src->getTensorDesc().getLayout() == NCHW && dst->getTensorDesc().getLayout() == NHWC) {
-        for (size_t n = 0; n < N; n++) {
-            for (size_t c = 0; c < C; c++) {
-                data_t* src_ptr_l = src_ptr + n * N_src_stride + c * C_src_stride;
-                data_t* dst_ptr_l = dst_ptr + n * N_dst_stride + c;
-                for (size_t h = 0; h < H; h++) {
-                    data_t* src_ptr_l_l = src_ptr_l + h * H_src_stride;
-                    for (size_t w = 0; w < W; w++) {
-                        *dst_ptr_l = *src_ptr_l_l;
-                        dst_ptr_l += W_dst_stride;
-                        src_ptr_l_l++;
-                    }
-                }
-            }
-        }
-    } else {
-        for (size_t i = 0; i < N * C * H * W; i++) {
-            dst_ptr[i] = src_ptr[i];
-        }
+};
+
+// Strides of a 4d or 5d blob in elements, D_stride is 0 for 4d blobs
+struct BlobStrides {
+    size_t N, C, D, H, W;
+};
+
+BlobStrides get_strides(const TensorDesc& desc) {
+    const auto& strides = desc.getBlockingDesc().getStrides();
+    const Layout l = desc.getLayout();
+    if (strides.size() == 4) {
+        return l == NHWC ? BlobStrides{strides[0], strides[3], 0, strides[1], strides[2]}
+                         : BlobStrides{strides[0], strides[1], 0, strides[2], strides[3]};
     }
+    return l == NDHWC ? BlobStrides{strides[0], strides[4], strides[1], strides[2], strides[3]}
+                      : BlobStrides{strides[0], strides[1], strides[2], strides[3], strides[4]};
 }
 
-static inline void blob_copy_4d(Blob::Ptr src, Blob::Ptr dst) {
-    switch (src->getTensorDesc().getPrecision()) {
-    case Precision::FP32:
-    case Precision::I32:
-    case Precision::U32:
-        blob_copy_4d_t<Precision::FP32>(src, dst);
-        break;
-
-    case Precision::FP16:
-    case Precision::U16:
-    case Precision::I16:
-        blob_copy_4d_t<Precision::U16>(src, dst);
-        break;
+// Copies a row of W pixels with C channels, interleaved <-> planar conversions are vectorized
+template <typename data_t>
+void blob_copy_row(const RowKernels& kernels, const data_t* src_ptr, data_t* dst_ptr, size_t C, size_t W,
+                   const BlobStrides& src_s, const BlobStrides& dst_s) {
+    if (C == 1 && src_s.W == 1 && dst_s.W == 1) {
+        std::copy(src_ptr, src_ptr + W, dst_ptr);
+        return;
+    }
 
-    case Precision::U8:
-    case Precision::I8:
-        blob_copy_4d_t<Precision::U8>(src, dst);
-        break;
+    size_t w_start = 0;
+    if (src_s.C == 1 && src_s.W == C && dst_s.W == 1) {
+        w_start = kernels.split(src_ptr, dst_ptr, sizeof(data_t), C, W, dst_s.C);
+    } else if (src_s.W == 1 && dst_s.C == 1 && dst_s.W == C) {
+        w_start = kernels.merge(src_ptr, dst_ptr, sizeof(data_t), C, W, src_s.C);
+    }
 
-    default:
-        THROW_IE_EXCEPTION << "Unsupported blob transformation for precision " << src->getTensorDesc().getPrecision();
+    for (size_t c = 0; c < C; c++) {
+        const data_t* src_ptr_c = src_ptr + c * src_s.C;
+        data_t* dst_ptr_c = dst_ptr + c * dst_s.C;
+        for (size_t w = w_start; w < W; w++) {
+            dst_ptr_c[w * dst_s.W] = src_ptr_c[w * src_s.W];
+        }
     }
 }
 
 template <InferenceEngine::Precision::ePrecision PRC>
-static void blob_copy_5d_t(Blob::Ptr src, Blob::Ptr dst) {
+void blob_copy_t(Blob::Ptr src, Blob::Ptr dst) {
     using data_t = typename InferenceEngine::PrecisionTrait<PRC>::value_type;
 
-    const auto& src_blk_desc = src->getTensorDesc().getBlockingDesc();
-    const auto& dst_blk_desc = dst->getTensorDesc().getBlockingDesc();
-
-    data_t* src_ptr = src->buffer().as<data_t*>() + src_blk_desc.getOffsetPadding();
-    data_t* dst_ptr = dst->buffer().as<data_t*>() + dst_blk_desc.getOffsetPadding();
+    const auto& src_desc = src->getTensorDesc();
+    const auto& dst_desc = dst->getTensorDesc();
 
-    SizeVector dims = src->getTensorDesc().getDims();  // == dst's dims
+    const data_t* src_ptr = src->cbuffer().as<const data_t*>() + src_desc.getBlockingDesc().getOffsetPadding();
+    data_t* dst_ptr = dst->buffer().as<data_t*>() + dst_desc.getBlockingDesc().getOffsetPadding();
 
+    const SizeVector& dims = src_desc.getDims();  // == dst's dims
+    const bool is_5d = dims.size() == 5;
     const size_t N = dims[0];
     const size_t C = dims[1];
-    const size_t D = dims[2];
-    const size_t H = dims[3];
-    const size_t W = dims[4];
-
-    const Layout src_l = src->getTensorDesc().getLayout();
-    const auto& src_strides = src_blk_desc.getStrides();
-    const auto N_src_stride = src_strides[0];
-    const auto C_src_stride = src_l == NDHWC ? src_strides[4] : src_strides[1];
-    const auto D_src_stride = src_l == NDHWC ? src_strides[1] : src_strides[2];
-    const auto H_src_stride = src_l == NDHWC ? src_strides[2] : src_strides[3];
-    const auto W_src_stride = src_l == NDHWC ? src_strides[3] : src_strides[4];
-
-    const Layout dst_l = dst->getTensorDesc().getLayout();
-    const auto& dst_strides = dst_blk_desc.getStrides();
-    const auto N_dst_stride = dst_strides[0];
-    const auto C_dst_stride = dst_l == NDHWC ? dst_strides[4] : dst_strides[1];
-    const auto D_dst_stride = dst_l == NDHWC ? dst_strides[1] : dst_strides[2];
-    const auto H_dst_stride = dst_l == NDHWC ? dst_strides[2] : dst_strides[3];
-    const auto W_dst_stride = dst_l == NDHWC ? dst_strides[3] : dst_strides[4];
-
-#ifdef HAVE_SSE
-    if (src->getTensorDesc().getLayout() == NDHWC && dst->getTensorDesc().getLayout() == NCDHW && C == 3 &&
-        C_src_stride == 1 && W_src_stride == 3 && W_dst_stride == 1 && with_cpu_x86_sse42()) {
-        if (PRC == Precision::U8) {
-            blob_copy_5d_split_u8c3(reinterpret_cast<const uint8_t*>(src_ptr), reinterpret_cast<uint8_t*>(dst_ptr),
-                                    N_src_stride, D_src_stride, H_src_stride, N_dst_stride, D_dst_stride, H_dst_stride,
-                                    C_dst_stride, static_cast<int>(N), static_cast<int>(D), static_cast<int>(H),
-                                    static_cast<int>(W));
-            return;
-        }
-
-        if (PRC == Precision::FP32) {
-            blob_copy_5d_split_f32c3(reinterpret_cast<const float*>(src_ptr), reinterpret_cast<float*>(dst_ptr),
-                                     N_src_stride, D_src_stride, H_src_stride, N_dst_stride, D_dst_stride, H_dst_stride,
-                                     C_dst_stride, static_cast<int>(N), static_cast<int>(D), static_cast<int>(H),
-                                     static_cast<int>(W));
-            return;
-        }
+    const size_t D = is_5d ? dims[2] : 1;
+    const size_t H = dims[dims.size() - 2];
+    const size_t W = dims[dims.size() - 1];
+
+    const Layout src_l = src_desc.getLayout();
+    const Layout dst_l = dst_desc.getLayout();
+    const bool split = (src_l == NHWC && dst_l == NCHW) || (src_l == NDHWC && dst_l == NCDHW);
+    const bool merge = (src_l == NCHW && dst_l == NHWC) || (src_l == NCDHW && dst_l == NDHWC);
+
+    if (!split && !merge) {
+        const size_t total = N * C * D * H * W;
+        parallel_nt(0, [&](const int ithr, const int nthr) {
+            size_t start = 0, end = 0;
+            splitter(total, nthr, ithr, start, end);
+            std::copy(src_ptr + start, src_ptr + end, dst_ptr + start);
+        });
+        return;
     }
 
-    if (src->getTensorDesc().getLayout() == NCDHW && dst->getTensorDesc().getLayout() == NDHWC && C == 3 &&
-        C_dst_stride == 1 && W_dst_stride == 3 && W_src_stride == 1 && with_cpu_x86_sse42()) {
-        if (PRC == Precision::U8) {
-            blob_copy_5d_merge_u8c3(reinterpret_cast<const uint8_t*>(src_ptr), reinterpret_cast<uint8_t*>(dst_ptr),
-                                    N_src_stride, D_src_stride, H_src_stride, C_src_stride, N_dst_stride, D_dst_stride,
-                                    H_dst_stride, static_cast<int>(N), static_cast<int>(D), static_cast<int>(H),
-                                    static_cast<int>(W));
-            return;
-        }
+    const BlobStrides src_s = get_strides(src_desc);
+    const BlobStrides dst_s = get_strides(dst_desc);
+    const RowKernels kernels;
 
-        if (PRC == Precision::FP32) {
-            blob_copy_5d_merge_f32c3(reinterpret_cast<const float*>(src_ptr), reinterpret_cast<float*>(dst_ptr),
-                                     N_src_stride, D_src_stride, H_src_stride, C_src_stride, N_dst_stride, D_dst_stride,
-                                     H_dst_stride, static_cast<int>(N), static_cast<int>(D), static_cast<int>(H),
-                                     static_cast<int>(W));
-            return;
-        }
-    }
-#else
-    (void)H_dst_stride;
-#endif  // HAVE_SSE
-    if (src->getTensorDesc().getLayout() == NDHWC && dst->getTensorDesc().getLayout() == NCDHW) {
-        for (size_t n = 0; n < N; n++) {
-            for (size_t c = 0; c < C; c++) {
-                for (size_t d = 0; d < D; d++) {
-                    data_t* dst_ptr_l = dst_ptr + n * N_dst_stride + c * C_dst_stride + d * D_dst_stride;
-                    data_t* src_ptr_l = src_ptr + n * N_src_stride + c * C_src_stride + d * D_src_stride;
-                    for (size_t h = 0; h < H; h++) {
-                        data_t* src_ptr_l_l = src_ptr_l + h * H_src_stride;
-                        for (size_t w = 0; w < W; w++) {
-                            *dst_ptr_l = *src_ptr_l_l;
-                            src_ptr_l_l += W_src_stride;
-                            dst_ptr_l++;
-                        }
-                    }
-                }
-            }
-        }
-    } else if (src->getTensorDesc().getLayout() == NCDHW && dst->getTensorDesc().getLayout() == NDHWC) {
-        for (size_t n = 0; n < N; n++) {
-            for (size_t c = 0; c < C; c++) {
-                for (size_t d = 0; d < D; d++) {
-                    data_t* src_ptr_l = src_ptr + n * N_src_stride + c * C_src_stride + d * D_src_stride;
-                    data_t* dst_ptr_l = dst_ptr + n * N_dst_stride + c + d * D_dst_stride;
-                    for (size_t h = 0; h < H; h++) {
-                        data_t* src_ptr_l_l = src_ptr_l + h * H_src_stride;
-                        for (size_t w = 0; w < W; w++) {
-                            *dst_ptr_l = *src_ptr_l_l;
-                            dst_ptr_l += W_dst_stride;
-                            src_ptr_l_l++;
-                        }
-                    }
-                }
-            }
-        }
-    } else {
-        for (size_t i = 0; i < N * C * D * H * W; i++) {
-            dst_ptr[i] = src_ptr[i];
-        }
-    }
+    parallel_for3d(N, D, H, [&](size_t n, size_t d, size_t h) {
+        blob_copy_row(kernels,
+                      src_ptr + n * src_s.N + d * src_s.D + h * src_s.H,
+                      dst_ptr + n * dst_s.N + d * dst_s.D + h * dst_s.H,
+                      C, W, src_s, dst_s);
+    });
 }
 
-static inline void blob_copy_5d(Blob::Ptr src, Blob::Ptr dst) {
+void blob_copy_impl(Blob::Ptr src, Blob::Ptr dst) {
     switch (src->getTensorDesc().getPrecision()) {
     case Precision::FP32:
     case Precision::I32:
     case Precision::U32:
-        blob_copy_5d_t<Precision::FP32>(src, dst);
+        blob_copy_t<Precision::FP32>(src, dst);
         break;
 
     case Precision::FP16:
     case Precision::U16:
     case Precision::I16:
-        blob_copy_5d_t<Precision::U16>(src, dst);
+        blob_copy_t<Precision::U16>(src, dst);
         break;
 
     case Precision::U8:
     case Precision::I8:
-        blob_copy_5d_t<Precision::U8>(src, dst);
+        blob_copy_t<Precision::U8>(src, dst);
         break;
 
     default:
@@ -288,6 +201,8 @@ static inline void blob_copy_5d(Blob::Ptr src, Blob::Ptr dst) {
     }
 }
 
+}  // namespace
+
 void blob_copy(Blob::Ptr src, Blob::Ptr dst) {
     if (src->buffer() == nullptr) THROW_IE_EXCEPTION << "Cannot copy blob data. Source is not allocated.";
 
@@ -300,12 +215,10 @@ void blob_copy(Blob::Ptr src, Blob::Ptr dst) {
     if (src->getTensorDesc().getDims() != dst->getTensorDesc().getDims())
         THROW_IE_EXCEPTION << "Unimplemented blob transformation from different shapes ";
 
-    if (src->getTensorDesc().getDims().size() == 4)
-        blob_copy_4d(src, dst);
-    else if (src->getTensorDesc().getDims().size() == 5)
-        blob_copy_5d(src, dst);
-    else
+    if (src->getTensorDesc().getDims().size() != 4 && src->getTensorDesc().getDims().size() != 5)
         THROW_IE_EXCEPTION << "Unimplemented blob transformation. Only 4d or 5d supported.";
+
+    blob_copy_impl(src, dst);
 }
 
 }  // namespace InferenceEngine
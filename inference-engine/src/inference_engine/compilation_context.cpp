@@ -12,13 +12,15 @@
 #include <xml_parse_utils.h>
 
 #include "ie_itt.hpp"
+#include "ie_hash.hpp"
 #include "cpp_interfaces/exception2status.hpp"
-#include "transformations/serialize.hpp"
 #include "cpp/ie_cnn_network.h"
 #include "details/ie_exception.hpp"
 
 #include "ngraph/variant.hpp"
 #include "ngraph/opsets/opset6.hpp"
+#include "ngraph/op/loop.hpp"
+#include "ngraph/runtime/aligned_buffer.hpp"
 #include "transformations/rt_info/dequantization_attribute.hpp"
 #include "transformations/rt_info/fused_names_attribute.hpp"
 #include "transformations/rt_info/primitives_priority_attribute.hpp"
@@ -41,27 +43,192 @@ static int32_t as_int32_t(T v) {
     return static_cast<int32_t>(v);
 }
 
-class OstreamHashWrapper final: public std::streambuf {
-    std::size_t    m_res = {};
-public:
-    std::size_t getResult() const { return m_res; }
-    std::streamsize xsputn(const char* s, std::streamsize n) override {
-        const std::int64_t* intS = (const std::int64_t *)s;
-        std::streamsize n64 = n / sizeof(std::int64_t);
-        std::streamsize i = 0;
-        // Using 64-bit values executes much faster than char
-        while (i++ < n64) {
-            m_res += *(intS++);
+static void hashFunction(DataHasher& hasher, const ngraph::Function& function);
+
+// Feeds node attributes directly to the hasher, so IR XML is not materialized
+class HashAttributeVisitor final : public ngraph::AttributeVisitor {
+    DataHasher& m_hasher;
+
+    template <typename T>
+    void hashValue(const std::string& name, const T& value) {
+        m_hasher.update(name);
+        m_hasher.update(value);
+    }
+
+    template <typename T>
+    void hashVector(const std::string& name, const std::vector<T>& values) {
+        m_hasher.update(name);
+        m_hasher.update(static_cast<uint64_t>(values.size()));
+        for (const auto& value : values) {
+            m_hasher.update(value);
         }
+    }
 
-        std::streamsize rest = n % sizeof(std::int64_t);
-        for (i = 0; i < rest; i++) {
-            m_res += s[n - rest + i];
+public:
+    explicit HashAttributeVisitor(DataHasher& hasher) : m_hasher(hasher) {}
+
+    void on_adapter(const std::string& name, ngraph::ValueAccessor<void>& adapter) override {
+        m_hasher.update(name);
+        if (const auto& a = ngraph::as_type<ngraph::AttributeAdapter<std::vector<std::shared_ptr
+                <ngraph::op::util::SubGraphOp::InputDescription>>>>(&adapter)) {
+            for (const auto& input : a->get()) {
+                m_hasher.update(std::string(input->get_type_info().name));
+                m_hasher.update(input->m_input_index).update(input->m_body_parameter_index);
+                if (auto slice = ngraph::as_type_ptr<ngraph::op::util::SubGraphOp::SliceInputDescription>(input)) {
+                    m_hasher.update(slice->m_axis).update(slice->m_start).update(slice->m_end)
+                            .update(slice->m_stride).update(slice->m_part_size);
+                } else if (auto merged = ngraph::as_type_ptr<ngraph::op::util::SubGraphOp::MergedInputDescription>(input)) {
+                    m_hasher.update(merged->m_body_value_index);
+                }
+            }
+        } else if (const auto& a = ngraph::as_type<ngraph::AttributeAdapter<std::vector<std::shared_ptr
+                <ngraph::op::util::SubGraphOp::OutputDescription>>>>(&adapter)) {
+            for (const auto& output : a->get()) {
+                m_hasher.update(std::string(output->get_type_info().name));
+                m_hasher.update(output->m_output_index).update(output->m_body_value_index);
+                if (auto concat = ngraph::as_type_ptr<ngraph::op::util::SubGraphOp::ConcatOutputDescription>(output)) {
+                    m_hasher.update(concat->m_axis).update(concat->m_start).update(concat->m_end)
+                            .update(concat->m_stride).update(concat->m_part_size);
+                } else if (auto body = ngraph::as_type_ptr<ngraph::op::util::SubGraphOp::BodyOutputDescription>(output)) {
+                    m_hasher.update(body->m_iteration);
+                }
+            }
+        } else if (const auto& a = ngraph::as_type<ngraph::AttributeAdapter<ngraph::op::v5::Loop::SpecialBodyPorts>>(&adapter)) {
+            m_hasher.update(a->get().current_iteration_input_idx).update(a->get().body_condition_output_idx);
+        } else if (const auto& a = ngraph::as_type<ngraph::AttributeAdapter<std::shared_ptr<ngraph::Variable>>>(&adapter)) {
+            m_hasher.update(a->get()->get_info().variable_id);
+        } else if (const auto& a = ngraph::as_type<ngraph::AttributeAdapter<std::shared_ptr<ngraph::runtime::AlignedBuffer>>>(&adapter)) {
+            m_hasher.update(static_cast<uint64_t>(a->get()->size()));
+            m_hasher.update(a->get()->get_ptr(), a->get()->size());
         }
-        return n;
+    }
+
+    void on_adapter(const std::string& name, ngraph::ValueAccessor<std::string>& adapter) override {
+        hashValue(name, adapter.get());
+    }
+    void on_adapter(const std::string& name, ngraph::ValueAccessor<bool>& adapter) override {
+        hashValue(name, adapter.get());
+    }
+    void on_adapter(const std::string& name, ngraph::ValueAccessor<int8_t>& adapter) override {
+        hashValue(name, adapter.get());
+    }
+    void on_adapter(const std::string& name, ngraph::ValueAccessor<int16_t>& adapter) override {
+        hashValue(name, adapter.get());
+    }
+    void on_adapter(const std::string& name, ngraph::ValueAccessor<int32_t>& adapter) override {
+        hashValue(name, adapter.get());
+    }
+    void on_adapter(const std::string& name, ngraph::ValueAccessor<int64_t>& adapter) override {
+        hashValue(name, adapter.get());
+    }
+    void on_adapter(const std::string& name, ngraph::ValueAccessor<uint8_t>& adapter) override {
+        hashValue(name, adapter.get());
+    }
+    void on_adapter(const std::string& name, ngraph::ValueAccessor<uint16_t>& adapter) override {
+        hashValue(name, adapter.get());
+    }
+    void on_adapter(const std::string& name, ngraph::ValueAccessor<uint32_t>& adapter) override {
+        hashValue(name, adapter.get());
+    }
+    void on_adapter(const std::string& name, ngraph::ValueAccessor<uint64_t>& adapter) override {
+        hashValue(name, adapter.get());
+    }
+    void on_adapter(const std::string& name, ngraph::ValueAccessor<float>& adapter) override {
+        hashValue(name, adapter.get());
+    }
+    void on_adapter(const std::string& name, ngraph::ValueAccessor<double>& adapter) override {
+        hashValue(name, adapter.get());
+    }
+    void on_adapter(const std::string& name, ngraph::ValueAccessor<std::vector<int8_t>>& adapter) override {
+        hashVector(name, adapter.get());
+    }
+    void on_adapter(const std::string& name, ngraph::ValueAccessor<std::vector<int16_t>>& adapter) override {
+        hashVector(name, adapter.get());
+    }
+    void on_adapter(const std::string& name, ngraph::ValueAccessor<std::vector<int32_t>>& adapter) override {
+        hashVector(name, adapter.get());
+    }
+    void on_adapter(const std::string& name, ngraph::ValueAccessor<std::vector<int64_t>>& adapter) override {
+        hashVector(name, adapter.get());
+    }
+    void on_adapter(const std::string& name, ngraph::ValueAccessor<std::vector<uint8_t>>& adapter) override {
+        hashVector(name, adapter.get());
+    }
+    void on_adapter(const std::string& name, ngraph::ValueAccessor<std::vector<uint16_t>>& adapter) override {
+        hashVector(name, adapter.get());
+    }
+    void on_adapter(const std::string& name, ngraph::ValueAccessor<std::vector<uint32_t>>& adapter) override {
+        hashVector(name, adapter.get());
+    }
+    void on_adapter(const std::string& name, ngraph::ValueAccessor<std::vector<uint64_t>>& adapter) override {
+        hashVector(name, adapter.get());
+    }
+    void on_adapter(const std::string& name, ngraph::ValueAccessor<std::vector<float>>& adapter) override {
+        hashVector(name, adapter.get());
+    }
+    void on_adapter(const std::string& name, ngraph::ValueAccessor<std::vector<double>>& adapter) override {
+        hashVector(name, adapter.get());
+    }
+    void on_adapter(const std::string& name, ngraph::ValueAccessor<std::vector<std::string>>& adapter) override {
+        hashVector(name, adapter.get());
+    }
+    void on_adapter(const std::string& name, ngraph::ValueAccessor<std::shared_ptr<ngraph::Function>>& adapter) override {
+        m_hasher.update(name);
+        hashFunction(m_hasher, *adapter.get());
     }
 };
 
+static void hashPartialShape(DataHasher& hasher, const ngraph::PartialShape& shape) {
+    if (shape.rank().is_dynamic()) {
+        hasher.update(static_cast<int64_t>(-1));
+        return;
+    }
+    hasher.update(static_cast<int64_t>(shape.rank().get_length()));
+    for (const auto& dim : shape) {
+        hasher.update(static_cast<int64_t>(dim.get_min_length()));
+        hasher.update(static_cast<int64_t>(dim.get_max_length()));
+    }
+}
+
+// Covers everything that IR serialization stores: topology, names, types, shapes, attributes and weights
+static void hashFunction(DataHasher& hasher, const ngraph::Function& function) {
+    const auto ops = function.get_ordered_ops();
+    std::unordered_map<const ngraph::Node*, uint64_t> nodeIds;
+    for (const auto& op : ops) {
+        nodeIds.emplace(op.get(), nodeIds.size());
+    }
+
+    hasher.update(function.get_friendly_name());
+    hasher.update(static_cast<uint64_t>(ops.size()));
+    for (const auto& op : ops) {
+        const auto& typeInfo = op->get_type_info();
+        hasher.update(std::string(typeInfo.name)).update(typeInfo.version);
+        hasher.update(op->get_friendly_name());
+
+        hasher.update(static_cast<uint64_t>(op->get_input_size()));
+        for (const auto& input : op->inputs()) {
+            const auto source = input.get_source_output();
+            hasher.update(nodeIds.at(source.get_node())).update(static_cast<uint64_t>(source.get_index()));
+        }
+
+        hasher.update(static_cast<uint64_t>(op->get_output_size()));
+        for (const auto& output : op->outputs()) {
+            hasher.update(output.get_element_type().get_type_name());
+            hashPartialShape(hasher, output.get_partial_shape());
+        }
+
+        HashAttributeVisitor visitor(hasher);
+        op->visit_attributes(visitor);
+    }
+
+    for (const auto& parameter : function.get_parameters()) {
+        hasher.update(nodeIds.at(parameter.get()));
+    }
+    for (const auto& result : function.get_results()) {
+        hasher.update(nodeIds.at(result.get()));
+    }
+}
+
 //////////////////////////////////////////////////
 
 std::string NetworkCompilationContext::calculateFileInfo(const std::string& filePath) {
@@ -87,44 +254,34 @@ std::string NetworkCompilationContext::calculateFileInfo(const std::string& file
 std::string NetworkCompilationContext::computeHash(const CNNNetwork& network,
                                const std::map<std::string, std::string>& compileOptions) {
     OV_ITT_SCOPED_TASK(itt::domains::IE_LT, "NetworkCompilationContext::computeHash - CNN");
-    OstreamHashWrapper xmlHash;
-    OstreamHashWrapper binHash;
-    std::ostream xml(&xmlHash);
-    std::ostream bin(&binHash);
 
     IE_ASSERT(network.getFunction());
 
-    // 1. Serialize
-    CNNNetwork net(network);
-    ngraph::pass::Serialize serializer(xml, bin,
-        ngraph::pass::Serialize::Version::IR_V10);
-    serializer.run_on_function(net.getFunction());
-
-    // 2. Compute hash on serialized data and options
-    size_t seed {};
-    seed = hash_combine(seed, xmlHash.getResult());
-    seed = hash_combine(seed, binHash.getResult());
+    // 1. Hash topology and weights
+    DataHasher hasher;
+    hashFunction(hasher, *network.getFunction());
 
+    // 2. Add compile options
     for (const auto& kvp : compileOptions) {
-        seed = hash_combine(seed, kvp.first + kvp.second);
+        hasher.update(kvp.first).update(kvp.second);
     }
 
     // 3. Add runtime information which may not be serialized
     for (const auto& op : network.getFunction()->get_ordered_ops()) {
         const auto& rt = op->get_rt_info();
         for (const auto& rtMapData : rt) {
-            seed = hash_combine(seed, rtMapData.first);
+            hasher.update(rtMapData.first);
 
             if (auto stringData = std::dynamic_pointer_cast<ngraph::VariantWrapper<std::string>>(rtMapData.second)) {
-                seed = hash_combine(seed, stringData->get());
+                hasher.update(stringData->get());
             } else if (auto intData = std::dynamic_pointer_cast<ngraph::VariantWrapper<std::int64_t>>(rtMapData.second)) {
-                seed = hash_combine(seed, intData->get());
+                hasher.update(intData->get());
             } else if (auto deq = std::dynamic_pointer_cast<ngraph::VariantWrapper<ngraph::DequantizationAttr>>(rtMapData.second)) {
-                seed = hash_combine(seed, deq->get().getDequantizationAttr());
+                hasher.update(deq->get().getDequantizationAttr());
             } else if (auto fNames = std::dynamic_pointer_cast<ngraph::VariantWrapper<ngraph::FusedNames>>(rtMapData.second)) {
-                seed = hash_combine(seed, fNames->get().getNames());
+                hasher.update(fNames->get().getNames());
             } else if (auto prim = std::dynamic_pointer_cast<ngraph::VariantWrapper<ngraph::PrimitivesPriority>>(rtMapData.second)) {
-                seed = hash_combine(seed, prim->get().getPrimitivesPriority());
+                hasher.update(prim->get().getPrimitivesPriority());
             }
         }
     }
@@ -132,18 +289,18 @@ std::string NetworkCompilationContext::computeHash(const CNNNetwork& network,
     // 4. Add inputs info
     for (const auto& input : network.getInputsInfo()) {
         InputInfo::Ptr info = input.second;
-        seed = hash_combine(seed, as_int32_t(info->getPrecision()));
-        seed = hash_combine(seed, as_int32_t(info->getLayout()));
+        hasher.update(as_int32_t(info->getPrecision()));
+        hasher.update(as_int32_t(info->getLayout()));
 
         const InferenceEngine::PreProcessInfo& preproc = info->getPreProcess();
-        seed = hash_combine(seed, as_int32_t(preproc.getMeanVariant()));
+        hasher.update(as_int32_t(preproc.getMeanVariant()));
 
         if (preproc.getMeanVariant() == MeanVariant::MEAN_VALUE) {
-            seed = hash_combine(seed, preproc.getNumberOfChannels());
+            hasher.update(preproc.getNumberOfChannels());
             for (size_t c = 0; c < preproc.getNumberOfChannels(); ++c) {
                 const PreProcessChannel::Ptr & channelInfo = preproc[c];
-                seed = hash_combine(seed, channelInfo->stdScale);
-                seed = hash_combine(seed, channelInfo->meanValue);
+                hasher.update(channelInfo->stdScale);
+                hasher.update(channelInfo->meanValue);
             }
         } else if (preproc.getMeanVariant() == MeanVariant::MEAN_IMAGE) {
             // TODO: think if we need to compute hash for mean image if it exists
@@ -153,11 +310,11 @@ std::string NetworkCompilationContext::computeHash(const CNNNetwork& network,
     // 5. Add outputs info
     for (const auto& output : network.getOutputsInfo()) {
         DataPtr info = output.second;
-        seed = hash_combine(seed, as_int32_t(info->getPrecision()));
-        seed = hash_combine(seed, as_int32_t(info->getLayout()));
+        hasher.update(as_int32_t(info->getPrecision()));
+        hasher.update(as_int32_t(info->getLayout()));
     }
 
-    return std::to_string(seed);
+    return std::to_string(hasher.digest());
 }
 
 std::string NetworkCompilationContext::computeHash(const std::string& modelName,
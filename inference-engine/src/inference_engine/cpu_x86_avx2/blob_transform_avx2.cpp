@@ -0,0 +1,125 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "cpu_x86_avx2/blob_transform_avx2.hpp"
+
+#include <immintrin.h>  // AVX2
+
+#include <limits>
+#include <vector>
+
+namespace InferenceEngine {
+
+namespace {
+
+constexpr size_t lanes = 8;
+
+// Gathers load 4 bytes for each element, so a few trailing pixels of a row are left
+// for scalar code to keep loads of narrow elements inside the row
+size_t vector_part(size_t W, size_t elem_size) {
+    const size_t margin = elem_size < sizeof(int32_t) ? 3 : 0;
+    return W < lanes + margin ? 0 : (W - margin) / lanes * lanes;
+}
+
+bool fits_offsets(size_t max_offset) {
+    return max_offset <= static_cast<size_t>(std::numeric_limits<int32_t>::max());
+}
+
+// Stores the lowest elem_size bytes of each 32-bit lane contiguously
+template <size_t elem_size>
+void store_lanes(uint8_t* dst, __m256i v);
+
+template <>
+inline void store_lanes<1>(uint8_t* dst, __m256i v) {
+    const __m256i shuffle = _mm256_setr_epi8(0, 4, 8, 12, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+                                             0, 4, 8, 12, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1);
+    v = _mm256_shuffle_epi8(v, shuffle);
+    v = _mm256_permutevar8x32_epi32(v, _mm256_setr_epi32(0, 4, 0, 0, 0, 0, 0, 0));
+    _mm_storel_epi64(reinterpret_cast<__m128i*>(dst), _mm256_castsi256_si128(v));
+}
+
+template <>
+inline void store_lanes<2>(uint8_t* dst, __m256i v) {
+    const __m256i shuffle = _mm256_setr_epi8(0, 1, 4, 5, 8, 9, 12, 13, -1, -1, -1, -1, -1, -1, -1, -1,
+                                             0, 1, 4, 5, 8, 9, 12, 13, -1, -1, -1, -1, -1, -1, -1, -1);
+    v = _mm256_shuffle_epi8(v, shuffle);
+    v = _mm256_permute4x64_epi64(v, 0x08);
+    _mm_storeu_si128(reinterpret_cast<__m128i*>(dst), _mm256_castsi256_si128(v));
+}
+
+template <>
+inline void store_lanes<4>(uint8_t* dst, __m256i v) {
+    _mm256_storeu_si256(reinterpret_cast<__m256i*>(dst), v);
+}
+
+template <size_t elem_size>
+size_t split_row(const uint8_t* src, uint8_t* dst, size_t C, size_t W, size_t C_dst_stride) {
+    const size_t Wv = vector_part(W, elem_size);
+    if (Wv == 0 || !fits_offsets(W * C * elem_size))
+        return 0;
+
+    const __m256i idx = _mm256_mullo_epi32(_mm256_setr_epi32(0, 1, 2, 3, 4, 5, 6, 7),
+                                           _mm256_set1_epi32(static_cast<int>(C * elem_size)));
+    for (size_t c = 0; c < C; c++) {
+        const uint8_t* src_c = src + c * elem_size;
+        uint8_t* dst_c = dst + c * C_dst_stride * elem_size;
+        for (size_t w = 0; w < Wv; w += lanes) {
+            __m256i v = _mm256_i32gather_epi32(reinterpret_cast<const int*>(src_c + w * C * elem_size), idx, 1);
+            store_lanes<elem_size>(dst_c + w * elem_size, v);
+        }
+    }
+    return Wv;
+}
+
+template <size_t elem_size>
+size_t merge_row(const uint8_t* src, uint8_t* dst, size_t C, size_t W, size_t C_src_stride) {
+    const size_t Wv = vector_part(W, elem_size);
+    if (Wv == 0 || !fits_offsets(((C - 1) * C_src_stride + W) * elem_size))
+        return 0;
+
+    // offsets of source elements for a block of lanes pixels, the block is stored by C vectors
+    std::vector<int32_t> offsets(C * lanes);
+    for (size_t j = 0; j < offsets.size(); j++) {
+        offsets[j] = static_cast<int32_t>(((j % C) * C_src_stride + j / C) * elem_size);
+    }
+
+    for (size_t w = 0; w < Wv; w += lanes) {
+        const uint8_t* src_w = src + w * elem_size;
+        uint8_t* dst_w = dst + w * C * elem_size;
+        for (size_t k = 0; k < C; k++) {
+            const __m256i idx = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(&offsets[k * lanes]));
+            __m256i v = _mm256_i32gather_epi32(reinterpret_cast<const int*>(src_w), idx, 1);
+            store_lanes<elem_size>(dst_w + k * lanes * elem_size, v);
+        }
+    }
+    return Wv;
+}
+
+}  // namespace
+
+size_t blob_copy_row_split_avx2(const void* src_ptr, void* dst_ptr, size_t elem_size, size_t C, size_t W,
+                                size_t C_dst_stride) {
+    auto src = reinterpret_cast<const uint8_t*>(src_ptr);
+    auto dst = reinterpret_cast<uint8_t*>(dst_ptr);
+    switch (elem_size) {
+    case 1: return split_row<1>(src, dst, C, W, C_dst_stride);
+    case 2: return split_row<2>(src, dst, C, W, C_dst_stride);
+    case 4: return split_row<4>(src, dst, C, W, C_dst_stride);
+    default: return 0;
+    }
+}
+
+size_t blob_copy_row_merge_avx2(const void* src_ptr, void* dst_ptr, size_t elem_size, size_t C, size_t W,
+                                size_t C_src_stride) {
+    auto src = reinterpret_cast<const uint8_t*>(src_ptr);
+    auto dst = reinterpret_cast<uint8_t*>(dst_ptr);
+    switch (elem_size) {
+    case 1: return merge_row<1>(src, dst, C, W, C_src_stride);
+    case 2: return merge_row<2>(src, dst, C, W, C_src_stride);
+    case 4: return merge_row<4>(src, dst, C, W, C_src_stride);
+    default: return 0;
+    }
+}
+
+}  // namespace InferenceEngine
@@ -0,0 +1,29 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <stdint.h>
+#include <stdlib.h>
+
+namespace InferenceEngine {
+
+//------------------------------------------------------------------------
+//
+// Blob-copy primitives manually vectored for AVX2 (w/o threads)
+//
+// Row primitives convert a row of W pixels with arbitrary number of channels C
+// between interleaved and planar layouts for 1, 2 and 4 bytes elements. Strides
+// are in elements. Primitives process some leading part of the row and return
+// number of processed pixels, the rest of the row is up to a caller.
+//
+//------------------------------------------------------------------------
+
+size_t blob_copy_row_split_avx2(const void* src_ptr, void* dst_ptr, size_t elem_size, size_t C, size_t W,
+                                size_t C_dst_stride);
+
+size_t blob_copy_row_merge_avx2(const void* src_ptr, void* dst_ptr, size_t elem_size, size_t C, size_t W,
+                                size_t C_src_stride);
+
+}  // namespace InferenceEngine
@@ -0,0 +1,145 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "cpu_x86_avx2/precision_utils_avx2.hpp"
+
+#include <immintrin.h>  // AVX2
+
+namespace InferenceEngine {
+namespace PrecisionUtils {
+
+namespace {
+
+constexpr size_t lanes = 8;
+
+inline __m256i set1(uint32_t v) {
+    return _mm256_set1_epi32(static_cast<int>(v));
+}
+
+inline __m256 set1_bits(uint32_t v) {
+    return _mm256_castsi256_ps(set1(v));
+}
+
+// F16C isn't a part of AVX2 compilation flags, so conversions are done with integer arithmetic
+// following the scalar f16tof32: normals are rebiased, INF/NAN keep max exponent with NAN made quiet,
+// denormals are exact as mantissa * 2^-24
+inline __m256 cvt_f16_f32(__m128i h) {
+    const __m256i u = _mm256_cvtepu16_epi32(h);
+    const __m256i sign = _mm256_slli_epi32(_mm256_and_si256(u, set1(0x8000)), 16);
+    const __m256i exp = _mm256_and_si256(u, set1(0x7C00));
+    const __m256i mant = _mm256_and_si256(u, set1(0x03FF));
+
+    const __m256i normal = _mm256_add_epi32(_mm256_slli_epi32(_mm256_and_si256(u, set1(0x7FFF)), 13),
+                                            set1((127 - 15) << 23));
+    const __m256i quiet = _mm256_andnot_si256(_mm256_cmpeq_epi32(mant, _mm256_setzero_si256()), set1(0x00400000));
+    const __m256i special = _mm256_or_si256(_mm256_or_si256(_mm256_slli_epi32(mant, 13), set1(0x7F800000)), quiet);
+    const __m256i denorm = _mm256_castps_si256(_mm256_mul_ps(_mm256_cvtepi32_ps(mant), set1_bits((127 - 24) << 23)));
+
+    __m256i r = _mm256_blendv_epi8(normal, special, _mm256_cmpeq_epi32(exp, set1(0x7C00)));
+    r = _mm256_blendv_epi8(r, denorm, _mm256_cmpeq_epi32(exp, _mm256_setzero_si256()));
+    return _mm256_castsi256_ps(_mm256_or_si256(r, sign));
+}
+
+// Follows the scalar f32tof16: rounding by adding half of f16 ULP, denormals are flushed,
+// overflow saturates to the maximal f16 value
+inline __m128i cvt_f32_f16(__m256 x) {
+    const __m256i u = _mm256_castps_si256(x);
+    const __m256i sign = _mm256_and_si256(_mm256_srli_epi32(u, 16), set1(0x8000));
+    const __m256i abs = _mm256_and_si256(u, set1(0x7FFFFFFF));
+    const __m256i exp = _mm256_and_si256(abs, set1(0x7F800000));
+
+    // NAN and INF, only lower 16 bits of the result are stored
+    const __m256i is_inf = _mm256_cmpeq_epi32(_mm256_and_si256(abs, set1(0x007FFFFF)), _mm256_setzero_si256());
+    const __m256i special = _mm256_blendv_epi8(_mm256_or_si256(_mm256_srli_epi32(abs, 23 - 10), set1(0x0200)),
+                                               set1(0x7C00), is_inf);
+
+    const __m256 half_ulp = _mm256_mul_ps(_mm256_castsi256_ps(exp), set1_bits((127 - 11) << 23));
+    const __m256 v = _mm256_add_ps(_mm256_castsi256_ps(abs), half_ulp);
+    const __m256 min16 = set1_bits((127 - 14) << 23);
+
+    __m256i r = _mm256_srli_epi32(_mm256_sub_epi32(_mm256_castps_si256(v), set1((127 - 15) << 23)), 23 - 10);
+    r = _mm256_blendv_epi8(r, set1(((15 + 15) << 10) | 0x3FF),
+                           _mm256_castps_si256(_mm256_cmp_ps(v, set1_bits(((127 + 15) << 23) | 0x007FE000), _CMP_GE_OQ)));
+    r = _mm256_blendv_epi8(r, set1(1 << 10), _mm256_castps_si256(_mm256_cmp_ps(v, min16, _CMP_LT_OQ)));
+    r = _mm256_blendv_epi8(r, _mm256_setzero_si256(),
+                           _mm256_castps_si256(_mm256_cmp_ps(v, _mm256_mul_ps(min16, _mm256_set1_ps(0.5f)), _CMP_LT_OQ)));
+    r = _mm256_blendv_epi8(r, special, _mm256_cmpeq_epi32(exp, set1(0x7F800000)));
+    r = _mm256_and_si256(_mm256_or_si256(r, sign), set1(0xFFFF));
+
+    return _mm256_castsi256_si128(_mm256_permute4x64_epi64(_mm256_packus_epi32(r, r), 0x08));
+}
+
+inline __m256 cvt_bf16_f32(__m128i h) {
+    return _mm256_castsi256_ps(_mm256_slli_epi32(_mm256_cvtepu16_epi32(h), 16));
+}
+
+// Rounding to nearest even, NAN is made quiet
+inline __m128i cvt_f32_bf16(__m256 x) {
+    const __m256i u = _mm256_castps_si256(x);
+    const __m256i lsb = _mm256_and_si256(_mm256_srli_epi32(u, 16), set1(1));
+    const __m256i rounded = _mm256_srli_epi32(_mm256_add_epi32(u, _mm256_add_epi32(lsb, set1(0x7FFF))), 16);
+    const __m256i nan = _mm256_or_si256(_mm256_srli_epi32(u, 16), set1(0x0040));
+    const __m256i r = _mm256_blendv_epi8(rounded, nan, _mm256_castps_si256(_mm256_cmp_ps(x, x, _CMP_UNORD_Q)));
+
+    return _mm256_castsi256_si128(_mm256_permute4x64_epi64(_mm256_packus_epi32(r, r), 0x08));
+}
+
+inline __m256 load_f32(const float* src, __m256 scale, __m256 bias) {
+    return _mm256_fmadd_ps(_mm256_loadu_ps(src), scale, bias);
+}
+
+inline void store_f32(float* dst, __m256 v, __m256 scale, __m256 bias) {
+    _mm256_storeu_ps(dst, _mm256_fmadd_ps(v, scale, bias));
+}
+
+template <typename T>
+inline __m128i load_16(const T* src) {
+    return _mm_loadu_si128(reinterpret_cast<const __m128i*>(src));
+}
+
+template <typename T>
+inline void store_16(T* dst, __m128i v) {
+    _mm_storeu_si128(reinterpret_cast<__m128i*>(dst), v);
+}
+
+}  // namespace
+
+size_t f16tof32Arrays_avx2(float* dst, const ie_fp16* src, size_t nelem, float scale, float bias) {
+    const __m256 vscale = _mm256_set1_ps(scale), vbias = _mm256_set1_ps(bias);
+    size_t i = 0;
+    for (; i + lanes <= nelem; i += lanes) {
+        store_f32(dst + i, cvt_f16_f32(load_16(src + i)), vscale, vbias);
+    }
+    return i;
+}
+
+size_t f32tof16Arrays_avx2(ie_fp16* dst, const float* src, size_t nelem, float scale, float bias) {
+    const __m256 vscale = _mm256_set1_ps(scale), vbias = _mm256_set1_ps(bias);
+    size_t i = 0;
+    for (; i + lanes <= nelem; i += lanes) {
+        store_16(dst + i, cvt_f32_f16(load_f32(src + i, vscale, vbias)));
+    }
+    return i;
+}
+
+size_t bf16tof32Arrays_avx2(float* dst, const ie_bf16* src, size_t nelem, float scale, float bias) {
+    const __m256 vscale = _mm256_set1_ps(scale), vbias = _mm256_set1_ps(bias);
+    size_t i = 0;
+    for (; i + lanes <= nelem; i += lanes) {
+        store_f32(dst + i, cvt_bf16_f32(load_16(src + i)), vscale, vbias);
+    }
+    return i;
+}
+
+size_t f32tobf16Arrays_avx2(ie_bf16* dst, const float* src, size_t nelem, float scale, float bias) {
+    const __m256 vscale = _mm256_set1_ps(scale), vbias = _mm256_set1_ps(bias);
+    size_t i = 0;
+    for (; i + lanes <= nelem; i += lanes) {
+        store_16(dst + i, cvt_f32_bf16(load_f32(src + i, vscale, vbias)));
+    }
+    return i;
+}
+
+}  // namespace PrecisionUtils
+}  // namespace InferenceEngine
@@ -0,0 +1,129 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "cpu_x86_avx512/precision_utils_avx512.hpp"
+
+#include <immintrin.h>  // AVX512
+
+namespace InferenceEngine {
+namespace PrecisionUtils {
+
+namespace {
+
+constexpr size_t lanes = 16;
+
+inline __m512i set1(uint32_t v) {
+    return _mm512_set1_epi32(static_cast<int>(v));
+}
+
+inline __m512 set1_bits(uint32_t v) {
+    return _mm512_castsi512_ps(set1(v));
+}
+
+// Hardware conversion is exact for all values including denormals, NAN are made quiet like in f16tof32
+inline __m512 cvt_f16_f32(__m256i h) {
+    return _mm512_cvtph_ps(h);
+}
+
+// Hardware conversion isn't used as it rounds to nearest even and keeps denormals and INF,
+// this one follows the scalar f32tof16: rounding by adding half of f16 ULP, denormals are flushed,
+// overflow saturates to the maximal f16 value
+inline __m256i cvt_f32_f16(__m512 x) {
+    const __m512i u = _mm512_castps_si512(x);
+    const __m512i sign = _mm512_and_si512(_mm512_srli_epi32(u, 16), set1(0x8000));
+    const __m512i abs = _mm512_and_si512(u, set1(0x7FFFFFFF));
+    const __m512i exp = _mm512_and_si512(abs, set1(0x7F800000));
+
+    // NAN and INF, only lower 16 bits of the result are stored
+    const __mmask16 is_inf = _mm512_cmpeq_epi32_mask(_mm512_and_si512(abs, set1(0x007FFFFF)), _mm512_setzero_si512());
+    const __m512i special = _mm512_mask_blend_epi32(is_inf, _mm512_or_si512(_mm512_srli_epi32(abs, 23 - 10), set1(0x0200)),
+                                                    set1(0x7C00));
+
+    const __m512 half_ulp = _mm512_mul_ps(_mm512_castsi512_ps(exp), set1_bits((127 - 11) << 23));
+    const __m512 v = _mm512_add_ps(_mm512_castsi512_ps(abs), half_ulp);
+    const __m512 min16 = set1_bits((127 - 14) << 23);
+
+    __m512i r = _mm512_srli_epi32(_mm512_sub_epi32(_mm512_castps_si512(v), set1((127 - 15) << 23)), 23 - 10);
+    r = _mm512_mask_blend_epi32(_mm512_cmp_ps_mask(v, set1_bits(((127 + 15) << 23) | 0x007FE000), _CMP_GE_OQ),
+                                r, set1(((15 + 15) << 10) | 0x3FF));
+    r = _mm512_mask_blend_epi32(_mm512_cmp_ps_mask(v, min16, _CMP_LT_OQ), r, set1(1 << 10));
+    r = _mm512_mask_blend_epi32(_mm512_cmp_ps_mask(v, _mm512_mul_ps(min16, _mm512_set1_ps(0.5f)), _CMP_LT_OQ),
+                                r, _mm512_setzero_si512());
+    r = _mm512_mask_blend_epi32(_mm512_cmpeq_epi32_mask(exp, set1(0x7F800000)), r, special);
+
+    return _mm512_cvtepi32_epi16(_mm512_or_si512(r, sign));
+}
+
+inline __m512 cvt_bf16_f32(__m256i h) {
+    return _mm512_castsi512_ps(_mm512_slli_epi32(_mm512_cvtepu16_epi32(h), 16));
+}
+
+// Rounding to nearest even, NAN is made quiet
+inline __m256i cvt_f32_bf16(__m512 x) {
+    const __m512i u = _mm512_castps_si512(x);
+    const __m512i lsb = _mm512_and_si512(_mm512_srli_epi32(u, 16), set1(1));
+    const __m512i rounded = _mm512_srli_epi32(_mm512_add_epi32(u, _mm512_add_epi32(lsb, set1(0x7FFF))), 16);
+    const __m512i nan = _mm512_or_si512(_mm512_srli_epi32(u, 16), set1(0x0040));
+
+    return _mm512_cvtepi32_epi16(_mm512_mask_blend_epi32(_mm512_cmp_ps_mask(x, x, _CMP_UNORD_Q), rounded, nan));
+}
+
+inline __m512 load_f32(const float* src, __m512 scale, __m512 bias) {
+    return _mm512_fmadd_ps(_mm512_loadu_ps(src), scale, bias);
+}
+
+inline void store_f32(float* dst, __m512 v, __m512 scale, __m512 bias) {
+    _mm512_storeu_ps(dst, _mm512_fmadd_ps(v, scale, bias));
+}
+
+template <typename T>
+inline __m256i load_16(const T* src) {
+    return _mm256_loadu_si256(reinterpret_cast<const __m256i*>(src));
+}
+
+template <typename T>
+inline void store_16(T* dst, __m256i v) {
+    _mm256_storeu_si256(reinterpret_cast<__m256i*>(dst), v);
+}
+
+}  // namespace
+
+size_t f16tof32Arrays_avx512(float* dst, const ie_fp16* src, size_t nelem, float scale, float bias) {
+    const __m512 vscale = _mm512_set1_ps(scale), vbias = _mm512_set1_ps(bias);
+    size_t i = 0;
+    for (; i + lanes <= nelem; i += lanes) {
+        store_f32(dst + i, cvt_f16_f32(load_16(src + i)), vscale, vbias);
+    }
+    return i;
+}
+
+size_t f32tof16Arrays_avx512(ie_fp16* dst, const float* src, size_t nelem, float scale, float bias) {
+    const __m512 vscale = _mm512_set1_ps(scale), vbias = _mm512_set1_ps(bias);
+    size_t i = 0;
+    for (; i + lanes <= nelem; i += lanes) {
+        store_16(dst + i, cvt_f32_f16(load_f32(src + i, vscale, vbias)));
+    }
+    return i;
+}
+
+size_t bf16tof32Arrays_avx512(float* dst, const ie_bf16* src, size_t nelem, float scale, float bias) {
+    const __m512 vscale = _mm512_set1_ps(scale), vbias = _mm512_set1_ps(bias);
+    size_t i = 0;
+    for (; i + lanes <= nelem; i += lanes) {
+        store_f32(dst + i, cvt_bf16_f32(load_16(src + i)), vscale, vbias);
+    }
+    return i;
+}
+
+size_t f32tobf16Arrays_avx512(ie_bf16* dst, const float* src, size_t nelem, float scale, float bias) {
+    const __m512 vscale = _mm512_set1_ps(scale), vbias = _mm512_set1_ps(bias);
+    size_t i = 0;
+    for (; i + lanes <= nelem; i += lanes) {
+        store_16(dst + i, cvt_f32_bf16(load_f32(src + i, vscale, vbias)));
+    }
+    return i;
+}
+
+}  // namespace PrecisionUtils
+}  // namespace InferenceEngine
@@ -0,0 +1,35 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include "precision_utils.h"
+
+#include <stdint.h>
+#include <stdlib.h>
+
+namespace InferenceEngine {
+namespace PrecisionUtils {
+
+//------------------------------------------------------------------------
+//
+// FP16/BF16 <-> FP32 array conversions manually vectored for AVX512 (w/o threads)
+//
+// Results are bit-exact to the scalar f16tof32/f32tof16/bf16tof32/f32tobf16
+// functions, `scale` and `bias` are applied with fused multiply-add. Functions
+// process some leading part of arrays and return number of processed elements,
+// the rest of arrays is up to a caller.
+//
+//------------------------------------------------------------------------
+
+size_t f16tof32Arrays_avx512(float* dst, const ie_fp16* src, size_t nelem, float scale, float bias);
+
+size_t f32tof16Arrays_avx512(ie_fp16* dst, const float* src, size_t nelem, float scale, float bias);
+
+size_t bf16tof32Arrays_avx512(float* dst, const ie_bf16* src, size_t nelem, float scale, float bias);
+
+size_t f32tobf16Arrays_avx512(ie_bf16* dst, const float* src, size_t nelem, float scale, float bias);
+
+}  // namespace PrecisionUtils
+}  // namespace InferenceEngine
@@ -0,0 +1,350 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "ie_cache_manager.hpp"
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <vector>
+
+#ifndef _WIN32
+# include <dirent.h>
+# include <fcntl.h>
+# include <sys/file.h>
+# include <sys/stat.h>
+# include <unistd.h>
+# include <utime.h>
+#else
+# ifndef NOMINMAX
+#  define NOMINMAX
+# endif
+# include <Windows.h>
+# include <sys/utime.h>
+#endif
+
+namespace InferenceEngine {
+
+namespace {
+
+const char blobExtension[] = ".blob";
+
+struct CacheEntryInfo {
+    std::string path;
+    uint64_t size;
+    uint64_t lastAccess;
+};
+
+bool isBlobFile(const std::string& name) {
+    const size_t extSize = sizeof(blobExtension) - 1;
+    return name.size() > extSize && name.compare(name.size() - extSize, extSize, blobExtension) == 0;
+}
+
+uint64_t elapsedMicroseconds(const std::chrono::steady_clock::time_point& start) {
+    return static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::microseconds>(
+        std::chrono::steady_clock::now() - start).count());
+}
+
+void touchFile(const std::string& path) {
+#ifdef _WIN32
+    _utime(path.c_str(), nullptr);
+#else
+    utime(path.c_str(), nullptr);
+#endif
+}
+
+#ifndef _WIN32
+
+/**
+ * @brief Advisory lock of the whole file, visible to other processes
+ */
+class FileLock {
+    int m_fd = -1;
+    bool m_locked = false;
+
+public:
+    FileLock(const std::string& path, bool exclusive, bool wait) {
+        m_fd = open(path.c_str(), O_RDONLY);
+        if (m_fd < 0)
+            return;
+        int operation = (exclusive ? LOCK_EX : LOCK_SH) | (wait ? 0 : LOCK_NB);
+        m_locked = flock(m_fd, operation) == 0;
+    }
+
+    ~FileLock() {
+        if (m_fd >= 0) {
+            if (m_locked)
+                flock(m_fd, LOCK_UN);
+            close(m_fd);
+        }
+    }
+
+    bool isLocked() const {
+        return m_locked;
+    }
+
+    /**
+     * @brief Checks that the path still names the locked file, i.e. it was not replaced or removed
+     */
+    bool isCurrent(const std::string& path) const {
+        struct stat locked, current;
+        if (m_fd < 0 || fstat(m_fd, &locked) != 0 || stat(path.c_str(), &current) != 0)
+            return false;
+        return locked.st_dev == current.st_dev && locked.st_ino == current.st_ino;
+    }
+};
+
+unsigned long getProcessId() {
+    return static_cast<unsigned long>(getpid());
+}
+
+bool publishFile(const std::string& from, const std::string& to) {
+    // rename atomically replaces the destination, so readers never see partially written data
+    return std::rename(from.c_str(), to.c_str()) == 0;
+}
+
+std::vector<CacheEntryInfo> listCacheEntries(const std::string& dirPath) {
+    std::vector<CacheEntryInfo> entries;
+    DIR* dir = opendir(dirPath.c_str());
+    if (dir == nullptr)
+        return entries;
+    while (struct dirent* ent = readdir(dir)) {
+        std::string name = ent->d_name;
+        if (!isBlobFile(name))
+            continue;
+        auto path = FileUtils::makePath(dirPath, name);
+        struct stat st;
+        if (stat(path.c_str(), &st) == 0 && S_ISREG(st.st_mode)) {
+            entries.push_back({path, static_cast<uint64_t>(st.st_size), static_cast<uint64_t>(st.st_mtime)});
+        }
+    }
+    closedir(dir);
+    return entries;
+}
+
+#else
+
+/**
+ * @brief Lock of the whole file, visible to other processes
+ */
+class FileLock {
+    HANDLE m_handle = INVALID_HANDLE_VALUE;
+    bool m_locked = false;
+
+public:
+    FileLock(const std::string& path, bool exclusive, bool wait) {
+        m_handle = CreateFileA(path.c_str(), GENERIC_READ, FILE_SHARE_READ | FILE_SHARE_WRITE | FILE_SHARE_DELETE,
+                               nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+        if (m_handle == INVALID_HANDLE_VALUE)
+            return;
+        OVERLAPPED overlapped = {};
+        DWORD flags = (exclusive ? LOCKFILE_EXCLUSIVE_LOCK : 0) | (wait ? 0 : LOCKFILE_FAIL_IMMEDIATELY);
+        m_locked = LockFileEx(m_handle, flags, 0, MAXDWORD, MAXDWORD, &overlapped) != FALSE;
+    }
+
+    ~FileLock() {
+        if (m_handle != INVALID_HANDLE_VALUE) {
+            if (m_locked) {
+                OVERLAPPED overlapped = {};
+                UnlockFileEx(m_handle, 0, MAXDWORD, MAXDWORD, &overlapped);
+            }
+            CloseHandle(m_handle);
+        }
+    }
+
+    bool isLocked() const {
+        return m_locked;
+    }
+
+    /**
+     * @brief Checks that the path still names the locked file, i.e. it was not replaced or removed
+     */
+    bool isCurrent(const std::string& path) const {
+        if (m_handle == INVALID_HANDLE_VALUE)
+            return false;
+        HANDLE current = CreateFileA(path.c_str(), 0, FILE_SHARE_READ | FILE_SHARE_WRITE | FILE_SHARE_DELETE,
+                                     nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+        if (current == INVALID_HANDLE_VALUE)
+            return false;
+        BY_HANDLE_FILE_INFORMATION lockedInfo, currentInfo;
+        bool same = GetFileInformationByHandle(m_handle, &lockedInfo) != FALSE &&
+                    GetFileInformationByHandle(current, &currentInfo) != FALSE &&
+                    lockedInfo.dwVolumeSerialNumber == currentInfo.dwVolumeSerialNumber &&
+                    lockedInfo.nFileIndexHigh == currentInfo.nFileIndexHigh &&
+                    lockedInfo.nFileIndexLow == currentInfo.nFileIndexLow;
+        CloseHandle(current);
+        return same;
+    }
+};
+
+unsigned long getProcessId() {
+    return static_cast<unsigned long>(GetCurrentProcessId());
+}
+
+bool publishFile(const std::string& from, const std::string& to) {
+    // Replacing fails if the destination is opened by a reader, the existing entry is kept in this case
+    return MoveFileExA(from.c_str(), to.c_str(), MOVEFILE_REPLACE_EXISTING) != FALSE;
+}
+
+std::vector<CacheEntryInfo> listCacheEntries(const std::string& dirPath) {
+    std::vector<CacheEntryInfo> entries;
+    WIN32_FIND_DATAA data;
+    HANDLE find = FindFirstFileA(FileUtils::makePath(dirPath, std::string("*") + blobExtension).c_str(), &data);
+    if (find == INVALID_HANDLE_VALUE)
+        return entries;
+    do {
+        if (data.dwFileAttributes & FILE_ATTRIBUTE_DIRECTORY)
+            continue;
+        std::string name = data.cFileName;
+        if (!isBlobFile(name))
+            continue;
+        uint64_t size = (static_cast<uint64_t>(data.nFileSizeHigh) << 32) | data.nFileSizeLow;
+        uint64_t lastAccess = (static_cast<uint64_t>(data.ftLastWriteTime.dwHighDateTime) << 32) |
+                              data.ftLastWriteTime.dwLowDateTime;
+        entries.push_back({FileUtils::makePath(dirPath, name), size, lastAccess});
+    } while (FindNextFileA(find, &data));
+    FindClose(find);
+    return entries;
+}
+
+#endif
+
+}  // namespace
+
+FileStorageCacheManager::FileStorageCacheManager(std::string cachePath, uint64_t sizeLimit) :
+        m_cachePath(std::move(cachePath)), m_sizeLimit(sizeLimit) {
+}
+
+void FileStorageCacheManager::setSizeLimit(uint64_t sizeLimit) {
+    m_sizeLimit = sizeLimit;
+    evict();
+}
+
+void FileStorageCacheManager::evict(const std::string& keepPath) {
+    const uint64_t sizeLimit = m_sizeLimit;
+    if (sizeLimit == 0)
+        return;
+
+    std::lock_guard<std::mutex> guard(m_evictMutex);
+    auto entries = listCacheEntries(m_cachePath);
+    uint64_t totalSize = 0;
+    for (const auto& entry : entries)
+        totalSize += entry.size;
+    if (totalSize <= sizeLimit)
+        return;
+
+    std::sort(entries.begin(), entries.end(), [](const CacheEntryInfo& a, const CacheEntryInfo& b) {
+        return a.lastAccess < b.lastAccess;
+    });
+
+    for (const auto& entry : entries) {
+        if (totalSize <= sizeLimit)
+            break;
+        if (entry.path == keepPath)
+            continue;
+        // Entry is being read by this or another process, skip it
+        FileLock lock(entry.path, true, false);
+        if (!lock.isLocked())
+            continue;
+        // The lock is held until the file is removed. The entry may have been republished by another
+        // process after it was listed, in this case the locked file is not the one the path names anymore
+        if (!lock.isCurrent(entry.path))
+            continue;
+        if (std::remove(entry.path.c_str()) == 0) {
+            totalSize -= entry.size;
+            m_evictions++;
+        }
+    }
+}
+
+void FileStorageCacheManager::writeCacheEntry(const std::string& id, StreamWriter writer) {
+    static std::atomic<uint64_t> tmpCounter {0};
+
+    const auto start = std::chrono::steady_clock::now();
+    const auto blobFileName = getBlobFile(id);
+    const auto tmpFileName = blobFileName + "." + std::to_string(getProcessId()) +
+                             "_" + std::to_string(tmpCounter++) + ".tmp";
+    bool written = false;
+    {
+        std::ofstream stream(tmpFileName, std::ios_base::binary | std::ofstream::out);
+        try {
+            writer(stream);
+        } catch (...) {
+            stream.close();
+            std::remove(tmpFileName.c_str());
+            throw;
+        }
+        stream.flush();
+        written = stream.good();
+    }
+
+    bool published = false;
+    if (written) {
+        // Entries of this process are not republished while eviction checks and removes them
+        std::lock_guard<std::mutex> guard(m_evictMutex);
+        published = publishFile(tmpFileName, blobFileName);
+    }
+
+    if (published) {
+        m_writes++;
+        evict(blobFileName);
+    } else {
+        std::remove(tmpFileName.c_str());
+    }
+    m_writeTimeUs += elapsedMicroseconds(start);
+}
+
+void FileStorageCacheManager::readCacheEntry(const std::string& id, StreamReader reader) {
+    auto blobFileName = getBlobFile(id);
+
+    // Shared lock prevents removal of the entry by eviction in other processes
+    FileLock lock(blobFileName, false, true);
+    if (!lock.isLocked() || !lock.isCurrent(blobFileName)) {
+        m_misses++;
+        return;
+    }
+
+    std::ifstream stream(blobFileName, std::ios_base::binary);
+    if (!stream.is_open()) {
+        m_misses++;
+        return;
+    }
+
+    // Modification time is used as the last access time for LRU eviction
+    touchFile(blobFileName);
+    m_hits++;
+
+    const auto start = std::chrono::steady_clock::now();
+    try {
+        reader(stream);
+    } catch (...) {
+        m_readTimeUs += elapsedMicroseconds(start);
+        throw;
+    }
+    m_readTimeUs += elapsedMicroseconds(start);
+}
+
+void FileStorageCacheManager::removeCacheEntry(const std::string& id) {
+    auto blobFileName = getBlobFile(id);
+    if (FileUtils::fileExist(blobFileName))
+        std::remove(blobFileName.c_str());
+}
+
+std::map<std::string, uint64_t> FileStorageCacheManager::getStatistics() const {
+    uint64_t totalSize = 0;
+    for (const auto& entry : listCacheEntries(m_cachePath))
+        totalSize += entry.size;
+
+    return {
+        {"HITS", m_hits},
+        {"MISSES", m_misses},
+        {"WRITES", m_writes},
+        {"EVICTIONS", m_evictions},
+        {"SIZE", totalSize},
+        {"READ_TIME_US", m_readTimeUs},
+        {"WRITE_TIME_US", m_writeTimeUs}
+    };
+}
+
+}  // namespace InferenceEngine
@@ -9,8 +9,12 @@
  */
 #pragma once
 
+#include <atomic>
+#include <cstdint>
 #include <memory>
 #include <fstream>
+#include <map>
+#include <mutex>
 #include <string>
 #include <functional>
 #include "ie_api.h"
@@ -69,27 +73,55 @@ public:
      * @param id Id of cache (hash of the network)
      */
     virtual void removeCacheEntry(const std::string& id) = 0;
+
+    /**
+     * @brief Returns cache usage counters as described for METRIC_KEY(CACHE_STATISTICS)
+     *
+     * @return Map of counter names to values, empty if statistics is not collected
+     */
+    virtual std::map<std::string, uint64_t> getStatistics() const {
+        return {};
+    }
 };
 
 /**
  * @brief File storage-based Implementation of ICacheManager
  *
- * Uses simple file for read/write cached models.
+ * Each network is stored in a separate `<id>.blob` file. Entries are published atomically:
+ * the data is written to a temporary file which is renamed to the final name once complete.
+ * Readers hold a shared file lock, so other processes never remove an entry which is being read.
+ * If the size limit is set, least recently used entries (by modification time, which is updated
+ * on every read) are removed after each write until the total size fits the limit. The entry which
+ * has just been written is never evicted, so the limit may be exceeded while other entries are being read.
  *
  */
 class FileStorageCacheManager final : public ICacheManager {
     std::string m_cachePath;
+    std::atomic<uint64_t> m_sizeLimit;
+
+    std::atomic<uint64_t> m_hits {0};
+    std::atomic<uint64_t> m_misses {0};
+    std::atomic<uint64_t> m_writes {0};
+    std::atomic<uint64_t> m_evictions {0};
+    std::atomic<uint64_t> m_readTimeUs {0};
+    std::atomic<uint64_t> m_writeTimeUs {0};
+
+    std::mutex m_evictMutex;
 
     std::string getBlobFile(const std::string& blobHash) const {
         return FileUtils::makePath(m_cachePath, blobHash + ".blob");
     }
 
+    void evict(const std::string& keepPath = {});
+
 public:
     /**
      * @brief Constructor
      *
+     * @param cachePath Directory to store cache entries in
+     * @param sizeLimit Maximum total size of the entries in bytes, 0 means unlimited
      */
-    FileStorageCacheManager(std::string&& cachePath) : m_cachePath(std::move(cachePath)) {}
+    explicit FileStorageCacheManager(std::string cachePath, uint64_t sizeLimit = 0);
 
     /**
      * @brief Destructor
@@ -97,25 +129,21 @@ public:
      */
     ~FileStorageCacheManager() override = default;
 
+    /**
+     * @brief Sets the maximum total size of the entries
+     *
+     * @param sizeLimit Maximum total size of the entries in bytes, 0 means unlimited
+     */
+    void setSizeLimit(uint64_t sizeLimit);
+
+    std::map<std::string, uint64_t> getStatistics() const override;
+
 private:
-    void writeCacheEntry(const std::string& id, StreamWriter writer) override {
-        std::ofstream stream(getBlobFile(id), std::ios_base::binary | std::ofstream::out);
-        writer(stream);
-    }
+    void writeCacheEntry(const std::string& id, StreamWriter writer) override;
 
-    void readCacheEntry(const std::string& id, StreamReader reader) override {
-        auto blobFileName = getBlobFile(id);
-        if (FileUtils::fileExist(blobFileName)) {
-            std::ifstream stream(blobFileName, std::ios_base::binary);
-            reader(stream);
-        }
-    }
+    void readCacheEntry(const std::string& id, StreamReader reader) override;
 
-    void removeCacheEntry(const std::string& id) override {
-        auto blobFileName = getBlobFile(id);
-        if (FileUtils::fileExist(blobFileName))
-            std::remove(blobFileName.c_str());
-    }
+    void removeCacheEntry(const std::string& id) override;
 };
 
 }  // namespace InferenceEngine
@@ -270,6 +270,47 @@ TensorDesc verifyBatchedBlobInput(const std::vector<Blob::Ptr>& blobs) {
     return TensorDesc{subBlobDesc.getPrecision(), blobDims, blobLayout};
 }
 
+TensorDesc verifyBatchedROIBlobInput(const Blob::Ptr& image, const std::vector<ROI>& rois) {
+    if (image == nullptr) {
+        THROW_IE_EXCEPTION << "BatchedROIBlob cannot be created from nullptr image";
+    }
+
+    if (!image->is<MemoryBlob>() && !image->is<NV12Blob>() && !image->is<I420Blob>()) {
+        THROW_IE_EXCEPTION << "BatchedROIBlob image must be a memory blob, an NV12 blob or an I420 blob";
+    }
+
+    if (rois.empty()) {
+        THROW_IE_EXCEPTION << "BatchedROIBlob cannot be created from empty vector of ROI, "
+                           << "Please, make sure vector contains at least one ROI";
+    }
+
+    auto imageDesc = getBlobTensorDesc(image);
+    auto blobDims = imageDesc.getDims();
+    const auto layout = imageDesc.getLayout();
+    if (layout != NCHW && layout != NHWC) {
+        THROW_IE_EXCEPTION << "BatchedROIBlob image layout must be NCHW or NHWC, actual: " << layout;
+    }
+
+    const auto batch = blobDims[0];
+    const auto width = blobDims[3];
+    const auto height = blobDims[2];
+    for (const auto& roi : rois) {
+        if (roi.sizeX == 0 || roi.sizeY == 0) {
+            THROW_IE_EXCEPTION << "BatchedROIBlob cannot be created from empty ROI";
+        }
+        if (roi.id >= batch) {
+            THROW_IE_EXCEPTION << "ROI id " << roi.id << " is out of the image batch " << batch;
+        }
+        if (roi.posX + roi.sizeX > width || roi.posY + roi.sizeY > height) {
+            THROW_IE_EXCEPTION << "ROI (" << roi.posX << ", " << roi.posY << ", " << roi.sizeX << ", " << roi.sizeY
+                               << ") is out of the image bounds " << width << "x" << height;
+        }
+    }
+
+    blobDims[0] = rois.size();
+    return TensorDesc{imageDesc.getPrecision(), blobDims, layout};
+}
+
 }  // anonymous namespace
 
 CompoundBlob::CompoundBlob(const TensorDesc& tensorDesc): Blob(tensorDesc) {}
@@ -472,4 +513,20 @@ BatchedBlob::BatchedBlob(std::vector<Blob::Ptr>&& blobs)
     this->_blobs = std::move(blobs);
 }
 
+BatchedROIBlob::BatchedROIBlob(const Blob::Ptr& image, const std::vector<ROI>& rois)
+    : CompoundBlob(verifyBatchedROIBlobInput(image, rois)), _image(image), _rois(rois) {
+    this->_blobs.reserve(rois.size());
+    for (const auto& roi : rois) {
+        this->_blobs.emplace_back(image->createROI(roi));
+    }
+}
+
+const Blob::Ptr& BatchedROIBlob::getImage() const noexcept {
+    return _image;
+}
+
+const std::vector<ROI>& BatchedROIBlob::getROIs() const noexcept {
+    return _rois;
+}
+
 }  // namespace InferenceEngine
@@ -168,12 +168,33 @@ class Core::Impl : public ICore {
         };
 
         void setAndUpdate(std::map<std::string, std::string>& config) {
-            auto it = config.find(CONFIG_KEY(CACHE_DIR));
+            auto it = config.find(CONFIG_KEY(CACHE_SIZE_LIMIT));
+            if (it != config.end()) {
+                uint64_t sizeLimit = 0;
+                try {
+                    size_t pos = 0;
+                    sizeLimit = std::stoull(it->second, &pos);
+                    if (pos != it->second.size())
+                        throw std::invalid_argument(it->second);
+                } catch (const std::exception&) {
+                    THROW_IE_EXCEPTION << "Wrong value " << it->second << " for " << CONFIG_KEY(CACHE_SIZE_LIMIT)
+                                       << ". Expected non-negative number of bytes";
+                }
+                std::lock_guard<std::mutex> lock(_cacheConfigMutex);
+                _cacheSizeLimit = sizeLimit;
+                auto fileCacheManager = std::dynamic_pointer_cast<FileStorageCacheManager>(_cacheConfig._cacheManager);
+                if (fileCacheManager)
+                    fileCacheManager->setSizeLimit(sizeLimit);
+                config.erase(it);
+            }
+
+            it = config.find(CONFIG_KEY(CACHE_DIR));
             if (it != config.end()) {
                 std::lock_guard<std::mutex> lock(_cacheConfigMutex);
                 if (!it->second.empty()) {
                     FileUtils::createDirectoryRecursive(it->second);
-                    _cacheConfig._cacheManager = std::make_shared<FileStorageCacheManager>(std::move(it->second));
+                    _cacheConfig._cacheManager =
+                        std::make_shared<FileStorageCacheManager>(std::move(it->second), _cacheSizeLimit);
                 } else {
                     _cacheConfig._cacheManager = nullptr;
                 }
@@ -191,6 +212,7 @@ class Core::Impl : public ICore {
     private:
         mutable std::mutex _cacheConfigMutex;
         CacheConfig _cacheConfig;
+        uint64_t _cacheSizeLimit = 0;
     };
 
     // Core settings (cache config, etc)
@@ -237,6 +259,9 @@ class Core::Impl : public ICore {
                                                         NetworkCompilationContext::calculateFileInfo(modelPath));
                     execNetwork.Export(networkStream);
                 });
+            } catch (const NotImplemented&) {
+                // Particular network cannot be exported by the plugin, just don't cache it
+                cacheManager->removeCacheEntry(blobID);
             } catch (...) {
                 cacheManager->removeCacheEntry(blobID);
                 throw;
@@ -542,6 +567,12 @@ public:
     }
 
     Parameter GetMetric(const std::string& deviceName, const std::string& name) const override {
+        // Core-level metric, does not depend on a device
+        if (name == METRIC_KEY(CACHE_STATISTICS)) {
+            auto cacheManager = coreConfig.getCacheConfig()._cacheManager;
+            return cacheManager ? cacheManager->getStatistics() : std::map<std::string, uint64_t>{};
+        }
+
         // HETERO case
         {
             if (deviceName.find("HETERO:") == 0) {
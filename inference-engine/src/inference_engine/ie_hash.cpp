@@ -0,0 +1,148 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "ie_hash.hpp"
+
+#include <cstring>
+
+namespace InferenceEngine {
+
+namespace {
+
+constexpr uint64_t prime1 = 0x9E3779B185EBCA87ULL;
+constexpr uint64_t prime2 = 0xC2B2AE3D27D4EB4FULL;
+constexpr uint64_t prime3 = 0x165667B19E3779F9ULL;
+constexpr uint64_t prime4 = 0x85EBCA77C2B2AE63ULL;
+constexpr uint64_t prime5 = 0x27D4EB2F165667C5ULL;
+
+inline uint64_t rotl(uint64_t x, int r) {
+    return (x << r) | (x >> (64 - r));
+}
+
+inline uint64_t read64(const uint8_t* p) {
+    uint64_t v;
+    std::memcpy(&v, p, sizeof(v));
+    return v;
+}
+
+inline uint32_t read32(const uint8_t* p) {
+    uint32_t v;
+    std::memcpy(&v, p, sizeof(v));
+    return v;
+}
+
+inline uint64_t xxRound(uint64_t acc, uint64_t input) {
+    acc += input * prime2;
+    acc = rotl(acc, 31);
+    return acc * prime1;
+}
+
+inline uint64_t mergeRound(uint64_t acc, uint64_t val) {
+    acc ^= xxRound(0, val);
+    return acc * prime1 + prime4;
+}
+
+// Processes all complete stripes, returns the number of consumed bytes
+inline size_t consumeStripes(uint64_t acc[4], const uint8_t* p, size_t size) {
+    const uint8_t* const begin = p;
+    const uint8_t* const limit = p + size - size % 32;
+    uint64_t v1 = acc[0], v2 = acc[1], v3 = acc[2], v4 = acc[3];
+    while (p < limit) {
+        v1 = xxRound(v1, read64(p));
+        v2 = xxRound(v2, read64(p + 8));
+        v3 = xxRound(v3, read64(p + 16));
+        v4 = xxRound(v4, read64(p + 24));
+        p += 32;
+    }
+    acc[0] = v1; acc[1] = v2; acc[2] = v3; acc[3] = v4;
+    return static_cast<size_t>(p - begin);
+}
+
+}  // namespace
+
+DataHasher::DataHasher(uint64_t seed) {
+    reset(seed);
+}
+
+void DataHasher::reset(uint64_t seed) {
+    _seed = seed;
+    _acc[0] = seed + prime1 + prime2;
+    _acc[1] = seed + prime2;
+    _acc[2] = seed;
+    _acc[3] = seed - prime1;
+    _totalSize = 0;
+    _bufferSize = 0;
+}
+
+DataHasher& DataHasher::update(const void* data, size_t size) {
+    if (size == 0)
+        return *this;
+
+    auto p = static_cast<const uint8_t*>(data);
+    _totalSize += size;
+
+    if (_bufferSize + size < stripeSize) {
+        std::memcpy(_buffer + _bufferSize, p, size);
+        _bufferSize += size;
+        return *this;
+    }
+
+    if (_bufferSize > 0) {
+        const size_t fill = stripeSize - _bufferSize;
+        std::memcpy(_buffer + _bufferSize, p, fill);
+        consumeStripes(_acc, _buffer, stripeSize);
+        p += fill;
+        size -= fill;
+        _bufferSize = 0;
+    }
+
+    const size_t consumed = consumeStripes(_acc, p, size);
+    _bufferSize = size - consumed;
+    std::memcpy(_buffer, p + consumed, _bufferSize);
+    return *this;
+}
+
+uint64_t DataHasher::digest() const {
+    uint64_t h;
+    if (_totalSize >= stripeSize) {
+        h = rotl(_acc[0], 1) + rotl(_acc[1], 7) + rotl(_acc[2], 12) + rotl(_acc[3], 18);
+        h = mergeRound(h, _acc[0]);
+        h = mergeRound(h, _acc[1]);
+        h = mergeRound(h, _acc[2]);
+        h = mergeRound(h, _acc[3]);
+    } else {
+        h = _seed + prime5;
+    }
+
+    h += _totalSize;
+
+    const uint8_t* p = _buffer;
+    const uint8_t* const end = _buffer + _bufferSize;
+    for (; p + 8 <= end; p += 8) {
+        h ^= xxRound(0, read64(p));
+        h = rotl(h, 27) * prime1 + prime4;
+    }
+    if (p + 4 <= end) {
+        h ^= static_cast<uint64_t>(read32(p)) * prime1;
+        h = rotl(h, 23) * prime2 + prime3;
+        p += 4;
+    }
+    for (; p < end; ++p) {
+        h ^= (*p) * prime5;
+        h = rotl(h, 11) * prime1;
+    }
+
+    h ^= h >> 33;
+    h *= prime2;
+    h ^= h >> 29;
+    h *= prime3;
+    h ^= h >> 32;
+    return h;
+}
+
+uint64_t DataHasher::hash(const void* data, size_t size, uint64_t seed) {
+    return DataHasher(seed).update(data, size).digest();
+}
+
+}  // namespace InferenceEngine
@@ -0,0 +1,26 @@
+// Copyright (C) 2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <ie_blob.h>
+#include <string>
+
+namespace InferenceEngine {
+namespace details {
+
+/**
+ * @brief Maps a whole file into the process address space and wraps the mapping into a U8 blob.
+ *
+ * The mapping is private (copy-on-write), so pages which are never written stay backed by the OS page cache
+ * and are shared between all processes mapping the same file. The mapping is released together with the last
+ * reference to the blob, including `SharedBuffer` objects created on top of it.
+ *
+ * @param path Path to the file
+ * @return A blob with the file content or `nullptr` if the file cannot be mapped (e.g. it is empty)
+ */
+Blob::Ptr make_mmap_blob(const std::string& path);
+
+}  // namespace details
+}  // namespace InferenceEngine
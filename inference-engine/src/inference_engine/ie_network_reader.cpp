@@ -4,6 +4,7 @@
 
 #include "ie_network_reader.hpp"
 #include "ie_itt.hpp"
+#include "ie_mmap_blob.hpp"
 
 #include <details/ie_so_pointer.hpp>
 #include <file_utils.h>
@@ -194,27 +195,31 @@ CNNNetwork details::ReadNetwork(const std::string& modelPath, const std::string&
                 }
             }
             if (!bPath.empty()) {
-                // Open weights file
+                // Map weights file to memory: constants will point directly into the mapping
+                Blob::Ptr weights = details::make_mmap_blob(bPath);
+                if (!weights) {
+                    // Fallback: read the whole weights file to memory
 #if defined(ENABLE_UNICODE_PATH_SUPPORT) && defined(_WIN32)
-                std::wstring weights_path = FileUtils::multiByteCharToWString(bPath.c_str());
+                    std::wstring weights_path = FileUtils::multiByteCharToWString(bPath.c_str());
 #else
-                std::string weights_path = bPath;
+                    std::string weights_path = bPath;
 #endif
-                std::ifstream binStream;
-                binStream.open(weights_path, std::ios::binary);
-                if (!binStream.is_open())
-                    THROW_IE_EXCEPTION << "Weights file " << bPath << " cannot be opened!";
+                    std::ifstream binStream;
+                    binStream.open(weights_path, std::ios::binary);
+                    if (!binStream.is_open())
+                        THROW_IE_EXCEPTION << "Weights file " << bPath << " cannot be opened!";
 
-                binStream.seekg(0, std::ios::end);
-                size_t fileSize = binStream.tellg();
-                binStream.seekg(0, std::ios::beg);
+                    binStream.seekg(0, std::ios::end);
+                    size_t fileSize = binStream.tellg();
+                    binStream.seekg(0, std::ios::beg);
 
-                Blob::Ptr weights = make_shared_blob<uint8_t>({Precision::U8, { fileSize }, C });
-                weights->allocate();
+                    weights = make_shared_blob<uint8_t>({Precision::U8, { fileSize }, C });
+                    weights->allocate();
 
-                binStream.read(weights->buffer(), fileSize);
+                    binStream.read(weights->buffer(), fileSize);
 
-                binStream.close();
+                    binStream.close();
+                }
 
                 // read model with weights
                 auto network = reader->read(modelStream, weights, exts);
@@ -0,0 +1,84 @@
+// Copyright (C) 2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <memory>
+
+#include "ie_mmap_blob.hpp"
+
+namespace InferenceEngine {
+namespace details {
+
+namespace {
+
+/**
+ * @brief POSIX based allocator which owns a private copy-on-write file mapping
+ */
+class MmapAllocator : public IAllocator {
+    void* _data = MAP_FAILED;
+    size_t _size = 0;
+
+public:
+    explicit MmapAllocator(const std::string& path) {
+        int fd = open(path.c_str(), O_RDONLY);
+        if (fd == -1)
+            return;
+
+        struct stat sb = {};
+        if (fstat(fd, &sb) == 0 && sb.st_size > 0) {
+            _size = static_cast<size_t>(sb.st_size);
+            // Writable private mapping: pages are shared with the page cache until somebody modifies them
+            _data = mmap(nullptr, _size, PROT_READ | PROT_WRITE, MAP_PRIVATE, fd, 0);
+        }
+        // the mapping keeps its own reference to the file
+        close(fd);
+    }
+
+    ~MmapAllocator() {
+        if (_data != MAP_FAILED)
+            munmap(_data, _size);
+    }
+
+    bool valid() const noexcept {
+        return _data != MAP_FAILED;
+    }
+
+    size_t size() const noexcept {
+        return _size;
+    }
+
+    void* lock(void* handle, LockOp = LOCK_FOR_WRITE) noexcept override {
+        return handle;
+    }
+
+    void unlock(void*) noexcept override {}
+
+    void* alloc(size_t size) noexcept override {
+        return valid() && size <= _size ? _data : nullptr;
+    }
+
+    bool free(void*) noexcept override {
+        // the mapping is released together with the allocator
+        return true;
+    }
+};
+
+}  // namespace
+
+Blob::Ptr make_mmap_blob(const std::string& path) {
+    auto allocator = std::make_shared<MmapAllocator>(path);
+    if (!allocator->valid())
+        return nullptr;
+
+    auto blob = make_shared_blob<uint8_t>({Precision::U8, { allocator->size() }, C }, allocator);
+    blob->allocate();
+    return blob;
+}
+
+}  // namespace details
+}  // namespace InferenceEngine
@@ -0,0 +1,99 @@
+// Copyright (C) 2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <memory>
+
+#include "ie_mmap_blob.hpp"
+#include "file_utils.h"
+
+#ifndef NOMINMAX
+# define NOMINMAX
+#endif
+
+#include <windows.h>
+
+namespace InferenceEngine {
+namespace details {
+
+namespace {
+
+/**
+ * @brief WINAPI based allocator which owns a private copy-on-write file mapping
+ */
+class MmapAllocator : public IAllocator {
+    HANDLE _mapping = NULL;
+    void* _data = nullptr;
+    size_t _size = 0;
+
+public:
+    explicit MmapAllocator(const std::string& path) {
+#ifdef ENABLE_UNICODE_PATH_SUPPORT
+        std::wstring widePath = FileUtils::multiByteCharToWString(path.c_str());
+        HANDLE file = CreateFileW(widePath.c_str(), GENERIC_READ, FILE_SHARE_READ, NULL,
+                                  OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, NULL);
+#else
+        HANDLE file = CreateFileA(path.c_str(), GENERIC_READ, FILE_SHARE_READ, NULL,
+                                  OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, NULL);
+#endif
+        if (file == INVALID_HANDLE_VALUE)
+            return;
+
+        LARGE_INTEGER fileSize = {};
+        if (GetFileSizeEx(file, &fileSize) && fileSize.QuadPart > 0) {
+            // Copy-on-write mapping: pages are shared with the system cache until somebody modifies them
+            _mapping = CreateFileMapping(file, NULL, PAGE_WRITECOPY, 0, 0, NULL);
+            if (_mapping != NULL) {
+                _data = MapViewOfFile(_mapping, FILE_MAP_COPY, 0, 0, 0);
+                _size = static_cast<size_t>(fileSize.QuadPart);
+            }
+        }
+        // the mapping keeps its own reference to the file
+        CloseHandle(file);
+    }
+
+    ~MmapAllocator() {
+        if (_data != nullptr)
+            UnmapViewOfFile(_data);
+        if (_mapping != NULL)
+            CloseHandle(_mapping);
+    }
+
+    bool valid() const noexcept {
+        return _data != nullptr;
+    }
+
+    size_t size() const noexcept {
+        return _size;
+    }
+
+    void* lock(void* handle, LockOp = LOCK_FOR_WRITE) noexcept override {
+        return handle;
+    }
+
+    void unlock(void*) noexcept override {}
+
+    void* alloc(size_t size) noexcept override {
+        return valid() && size <= _size ? _data : nullptr;
+    }
+
+    bool free(void*) noexcept override {
+        // the mapping is released together with the allocator
+        return true;
+    }
+};
+
+}  // namespace
+
+Blob::Ptr make_mmap_blob(const std::string& path) {
+    auto allocator = std::make_shared<MmapAllocator>(path);
+    if (!allocator->valid())
+        return nullptr;
+
+    auto blob = make_shared_blob<uint8_t>({Precision::U8, { allocator->size() }, C }, allocator);
+    blob->allocate();
+    return blob;
+}
+
+}  // namespace details
+}  // namespace InferenceEngine
@@ -4,24 +4,115 @@
 
 #include "precision_utils.h"
 #include <details/ie_exception.hpp>
+#include <ie_parallel.hpp>
+#include <ie_system_conf.h>
+
+#ifdef HAVE_AVX2
+#include "cpu_x86_avx2/precision_utils_avx2.hpp"
+#endif
+#ifdef HAVE_AVX512
+#include "cpu_x86_avx512/precision_utils_avx512.hpp"
+#endif
+#ifdef HAVE_NEON
+#include "arm_neon/precision_utils_neon.hpp"
+#endif
 
 #include <stdint.h>
 
 namespace InferenceEngine {
 namespace PrecisionUtils {
 
-void f16tof32Arrays(float* dst, const short* src, size_t nelem, float scale, float bias) {
-    const ie_fp16* _src = reinterpret_cast<const ie_fp16*>(src);
+namespace {
+
+// Arrays smaller than this number of elements are converted in the calling thread
+constexpr size_t parallelThreshold = 64 * 1024;
+
+template <typename DstT, typename SrcT>
+using ConvertKernel = size_t (*)(DstT* dst, const SrcT* src, size_t nelem, float scale, float bias);
+
+// Vectorized kernels for the current CPU, null if there are none
+struct ConvertKernels {
+    ConvertKernel<float, ie_fp16> f16tof32 = nullptr;
+    ConvertKernel<ie_fp16, float> f32tof16 = nullptr;
+    ConvertKernel<float, ie_bf16> bf16tof32 = nullptr;
+    ConvertKernel<ie_bf16, float> f32tobf16 = nullptr;
 
-    for (size_t i = 0; i < nelem; i++) {
-        dst[i] = PrecisionUtils::f16tof32(_src[i]) * scale + bias;
+    ConvertKernels() {
+#ifdef HAVE_NEON
+        f16tof32 = f16tof32Arrays_neon;
+        f32tof16 = f32tof16Arrays_neon;
+        bf16tof32 = bf16tof32Arrays_neon;
+        f32tobf16 = f32tobf16Arrays_neon;
+#endif
+#ifdef HAVE_AVX2
+        if (with_cpu_x86_avx2()) {
+            f16tof32 = f16tof32Arrays_avx2;
+            f32tof16 = f32tof16Arrays_avx2;
+            bf16tof32 = bf16tof32Arrays_avx2;
+            f32tobf16 = f32tobf16Arrays_avx2;
+        }
+#endif
+#ifdef HAVE_AVX512
+        if (with_cpu_x86_avx512f()) {
+            f16tof32 = f16tof32Arrays_avx512;
+            f32tof16 = f32tof16Arrays_avx512;
+            bf16tof32 = bf16tof32Arrays_avx512;
+            f32tobf16 = f32tobf16Arrays_avx512;
+        }
+#endif
     }
+};
+
+const ConvertKernels& getConvertKernels() {
+    static const ConvertKernels kernels;
+    return kernels;
 }
 
-void f32tof16Arrays(short* dst, const float* src, size_t nelem, float scale, float bias) {
-    for (size_t i = 0; i < nelem; i++) {
-        dst[i] = PrecisionUtils::f32tof16(src[i] * scale + bias);
+// Converts arrays with the vectorized kernel if any and scalar function for the rest,
+// large arrays are split between threads
+template <typename DstT, typename SrcT, typename ScalarConvert>
+void convertArrays(DstT* dst, const SrcT* src, size_t nelem, float scale, float bias,
+                   ConvertKernel<DstT, SrcT> kernel, const ScalarConvert& convert) {
+    auto convertRange = [&](size_t start, size_t end) {
+        size_t i = start;
+        if (kernel)
+            i += kernel(dst + start, src + start, end - start, scale, bias);
+        for (; i < end; i++)
+            dst[i] = convert(src[i]);
+    };
+
+    if (nelem < parallelThreshold) {
+        convertRange(0, nelem);
+        return;
     }
+
+    parallel_nt(0, [&](const int ithr, const int nthr) {
+        size_t start = 0, end = 0;
+        splitter(nelem, nthr, ithr, start, end);
+        convertRange(start, end);
+    });
+}
+
+}  // namespace
+
+void f16tof32Arrays(float* dst, const ie_fp16* src, size_t nelem, float scale, float bias) {
+    convertArrays(dst, src, nelem, scale, bias, getConvertKernels().f16tof32,
+                  [&](ie_fp16 x) { return PrecisionUtils::f16tof32(x) * scale + bias; });
+}
+
+void f32tof16Arrays(ie_fp16* dst, const float* src, size_t nelem, float scale, float bias) {
+    convertArrays(dst, src, nelem, scale, bias, getConvertKernels().f32tof16,
+                  [&](float x) { return PrecisionUtils::f32tof16(x * scale + bias); });
+}
+
+void bf16tof32Arrays(float* dst, const ie_bf16* src, size_t nelem, float scale, float bias) {
+    convertArrays(dst, src, nelem, scale, bias, getConvertKernels().bf16tof32,
+                  [&](ie_bf16 x) { return PrecisionUtils::bf16tof32(x) * scale + bias; });
+}
+
+void f32tobf16Arrays(ie_bf16* dst, const float* src, size_t nelem, float scale, float bias) {
+    convertArrays(dst, src, nelem, scale, bias, getConvertKernels().f32tobf16,
+                  [&](float x) { return PrecisionUtils::f32tobf16(x * scale + bias); });
 }
 
 // Function to convert F32 into F16
@@ -164,5 +255,26 @@ ie_fp16 f32tof16(float x) {
     return v.u | s;
 }
 
+ie_bf16 f32tobf16(float x) {
+    union {
+        float f;
+        uint32_t u;
+    } v;
+    v.f = x;
+
+    // keep NAN quiet, rounding could turn it to INF
+    if ((v.u & EXP_MASK_F32) == EXP_MASK_F32 && (v.u & 0x007FFFFF)) {
+        return ie_bf16{static_cast<uint16_t>((v.u >> 16) | 0x0040)};
+    }
+
+    // round to nearest even
+    v.u += 0x7FFF + ((v.u >> 16) & 1);
+    return ie_bf16{static_cast<uint16_t>(v.u >> 16)};
+}
+
+float bf16tof32(ie_bf16 x) {
+    return asfloat(static_cast<uint32_t>(x.bits) << 16);
+}
+
 }  // namespace PrecisionUtils
 }  // namespace InferenceEngine
@@ -32,6 +32,21 @@ public:
                    const Shape & output_shape,
                    const element::Type output_type = element::undefined);
 
+    /// \brief Constructs an FullyConnected operation with compressed weights.
+    ///
+    /// \param A Matrix A
+    /// \param B Compressed matrix B (u8 or i8)
+    /// \param C Matrix C
+    /// \param scale Per output channel decompression scale
+    /// \param zero_point Per output channel decompression zero point: B = (B_compressed - zero_point) * scale
+    FullyConnected(const Output<Node> & A,
+                   const Output<Node> & B,
+                   const Output<Node> & C,
+                   const Output<Node> & scale,
+                   const Output<Node> & zero_point,
+                   const Shape & output_shape,
+                   const element::Type output_type = element::undefined);
+
     bool visit_attributes(AttributeVisitor &visitor) override;
 
     void validate_and_infer_types() override;
@@ -42,6 +57,8 @@ public:
 
     element::Type get_output_type() const { return m_output_type; }
 
+    bool has_compressed_weights() const { return get_input_size() == 5; }
+
 private:
     size_t m_output_size = 0;
     Shape m_output_shape = {};
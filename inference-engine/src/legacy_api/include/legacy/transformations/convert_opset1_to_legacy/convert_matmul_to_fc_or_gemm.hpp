@@ -21,6 +21,8 @@ namespace pass {
 class INFERENCE_ENGINE_API_CLASS(ConvertMatMulToFCorGemm);
 class INFERENCE_ENGINE_API_CLASS(ConvertMatMulToFC);
 class INFERENCE_ENGINE_API_CLASS(ConvertMatMulToGemm);
+class INFERENCE_ENGINE_API_CLASS(DisableCompressedWeightsConstantFolding);
+class INFERENCE_ENGINE_API_CLASS(ConvertMatMulWithCompressedWeightsToFC);
 
 }  // namespace pass
 }  // namespace ngraph
@@ -37,6 +39,30 @@ public:
     ConvertMatMulToGemm();
 };
 
+/**
+ * @ingroup ie_transformation_common_api
+ * @brief DisableCompressedWeightsConstantFolding keeps weights decompression subgraph of MatMul
+ * (Constant(u8/i8) -> Convert -> [Subtract] -> Multiply) from constant folding, so that it can be
+ * converted by ConvertMatMulWithCompressedWeightsToFC.
+ */
+class ngraph::pass::DisableCompressedWeightsConstantFolding: public ngraph::pass::MatcherPass {
+public:
+    NGRAPH_RTTI_DECLARATION;
+    DisableCompressedWeightsConstantFolding();
+};
+
+/**
+ * @ingroup ie_transformation_common_api
+ * @brief ConvertMatMulWithCompressedWeightsToFC converts MatMul with decompressed u8/i8 weights to FullyConnected
+ * which keeps weights compressed and takes per output channel decompression scale and zero point as inputs.
+ * Disabled by default, plugins which support compressed weights enable it.
+ */
+class ngraph::pass::ConvertMatMulWithCompressedWeightsToFC: public ngraph::pass::MatcherPass {
+public:
+    NGRAPH_RTTI_DECLARATION;
+    ConvertMatMulWithCompressedWeightsToFC();
+};
+
 class ngraph::pass::ConvertMatMulToFCorGemm: public ngraph::pass::GraphRewrite {
 public:
     NGRAPH_RTTI_DECLARATION;
@@ -1742,10 +1742,21 @@ InferenceEngine::details::CNNLayerCreator::CNNLayerCreator(const std::shared_ptr
             keep_constants = attr->get();
         }
         const auto weightsNode = node->input_value(1).get_node_shared_ptr();
-        if (!keep_constants && InferenceEngine::details::addBlob(weightsNode, res, InferenceEngine::details::weights)) {
+        // compressed weights are not usable as regular ones, so the plugin always gets them with decompression parameters as blobs
+        const auto fc = ngraph::as_type_ptr<ngraph::op::FullyConnected>(node);
+        const bool compressedWeights = fc != nullptr && fc->has_compressed_weights();
+        if ((!keep_constants || compressedWeights) && InferenceEngine::details::addBlob(weightsNode, res, InferenceEngine::details::weights)) {
             const auto biasNode = node->input_value(2).get_node_shared_ptr();
             InferenceEngine::details::addBlob(biasNode, res, InferenceEngine::details::biases);
         }
+        if (compressedWeights) {
+            const auto scaleNode = ngraph::as_type_ptr<ngraph::op::Constant>(node->input_value(3).get_node_shared_ptr());
+            const auto zeroPointNode = ngraph::as_type_ptr<ngraph::op::Constant>(node->input_value(4).get_node_shared_ptr());
+            if (scaleNode == nullptr || zeroPointNode == nullptr)
+                THROW_IE_EXCEPTION << "FullyConnected layer " << attrs.name << " has not constant decompression parameters";
+            res->blobs["decompression_scale"] = InferenceEngine::details::shareWeights(scaleNode);
+            res->blobs["decompression_zero_point"] = InferenceEngine::details::shareWeights(zeroPointNode);
+        }
         return res;
     });
 
@@ -22,9 +22,25 @@ op::FullyConnected::FullyConnected(
     constructor_validate_and_infer_types();
 }
 
+op::FullyConnected::FullyConnected(
+    const Output<Node>& A,
+    const Output<Node>& B,
+    const Output<Node>& C,
+    const Output<Node>& scale,
+    const Output<Node>& zero_point,
+    const Shape & output_shape,
+    const element::Type output_type)
+    : Op({A, B, C, scale, zero_point}), m_output_shape(output_shape), m_output_type(output_type) {
+    constructor_validate_and_infer_types();
+}
+
 shared_ptr<Node> op::FullyConnected::clone_with_new_inputs(const OutputVector& new_args) const {
     check_new_args_count(this, new_args);
-    return make_shared<FullyConnected>(new_args.at(0), new_args.at(1), new_args.at(2), m_output_shape);
+    if (new_args.size() == 5) {
+        return make_shared<FullyConnected>(new_args.at(0), new_args.at(1), new_args.at(2), new_args.at(3), new_args.at(4),
+                                           m_output_shape, m_output_type);
+    }
+    return make_shared<FullyConnected>(new_args.at(0), new_args.at(1), new_args.at(2), m_output_shape, m_output_type);
 }
 
 void op::FullyConnected::validate_and_infer_types() {
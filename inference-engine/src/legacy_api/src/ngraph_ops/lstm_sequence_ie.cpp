@@ -36,9 +36,9 @@ op::LSTMSequenceIE::LSTMSequenceIE(const Output<Node> &X,
 void op::LSTMSequenceIE::validate_and_infer_types() {
     for (const auto& input : inputs()) {
         if (input.get_partial_shape().rank().is_dynamic()) {
-            set_output_type(0, get_input_element_type(0), PartialShape::dynamic());
-            set_output_type(1, get_input_element_type(0), PartialShape::dynamic());
-            set_output_type(2, get_input_element_type(0), PartialShape::dynamic());
+            set_output_type(0, get_input_element_type(1), PartialShape::dynamic());
+            set_output_type(1, get_input_element_type(1), PartialShape::dynamic());
+            set_output_type(2, get_input_element_type(1), PartialShape::dynamic());
             return;
         }
     }
@@ -62,7 +62,8 @@ void op::LSTMSequenceIE::validate_and_infer_types() {
                      " input rank is not correct.");
     }
 
-    element::Type arg_type = get_input_element_type(0);
+    // outputs follow the hidden state type: the data input may be quantized
+    element::Type arg_type = get_input_element_type(1);
     PartialShape output_shape_0{PartialShape::dynamic(3)};
     PartialShape output_shape_1{PartialShape::dynamic(2)};
     if (get_input_partial_shape(0).is_static()) {
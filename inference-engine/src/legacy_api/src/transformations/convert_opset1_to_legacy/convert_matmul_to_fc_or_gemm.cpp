@@ -14,6 +14,7 @@
 #include <ngraph/opsets/opset1.hpp>
 #include <ngraph/rt_info.hpp>
 #include <ngraph/pattern/op/wrap_type.hpp>
+#include <ngraph/variant.hpp>
 
 #include <legacy/ngraph_ops/fully_connected.hpp>
 #include <transformations/utils/utils.hpp>
@@ -264,3 +265,203 @@ ngraph::pass::ConvertMatMulToGemm::ConvertMatMulToGemm() {
     auto m = std::make_shared<ngraph::pattern::Matcher>(matmul, "ConvertMatMulToGemm");
     this->register_matcher(m, callback);
 }
+
+namespace {
+
+// Gets per output channel values of a constant which is broadcasted to 2D weights with output channels on outAxis
+bool getPerChannelValues(const ngraph::Output<ngraph::Node>& output, const ngraph::Shape& weightsShape, const size_t outAxis,
+                         std::vector<float>& values) {
+    const auto constant = std::dynamic_pointer_cast<ngraph::opset1::Constant>(output.get_node_shared_ptr());
+    if (!constant) {
+        return false;
+    }
+
+    ngraph::Shape shape = constant->get_shape();
+    while (shape.size() > weightsShape.size()) {
+        if (shape.front() != 1) {
+            return false;
+        }
+        shape.erase(shape.begin());
+    }
+    shape.insert(shape.begin(), weightsShape.size() - shape.size(), 1);
+
+    const size_t channels = weightsShape[outAxis];
+    if ((shape[1 - outAxis] != 1) || ((shape[outAxis] != 1) && (shape[outAxis] != channels))) {
+        return false;
+    }
+
+    const auto data = constant->cast_vector<float>();
+    values.resize(channels);
+    for (size_t i = 0; i < channels; ++i) {
+        values[i] = data[shape[outAxis] == 1 ? 0 : i];
+    }
+    return true;
+}
+
+/*
+ * Matches weights decompression subgraph of MatMul:
+ *
+ *   Constant (u8/i8)
+ *      |
+ *   Convert   Constant
+ *       \      /
+ *   Subtract or Add (optional)   Constant
+ *              \                  /
+ *                    Multiply       Constant
+ *                       \           /
+ *                       Add (optional)
+ *
+ * Subtract is decomposed to Add and Add is moved after Multiply by common optimizations, so all forms are handled.
+ * Returns the Convert operation and per output channel decompression parameters: weights = (compressed - zero_point) * scale.
+ */
+std::shared_ptr<ngraph::opset1::Convert> getCompressedWeights(const std::shared_ptr<ngraph::opset1::MatMul>& matmul,
+                                                              std::vector<float>& scale,
+                                                              std::vector<float>& zero_point) {
+    using namespace ngraph;
+
+    // FullyConnected takes 2D or higher rank data and 2D weights
+    if (matmul->get_transpose_a() || matmul->get_input_shape(0).size() < 2 || matmul->get_input_shape(1).size() != 2) {
+        return nullptr;
+    }
+
+    const Shape weights_shape = matmul->get_input_shape(1);
+    const size_t out_axis = matmul->get_transpose_b() ? 0 : 1;
+    const auto single_consumer = [](const Output<Node>& output) {
+        return output.get_target_inputs().size() == 1;
+    };
+
+    Output<Node> current = matmul->input_value(1);
+    std::vector<float> shift;
+    if (is_type<opset1::Add>(current.get_node())) {
+        const auto add = current.get_node_shared_ptr();
+        if (!getPerChannelValues(add->input_value(1), weights_shape, out_axis, shift)) {
+            return nullptr;
+        }
+        current = add->input_value(0);
+    }
+
+    const auto multiply = as_type_ptr<opset1::Multiply>(current.get_node_shared_ptr());
+    if (!multiply || !single_consumer(current) ||
+        !getPerChannelValues(multiply->input_value(1), weights_shape, out_axis, scale)) {
+        return nullptr;
+    }
+    current = multiply->input_value(0);
+
+    zero_point.assign(scale.size(), 0.f);
+    const auto zero_point_node = current.get_node_shared_ptr();
+    if (is_type<opset1::Subtract>(zero_point_node) || is_type<opset1::Add>(zero_point_node)) {
+        std::vector<float> values;
+        if (!single_consumer(current) || !getPerChannelValues(zero_point_node->input_value(1), weights_shape, out_axis, values)) {
+            return nullptr;
+        }
+        const float sign = is_type<opset1::Subtract>(zero_point_node) ? 1.f : -1.f;
+        for (size_t i = 0; i < values.size(); ++i) {
+            zero_point[i] = sign * values[i];
+        }
+        current = zero_point_node->input_value(0);
+    }
+
+    const auto convert = as_type_ptr<opset1::Convert>(current.get_node_shared_ptr());
+    if (!convert || !single_consumer(current) ||
+        !is_type<opset1::Constant>(convert->get_input_node_ptr(0)) ||
+        (convert->get_input_element_type(0) != element::u8 && convert->get_input_element_type(0) != element::i8) ||
+        convert->get_input_shape(0) != weights_shape) {
+        return nullptr;
+    }
+
+    // shift after Multiply moves to zero point: (w - z) * s + b = (w - (z - b / s)) * s
+    for (size_t i = 0; i < shift.size(); ++i) {
+        if (scale[i] != 0.f) {
+            zero_point[i] -= shift[i] / scale[i];
+        } else if (shift[i] != 0.f) {
+            return nullptr;
+        }
+    }
+
+    return convert;
+}
+
+}  // namespace
+
+NGRAPH_RTTI_DEFINITION(ngraph::pass::DisableCompressedWeightsConstantFolding, "DisableCompressedWeightsConstantFolding", 0);
+
+ngraph::pass::DisableCompressedWeightsConstantFolding::DisableCompressedWeightsConstantFolding() {
+    auto matmul = pattern::wrap_type<opset1::MatMul>({pattern::any_input(pattern::has_static_shape()),
+                                                      pattern::any_input(pattern::has_static_shape())},
+                                                      pattern::has_static_shape());
+
+    ngraph::matcher_pass_callback callback = [this](pattern::Matcher& m) {
+        auto matmul = std::dynamic_pointer_cast<ngraph::opset1::MatMul>(m.get_match_root());
+        if (!matmul || transformation_callback(matmul)) {
+            return false;
+        }
+
+        std::vector<float> scale, zero_point;
+        const auto convert = getCompressedWeights(matmul, scale, zero_point);
+        if (!convert || convert->get_rt_info().count("DISABLED_CONSTANT_FOLDING")) {
+            return false;
+        }
+
+        convert->get_rt_info()["DISABLED_CONSTANT_FOLDING"] = std::make_shared<VariantWrapper<std::string>>("");
+        return true;
+    };
+
+    auto m = std::make_shared<ngraph::pattern::Matcher>(matmul, "DisableCompressedWeightsConstantFolding");
+    this->register_matcher(m, callback);
+}
+
+NGRAPH_RTTI_DEFINITION(ngraph::pass::ConvertMatMulWithCompressedWeightsToFC, "ConvertMatMulWithCompressedWeightsToFC", 0);
+
+ngraph::pass::ConvertMatMulWithCompressedWeightsToFC::ConvertMatMulWithCompressedWeightsToFC() {
+    auto matmul = pattern::wrap_type<opset1::MatMul>({pattern::any_input(pattern::has_static_shape()),
+                                                      pattern::any_input(pattern::has_static_shape())},
+                                                      pattern::has_static_shape());
+
+    ngraph::matcher_pass_callback callback = [this](pattern::Matcher& m) {
+        auto matmul = std::dynamic_pointer_cast<ngraph::opset1::MatMul>(m.get_match_root());
+        if (!matmul || transformation_callback(matmul)) {
+            return false;
+        }
+
+        std::vector<float> scale, zero_point;
+        const auto convert = getCompressedWeights(matmul, scale, zero_point);
+        if (!convert) {
+            return false;
+        }
+
+        NodeVector new_ops;
+        auto weights = std::dynamic_pointer_cast<opset1::Constant>(convert->get_input_node_shared_ptr(0));
+        const size_t O = scale.size();
+        const size_t K = shape_size(weights->get_shape()) / O;
+
+        // Transferring from MatMul representation [K, O] to FullyConnected representation [O, K]
+        if (!matmul->get_transpose_b()) {
+            const auto src = static_cast<const uint8_t*>(weights->get_data_ptr());
+            std::vector<uint8_t> transposed(O * K);
+            for (size_t k = 0; k < K; ++k) {
+                for (size_t o = 0; o < O; ++o) {
+                    transposed[o * K + k] = src[k * O + o];
+                }
+            }
+            weights = std::make_shared<opset1::Constant>(weights->get_element_type(), Shape{O, K}, transposed.data());
+            new_ops.push_back(weights);
+        }
+
+        const auto output_type = matmul->get_output_element_type(0);
+        auto fc_bias = opset1::Constant::create(output_type, Shape{O}, std::vector<float>(O, 0.f));
+        auto fc_scale = opset1::Constant::create(element::f32, Shape{O}, scale);
+        auto fc_zero_point = opset1::Constant::create(element::f32, Shape{O}, zero_point);
+
+        auto fc = std::make_shared<op::FullyConnected>(matmul->input_value(0), weights, fc_bias, fc_scale, fc_zero_point,
+                                                       matmul->get_shape(), output_type);
+        fc->set_friendly_name(matmul->get_friendly_name());
+
+        new_ops.insert(new_ops.end(), {fc_bias, fc_scale, fc_zero_point, fc});
+        ngraph::copy_runtime_info(matmul, new_ops);
+        ngraph::replace_node(matmul, fc);
+        return true;
+    };
+
+    auto m = std::make_shared<ngraph::pattern::Matcher>(matmul, "ConvertMatMulWithCompressedWeightsToFC");
+    this->register_matcher(m, callback);
+}
@@ -73,6 +73,7 @@ bool ngraph::pass::ConvertOpSet1ToLegacy::run_on_function(std::shared_ptr<ngraph
     decomp->set_name("ngraph::pass::LegacyDecompositions");
 
     auto convert_matmul = manager.register_pass<ngraph::pass::GraphRewrite>();
+    convert_matmul->add_matcher<ngraph::pass::ConvertMatMulWithCompressedWeightsToFC, false>();
     convert_matmul->add_matcher<ngraph::pass::ConvertMatMulToFC>();
     convert_matmul->add_matcher<ngraph::pass::PullTransposeThroughFQUp>();
     convert_matmul->add_matcher<ngraph::pass::ConvertMatMulToGemm>();
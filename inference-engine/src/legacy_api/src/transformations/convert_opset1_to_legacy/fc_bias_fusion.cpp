@@ -57,11 +57,10 @@ ngraph::pass::FullyConnectedBiasFusion::FullyConnectedBiasFusion() {
             new_ops.push_back(final_bias);
         }
 
-        auto new_fc = std::make_shared<op::FullyConnected>(fc->input(0).get_source_output(),
-                                                           fc->input(1).get_source_output(),
-                                                           final_bias,
-                                                           fc->get_shape(),
-                                                           fc->get_output_type());
+        // decompression inputs of FullyConnected with compressed weights are kept as is
+        OutputVector new_inputs = fc->input_values();
+        new_inputs[2] = final_bias;
+        auto new_fc = fc->clone_with_new_inputs(new_inputs);
         new_ops.push_back(new_fc);
 
         new_fc->set_friendly_name(add->get_friendly_name());
@@ -0,0 +1,32 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <string>
+#include "layer_transformation.hpp"
+
+namespace ngraph {
+namespace pass {
+namespace low_precision {
+
+// Moves per-tensor dequantization of LSTMSequence data input into the runtime info of the operation: the data
+// input becomes low precision, the quantization parameters are stored as string attributes
+// (u8 = f32 * scale + shift) and FakeQuantize operations on weights are folded to be requantized by a plugin.
+// GRUSequence and RNNSequence are not handled, as plugins execute them in floating point precision only.
+class TRANSFORMATIONS_API RecurrentCellTransformation : public LayerTransformation {
+public:
+    RecurrentCellTransformation(const Params& params) : LayerTransformation(params) {}
+    void registerMatcherIn(GraphRewrite& pass, TransformationContext& context) const override;
+    bool transform(TransformationContext &context, ngraph::pattern::Matcher &m) const override;
+    bool canBeTransformed(const TransformationContext& context, std::shared_ptr<Node> layer) const override;
+    bool isPrecisionPreserved(std::shared_ptr<Node> layer) const noexcept override;
+
+    static const std::string dataScaleAttribute;
+    static const std::string dataShiftAttribute;
+};
+
+}  // namespace low_precision
+}  // namespace pass
+}  // namespace ngraph
@@ -0,0 +1,163 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "low_precision/recurrent_cell.hpp"
+
+#include <algorithm>
+#include <iomanip>
+#include <limits>
+#include <memory>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include <ngraph/opsets/opset5.hpp>
+#include <ngraph/variant.hpp>
+#include "low_precision/network_helper.hpp"
+
+using namespace ngraph;
+using namespace ngraph::pass;
+using namespace ngraph::pass::low_precision;
+
+const std::string RecurrentCellTransformation::dataScaleAttribute = "rnn_data_scale";
+const std::string RecurrentCellTransformation::dataShiftAttribute = "rnn_data_shift";
+
+namespace recurrent_cell {
+
+// W, R and B inputs of LSTMSequence follow data, hidden state, cell state and sequence lengths inputs
+constexpr size_t weightsIndex = 4ul;
+
+// returns dequantization scale and zero point: f32 = (u8 - shift) * scale
+void getDequantizationValues(const FakeQuantizeDequantization& dequantization, float& scale, float& shift) {
+    scale = dequantization.multiplyConstant->cast_vector<float>()[0];
+    shift = dequantization.subtract == nullptr ? 0.f : dequantization.subtractConstant->cast_vector<float>()[0];
+}
+
+std::shared_ptr<Node> createRelaxedSequence(const std::shared_ptr<Node>& sequence, const Output<Node>& data, const element::Type& precision) {
+    OutputVector inputs = sequence->input_values();
+    inputs[0] = data;
+
+    // the original operation requires equal input types, so it is created with the data input temporary set to f32
+    const ngraph::op::TemporaryReplaceOutputType temporaryData(data, precision);
+    const auto copyNode = as_type_ptr<opset5::LSTMSequence>(sequence->clone_with_new_inputs(inputs));
+    return std::make_shared<ngraph::op::TypeRelaxed<opset5::LSTMSequence>>(
+        *copyNode,
+        element::TypeVector{ precision },
+        element::TypeVector(copyNode->get_output_size(), precision));
+}
+
+bool foldWeights(const std::shared_ptr<Node>& sequence) {
+    bool folded = false;
+    for (size_t i = weightsIndex; i < weightsIndex + 3ul; ++i) {
+        const auto parent = sequence->get_input_node_shared_ptr(i);
+        if (is_type<opset1::Constant>(parent) || !NetworkHelper::isConstantPath(parent)) {
+            continue;
+        }
+
+        const auto fakeQuantize = as_type_ptr<opset1::FakeQuantize>(parent);
+        if (fakeQuantize != nullptr) {
+            const std::shared_ptr<Node> resultConstant = NetworkHelper::fold_fake_quantize(fakeQuantize);
+            if (is_type<opset1::Constant>(resultConstant)) {
+                replace_node(fakeQuantize, resultConstant);
+                folded = true;
+            }
+        } else {
+            NetworkHelper::foldDequantization(sequence, i);
+            folded = folded || is_type<opset1::Constant>(sequence->get_input_node_ptr(i));
+        }
+    }
+    return folded;
+}
+
+std::string toString(const float value) {
+    std::ostringstream stream;
+    stream << std::setprecision(std::numeric_limits<float>::max_digits10) << value;
+    return stream.str();
+}
+
+} // namespace recurrent_cell
+
+// Only LSTM sequences are matched: plugins execute GRU and RNN sequences in floating point precision only,
+// so quantized data must stay dequantized for them.
+void RecurrentCellTransformation::registerMatcherIn(GraphRewrite& pass, TransformationContext& context) const {
+    addSingleNodePattern<opset5::LSTMSequence>(pass, context);
+}
+
+bool RecurrentCellTransformation::canBeTransformed(const TransformationContext& context, std::shared_ptr<Node> layer) const {
+    if (!is_type<opset5::LSTMSequence>(layer)) {
+        return false;
+    }
+
+    if (!LayerTransformation::canBeTransformed(context, layer)) {
+        return false;
+    }
+
+    if (!updatePrecisions) {
+        return false;
+    }
+
+    const FakeQuantizeDequantization dequantization = NetworkHelper::getDequantization(layer);
+    if (dequantization.empty() || (dequantization.multiply == nullptr)) {
+        return false;
+    }
+
+    // quantization parameters of a recurrent primitive are per tensor
+    if (!NetworkHelper::isScalarLike(dequantization.multiplyConstant) ||
+        ((dequantization.subtract != nullptr) && !NetworkHelper::isScalarLike(dequantization.subtractConstant))) {
+        return false;
+    }
+
+    if (dequantization.data.get_element_type() != element::u8) {
+        return false;
+    }
+
+    if (!canSubtractBeHandled(layer, dequantization)) {
+        return false;
+    }
+
+    for (size_t i = recurrent_cell::weightsIndex; i < recurrent_cell::weightsIndex + 3ul; ++i) {
+        if (!NetworkHelper::isConstantPath(layer->get_input_node_shared_ptr(i))) {
+            return false;
+        }
+    }
+
+    // Hidden state is quantized with the data quantization parameters on each iteration, so the quantization
+    // interval has to cover the hidden state values range [-1, 1] produced by sigmoid and tanh activations.
+    float scale, shift;
+    recurrent_cell::getDequantizationValues(dequantization, scale, shift);
+    const float low = (0.f - shift) * scale;
+    const float high = (255.f - shift) * scale;
+    return (std::min(low, high) <= -1.f) && (std::max(low, high) >= 1.f);
+}
+
+bool RecurrentCellTransformation::transform(TransformationContext& context, ngraph::pattern::Matcher &m) const {
+    std::shared_ptr<Node> sequence = m.get_match_root();
+
+    // weights are folded even if the data input is not handled: FakeQuantize decomposition keeps them
+    // for the operation, but a plugin expects constant floating point weights to requantize them per output channel
+    const bool weightsFolded = recurrent_cell::foldWeights(sequence);
+    if (!canBeTransformed(context, sequence)) {
+        return weightsFolded;
+    }
+
+    const FakeQuantizeDequantization dequantization = NetworkHelper::getDequantization(sequence);
+    float scale, shift;
+    recurrent_cell::getDequantizationValues(dequantization, scale, shift);
+
+    const std::shared_ptr<Node> newSequence = recurrent_cell::createRelaxedSequence(
+        sequence, dequantization.data, deqPrecision);
+    NetworkHelper::copyInfo(sequence, newSequence);
+
+    // dequantization: f32 = (u8 - shift) * scale, quantization: u8 = f32 * (1 / scale) + shift
+    auto& rtInfo = newSequence->get_rt_info();
+    rtInfo[dataScaleAttribute] = std::make_shared<VariantWrapper<std::string>>(recurrent_cell::toString(1.f / scale));
+    rtInfo[dataShiftAttribute] = std::make_shared<VariantWrapper<std::string>>(recurrent_cell::toString(shift));
+
+    replace_node(sequence, newSequence);
+    return true;
+}
+
+bool RecurrentCellTransformation::isPrecisionPreserved(std::shared_ptr<Node> layer) const noexcept {
+    return false;
+}
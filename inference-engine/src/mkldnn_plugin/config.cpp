@@ -9,6 +9,7 @@
 #include <algorithm>
 
 #include "ie_plugin_config.hpp"
+#include "cpu/cpu_config.hpp"
 #include "ie_common.h"
 #include "ie_parallel.hpp"
 #include "ie_system_conf.h"
@@ -89,6 +90,13 @@ void Config::readProperties(const std::map<std::string, std::string> &prop) {
                 lpTransformsMode = LPTransformsMode::On;
             else
                 THROW_IE_EXCEPTION << "Wrong value for property key " << PluginConfigInternalParams::KEY_LP_TRANSFORMS_MODE;
+        } else if (key.compare(PluginConfigInternalParams::KEY_SNIPPETS_MODE) == 0) {
+            if (val == PluginConfigParams::NO)
+                enableSnippets = false;
+            else if (val == PluginConfigParams::YES)
+                enableSnippets = true;
+            else
+                THROW_IE_EXCEPTION << "Wrong value for property key " << PluginConfigInternalParams::KEY_SNIPPETS_MODE;
         } else if (key.compare(PluginConfigParams::KEY_DUMP_QUANTIZED_GRAPH_AS_DOT) == 0) {
             dumpQuantizedGraphToDot = val;
         } else if (key.compare(PluginConfigParams::KEY_DUMP_QUANTIZED_GRAPH_AS_IR) == 0) {
@@ -105,6 +113,20 @@ void Config::readProperties(const std::map<std::string, std::string> &prop) {
                 THROW_IE_EXCEPTION << "Wrong value for property key " << PluginConfigParams::KEY_ENFORCE_BF16
                     << ". Expected only YES/NO";
             }
+        } else if (key == CPUConfigParams::KEY_CPU_INTER_OP_PARALLELISM) {
+            if (val == PluginConfigParams::YES) interOpParallelism = true;
+            else if (val == PluginConfigParams::NO) interOpParallelism = false;
+            else
+                THROW_IE_EXCEPTION << "Wrong value for property key " << CPUConfigParams::KEY_CPU_INTER_OP_PARALLELISM
+                                   << ". Expected only YES/NO";
+        } else if (key == CPUConfigParams::KEY_CPU_MEMORY_REUSE_STRATEGY) {
+            if (val == CPUConfigParams::CPU_FIRST_FIT) memoryReuseStrategy = MemorySolver::Strategy::FirstFit;
+            else if (val == CPUConfigParams::CPU_BEST_FIT) memoryReuseStrategy = MemorySolver::Strategy::BestFit;
+            else if (val == CPUConfigParams::CPU_AUTO) memoryReuseStrategy = MemorySolver::Strategy::Auto;
+            else
+                THROW_IE_EXCEPTION << "Wrong value for property key " << CPUConfigParams::KEY_CPU_MEMORY_REUSE_STRATEGY
+                                   << ". Expected only " << CPUConfigParams::CPU_FIRST_FIT << "/" << CPUConfigParams::CPU_BEST_FIT
+                                   << "/" << CPUConfigParams::CPU_AUTO;
         } else {
             THROW_IE_EXCEPTION << NOT_FOUND_str << "Unsupported property " << key << " by CPU plugin";
         }
@@ -149,6 +171,20 @@ void Config::updateProperties() {
             _config.insert({ PluginConfigParams::KEY_ENFORCE_BF16, PluginConfigParams::YES });
         else
             _config.insert({ PluginConfigParams::KEY_ENFORCE_BF16, PluginConfigParams::NO });
+        if (interOpParallelism)
+            _config.insert({ CPUConfigParams::KEY_CPU_INTER_OP_PARALLELISM, PluginConfigParams::YES });
+        else
+            _config.insert({ CPUConfigParams::KEY_CPU_INTER_OP_PARALLELISM, PluginConfigParams::NO });
+        switch (memoryReuseStrategy) {
+            case MemorySolver::Strategy::BestFit:
+                _config.insert({ CPUConfigParams::KEY_CPU_MEMORY_REUSE_STRATEGY, CPUConfigParams::CPU_BEST_FIT });
+                break;
+            case MemorySolver::Strategy::Auto:
+                _config.insert({ CPUConfigParams::KEY_CPU_MEMORY_REUSE_STRATEGY, CPUConfigParams::CPU_AUTO });
+                break;
+            default:
+                _config.insert({ CPUConfigParams::KEY_CPU_MEMORY_REUSE_STRATEGY, CPUConfigParams::CPU_FIRST_FIT });
+        }
     }
 }
 
@@ -7,6 +7,7 @@
 #include <string>
 #include <map>
 #include <threading/ie_istreams_executor.hpp>
+#include "mkldnn_memory_solver.hpp"
 
 namespace MKLDNNPlugin {
 
@@ -21,10 +22,13 @@ struct Config {
     bool collectPerfCounters = false;
     bool exclusiveAsyncRequests = false;
     bool enableDynamicBatch = false;
+    bool interOpParallelism = false;
+    bool enableSnippets = false;
     std::string dumpToDot = "";
     std::string dumpQuantizedGraphToDot = "";
     std::string dumpQuantizedGraphToIr = "";
     int batchLimit = 0;
+    MemorySolver::Strategy memoryReuseStrategy = MemorySolver::Strategy::FirstFit;
     InferenceEngine::IStreamsExecutor::Config streamExecutorConfig;
 
 #if defined(__arm__) || defined(__aarch64__)
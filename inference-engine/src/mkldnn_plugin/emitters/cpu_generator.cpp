@@ -0,0 +1,236 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "cpu_generator.hpp"
+
+#include <ngraph/opsets/opset1.hpp>
+#include <ngraph/pass/manager.hpp>
+#include <snippets/snippets_isa.hpp>
+#include <snippets/pass/vector_to_scalar.hpp>
+
+#include "jit_eltwise_emitters.hpp"
+#include "jit_mkldnn_emitters.hpp"
+#include "jit_snippets_emitters.hpp"
+
+#include <utility>
+#include <vector>
+
+using namespace mkldnn::impl::cpu::x64;
+using namespace Xbyak;
+
+#define GET_OFF(field) offsetof(jit_snippets_call_args, field)
+
+#define CREATE_EMITTER(e_type) [this](const std::shared_ptr<ngraph::Node>& n) \
+    -> std::shared_ptr<ngraph::snippets::Emitter> { return std::make_shared<e_type>(h, isa, n); }
+
+namespace MKLDNNPlugin {
+
+CPUTargetMachine::CPUTargetMachine(jit_generator* h, cpu_isa_t isa) : h(h), isa(isa) {}
+
+auto CPUTargetMachine::getJitters() -> std::map<const ngraph::DiscreteTypeInfo,
+                                                std::function<std::shared_ptr<ngraph::snippets::Emitter>(std::shared_ptr<ngraph::Node>)>> {
+    return {
+        // data movement
+        {ngraph::opset1::Parameter::type_info, CREATE_EMITTER(NopEmitter)},
+        {ngraph::opset1::Result::type_info, CREATE_EMITTER(NopEmitter)},
+        {ngraph::snippets::op::Nop::type_info, CREATE_EMITTER(NopEmitter)},
+        {ngraph::snippets::op::Scalar::type_info, CREATE_EMITTER(ScalarEmitter)},
+        {ngraph::snippets::op::BroadcastMove::type_info, CREATE_EMITTER(BroadcastMoveEmitter)},
+        {ngraph::snippets::op::Load::type_info, CREATE_EMITTER(LoadEmitter)},
+        {ngraph::snippets::op::ScalarLoad::type_info, CREATE_EMITTER(LoadEmitter)},
+        {ngraph::snippets::op::BroadcastLoad::type_info, CREATE_EMITTER(BroadcastLoadEmitter)},
+        {ngraph::snippets::op::Store::type_info, CREATE_EMITTER(StoreEmitter)},
+        {ngraph::snippets::op::ScalarStore::type_info, CREATE_EMITTER(StoreEmitter)},
+
+        // binary
+        {ngraph::opset1::Add::type_info, CREATE_EMITTER(jit_add_emitter)},
+        {ngraph::opset1::Divide::type_info, CREATE_EMITTER(jit_divide_emitter)},
+        {ngraph::opset1::Equal::type_info, CREATE_EMITTER(jit_equal_emitter)},
+        {ngraph::opset1::FloorMod::type_info, CREATE_EMITTER(jit_floor_mod_emitter)},
+        {ngraph::opset1::Greater::type_info, CREATE_EMITTER(jit_greater_emitter)},
+        {ngraph::opset1::GreaterEqual::type_info, CREATE_EMITTER(jit_greater_equal_emitter)},
+        {ngraph::opset1::Less::type_info, CREATE_EMITTER(jit_less_emitter)},
+        {ngraph::opset1::LessEqual::type_info, CREATE_EMITTER(jit_less_equal_emitter)},
+        {ngraph::opset1::LogicalAnd::type_info, CREATE_EMITTER(jit_logical_and_emitter)},
+        {ngraph::opset1::LogicalOr::type_info, CREATE_EMITTER(jit_logical_or_emitter)},
+        {ngraph::opset1::LogicalXor::type_info, CREATE_EMITTER(jit_logical_xor_emitter)},
+        {ngraph::opset1::Maximum::type_info, CREATE_EMITTER(jit_maximum_emitter)},
+        {ngraph::opset1::Minimum::type_info, CREATE_EMITTER(jit_minimum_emitter)},
+        {ngraph::opset1::Mod::type_info, CREATE_EMITTER(jit_mod_emitter)},
+        {ngraph::opset1::Multiply::type_info, CREATE_EMITTER(jit_multiply_emitter)},
+        {ngraph::opset1::NotEqual::type_info, CREATE_EMITTER(jit_not_equal_emitter)},
+        {ngraph::snippets::op::PowerStatic::type_info, CREATE_EMITTER(jit_power_static_emitter)},
+        {ngraph::opset1::Power::type_info, CREATE_EMITTER(jit_power_dynamic_emitter)},
+        {ngraph::opset1::PRelu::type_info, CREATE_EMITTER(jit_prelu_emitter)},
+        {ngraph::opset1::SquaredDifference::type_info, CREATE_EMITTER(jit_squared_difference_emitter)},
+        {ngraph::opset1::Subtract::type_info, CREATE_EMITTER(jit_subtract_emitter)},
+
+        // unary
+        {ngraph::opset1::Abs::type_info, CREATE_EMITTER(jit_abs_emitter)},
+        {ngraph::opset1::Clamp::type_info, CREATE_EMITTER(jit_clamp_emitter)},
+        {ngraph::opset1::Elu::type_info, CREATE_EMITTER(jit_elu_emitter)},
+        {ngraph::opset1::Exp::type_info, CREATE_EMITTER(jit_exp_emitter)},
+        {ngraph::opset1::LogicalNot::type_info, CREATE_EMITTER(jit_logical_not_emitter)},
+        {ngraph::opset1::Negative::type_info, CREATE_EMITTER(jit_negative_emitter)},
+        {ngraph::opset1::Relu::type_info, CREATE_EMITTER(jit_relu_emitter)},
+        {ngraph::opset1::Sigmoid::type_info, CREATE_EMITTER(jit_sigmoid_emitter)},
+        {ngraph::opset1::Sqrt::type_info, CREATE_EMITTER(jit_sqrt_emitter)},
+        {ngraph::opset1::Tanh::type_info, CREATE_EMITTER(jit_tanh_emitter)},
+    };
+}
+
+// Convolutions and fully connected layers (MatMul with constant weights) take the following element-wise
+// operations as post ops during the legacy graph optimization
+static bool isFusableLayer(const std::shared_ptr<const ngraph::Node>& node) {
+    if (ngraph::is_type<ngraph::opset1::Convolution>(node) || ngraph::is_type<ngraph::opset1::GroupConvolution>(node) ||
+        ngraph::is_type<ngraph::opset1::ConvolutionBackpropData>(node))
+        return true;
+    return ngraph::is_type<ngraph::opset1::MatMul>(node) &&
+           ngraph::is_type<ngraph::opset1::Constant>(node->get_input_node_shared_ptr(1));
+}
+
+// Checks if the operation ends a chain of element-wise operations that starts from a fusable layer,
+// a snippet would take the operation from the layer and prevent the fusing
+static bool isFusedToLayer(const std::shared_ptr<const ngraph::Node>& node,
+                           const std::map<const ngraph::DiscreteTypeInfo,
+                                          std::function<std::shared_ptr<ngraph::snippets::Emitter>(std::shared_ptr<ngraph::Node>)>>& jitters) {
+    for (const auto& input : node->inputs()) {
+        const auto& source = input.get_source_output();
+        if (source.get_target_inputs().size() != 1)
+            continue;
+        const auto parent = source.get_node_shared_ptr();
+        if (isFusableLayer(parent))
+            return true;
+        if (jitters.count(parent->get_type_info()) && isFusedToLayer(parent, jitters))
+            return true;
+    }
+    return false;
+}
+
+bool CPUTargetMachine::isSupported(const std::shared_ptr<const ngraph::Node>& node) {
+    // only operation types are of interest here, emitters are never created from this table
+    static const auto jitters = CPUTargetMachine(nullptr, cpu_isa_t::isa_any).getJitters();
+    if (!jitters.count(node->get_type_info()))
+        return false;
+
+    // Subgraph node executes snippets in FP32 only
+    for (const auto& input : node->inputs()) {
+        if (input.get_partial_shape().is_dynamic() || input.get_element_type() != ngraph::element::f32)
+            return false;
+    }
+    for (const auto& output : node->outputs()) {
+        if (output.get_element_type() != ngraph::element::f32)
+            return false;
+    }
+
+    // tokenization runs before the legacy fusing, so post ops of convolutions are left to it
+    if (isFusedToLayer(node, jitters))
+        return false;
+
+    // slope is broadcasted along channels axis, that doesn't fit numpy broadcasting of snippets
+    if (ngraph::is_type<ngraph::opset1::PRelu>(node)) {
+        const auto& slope_shape = node->get_input_shape(1);
+        return ngraph::shape_size(slope_shape) == 1 || slope_shape == node->get_input_shape(0);
+    }
+
+    return true;
+}
+
+CPUGenerator::CPUGenerator(cpu_isa_t isa) : h(new jit_snippet()), isa(isa) {
+    jitters = CPUTargetMachine(h.get(), isa).getJitters();
+}
+
+ngraph::snippets::code CPUGenerator::generate(std::shared_ptr<ngraph::Function>& f) const {
+    const auto& params = f->get_parameters();
+    const auto& results = f->get_results();
+    if (params.size() + results.size() > SNIPPETS_MAX_IO_COUNT)
+        THROW_IE_EXCEPTION << "Snippet " << f->get_friendly_name() << " has too many inputs and outputs";
+
+    // all outputs have the shape of work domain, inputs with broadcasted innermost dimension aren't advanced
+    const size_t work_inner_dim = results[0]->get_input_shape(0).back();
+    std::vector<bool> is_advanced;
+    for (const auto& param : params)
+        is_advanced.push_back(param->get_shape().back() == work_inner_dim);
+    is_advanced.insert(is_advanced.end(), results.size(), true);
+
+    using lowered_tile = std::vector<std::pair<std::shared_ptr<ngraph::snippets::Emitter>, ngraph::snippets::RegInfo>>;
+    auto lower = [this](const std::shared_ptr<ngraph::Function>& tile) {
+        lowered_tile lowered;
+        for (auto n : tile->get_ordered_ops()) {
+            auto jitter = jitters.find(n->get_type_info());
+            if (jitter == jitters.end())
+                THROW_IE_EXCEPTION << "Snippet operation " << n->get_type_name() << " is not supported by CPU code generator";
+            lowered.emplace_back(jitter->second(n), ngraph::snippets::getRegisters(n));
+        }
+        return lowered;
+    };
+
+    // tail is processed by the same body operating on scalars
+    auto scalar_f = ngraph::clone_function(*f);
+    ngraph::pass::Manager m;
+    m.register_pass<ngraph::snippets::pass::ReplaceLoadsWithScalarLoads>();
+    m.register_pass<ngraph::snippets::pass::ReplaceStoresWithScalarStores>();
+    m.run_passes(scalar_f);
+
+    auto vector_tile = lower(f);
+    auto scalar_tile = lower(scalar_f);
+
+    const size_t vlen = isa == avx512_common ? cpu_isa_traits<avx512_common>::vlen :
+                        isa == avx2 ? cpu_isa_traits<avx2>::vlen : cpu_isa_traits<sse41>::vlen;
+    const size_t lanes = vlen / sizeof(float);
+
+    Reg64 reg_params = abi_param1;
+    Reg64 reg_work_amount = h->rbx;
+
+    h->preamble();
+
+    for (size_t i = 0; i < is_advanced.size(); i++)
+        h->mov(Reg64(8 + i), h->ptr[reg_params + GET_OFF(ptrs) + i * sizeof(void*)]);
+    h->mov(reg_work_amount, h->ptr[reg_params + GET_OFF(work_amount)]);
+
+    auto emit_tile = [&](const lowered_tile& tile, size_t step) {
+        for (const auto& op : tile)
+            op.first->emit_code(op.second.first, op.second.second);
+        for (size_t i = 0; i < is_advanced.size(); i++) {
+            if (is_advanced[i])
+                h->add(Reg64(8 + i), step * sizeof(float));
+        }
+        h->sub(reg_work_amount, step);
+    };
+
+    Label vector_loop, tail_loop, exit;
+
+    h->L(vector_loop);
+    {
+        h->cmp(reg_work_amount, lanes);
+        h->jl(tail_loop, jit_generator::T_NEAR);
+
+        emit_tile(vector_tile, lanes);
+
+        h->jmp(vector_loop, jit_generator::T_NEAR);
+    }
+
+    h->L(tail_loop);
+    {
+        h->cmp(reg_work_amount, 1);
+        h->jl(exit, jit_generator::T_NEAR);
+
+        emit_tile(scalar_tile, 1);
+
+        h->jmp(tail_loop, jit_generator::T_NEAR);
+    }
+
+    h->L(exit);
+    h->postamble();
+
+    for (const auto& op : vector_tile)
+        op.first->emit_data();
+    for (const auto& op : scalar_tile)
+        op.first->emit_data();
+
+    h->create_kernel();
+    return h->jit_ker();
+}
+
+}  // namespace MKLDNNPlugin
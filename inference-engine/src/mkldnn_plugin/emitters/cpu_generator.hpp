@@ -0,0 +1,64 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <cpu/x64/jit_generator.hpp>
+#include "snippets/generator.hpp"
+
+#include <map>
+#include <memory>
+
+namespace MKLDNNPlugin {
+
+// Maximum number of inputs and outputs of a snippet, bounded by general purpose registers R8-R14 used as tensor pointers
+constexpr size_t SNIPPETS_MAX_IO_COUNT = 7;
+
+/**
+ * Arguments of a compiled snippet. Kernel processes work_amount elements of the innermost dimension,
+ * inputs are followed by outputs in ptrs. Tensors broadcasted over the innermost dimension are not advanced.
+ */
+struct jit_snippets_call_args {
+    const void* ptrs[SNIPPETS_MAX_IO_COUNT];
+    size_t work_amount;
+};
+
+struct jit_snippet : public mkldnn::impl::cpu::x64::jit_generator {
+    DECLARE_CPU_JIT_AUX_FUNCTIONS(jit_snippet)
+
+    jit_snippet() : jit_generator() {}
+
+    void generate() override {}
+};
+
+class CPUTargetMachine : public ngraph::snippets::TargetMachine {
+public:
+    CPUTargetMachine(mkldnn::impl::cpu::x64::jit_generator* h, mkldnn::impl::cpu::x64::cpu_isa_t isa);
+
+    auto getJitters() -> std::map<const ngraph::DiscreteTypeInfo,
+                                  std::function<std::shared_ptr<ngraph::snippets::Emitter>(std::shared_ptr<ngraph::Node>)>> override;
+
+    /**
+     * Checks if an operation can be tokenized into a snippet compiled by CPUGenerator
+     */
+    static bool isSupported(const std::shared_ptr<const ngraph::Node>& node);
+
+private:
+    mkldnn::impl::cpu::x64::jit_generator* h;
+    mkldnn::impl::cpu::x64::cpu_isa_t isa;
+};
+
+class CPUGenerator : public ngraph::snippets::Generator {
+public:
+    explicit CPUGenerator(mkldnn::impl::cpu::x64::cpu_isa_t isa);
+    ~CPUGenerator() override = default;
+
+    ngraph::snippets::code generate(std::shared_ptr<ngraph::Function>& f) const override;
+
+private:
+    std::unique_ptr<jit_snippet> h;
+    mkldnn::impl::cpu::x64::cpu_isa_t isa;
+};
+
+}  // namespace MKLDNNPlugin
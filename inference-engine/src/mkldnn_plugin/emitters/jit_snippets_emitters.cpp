@@ -0,0 +1,184 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "jit_snippets_emitters.hpp"
+
+#include <ngraph/opsets/opset1.hpp>
+#include <snippets/snippets_isa.hpp>
+
+#include <queue>
+#include <unordered_set>
+
+using namespace InferenceEngine;
+using namespace mkldnn::impl::utils;
+using namespace mkldnn::impl;
+using namespace mkldnn::impl::cpu::x64;
+using namespace Xbyak;
+
+namespace MKLDNNPlugin {
+
+namespace {
+
+size_t get_effective_address(const std::shared_ptr<ngraph::Node>& n) {
+    auto& rt = n->get_rt_info();
+    auto it = rt.find("effectiveAddress");
+    if (it == rt.end()) {
+        THROW_IE_EXCEPTION << "Snippet operation " << n->get_friendly_name() << " has no effective address assigned";
+    }
+    return static_cast<size_t>(ngraph::as_type_ptr<ngraph::VariantWrapper<int64_t>>(it->second)->get());
+}
+
+// Size of the innermost dimension of the work domain, which is a shape of any subgraph result
+size_t get_work_inner_dim(const std::shared_ptr<ngraph::Node>& n) {
+    std::queue<ngraph::Node*> q;
+    std::unordered_set<ngraph::Node*> visited;
+    q.push(n.get());
+    while (!q.empty()) {
+        auto node = q.front();
+        q.pop();
+        if (ngraph::is_type<ngraph::opset1::Result>(node)) {
+            return node->get_input_shape(0).back();
+        }
+        for (const auto& output : node->outputs()) {
+            for (const auto& consumer : output.get_target_inputs()) {
+                if (visited.insert(consumer.get_node()).second)
+                    q.push(consumer.get_node());
+            }
+        }
+    }
+    THROW_IE_EXCEPTION << "Snippet operation " << n->get_friendly_name() << " doesn't contribute to any result";
+}
+
+// Tensor with broadcasted innermost dimension is not advanced by a kernel and is loaded a single value at a time
+bool is_broadcasted_inner(const std::shared_ptr<ngraph::Node>& n) {
+    return n->get_input_shape(0).back() != get_work_inner_dim(n);
+}
+
+} // namespace
+
+/// SCALAR ///
+ScalarEmitter::ScalarEmitter(jit_generator* host, cpu_isa_t host_isa, const std::shared_ptr<ngraph::Node>& n)
+    : jit_emitter(host, host_isa, n) {
+    value = std::dynamic_pointer_cast<ngraph::op::Constant>(n)->cast_vector<float>()[0];
+    push_arg_entry_of("scalar", float2int(value), true);
+    prepare_table();
+}
+
+void ScalarEmitter::emit_impl(const std::vector<size_t>& in, const std::vector<size_t>& out,
+                              const std::vector<size_t>& pool, const std::vector<size_t>& gpr,
+                              const emitter_context *emit_context) const {
+    if (host_isa_ == cpu::x64::sse41) {
+        emit_isa<cpu::x64::sse41>(in, out);
+    } else if (host_isa_ == cpu::x64::avx2) {
+        emit_isa<cpu::x64::avx2>(in, out);
+    } else if (host_isa_ == cpu::x64::avx512_common) {
+        emit_isa<cpu::x64::avx512_common>(in, out);
+    } else {
+        assert(!"unsupported isa");
+    }
+}
+
+template <mkldnn::impl::cpu::x64::cpu_isa_t isa>
+void ScalarEmitter::emit_isa(const std::vector<size_t> &in, const std::vector<size_t> &out) const {
+    using Vmm = typename conditional3<isa == cpu::x64::sse41, Xmm, isa == cpu::x64::avx2, Ymm, Zmm>::type;
+    h->uni_vmovups(Vmm(out[0]), table_val("scalar"));
+}
+
+/// BROADCAST_MOVE ///
+BroadcastMoveEmitter::BroadcastMoveEmitter(jit_generator* host, cpu_isa_t host_isa, const std::shared_ptr<ngraph::Node>& n)
+    : jit_emitter(host, host_isa, n) {
+    broadcast_inner = n->get_input_shape(0).back() != n->get_output_shape(0).back();
+}
+
+void BroadcastMoveEmitter::emit_impl(const std::vector<size_t>& in, const std::vector<size_t>& out,
+                                     const std::vector<size_t>& pool, const std::vector<size_t>& gpr,
+                                     const emitter_context *emit_context) const {
+    if (host_isa_ == cpu::x64::sse41) {
+        emit_isa<cpu::x64::sse41>(in, out);
+    } else if (host_isa_ == cpu::x64::avx2) {
+        emit_isa<cpu::x64::avx2>(in, out);
+    } else if (host_isa_ == cpu::x64::avx512_common) {
+        emit_isa<cpu::x64::avx512_common>(in, out);
+    } else {
+        assert(!"unsupported isa");
+    }
+}
+
+template <mkldnn::impl::cpu::x64::cpu_isa_t isa>
+void BroadcastMoveEmitter::emit_isa(const std::vector<size_t> &in, const std::vector<size_t> &out) const {
+    using Vmm = typename conditional3<isa == cpu::x64::sse41, Xmm, isa == cpu::x64::avx2, Ymm, Zmm>::type;
+    Vmm vmm_src = Vmm(in[0]);
+    Vmm vmm_dst = Vmm(out[0]);
+
+    if (broadcast_inner) {
+        h->uni_vbroadcastss(vmm_dst, Xmm(in[0]));
+    } else if (in[0] != out[0]) {
+        h->uni_vmovups(vmm_dst, vmm_src);
+    }
+}
+
+/// BROADCAST_LOAD ///
+BroadcastLoadEmitter::BroadcastLoadEmitter(jit_generator* host, cpu_isa_t host_isa, const std::shared_ptr<ngraph::Node>& n)
+    : jit_emitter(host, host_isa, n, Precision::FP32, emitter_in_out_map::gpr_to_vec) {
+    ea = get_effective_address(n);
+}
+
+void BroadcastLoadEmitter::emit_code(const std::vector<size_t>& in, const std::vector<size_t>& out,
+                                     const std::vector<size_t>& pool, const std::vector<size_t>& gpr) const {
+    jit_emitter::emit_code({ea}, out, pool, gpr);
+}
+
+void BroadcastLoadEmitter::emit_impl(const std::vector<size_t>& in, const std::vector<size_t>& out,
+                                     const std::vector<size_t>& pool, const std::vector<size_t>& gpr,
+                                     const emitter_context *emit_context) const {
+    if (host_isa_ == cpu::x64::sse41) {
+        emit_isa<cpu::x64::sse41>(in, out);
+    } else if (host_isa_ == cpu::x64::avx2) {
+        emit_isa<cpu::x64::avx2>(in, out);
+    } else if (host_isa_ == cpu::x64::avx512_common) {
+        emit_isa<cpu::x64::avx512_common>(in, out);
+    } else {
+        assert(!"unsupported isa");
+    }
+}
+
+template <mkldnn::impl::cpu::x64::cpu_isa_t isa>
+void BroadcastLoadEmitter::emit_isa(const std::vector<size_t> &in, const std::vector<size_t> &out) const {
+    using Vmm = typename conditional3<isa == cpu::x64::sse41, Xmm, isa == cpu::x64::avx2, Ymm, Zmm>::type;
+    h->uni_vbroadcastss(Vmm(out[0]), h->ptr[Reg64(in[0])]);
+}
+
+/// LOAD ///
+LoadEmitter::LoadEmitter(jit_generator* host, cpu_isa_t host_isa, const std::shared_ptr<ngraph::Node>& n)
+    : jit_load_emitter(host, host_isa, nullptr) {
+    ea = get_effective_address(n);
+    const bool is_scalar = ngraph::is_type<ngraph::snippets::op::ScalarLoad>(n) || is_broadcasted_inner(n);
+    const int load_num = is_scalar ? 1 : static_cast<int>(get_vec_length() / sizeof(float));
+    context = load_emitter_context(Precision::FP32, Precision::FP32, load_num);
+}
+
+void LoadEmitter::emit_code(const std::vector<size_t>& in, const std::vector<size_t>& out,
+                            const std::vector<size_t>& pool, const std::vector<size_t>& gpr) const {
+    emitter_preamble({ea}, out, pool, gpr);
+    emit_impl({ea}, out, pool, gpr, &context);
+    emitter_postamble();
+}
+
+/// STORE ///
+StoreEmitter::StoreEmitter(jit_generator* host, cpu_isa_t host_isa, const std::shared_ptr<ngraph::Node>& n)
+    : jit_store_emitter(host, host_isa, nullptr) {
+    ea = get_effective_address(n);
+    const bool is_scalar = ngraph::is_type<ngraph::snippets::op::ScalarStore>(n);
+    const int store_num = is_scalar ? 1 : static_cast<int>(get_vec_length() / sizeof(float));
+    context = store_emitter_context(Precision::FP32, Precision::FP32, store_num);
+}
+
+void StoreEmitter::emit_code(const std::vector<size_t>& in, const std::vector<size_t>& out,
+                             const std::vector<size_t>& pool, const std::vector<size_t>& gpr) const {
+    emitter_preamble(in, {ea}, pool, gpr);
+    emit_impl(in, {ea}, pool, gpr, &context);
+    emitter_postamble();
+}
+
+} // namespace MKLDNNPlugin
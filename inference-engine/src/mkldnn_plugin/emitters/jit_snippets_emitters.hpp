@@ -0,0 +1,111 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <ngraph/rt_info.hpp>
+#include <ngraph/variant.hpp>
+
+#include "jit_emitter.hpp"
+#include "jit_load_store_emitters.hpp"
+
+namespace MKLDNNPlugin {
+
+/**
+ * Emitters for snippets dialect operations (see ngraph::snippets::op). Vector registers come from "reginfo" and
+ * general purpose registers holding tensor pointers from "effectiveAddress" runtime info set by AssignRegisters pass.
+ */
+class NopEmitter : public jit_emitter {
+public:
+    NopEmitter(mkldnn::impl::cpu::x64::jit_generator* host, mkldnn::impl::cpu::x64::cpu_isa_t host_isa, const std::shared_ptr<ngraph::Node>& n)
+        : jit_emitter(host, host_isa, n) {}
+
+    size_t get_inputs_num() const override { return 0; }
+
+private:
+    void emit_impl(const std::vector<size_t>& in, const std::vector<size_t>& out,
+                   const std::vector<size_t>& pool, const std::vector<size_t>& gpr,
+                   const emitter_context *emit_context) const override {}
+};
+
+class ScalarEmitter : public jit_emitter {
+public:
+    ScalarEmitter(mkldnn::impl::cpu::x64::jit_generator* host, mkldnn::impl::cpu::x64::cpu_isa_t host_isa, const std::shared_ptr<ngraph::Node>& n);
+
+    size_t get_inputs_num() const override { return 0; }
+
+private:
+    void emit_impl(const std::vector<size_t>& in, const std::vector<size_t>& out,
+                   const std::vector<size_t>& pool, const std::vector<size_t>& gpr,
+                   const emitter_context *emit_context) const override;
+
+    template <mkldnn::impl::cpu::x64::cpu_isa_t isa>
+    void emit_isa(const std::vector<size_t> &in, const std::vector<size_t> &out) const;
+
+    float value;
+};
+
+class BroadcastMoveEmitter : public jit_emitter {
+public:
+    BroadcastMoveEmitter(mkldnn::impl::cpu::x64::jit_generator* host, mkldnn::impl::cpu::x64::cpu_isa_t host_isa, const std::shared_ptr<ngraph::Node>& n);
+
+    size_t get_inputs_num() const override { return 1; }
+
+private:
+    void emit_impl(const std::vector<size_t>& in, const std::vector<size_t>& out,
+                   const std::vector<size_t>& pool, const std::vector<size_t>& gpr,
+                   const emitter_context *emit_context) const override;
+
+    template <mkldnn::impl::cpu::x64::cpu_isa_t isa>
+    void emit_isa(const std::vector<size_t> &in, const std::vector<size_t> &out) const;
+
+    // true if the innermost dimension is broadcasted, outer dimensions are handled by the caller
+    bool broadcast_inner;
+};
+
+class BroadcastLoadEmitter : public jit_emitter {
+public:
+    BroadcastLoadEmitter(mkldnn::impl::cpu::x64::jit_generator* host, mkldnn::impl::cpu::x64::cpu_isa_t host_isa, const std::shared_ptr<ngraph::Node>& n);
+
+    size_t get_inputs_num() const override { return 0; }
+
+    void emit_code(const std::vector<size_t>& in, const std::vector<size_t>& out,
+                   const std::vector<size_t>& pool = {}, const std::vector<size_t>& gpr = {}) const override;
+
+private:
+    void emit_impl(const std::vector<size_t>& in, const std::vector<size_t>& out,
+                   const std::vector<size_t>& pool, const std::vector<size_t>& gpr,
+                   const emitter_context *emit_context) const override;
+
+    template <mkldnn::impl::cpu::x64::cpu_isa_t isa>
+    void emit_isa(const std::vector<size_t> &in, const std::vector<size_t> &out) const;
+
+    size_t ea;
+};
+
+class LoadEmitter : public jit_load_emitter {
+public:
+    LoadEmitter(mkldnn::impl::cpu::x64::jit_generator* host, mkldnn::impl::cpu::x64::cpu_isa_t host_isa, const std::shared_ptr<ngraph::Node>& n);
+
+    void emit_code(const std::vector<size_t>& in, const std::vector<size_t>& out,
+                   const std::vector<size_t>& pool = {}, const std::vector<size_t>& gpr = {}) const override;
+
+private:
+    size_t ea;
+    load_emitter_context context;
+};
+
+class StoreEmitter : public jit_store_emitter {
+public:
+    StoreEmitter(mkldnn::impl::cpu::x64::jit_generator* host, mkldnn::impl::cpu::x64::cpu_isa_t host_isa, const std::shared_ptr<ngraph::Node>& n);
+
+    void emit_code(const std::vector<size_t>& in, const std::vector<size_t>& out,
+                   const std::vector<size_t>& pool = {}, const std::vector<size_t>& gpr = {}) const override;
+
+private:
+    size_t ea;
+    store_emitter_context context;
+};
+
+} // namespace MKLDNNPlugin
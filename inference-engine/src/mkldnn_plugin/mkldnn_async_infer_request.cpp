@@ -4,12 +4,26 @@
 
 #include "mkldnn_async_infer_request.h"
 #include <memory>
+#include <threading/ie_executor_manager.hpp>
+#include <threading/ie_immediate_executor.hpp>
 
 MKLDNNPlugin::MKLDNNAsyncInferRequest::MKLDNNAsyncInferRequest(const InferenceEngine::InferRequestInternal::Ptr& inferRequest,
                                                                const InferenceEngine::ITaskExecutor::Ptr& taskExecutor,
                                                                const InferenceEngine::ITaskExecutor::Ptr& callbackExecutor)
     : InferenceEngine::AsyncInferRequestThreadSafeDefault(inferRequest, taskExecutor, callbackExecutor) {
-    static_cast<MKLDNNInferRequest*>(inferRequest.get())->SetAsyncRequest(this);
+    auto mkldnnRequest = static_cast<MKLDNNInferRequest*>(inferRequest.get());
+    mkldnnRequest->SetAsyncRequest(this);
+    if (mkldnnRequest->HasDynamicInputs()) {
+        // Graphs for new shapes of dynamic inputs are compiled before the inference stage,
+        // so streams keep executing other requests meanwhile
+        auto prepareGraph = [mkldnnRequest] {
+            mkldnnRequest->PrepareGraph();
+        };
+        _pipeline.insert(_pipeline.begin(),
+                         Stage{InferenceEngine::ExecutorManager::getInstance()->getExecutor("CPUGraphCompilation"), prepareGraph});
+        _syncPipeline.insert(_syncPipeline.begin(),
+                             Stage{std::make_shared<InferenceEngine::ImmediateExecutor>(), prepareGraph});
+    }
 }
 
 MKLDNNPlugin::MKLDNNAsyncInferRequest::~MKLDNNAsyncInferRequest() {
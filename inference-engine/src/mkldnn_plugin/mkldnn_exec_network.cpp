@@ -3,7 +3,9 @@
 //
 
 #include <ie_metric_helpers.hpp>
+#include <cpu/cpu_config.hpp>
 #include <precision_utils.h>
+#include <debug.h>
 #include <legacy/net_pass.h>
 #include "mkldnn_exec_network.h"
 
@@ -11,10 +13,12 @@
 #include "mkldnn_infer_request.h"
 #include "mkldnn_memory_state.h"
 #include "mkldnn_itt.h"
+#include "mkldnn_serialize.h"
 #include "nodes/mkldnn_memory_node.hpp"
 #include <legacy/ie_util_internal.hpp>
 #include <legacy/graph_tools.hpp>
 #include <threading/ie_executor_manager.hpp>
+#include <cpp_interfaces/exception2status.hpp>
 
 #include <threading/ie_cpu_streams_executor.hpp>
 #include <ie_system_conf.h>
@@ -29,27 +33,9 @@ using namespace MKLDNNPlugin;
 using namespace InferenceEngine;
 using namespace InferenceEngine::details;
 
-InferenceEngine::InferRequestInternal::Ptr
-MKLDNNExecNetwork::CreateInferRequestImpl(InferenceEngine::InputsDataMap networkInputs,
-                                          InferenceEngine::OutputsDataMap networkOutputs) {
-    return std::make_shared<MKLDNNInferRequest>(networkInputs, networkOutputs, std::static_pointer_cast<MKLDNNExecNetwork>(shared_from_this()));
-}
-
-MKLDNNExecNetwork::MKLDNNExecNetwork(const InferenceEngine::CNNNetwork &network,
-                                     const Config &cfg,
-                                     const MKLDNNExtensionManager::Ptr& extMgr,
-                                     NumaNodesWeights &numaNodesWeights) :
-    InferenceEngine::ExecutableNetworkThreadSafeDefault{nullptr, nullptr},
-    extensionManager(extMgr),
-    _cfg{cfg},
-    _name{network.getName()},
-    _numaNodesWeights(numaNodesWeights) {
-    OV_ITT_TASK_CHAIN(taskChain, MKLDNNPlugin::itt::domains::MKLDNN_LT, "MKLDNNExecNetwork", "cloneNet");
-
-    // we are cloning network if we have statistics and we can transform network.
-    _clonedNetwork = cloneNetwork(network);
-
-    if (_cfg.lpTransformsMode == Config::LPTransformsMode::On) {
+// Adjusts precisions for BF16 execution and converts weights of legacy layers to constant inputs
+static void ConvertLegacyLayers(CNNNetwork& network, const Config& cfg) {
+    if (cfg.lpTransformsMode == Config::LPTransformsMode::On) {
         // Check if network is INT8 or Binary.
         // BF16 transformations were disabled since CPU plug-in doesn't support mixed precision execution:
         // BF16 + INT8 or BF16 + BIN.
@@ -64,9 +50,9 @@ MKLDNNExecNetwork::MKLDNNExecNetwork(const InferenceEngine::CNNNetwork &network,
         }
 
         auto changePrecisionBF16 = [&](Precision current, Precision target) {
-            InputsDataMap inputs = _clonedNetwork.getInputsInfo();
-            OutputsDataMap outputs = _clonedNetwork.getOutputsInfo();
-            CNNNetworkIterator iter(_clonedNetwork);
+            InputsDataMap inputs = network.getInputsInfo();
+            OutputsDataMap outputs = network.getOutputsInfo();
+            CNNNetworkIterator iter(network);
             while (iter != CNNNetworkIterator()) {
                 //  check, if memory output node needs to be transformed
                 if (current == Precision::FP32 &&
@@ -89,7 +75,7 @@ MKLDNNExecNetwork::MKLDNNExecNetwork(const InferenceEngine::CNNNetwork &network,
 
         if (with_cpu_x86_avx512_core() && isFloatModel) {
             // If enforceBF16 flag was set, BF16 transformation applies for all layers supported by CPU plugin.
-            // Otherwise, only layers marked as BF16 in '_clonedNetwork' will be performed in bfloat16 mode.
+            // Otherwise, only layers marked as BF16 in 'network' will be performed in bfloat16 mode.
             // CPU plugin throws an exception, if marked as BF16 layers have not supported by CPU plugin.
             if (cfg.enforceBF16 == true)
                 changePrecisionBF16(Precision::FP32, Precision::BF16);
@@ -98,7 +84,6 @@ MKLDNNExecNetwork::MKLDNNExecNetwork(const InferenceEngine::CNNNetwork &network,
         }
     }
 
-    OV_ITT_TASK_NEXT(taskChain, "createConstInputs");
     auto createConstInputTo = [&](CNNLayerPtr layer, Blob::Ptr blob, const std::vector<size_t>& shape, const std::string& name) {
         LayerParams attrs = {layer->name + "_const_" + name, "Const", blob->getTensorDesc().getPrecision()};
         auto constLayer = std::make_shared<InferenceEngine::CNNLayer>(attrs);
@@ -112,7 +97,7 @@ MKLDNNExecNetwork::MKLDNNExecNetwork(const InferenceEngine::CNNNetwork &network,
         getInputTo(newEdgeAfterLayer).clear();
 
         IE_SUPPRESS_DEPRECATED_START
-        auto icnnnet = static_cast<ICNNNetwork::Ptr>(_clonedNetwork);
+        auto icnnnet = static_cast<ICNNNetwork::Ptr>(network);
         IE_SUPPRESS_DEPRECATED_END
         auto implNetwork = std::dynamic_pointer_cast<details::CNNNetworkImpl>(icnnnet);
         IE_ASSERT(implNetwork != nullptr);
@@ -126,7 +111,7 @@ MKLDNNExecNetwork::MKLDNNExecNetwork(const InferenceEngine::CNNNetwork &network,
 
     // The code block below transforms legacy layers to the form more compatible with opset1 in order to simplify future migration
     // TODO: remove after plug-in is migrated on opset1
-    auto all_layers = details::CNNNetSortTopologically(_clonedNetwork);
+    auto all_layers = details::CNNNetSortTopologically(network);
     for (auto &layer : all_layers) {
         if (layer->type == "ScaleShift" && layer->insData.size() == 1) {
             auto constDimsRank = layer->insData[0].lock()->getDims().size();
@@ -215,6 +200,30 @@ MKLDNNExecNetwork::MKLDNNExecNetwork(const InferenceEngine::CNNNetwork &network,
             }
         }
     }
+}
+
+InferenceEngine::InferRequestInternal::Ptr
+MKLDNNExecNetwork::CreateInferRequestImpl(InferenceEngine::InputsDataMap networkInputs,
+                                          InferenceEngine::OutputsDataMap networkOutputs) {
+    return std::make_shared<MKLDNNInferRequest>(networkInputs, networkOutputs, std::static_pointer_cast<MKLDNNExecNetwork>(shared_from_this()));
+}
+
+MKLDNNExecNetwork::MKLDNNExecNetwork(const InferenceEngine::CNNNetwork &network,
+                                     const Config &cfg,
+                                     const MKLDNNExtensionManager::Ptr& extMgr,
+                                     NumaNodesWeights &numaNodesWeights) :
+    InferenceEngine::ExecutableNetworkThreadSafeDefault{nullptr, nullptr},
+    extensionManager(extMgr),
+    _cfg{cfg},
+    _name{network.getName()},
+    _numaNodesWeights(numaNodesWeights) {
+    OV_ITT_TASK_CHAIN(taskChain, MKLDNNPlugin::itt::domains::MKLDNN_LT, "MKLDNNExecNetwork", "cloneNet");
+
+    // we are cloning network if we have statistics and we can transform network.
+    _clonedNetwork = cloneNetwork(network);
+
+    OV_ITT_TASK_NEXT(taskChain, "ConvertLegacyLayers");
+    ConvertLegacyLayers(_clonedNetwork, _cfg);
 
     OV_ITT_TASK_SKIP(taskChain);
 
@@ -257,6 +266,8 @@ MKLDNNExecNetwork::MKLDNNExecNetwork(const InferenceEngine::CNNNetwork &network,
     // Save all MemoryLayer data tensors. Will use insight about mechanics
     // of MemoryLayer implementation. It uses output edge of MemoryLayer
     // producer as storage for tensor to keep it between infer calls.
+    // The states of the executable network are the deprecated API, so they are kept for single stream only.
+    // Infer requests own their states and bind them to the stream graph on each inference.
     if (_graphs.size() == 1) {
         for (auto &node : GetGraph()._graph.GetNodes()) {
             if (node->getType() == MemoryInput) {
@@ -310,6 +321,11 @@ MKLDNNExecNetwork::Graph::Lock MKLDNNExecNetwork::GetGraph() {
     return graphLock;
 }
 
+int MKLDNNExecNetwork::GetNumaNodeId() const {
+    auto streamsExecutor = dynamic_cast<InferenceEngine::IStreamsExecutor*>(_taskExecutor.get());
+    return nullptr != streamsExecutor ? streamsExecutor->GetNumaNodeId() : 0;
+}
+
 void MKLDNNExecNetwork::setProperty(const std::map<std::string, std::string> &properties) {
     {
         std::lock_guard<std::mutex> lock{_cfgMutex};
@@ -321,6 +337,99 @@ void MKLDNNExecNetwork::setProperty(const std::map<std::string, std::string> &pr
             graphLock._graph.setProperty(properties);
         }
     }
+    // Graphs for other shapes are compiled again with the new configuration on the next use
+    std::lock_guard<std::mutex> lock{_reshapedGraphsMutex};
+    _reshapedGraphs.clear();
+}
+
+void MKLDNNExecNetwork::setDynamicInputs(const InputBounds& bounds, const NetworkBuilder& builder) {
+    _dynamicInputs = bounds;
+    _networkBuilder = builder;
+}
+
+void MKLDNNExecNetwork::checkInputShape(const std::string& name, const SizeVector& dims) const {
+    auto bounds = _dynamicInputs.find(name);
+    if (bounds == _dynamicInputs.end())
+        THROW_IE_EXCEPTION << "Input " << name << " is not dynamic";
+
+    const auto& lower = bounds->second.first;
+    const auto& upper = bounds->second.second;
+    bool inBounds = dims.size() == upper.size();
+    for (size_t i = 0; inBounds && i < dims.size(); i++) {
+        inBounds = dims[i] >= lower[i] && dims[i] <= upper[i];
+    }
+    if (!inBounds) {
+        THROW_IE_EXCEPTION << PARAMETER_MISMATCH_str << "Failed to set input blob. Dimensions "
+                           << details::dumpVec(dims) << " of input " << name << " are out of bounds "
+                           << details::dumpVec(lower) << " - " << details::dumpVec(upper);
+    }
+}
+
+bool MKLDNNExecNetwork::IsUpperBound(const ICNNNetwork::InputShapes& shapes) const {
+    return std::all_of(shapes.begin(), shapes.end(), [&](const ICNNNetwork::InputShapes::value_type& shape) {
+        return _dynamicInputs.at(shape.first).second == shape.second;
+    });
+}
+
+MKLDNNExecNetwork::ReshapedGraph::Ptr MKLDNNExecNetwork::AcquireGraphForShapes(const ICNNNetwork::InputShapes& shapes,
+                                                                                int numaNodeId) {
+    // Maximum number of different input shapes the graphs are kept for
+    constexpr size_t reshapedGraphsCapacity = 8;
+
+    std::shared_ptr<ReshapedGraphs> reshapedGraphs;
+    {
+        std::lock_guard<std::mutex> lock{_reshapedGraphsMutex};
+        auto cached = std::find_if(_reshapedGraphs.begin(), _reshapedGraphs.end(),
+                                   [&](const std::shared_ptr<ReshapedGraphs>& item) {
+                                       return item->_shapes == shapes && item->_numaNodeId == numaNodeId;
+                                   });
+        if (cached != _reshapedGraphs.end()) {
+            _reshapedGraphs.splice(_reshapedGraphs.begin(), _reshapedGraphs, cached);
+        } else {
+            _reshapedGraphs.emplace_front(std::make_shared<ReshapedGraphs>());
+            _reshapedGraphs.front()->_shapes = shapes;
+            _reshapedGraphs.front()->_numaNodeId = numaNodeId;
+            // Evicted graphs are destroyed once the requests using them release them
+            if (_reshapedGraphs.size() > reshapedGraphsCapacity)
+                _reshapedGraphs.pop_back();
+        }
+        reshapedGraphs = _reshapedGraphs.front();
+    }
+
+    {
+        std::lock_guard<std::mutex> lock{reshapedGraphs->_graphsMutex};
+        for (auto& graph : reshapedGraphs->_graphs) {
+            bool busy = false;
+            if (graph->_busy.compare_exchange_strong(busy, true))
+                return graph;
+        }
+    }
+
+    OV_ITT_SCOPED_TASK(itt::domains::MKLDNNPlugin, "MKLDNNExecNetwork::AcquireGraphForShapes");
+    Config cfg;
+    {
+        std::lock_guard<std::mutex> lock{_cfgMutex};
+        cfg = _cfg;
+    }
+    CNNNetwork network;
+    {
+        // Requests waiting for the same shapes reuse the network converted by the first one
+        std::lock_guard<std::mutex> lock{reshapedGraphs->_networkMutex};
+        if (!reshapedGraphs->_isNetworkConverted) {
+            reshapedGraphs->_network = _networkBuilder(shapes);
+            ConvertLegacyLayers(reshapedGraphs->_network, cfg);
+            reshapedGraphs->_isNetworkConverted = true;
+        }
+        network = cloneNetwork(reshapedGraphs->_network);
+    }
+
+    auto graph = std::make_shared<ReshapedGraph>();
+    graph->setConfig(cfg);
+    graph->CreateGraph(network, extensionManager, _numaNodesWeights[numaNodeId]);
+
+    std::lock_guard<std::mutex> lock{reshapedGraphs->_graphsMutex};
+    reshapedGraphs->_graphs.push_back(graph);
+    return graph;
 }
 
 InferenceEngine::IInferRequest::Ptr MKLDNNExecNetwork::CreateInferRequest() {
@@ -359,6 +468,7 @@ InferenceEngine::Parameter MKLDNNExecNetwork::GetMetric(const std::string &name)
         metrics.push_back(METRIC_KEY(SUPPORTED_METRICS));
         metrics.push_back(METRIC_KEY(SUPPORTED_CONFIG_KEYS));
         metrics.push_back(METRIC_KEY(OPTIMAL_NUMBER_OF_INFER_REQUESTS));
+        metrics.push_back(CPU_METRIC_KEY(MEMORY_STATISTICS));
         IE_SET_METRIC_RETURN(SUPPORTED_METRICS, metrics);
     } else if (name == METRIC_KEY(SUPPORTED_CONFIG_KEYS)) {
         std::vector<std::string> configKeys;
@@ -373,11 +483,32 @@ InferenceEngine::Parameter MKLDNNExecNetwork::GetMetric(const std::string &name)
         auto streams = std::stoi(option->second);
         IE_SET_METRIC_RETURN(OPTIMAL_NUMBER_OF_INFER_REQUESTS, static_cast<unsigned int>(
             streams ? streams : 1));
+    } else if (name == CPU_METRIC_KEY(MEMORY_STATISTICS)) {
+        auto& graph = const_cast<MKLDNNExecNetwork*>(this)->GetGraph()._graph;
+        std::map<std::string, uint64_t> statistics;
+        statistics["WORKSPACE_SIZE"] = graph.GetWorkspaceSize();
+        statistics["WORKSPACE_LOWER_BOUND"] = graph.GetWorkspaceLowerBound();
+        statistics["STREAMS"] = _graphs.size();
+        IE_SET_METRIC_RETURN(CPU_MEMORY_STATISTICS, statistics);
     } else {
         THROW_IE_EXCEPTION << "Unsupported ExecutableNetwork metric: " << name;
     }
 }
 
+void MKLDNNExecNetwork::setExportFunctionBuilder(const ExportFunctionBuilder& builder) {
+    _exportFunctionBuilder = builder;
+}
+
+void MKLDNNExecNetwork::ExportImpl(std::ostream& modelStream) {
+    OV_ITT_SCOPED_TASK(itt::domains::MKLDNNPlugin, "MKLDNNExecNetwork::ExportImpl");
+    bool isTransformed = false;
+    auto function = _exportFunctionBuilder ? _exportFunctionBuilder(isTransformed) : nullptr;
+    if (!function || !isSerializable(function, true))
+        THROW_IE_EXCEPTION_WITH_STATUS(NOT_IMPLEMENTED) << "Network cannot be exported by CPU plugin";
+
+    serializeNetwork(modelStream, function, isTransformed, _networkInputs, _networkOutputs);
+}
+
 bool MKLDNNExecNetwork::CanProcessDynBatch(const InferenceEngine::CNNNetwork &network) const {
     InputsDataMap inputs = network.getInputsInfo();
 
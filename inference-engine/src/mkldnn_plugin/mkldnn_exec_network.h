@@ -9,11 +9,16 @@
 #include "mkldnn_graph.h"
 #include "mkldnn_extension_mngr.h"
 #include <threading/ie_thread_local.hpp>
+#include <ngraph/function.hpp>
 
 #include <vector>
 #include <memory>
 #include <map>
+#include <list>
+#include <atomic>
 #include <string>
+#include <utility>
+#include <functional>
 #include <legacy/cnn_network_impl.hpp>
 #include <unordered_map>
 
@@ -45,7 +50,56 @@ public:
     INFERENCE_ENGINE_DEPRECATED("Use InferRequest::QueryState instead")
     std::vector<InferenceEngine::IVariableStateInternal::Ptr> QueryState() override;
 
+    /**
+     * @brief Produces the nGraph function to be written by Export
+     * @param isTransformed Set to `true` if the function has passed through the plugin nGraph transformations
+     * @return nGraph function or nullptr if the network cannot be exported
+     */
+    using ExportFunctionBuilder = std::function<std::shared_ptr<ngraph::Function>(bool& isTransformed)>;
+
+    /**
+     * @brief Sets the builder of the function written by Export. The function is built on Export only,
+     *        so the executable network doesn't keep a copy of it.
+     * @param builder Function builder, empty one disables Export
+     */
+    void setExportFunctionBuilder(const ExportFunctionBuilder& builder);
+
+    /**
+     * @brief Lower and upper bounds of dimensions of dynamic network inputs by input name
+     */
+    using InputBounds = std::map<std::string, std::pair<InferenceEngine::SizeVector, InferenceEngine::SizeVector>>;
+
+    /**
+     * @brief Produces a network converted for the plugin with the given static shapes of dynamic inputs
+     */
+    using NetworkBuilder = std::function<InferenceEngine::CNNNetwork(const InferenceEngine::ICNNNetwork::InputShapes&)>;
+
+    /**
+     * @brief Enables per-inference shapes of dynamic inputs. The network the executable network is created from
+     *        must be compiled for the upper bounds, graphs for other shapes are created by the builder on demand.
+     * @param bounds Bounds of dynamic inputs dimensions
+     * @param builder Network builder for concrete input shapes
+     */
+    void setDynamicInputs(const InputBounds& bounds, const NetworkBuilder& builder);
+
+    bool hasDynamicInputs() const {
+        return !_dynamicInputs.empty();
+    }
+
+    bool isDynamicInput(const std::string& name) const {
+        return _dynamicInputs.find(name) != _dynamicInputs.end();
+    }
+
+    /**
+     * @brief Checks that dimensions of a dynamic input are within its bounds
+     * @param name Input name
+     * @param dims Input dimensions
+     */
+    void checkInputShape(const std::string& name, const InferenceEngine::SizeVector& dims) const;
+
 protected:
+    void ExportImpl(std::ostream& modelStream) override;
+
     friend class MKLDNNInferRequest;
     MKLDNNExtensionManager::Ptr extensionManager;
     std::vector<InferenceEngine::IVariableStateInternal::Ptr> memoryStates;
@@ -64,6 +118,31 @@ protected:
     // WARNING: Do not use _graphs directly.
     std::deque<Graph>                           _graphs;
     NumaNodesWeights&                           _numaNodesWeights;
+    ExportFunctionBuilder                       _exportFunctionBuilder;
+    InputBounds                                 _dynamicInputs;
+    NetworkBuilder                              _networkBuilder;
+
+    /**
+     * @brief Graph compiled for shapes of dynamic inputs other than the upper bounds.
+     *        It is used by a single infer request at a time, which is marked by the busy flag.
+     */
+    struct ReshapedGraph : public MKLDNNGraph {
+        using Ptr = std::shared_ptr<ReshapedGraph>;
+        std::atomic<bool>   _busy = {true};
+    };
+    // Graphs compiled for the same shapes and NUMA node, shared by all streams
+    struct ReshapedGraphs {
+        InferenceEngine::ICNNNetwork::InputShapes   _shapes;
+        int                                         _numaNodeId = 0;
+        std::mutex                                  _networkMutex;
+        InferenceEngine::CNNNetwork                 _network;
+        bool                                        _isNetworkConverted = false;
+        std::mutex                                  _graphsMutex;
+        std::vector<ReshapedGraph::Ptr>             _graphs;
+    };
+    std::mutex                                  _reshapedGraphsMutex;
+    // Most recently used shapes first
+    std::list<std::shared_ptr<ReshapedGraphs>>  _reshapedGraphs;
 
     /* WARNING: Use GetGraph() function to get access to graph in current stream.
      * NOTE: Main thread is interpreted as master thread of external stream so use this function to get access to graphs
@@ -71,6 +150,26 @@ protected:
      */
     Graph::Lock GetGraph();
 
+    /**
+     * @brief Returns NUMA node of the stream the current thread belongs to
+     */
+    int GetNumaNodeId() const;
+
+    /**
+     * @brief Returns an idle graph compiled for the given shapes of dynamic inputs and marks it busy.
+     *        Graphs are shared by all streams. The network is converted once for the shapes, a new graph
+     *        is compiled only if all graphs for the shapes are used by other requests.
+     * @param shapes Shapes of all dynamic inputs
+     * @param numaNodeId NUMA node to share weights of the graph on
+     * @return Busy graph for the shapes, it should be released by resetting the busy flag
+     */
+    ReshapedGraph::Ptr AcquireGraphForShapes(const InferenceEngine::ICNNNetwork::InputShapes& shapes, int numaNodeId);
+
+    /**
+     * @brief Checks that the shapes of dynamic inputs are the upper bounds, so the graphs of streams are used for them
+     */
+    bool IsUpperBound(const InferenceEngine::ICNNNetwork::InputShapes& shapes) const;
+
     bool CanProcessDynBatch(const InferenceEngine::CNNNetwork &network) const;
 };
 
@@ -569,6 +569,15 @@ static inline bool isConstOutput(MKLDNNEdgePtr edge) {
     return edge->getParent()->isConstant() && !edge->getChild()->isConstant();
 }
 
+static inline bool isInterOpParallelismSupported() {
+#if (IE_THREAD == IE_THREAD_TBB || IE_THREAD == IE_THREAD_TBB_AUTO) && (TBB_INTERFACE_VERSION >= 11000)
+    return true;
+#else
+    // Concurrent execution of nodes relies on TBB task isolation
+    return false;
+#endif
+}
+
 static edge_clusters_t findEdgeClusters(const std::vector<MKLDNNEdgePtr> & graphEdges) {
     typedef std::unordered_map<MKLDNNEdgePtr, size_t> edge_cluster_idx_map_t;
 
@@ -648,8 +657,8 @@ void MKLDNNGraph::AllocateWithReuse() {
         MemorySolver::Box &box = boxes[i];
         box = { std::numeric_limits<int>::max(), 0, 0, i };
         for (auto &edge : edge_clusters[i]) {
-            int e_start = edge->getParent()->execIndex;
-            int e_finish = edge->getChild()->execIndex;
+            int e_start = edge->getParent()->execLevel;
+            int e_finish = edge->getChild()->execLevel;
 
             const BlockingDesc block_desk = edge->getDesc().getBlockingDesc();
 
@@ -697,7 +706,9 @@ void MKLDNNGraph::AllocateWithReuse() {
     }
 
     MemorySolver memSolver(boxes);
-    size_t total_size = static_cast<size_t>(memSolver.solve()) * alignment;
+    size_t total_size = static_cast<size_t>(memSolver.solve(config.memoryReuseStrategy)) * alignment;
+    workspaceSize = total_size;
+    workspaceLowerBound = boxes.empty() ? 0 : static_cast<size_t>(memSolver.maxDepth()) * alignment;
 
     memWorkspace = std::make_shared<MKLDNNMemory>(eng);
     memWorkspace->Create(MKLDNNMemoryDesc(TensorDesc(Precision::I8, {total_size}, Layout::C)));
@@ -729,6 +740,85 @@ void MKLDNNGraph::AllocateWithReuse() {
     }
 }
 
+void MKLDNNGraph::InitExecutionLevels() {
+    execWaves.clear();
+
+    if (!config.interOpParallelism || !isInterOpParallelismSupported()) {
+        for (auto &node : graphNodes) node->execLevel = node->execIndex;
+        return;
+    }
+
+    // Edges of one cluster share the same memory. An in-place node may overwrite it,
+    // so all preceding accesses to the cluster have to complete before such node starts
+    // and all subsequent accesses have to wait for it.
+    edge_clusters_t edge_clusters = findEdgeClusters(graphEdges);
+    std::unordered_map<MKLDNNEdgePtr, size_t> edge_cluster_indices;
+    for (size_t i = 0; i < edge_clusters.size(); i++) {
+        for (auto &edge : edge_clusters[i])
+            edge_cluster_indices.emplace(edge, i);
+    }
+
+    std::vector<int> lastWriteLevel(edge_clusters.size(), -1);
+    std::vector<int> lastAccessLevel(edge_clusters.size(), -1);
+
+    int minLevel = 0;
+    int maxLevel = -1;
+    for (auto &node : graphNodes) {
+        // Constant nodes are executed on load and do not participate in the inference
+        if (node->isConstant()) {
+            node->execLevel = 0;
+            continue;
+        }
+
+        std::vector<size_t> clusters;
+        int level = minLevel;
+        for (size_t i = 0; i < node->getParentEdges().size(); i++) {
+            auto edge = node->getParentEdgeAt(i);
+            auto parent = edge->getParent();
+            if (!parent->isConstant())
+                level = std::max(level, parent->execLevel + 1);
+            clusters.push_back(edge_cluster_indices.at(edge));
+        }
+        for (size_t i = 0; i < node->getChildEdges().size(); i++) {
+            clusters.push_back(edge_cluster_indices.at(node->getChildEdgeAt(i)));
+        }
+
+        // In-place node may overwrite the memory visible through the other edges of its clusters
+        const bool inPlace = node->isInplace();
+        for (auto cluster : clusters) {
+            level = std::max(level, lastWriteLevel[cluster] + 1);
+            if (inPlace)
+                level = std::max(level, lastAccessLevel[cluster] + 1);
+        }
+
+        // Memory nodes pass data between inferences through the shared state,
+        // so they are executed exclusively in the original order
+        const bool isBarrier = node->getType() == MemoryInput || node->getType() == MemoryOutput;
+        if (isBarrier) {
+            level = std::max(level, maxLevel + 1);
+            minLevel = level + 1;
+        }
+
+        node->execLevel = level;
+        maxLevel = std::max(maxLevel, level);
+
+        for (auto cluster : clusters) {
+            lastAccessLevel[cluster] = std::max(lastAccessLevel[cluster], level);
+            if (inPlace)
+                lastWriteLevel[cluster] = level;
+        }
+    }
+
+    execWaves.resize(maxLevel + 1);
+    for (auto &node : graphNodes) {
+        if (!node->isConstant())
+            execWaves[node->execLevel].push_back(node);
+    }
+    execWaves.erase(std::remove_if(execWaves.begin(), execWaves.end(),
+                                   [](const std::vector<MKLDNNNodePtr>& wave) { return wave.empty(); }),
+                    execWaves.end());
+}
+
 void MKLDNNGraph::Allocate() {
     OV_ITT_SCOPED_TASK(itt::domains::MKLDNN_LT, "MKLDNNGraph::Allocate");
 
@@ -737,6 +827,10 @@ void MKLDNNGraph::Allocate() {
     //   NotAllocated - view on other blob, peer or in-place
     for (auto& edge : graphEdges) edge->init();
 
+    // Define the order of execution. Lifetimes of the memory are measured in execution levels,
+    // so nodes executed concurrently never share the memory space.
+    InitExecutionLevels();
+
     // Allocate memory space for all edges marked with NeedAllocation
     AllocateWithReuse();
 
@@ -755,7 +849,7 @@ void MKLDNNGraph::CreatePrimitives() {
     }
 }
 
-void MKLDNNGraph::PushInputData(const std::string& name, const InferenceEngine::Blob::Ptr &in) {
+void MKLDNNGraph::PushInputData(const std::string& name, const InferenceEngine::Blob::Ptr &in, bool subtractMean) {
     if (!IsReady()) THROW_IE_EXCEPTION<< "Wrong state. Topology not ready.";
 
     auto input = inputNodes.find(name);
@@ -775,7 +869,7 @@ void MKLDNNGraph::PushInputData(const std::string& name, const InferenceEngine::
         }
 
         // todo: make sure 'name' exists in this map...
-        if (_meanImages.find(name) != _meanImages.end()) {
+        if (subtractMean && _meanImages.find(name) != _meanImages.end()) {
             if (in->getTensorDesc().getPrecision() == InferenceEngine::Precision::FP32) {
                 _meanImages[name].Subtract(outDims, reinterpret_cast<float *>(inter_data_ptr), in->getTensorDesc().getLayout());
             } else {
@@ -844,28 +938,59 @@ void MKLDNNGraph::Infer(MKLDNNInferRequest* request, int batch) {
 
     mkldnn::stream stream(eng);
 
-    for (int i = 0; i < graphNodes.size(); i++) {
-        if (request != nullptr) {
-            request->ThrowIfCanceled();
-        }
-
-        PERF(graphNodes[i]);
+    if (execWaves.empty()) {
+        for (int i = 0; i < graphNodes.size(); i++) {
+            if (request != nullptr) {
+                request->ThrowIfCanceled();
+            }
 
-        if (batch > 0)
-            graphNodes[i]->setDynamicBatchLim(batch);
+            ExecuteNode(graphNodes[i], stream, batch);
+        }
+    } else {
+        for (auto &wave : execWaves) {
+            if (request != nullptr) {
+                request->ThrowIfCanceled();
+            }
 
-        ENABLE_DUMP(do_before(DUMP_DIR, graphNodes[i]));
+            if (wave.size() == 1) {
+                ExecuteNode(wave[0], stream, batch);
+                continue;
+            }
 
-        if (!graphNodes[i]->isConstant()) {
-            OV_ITT_SCOPED_TASK(itt::domains::MKLDNNPlugin, graphNodes[i]->profiling.execute);
-            graphNodes[i]->execute(stream);
+#if (IE_THREAD == IE_THREAD_TBB || IE_THREAD == IE_THREAD_TBB_AUTO) && (TBB_INTERFACE_VERSION >= 11000)
+            parallel_for(wave.size(), [&](size_t i) {
+                // Isolation prevents the thread from picking up another node of the wave
+                // while it waits for the nested parallel regions of the current one
+                tbb::this_task_arena::isolate([&] {
+                    mkldnn::stream nodeStream(eng);
+                    ExecuteNode(wave[i], nodeStream, batch);
+                });
+            });
+#else
+            for (auto &node : wave)
+                ExecuteNode(node, stream, batch);
+#endif
         }
-        ENABLE_DUMP(do_after(DUMP_DIR, graphNodes[i]));
     }
 
     if (infer_count != -1) infer_count++;
 }
 
+void MKLDNNGraph::ExecuteNode(const MKLDNNNodePtr& node, mkldnn::stream& stream, int batch) {
+    PERF(node);
+
+    if (batch > 0)
+        node->setDynamicBatchLim(batch);
+
+    ENABLE_DUMP(do_before(DUMP_DIR, node));
+
+    if (!node->isConstant()) {
+        OV_ITT_SCOPED_TASK(itt::domains::MKLDNNPlugin, node->profiling.execute);
+        node->execute(stream);
+    }
+    ENABLE_DUMP(do_after(DUMP_DIR, node));
+}
+
 void MKLDNNGraph::VisitNode(MKLDNNNodePtr node, std::vector<MKLDNNNodePtr>& sortedNodes) {
     if (node->temporary) {
         return;
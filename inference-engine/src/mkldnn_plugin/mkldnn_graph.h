@@ -56,7 +56,7 @@ public:
         return _meanImages.find(name) != _meanImages.end();
     }
 
-    void PushInputData(const std::string& name, const InferenceEngine::Blob::Ptr &in);
+    void PushInputData(const std::string& name, const InferenceEngine::Blob::Ptr &in, bool subtractMean = true);
     void PullOutputData(InferenceEngine::BlobMap &out);
 
     void Infer(MKLDNNInferRequest* request = nullptr, int batch = -1);
@@ -88,6 +88,16 @@ public:
 
     void GetPerfData(std::map<std::string, InferenceEngine::InferenceEngineProfileInfo> &perfMap) const;
 
+    /** Size of the memory shared by intermediate tensors, in bytes */
+    size_t GetWorkspaceSize() const {
+        return workspaceSize;
+    }
+
+    /** Maximal total size of intermediate tensors alive at the same time, in bytes */
+    size_t GetWorkspaceLowerBound() const {
+        return workspaceLowerBound;
+    }
+
     void RemoveDroppedNodes();
     void RemoveDroppedEdges();
     void DropNode(const MKLDNNNodePtr& node);
@@ -170,6 +180,7 @@ protected:
         outputNodes.clear();
         graphNodes.clear();
         graphEdges.clear();
+        execWaves.clear();
         _meanImages.clear();
     }
     Status status { NotReady };
@@ -182,12 +193,18 @@ protected:
     bool reuse_io_tensors = true;
 
     MKLDNNMemoryPtr memWorkspace;
+    size_t workspaceSize = 0;
+    size_t workspaceLowerBound = 0;
 
     std::map<std::string, MKLDNNNodePtr> inputNodes;
     std::vector<MKLDNNNodePtr> outputNodes;
     std::vector<MKLDNNNodePtr> graphNodes;
     std::vector<MKLDNNEdgePtr> graphEdges;
 
+    // Groups of mutually independent nodes that are executed concurrently when
+    // inter-op parallelism is enabled. Empty in the sequential execution mode.
+    std::vector<std::vector<MKLDNNNodePtr>> execWaves;
+
     std::map<std::string, MeanImage> _meanImages;
     std::string _name;
 
@@ -200,10 +217,12 @@ protected:
     void InitDescriptors();
     void InitOptimalPrimitiveDescriptors();
     void InitEdges();
+    void InitExecutionLevels();
     void Allocate();
     void AllocateWithReuse();
     void CreatePrimitives();
     void ExecuteConstantNodesOnly();
+    void ExecuteNode(const MKLDNNNodePtr& node, mkldnn::stream& stream, int batch);
     void SetOriginalLayerNames();
 
     void do_before(const std::string &dir, const MKLDNNNodePtr &node);
@@ -11,6 +11,7 @@
 #include "nodes/mkldnn_concat_node.h"
 #include "nodes/mkldnn_reorder_node.h"
 #include "nodes/mkldnn_conv_node.h"
+#include "nodes/mkldnn_fullyconnected_node.h"
 #include "nodes/mkldnn_bin_conv_node.h"
 #include "nodes/mkldnn_quantize_node.h"
 #include "nodes/mkldnn_mvn_node.h"
@@ -641,8 +642,11 @@ void MKLDNNGraphOptimizer::FuseFullyConnectedAndSimpleOperation(MKLDNNGraph &gra
     auto& graphNodes = graph.GetNodes();
 
     auto isSutableParentNode = [](MKLDNNNodePtr node) {
+        // post operations are not supported by FullyConnected with compressed weights
+        auto* fcNode = dynamic_cast<MKLDNNFullyConnectedNode*>(node.get());
         return node->getType() == FullyConnected &&
-               node->getChildEdges().size() == 1;
+               node->getChildEdges().size() == 1 &&
+               fcNode != nullptr && !fcNode->isWeightsCompressed();
     };
 
     auto isSutableChildNode = [&](MKLDNNNodePtr parentNode, MKLDNNNodePtr childNode) {
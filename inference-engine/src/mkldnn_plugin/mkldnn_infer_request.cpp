@@ -31,6 +31,26 @@ MKLDNNPlugin::MKLDNNInferRequest::MKLDNNInferRequest(InferenceEngine::InputsData
     if (execNetwork->_graphs.size() == 0)
         THROW_IE_EXCEPTION << "No graph was found";
     graph = &(execNetwork->GetGraph()._graph);
+    if (execNetwork->hasDynamicInputs()) {
+        // Dynamic dimensions are set to the upper bounds until the user sets blobs of other shapes
+        InferenceEngine::BlobMap outputBlobs;
+        graph->getOutputBlobs(outputBlobs);
+        auto reshapeData = [](const InferenceEngine::DataPtr& data, const InferenceEngine::SizeVector& dims) {
+            auto layout = data->getLayout();
+            if (layout == InferenceEngine::Layout::SCALAR || layout == InferenceEngine::Layout::ANY)
+                layout = InferenceEngine::TensorDesc::getLayoutByDims(dims);
+            data->reshape(dims, layout);
+        };
+        InferenceEngine::BlobMap inputBlobs;
+        graph->getInputBlobs(inputBlobs);
+        for (const auto& it : _networkInputs) {
+            if (execNetwork->isDynamicInput(it.first))
+                reshapeData(it.second->getInputData(), inputBlobs[it.first]->getTensorDesc().getDims());
+        }
+        for (const auto& it : _networkOutputs) {
+            reshapeData(it.second, outputBlobs[it.first]->getTensorDesc().getDims());
+        }
+    }
     for (const auto& it : _networkInputs) {
         MKLDNNInferRequest::GetBlob(it.first);
     }
@@ -65,9 +85,18 @@ MKLDNNPlugin::MKLDNNInferRequest::MKLDNNInferRequest(InferenceEngine::InputsData
 }
 
 MKLDNNPlugin::MKLDNNInferRequest::~MKLDNNInferRequest() {
+    releaseGraph();
     --(execNetwork->_numRequests);
 }
 
+// Checks that the blob memory can be used by the graph edge directly, so no copy is needed
+static bool canReplaceEdgeMemory(const InferenceEngine::TensorDesc& desc, const InferenceEngine::Blob::Ptr& edgeBlob) {
+    const auto& edgeDesc = edgeBlob->getTensorDesc();
+    return desc.getPrecision() == edgeDesc.getPrecision() &&
+           desc.getBlockingDesc().getBlockDims() == edgeDesc.getBlockingDesc().getBlockDims() &&
+           desc.getBlockingDesc().getOrder() == edgeDesc.getBlockingDesc().getOrder();
+}
+
 void MKLDNNPlugin::MKLDNNInferRequest::pushInput(const std::string& inputName, InferenceEngine::Blob::Ptr& inputBlob, InferenceEngine::Precision inPrec) {
     bool needConvert = inPrec != inputBlob->getTensorDesc().getPrecision();
 
@@ -92,7 +121,37 @@ void MKLDNNPlugin::MKLDNNInferRequest::pushInput(const std::string& inputName, I
         cpu_convert(srcData, dstData, inputBlob->getTensorDesc().getPrecision(), iconv->getTensorDesc().getPrecision(), iconv->size());
     }
 
-    graph->PushInputData(inputName, needConvert ? iconv : inputBlob);
+    graph->PushInputData(inputName, needConvert ? iconv : inputBlob, !isNormalizationFused(inputName));
+}
+
+bool MKLDNNPlugin::MKLDNNInferRequest::isNormalizationFused(const std::string& name) const {
+    // MeanImage doesn't apply stdScale, so only inputs with unit scales are fused to keep results the same
+    if (_preProcData.find(name) == _preProcData.end() || !graph->hasMeanImageFor(name))
+        return false;
+
+    const auto& preProcess = _networkInputs.at(name)->getPreProcess();
+    if (preProcess.getMeanVariant() != InferenceEngine::MEAN_VALUE)
+        return false;
+
+    for (size_t c = 0; c < preProcess.getNumberOfChannels(); c++) {
+        if (preProcess[c]->stdScale != 1.0f)
+            return false;
+    }
+    return true;
+}
+
+void MKLDNNPlugin::MKLDNNInferRequest::allocateNormalizedInputs() {
+    // Pre-processing writes normalized data, so it needs FP32 blob instead of the network input precision one.
+    // The blob is internal as GetBlob returns the ROI blob for pre-processed inputs.
+    for (auto& input : _inputs) {
+        const auto& desc = input.second->getTensorDesc();
+        if (desc.getPrecision() == InferenceEngine::Precision::FP32 || !isNormalizationFused(input.first))
+            continue;
+
+        input.second = make_blob_with_precision(InferenceEngine::TensorDesc(InferenceEngine::Precision::FP32,
+                                                                            desc.getDims(), desc.getLayout()));
+        input.second->allocate();
+    }
 }
 
 void MKLDNNPlugin::MKLDNNInferRequest::PushInputData() {
@@ -141,6 +200,8 @@ void MKLDNNPlugin::MKLDNNInferRequest::PushInputData() {
 }
 
 void MKLDNNPlugin::MKLDNNInferRequest::PushStates() {
+    // The state storage of the request becomes the memory of the graph memory nodes,
+    // so the graph reads and updates the state of this request in place
     for (auto &node : graph->GetNodes()) {
         if (node->getType() == MemoryInput) {
             auto cur_node = dynamic_cast<MKLDNNMemoryInputNode*>(node.get());
@@ -148,45 +209,80 @@ void MKLDNNPlugin::MKLDNNInferRequest::PushStates() {
             for (const auto& state : memoryStates) {
                 if (state->GetName() == cur_id) {
                     auto cur_state_mem = cur_node->getStore();
-                    auto data_ptr = state->GetState()->cbuffer().as<void*>();
-                    auto data_size = state->GetState()->byteSize();
-                    auto cur_state_mem_buf = static_cast<uint8_t*>(cur_state_mem->GetPtr());
+                    auto state_blob = state->GetState();
+                    if (state_blob->byteSize() != cur_state_mem->GetSize())
+                        THROW_IE_EXCEPTION << "State '" << cur_id << "' has size " << state_blob->byteSize()
+                                           << " bytes, but " << cur_state_mem->GetSize() << " bytes are expected";
 
-                    cpu_memcpy(cur_state_mem_buf, data_ptr, data_size);
+                    cur_state_mem->GetPrimitivePtr()->set_data_handle(state_blob->cbuffer().as<void*>());
                 }
             }
         }
     }
 }
 
-void MKLDNNPlugin::MKLDNNInferRequest::PullStates() {
-    for (auto &node : graph->GetNodes()) {
-        if (node->getType() == MemoryInput) {
-            auto cur_node = dynamic_cast<MKLDNNMemoryInputNode*>(node.get());
-            auto cur_id = cur_node->getId();
-            for (const auto& state : memoryStates) {
-                if (state->GetName() == cur_id) {
-                    auto cur_state_mem = cur_node->getStore();
-                    auto data_ptr = state->GetState()->cbuffer().as<void*>();
-                    auto data_size = state->GetState()->byteSize();
-                    auto cur_state_mem_buf = static_cast<uint8_t*>(cur_state_mem->GetPtr());
 
-                    cpu_memcpy(data_ptr, cur_state_mem_buf, data_size);
-                }
-            }
-        }
+bool MKLDNNPlugin::MKLDNNInferRequest::HasDynamicInputs() const {
+    return execNetwork->hasDynamicInputs();
+}
+
+void MKLDNNPlugin::MKLDNNInferRequest::PrepareGraph() {
+    releaseGraph();
+    if (!execNetwork->hasDynamicInputs())
+        return;
+
+    InferenceEngine::ICNNNetwork::InputShapes shapes;
+    for (const auto& input : _inputs) {
+        if (execNetwork->isDynamicInput(input.first))
+            shapes[input.first] = input.second->getTensorDesc().getDims();
+    }
+    if (execNetwork->IsUpperBound(shapes)) {
+        // The graphs of streams are compiled for the upper bounds
+        currentGraph.reset();
+        return;
     }
+    // Weights are shared on the NUMA node the request was last executed on
+    currentGraph = execNetwork->AcquireGraphForShapes(shapes, numaNodeId);
+    isCurrentGraphAcquired = true;
 }
 
+void MKLDNNPlugin::MKLDNNInferRequest::releaseGraph() {
+    if (isCurrentGraphAcquired) {
+        std::static_pointer_cast<MKLDNNExecNetwork::ReshapedGraph>(currentGraph)->_busy = false;
+        isCurrentGraphAcquired = false;
+    }
+}
 
 void MKLDNNPlugin::MKLDNNInferRequest::InferImpl() {
     using namespace openvino::itt;
     OV_ITT_SCOPED_TASK(itt::domains::MKLDNNPlugin, profilingTask);
-    auto graphLock = execNetwork->GetGraph();
-    graph = &(graphLock._graph);
+    numaNodeId = execNetwork->GetNumaNodeId();
+
+    if (isCurrentGraphAcquired) {
+        // The graph compiled for the current input shapes is used by this request only
+        graph = currentGraph.get();
+        try {
+            inferGraph();
+        } catch (...) {
+            releaseGraph();
+            throw;
+        }
+        releaseGraph();
+    } else {
+        auto graphLock = execNetwork->GetGraph();
+        graph = &(graphLock._graph);
+        inferGraph();
+    }
+}
+
+void MKLDNNPlugin::MKLDNNInferRequest::inferGraph() {
+    if (execNetwork->hasDynamicInputs())
+        updateDynamicOutputs();
 
     ThrowIfCanceled();
 
+    allocateNormalizedInputs();
+
     execDataPreprocessing(_inputs);
 
     changeDefaultPtr();
@@ -201,10 +297,6 @@ void MKLDNNPlugin::MKLDNNInferRequest::InferImpl() {
 
     graph->Infer(this, m_curBatch);
 
-    if (memoryStates.size() != 0) {
-        PullStates();
-    }
-
     ThrowIfCanceled();
 
     graph->PullOutputData(_outputs);
@@ -239,7 +331,8 @@ InferenceEngine::Blob::Ptr MKLDNNPlugin::MKLDNNInferRequest::GetBlob(const std::
 
         if (_inputs.find(name) != _inputs.end()) {
             data = _inputs[name];
-            checkBlob(data, name, true);
+            checkBlob(data, name, true, execNetwork->isDynamicInput(name) ? data->getTensorDesc().getDims()
+                                                                         : InferenceEngine::SizeVector{});
             return data;
         }
 
@@ -268,7 +361,8 @@ InferenceEngine::Blob::Ptr MKLDNNPlugin::MKLDNNInferRequest::GetBlob(const std::
     if (blobs.find(name) != blobs.end()) {
         if (_outputs.find(name) != _outputs.end()) {
             data = _outputs[name];
-            checkBlob(data, name, false);
+            checkBlob(data, name, false, execNetwork->hasDynamicInputs() ? data->getTensorDesc().getDims()
+                                                                         : InferenceEngine::SizeVector{});
             return data;
         }
 
@@ -283,11 +377,13 @@ InferenceEngine::Blob::Ptr MKLDNNPlugin::MKLDNNInferRequest::GetBlob(const std::
 
         _outputs[name] = make_blob_with_precision(desc);
         _outputs[name]->allocate();
-        if (desc.getPrecision() == InferenceEngine::Precision::FP32 && !graph->getProperty().batchLimit) {
+        // The blob is created with the edge precision and layout, so the graph can write the result to it directly
+        if (!graph->getProperty().batchLimit) {
             externalPtr[name] = _outputs[name]->buffer();
         }
         data = _outputs[name];
-        checkBlob(data, name, false);
+        checkBlob(data, name, false, execNetwork->hasDynamicInputs() ? data->getTensorDesc().getDims()
+                                                                     : InferenceEngine::SizeVector{});
         return data;
     }
     THROW_IE_EXCEPTION << "Cannot find blob with name: " << name;
@@ -331,6 +427,23 @@ void MKLDNNPlugin::MKLDNNInferRequest::SetBlob(const std::string& name, const In
             // Stores the given blob as ROI blob. It will be used to fill in network input during
             // pre-processing
             _preProcData[name]->setRoiBlob(data);
+        } else if (execNetwork->isDynamicInput(name)) {
+            execNetwork->checkInputShape(name, data->getTensorDesc().getDims());
+
+            if (data->getTensorDesc().getLayout() != InferenceEngine::Layout::ANY &&
+                foundInput->getTensorDesc().getLayout() != data->getTensorDesc().getLayout()) {
+                THROW_IE_EXCEPTION << PARAMETER_MISMATCH_str << "Failed to set input blob. Layout mismatch.";
+            }
+
+            InferenceEngine::BlobMap blobs;
+            graph->getInputBlobs(blobs);
+            if (data->getTensorDesc().getPrecision() == blobs[name]->getTensorDesc().getPrecision() &&
+                graph->_meanImages.find(name) == graph->_meanImages.end()) {
+                externalPtr[name] = data->buffer();
+            } else if (externalPtr.find(name) != externalPtr.end()) {
+                externalPtr.erase(name);
+            }
+            _inputs[name] = data;
         } else {
             size_t inputSize = foundInput->getTensorDesc().getLayout() != InferenceEngine::Layout::SCALAR
                 ? InferenceEngine::details::product(foundInput->getTensorDesc().getDims())
@@ -349,7 +462,9 @@ void MKLDNNPlugin::MKLDNNInferRequest::SetBlob(const std::string& name, const In
                 THROW_IE_EXCEPTION << PARAMETER_MISMATCH_str << "Failed to set input blob. Blocking descriptor mismatch.";
             }
 
-            if (data->getTensorDesc().getPrecision() == InferenceEngine::Precision::FP32 &&
+            InferenceEngine::BlobMap blobs;
+            graph->getInputBlobs(blobs);
+            if (data->getTensorDesc().getPrecision() == blobs[name]->getTensorDesc().getPrecision() &&
                 graph->_meanImages.find(name) == graph->_meanImages.end() && !graph->getProperty().batchLimit) {
                 externalPtr[name] = data->buffer();
             } else if (externalPtr.find(name) != externalPtr.end()) {
@@ -366,22 +481,28 @@ void MKLDNNPlugin::MKLDNNInferRequest::SetBlob(const std::string& name, const In
             THROW_IE_EXCEPTION << PARAMETER_MISMATCH_str << "Failed to set output blob with precision: "
                                << data->getTensorDesc().getPrecision() << ", if CNNNetwork output blob precision is: " << foundOutput->getPrecision();
         }
-        size_t outputSize = foundOutput->getTensorDesc().getLayout() != InferenceEngine::Layout::SCALAR
-            ? InferenceEngine::details::product(foundOutput->getDims())
-            : 1;
-        if (dataSize != outputSize) {
-            THROW_IE_EXCEPTION << "Output blob size is not equal network output size ("
-                               << dataSize << "!=" << outputSize << ").";
-        }
-        if (foundOutput->getTensorDesc().getDims() != data->getTensorDesc().getDims()) {
-            THROW_IE_EXCEPTION << PARAMETER_MISMATCH_str << "Failed to set output Blob. Dimensions mismatch.";
-        }
-        if (data->getTensorDesc().getLayout() != InferenceEngine::Layout::ANY && foundOutput->getTensorDesc().getLayout() != InferenceEngine::Layout::ANY &&
-            foundOutput->getTensorDesc().getBlockingDesc() != data->getTensorDesc().getBlockingDesc()) {
-                THROW_IE_EXCEPTION << PARAMETER_MISMATCH_str << "Failed to set output blob. Blocking descriptor mismatch.";
+        // Output shapes of a network with dynamic inputs are known only at inference,
+        // the blob is replaced by the plugin if it does not match the actual shape
+        if (!execNetwork->hasDynamicInputs()) {
+            size_t outputSize = foundOutput->getTensorDesc().getLayout() != InferenceEngine::Layout::SCALAR
+                ? InferenceEngine::details::product(foundOutput->getDims())
+                : 1;
+            if (dataSize != outputSize) {
+                THROW_IE_EXCEPTION << "Output blob size is not equal network output size ("
+                                   << dataSize << "!=" << outputSize << ").";
+            }
+            if (foundOutput->getTensorDesc().getDims() != data->getTensorDesc().getDims()) {
+                THROW_IE_EXCEPTION << PARAMETER_MISMATCH_str << "Failed to set output Blob. Dimensions mismatch.";
+            }
+            if (data->getTensorDesc().getLayout() != InferenceEngine::Layout::ANY && foundOutput->getTensorDesc().getLayout() != InferenceEngine::Layout::ANY &&
+                foundOutput->getTensorDesc().getBlockingDesc() != data->getTensorDesc().getBlockingDesc()) {
+                    THROW_IE_EXCEPTION << PARAMETER_MISMATCH_str << "Failed to set output blob. Blocking descriptor mismatch.";
+            }
         }
-        if (data->getTensorDesc().getPrecision() == InferenceEngine::Precision::FP32 &&
-                !graph->getProperty().batchLimit) {
+        // User blob becomes the memory of the output edge, if the graph produces data of the same precision and layout
+        InferenceEngine::BlobMap blobs;
+        graph->getOutputBlobs(blobs);
+        if (canReplaceEdgeMemory(data->getTensorDesc(), blobs[name]) && !graph->getProperty().batchLimit) {
             externalPtr[name] = data->buffer();
         } else if (externalPtr.find(name) != externalPtr.end()) {
             externalPtr.erase(name);
@@ -390,6 +511,39 @@ void MKLDNNPlugin::MKLDNNInferRequest::SetBlob(const std::string& name, const In
     }
 }
 
+void MKLDNNPlugin::MKLDNNInferRequest::checkBlobs() {
+    if (!execNetwork->hasDynamicInputs()) {
+        InferRequestInternal::checkBlobs();
+        return;
+    }
+
+    for (const auto& input : _inputs) {
+        if (execNetwork->isDynamicInput(input.first)) {
+            checkBlob(input.second, input.first, true, input.second->getTensorDesc().getDims());
+            execNetwork->checkInputShape(input.first, input.second->getTensorDesc().getDims());
+        } else {
+            checkBlob(input.second, input.first, true);
+        }
+    }
+    for (const auto& output : _outputs) {
+        checkBlob(output.second, output.first, false, output.second->getTensorDesc().getDims());
+    }
+}
+
+void MKLDNNPlugin::MKLDNNInferRequest::updateDynamicOutputs() {
+    InferenceEngine::BlobMap outputBlobs;
+    graph->getOutputBlobs(outputBlobs);
+    for (const auto& output : outputBlobs) {
+        auto it = _outputs.find(output.first);
+        if (it != _outputs.end() && it->second->getTensorDesc().getDims() == output.second->getTensorDesc().getDims())
+            continue;
+        // Allocates a new blob for the actual output shape
+        _outputs.erase(output.first);
+        externalPtr.erase(output.first);
+        GetBlob(output.first);
+    }
+}
+
 static inline void changeEdgePtr(const MKLDNNPlugin::MKLDNNEdgePtr &edge, void *newPtr) {
     edge->getMemory().GetPrimitivePtr()->set_data_handle(newPtr);
 }
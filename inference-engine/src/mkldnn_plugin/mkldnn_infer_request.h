@@ -34,6 +34,8 @@ public:
 
     void SetBatch(int batch = -1) override;
 
+    void checkBlobs() override;
+
     std::vector<InferenceEngine::IVariableStateInternal::Ptr> QueryState() override;
 
     /**
@@ -47,16 +49,33 @@ public:
      */
     void ThrowIfCanceled() const;
 
+    bool HasDynamicInputs() const;
+
+    /**
+     * @brief Acquires the graph compiled for the current shapes of dynamic inputs, compiling it if needed.
+     *        Runs as a separate pipeline stage, so compilation does not hold the graph of a stream.
+     */
+    void PrepareGraph();
+
 private:
     void PushInputData();
     void PushStates();
-    void PullStates();
 
     void pushInput(const std::string& inputName, InferenceEngine::Blob::Ptr& inputBlob, InferenceEngine::Precision dataType);
 
+    bool isNormalizationFused(const std::string& name) const override;
+    void allocateNormalizedInputs();
+
     void changeDefaultPtr();
+    void updateDynamicOutputs();
+    void inferGraph();
+    void releaseGraph();
+
     std::shared_ptr<MKLDNNExecNetwork>  execNetwork;
     MKLDNNGraph*                        graph = nullptr;
+    std::shared_ptr<MKLDNNGraph>        currentGraph;
+    bool                                isCurrentGraphAcquired = false;
+    int                                 numaNodeId = 0;
     std::map<std::string, void*>        externalPtr;
     openvino::itt::handle_t             profilingTask;
     std::vector<InferenceEngine::IVariableStateInternal::Ptr> memoryStates;
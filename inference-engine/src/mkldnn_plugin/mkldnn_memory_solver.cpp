@@ -7,6 +7,8 @@
 #include <details/ie_exception.hpp>
 
 #include <algorithm>
+#include <limits>
+#include <utility>
 #include <vector>
 #include <map>
 
@@ -56,19 +58,62 @@ inline bool popupTogetherWith(MemorySolver::Box &box_new, const MemorySolver::Bo
     }
 }
 
-int64_t MemorySolver::solve() {
+int64_t MemorySolver::solve(Strategy strategy) {
+    switch (strategy) {
+        case Strategy::FirstFit:
+            _offsets.clear();
+            return solveFirstFit(_offsets);
+        case Strategy::BestFit:
+            _offsets.clear();
+            return solveBestFit(_offsets);
+        case Strategy::Auto: {
+            std::map<int64_t, int64_t> firstFitOffsets, bestFitOffsets;
+            int64_t firstFitSize = solveFirstFit(firstFitOffsets);
+            int64_t bestFitSize = solveBestFit(bestFitOffsets);
+            if (bestFitSize < firstFitSize) {
+                _offsets = std::move(bestFitOffsets);
+                return bestFitSize;
+            }
+            _offsets = std::move(firstFitOffsets);
+            return firstFitSize;
+        }
+        default:
+            THROW_IE_EXCEPTION << "Unsupported memory solver strategy";
+    }
+}
+
+int64_t MemorySolver::maxDepth() {
+    if (_depth == -1) calcDepth();
+    return _depth;
+}
+
+int64_t MemorySolver::maxTopDepth() {
+    if (_top_depth == -1) calcDepth();
+    return _top_depth;
+}
+
+int64_t MemorySolver::getOffset(int id) const {
+    auto res = _offsets.find(id);
+    if (res == _offsets.end()) THROW_IE_EXCEPTION << "There are no box for provided ID";
+    return res->second;
+}
+
+//======== Private =============//
+
+int64_t MemorySolver::solveFirstFit(std::map<int64_t, int64_t>& offsets) {
     maxTopDepth();  // at first make sure that we no need more for boxes sorted by box.start
     std::vector<std::vector<const Box*>> time_slots(_time_duration);
     for (auto & slot : time_slots) slot.reserve(_top_depth);  // 2D array [_time_duration][_top_depth]
 
     // Sort be box size. First is biggest
     // Comment this line to check other order of box putting
-    std::sort(_boxes.begin(), _boxes.end(), [](const Box& l, const Box& r)
+    std::vector<Box> boxes = _boxes;
+    std::sort(boxes.begin(), boxes.end(), [](const Box& l, const Box& r)
         { return l.size > r.size; });
 
     int64_t _min_required = 0;
 
-    for (Box& box : _boxes) {
+    for (Box& box : boxes) {
         // start from bottom and will lift it up if intersect with other present
         int64_t id = box.id;
         box.id = 0;  // id will be used as a temp offset storage
@@ -90,29 +135,58 @@ int64_t MemorySolver::solve() {
 
         // store the max top bound for each box
         _min_required = std::max(_min_required, box.id + box.size);
-        _offsets[id] = box.id;  // TODO: move to constructor (use .insert instead of [])
+        offsets[id] = box.id;
     }
 
     return _min_required;
 }
 
-int64_t MemorySolver::maxDepth() {
-    if (_depth == -1) calcDepth();
-    return _depth;
-}
+int64_t MemorySolver::solveBestFit(std::map<int64_t, int64_t>& offsets) const {
+    std::vector<const Box*> boxes(_boxes.size());
+    for (size_t i = 0; i < _boxes.size(); i++) boxes[i] = &_boxes[i];
+
+    // Big and long living boxes are the hardest to place, so they go first
+    std::sort(boxes.begin(), boxes.end(), [](const Box* l, const Box* r) {
+        if (l->size != r->size) return l->size > r->size;
+        if (l->finish - l->start != r->finish - r->start) return l->finish - l->start > r->finish - r->start;
+        return l->start < r->start;
+    });
+
+    // Already placed boxes with their offsets, ordered by offset
+    std::vector<std::pair<int64_t, const Box*>> placed;
+    placed.reserve(boxes.size());
+
+    int64_t min_required = 0;
+
+    for (const Box* box : boxes) {
+        int64_t best_offset = -1;
+        int64_t best_gap = std::numeric_limits<int64_t>::max();
+        int64_t prev_top = 0;  // top bound of the placed boxes below the current gap
+        for (const auto& item : placed) {
+            const Box* other = item.second;
+            if (other->finish < box->start || box->finish < other->start)
+                continue;  // no intersection on ExecOrder axis
+
+            int64_t gap = item.first - prev_top;
+            if (gap >= box->size && gap < best_gap) {
+                best_gap = gap;
+                best_offset = prev_top;
+            }
+            prev_top = std::max(prev_top, item.first + other->size);
+        }
+        // no suitable gap, put the box on top of all intersected ones
+        if (best_offset == -1) best_offset = prev_top;
 
-int64_t MemorySolver::maxTopDepth() {
-    if (_top_depth == -1) calcDepth();
-    return _top_depth;
-}
+        auto position = std::upper_bound(placed.begin(), placed.end(), best_offset,
+            [](int64_t offset, const std::pair<int64_t, const Box*>& item) { return offset < item.first; });
+        placed.insert(position, {best_offset, box});
 
-int64_t MemorySolver::getOffset(int id) const {
-    auto res = _offsets.find(id);
-    if (res == _offsets.end()) THROW_IE_EXCEPTION << "There are no box for provided ID";
-    return res->second;
-}
+        min_required = std::max(min_required, best_offset + box->size);
+        offsets[box->id] = best_offset;
+    }
 
-//======== Private =============//
+    return min_required;
+}
 
 void MemorySolver::calcDepth() {
     int64_t top_depth = 0;
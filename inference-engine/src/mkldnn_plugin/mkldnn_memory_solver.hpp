@@ -65,13 +65,28 @@ public:
         int64_t id;
     };
 
+    /** @brief Placement strategies of boxes on Mem axis */
+    enum class Strategy {
+        /** Boxes are placed in order of decreasing size at the lowest offset free during their live time */
+        FirstFit,
+        /**
+         * Boxes are placed in order of decreasing size (and live time) into the smallest gap between
+         * already placed boxes which is large enough. Keeps large gaps for the boxes which fit only there.
+         */
+        BestFit,
+        /** All strategies are tried and the one with the smallest memory blob is kept */
+        Auto,
+    };
+
     explicit MemorySolver(const std::vector<Box>& boxes);
 
     /**
      * @brief Solve memory location with maximal reuse.
+     * @param strategy Placement strategy. The method may be called several times with different strategies,
+     *        offsets of the last call are provided by getOffset
      * @return Size of common memory blob required for storing all
      */
-    int64_t solve();
+    int64_t solve(Strategy strategy = Strategy::FirstFit);
 
     /** Provides calculated offset for specified box id */
     int64_t getOffset(int id) const;
@@ -89,6 +104,8 @@ private:
     int _time_duration = -1;
 
     void calcDepth();
+    int64_t solveFirstFit(std::map<int64_t, int64_t>& offsets);
+    int64_t solveBestFit(std::map<int64_t, int64_t>& offsets) const;
 };
 
 }  // namespace MKLDNNPlugin
@@ -19,6 +19,8 @@ void  MKLDNNVariableState::Reset() {
 }
 
 void  MKLDNNVariableState::SetState(Blob::Ptr newState) {
+    if (!newState || newState->byteSize() != storage->byteSize())
+        THROW_IE_EXCEPTION << "Failed to set state '" << name << "': blob of " << storage->byteSize() << " bytes is expected";
     storage = newState;
 }
 
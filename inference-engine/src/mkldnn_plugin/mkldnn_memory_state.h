@@ -7,19 +7,23 @@
 #include "cpp_interfaces/impl/ie_variable_state_internal.hpp"
 #include "blob_factory.hpp"
 #include "mkldnn_memory.h"
-#include "nodes/common/cpu_memcpy.h"
-
+#include <cstring>
 #include <string>
 
 namespace MKLDNNPlugin {
 
 class MKLDNNVariableState : public InferenceEngine::IVariableStateInternal {
 public:
+    /**
+     * @brief Creates zero filled state with the same descriptor as the graph state memory.
+     * The storage is owned by the state and is bound to the graph on every inference, so the graph
+     * memory may hold the state of another infer request at the moment of creation.
+     */
     MKLDNNVariableState(std::string name, MKLDNNMemoryPtr storage) :
             name(name) {
         this->storage = make_blob_with_precision(MKLDNNMemoryDesc(storage->GetDescriptor()));
         this->storage->allocate();
-        cpu_memcpy(this->storage->buffer(), storage->GetData(), storage->GetSize());
+        std::memset(this->storage->buffer(), 0, this->storage->byteSize());
     }
 
     std::string GetName() const override;
@@ -7,6 +7,7 @@
 #include "mkldnn_itt.h"
 
 #include "caseless.hpp"
+#include "ie_hash.hpp"
 #include <vector>
 #include <string>
 #include <limits>
@@ -137,6 +138,7 @@ static const InferenceEngine::details::caseless_unordered_map<std::string, Type>
         { "ReduceProd", ReduceProd},
         { "ReduceSum", ReduceSum},
         { "ReduceSumSquare", ReduceSumSquare},
+        { "Subgraph", Subgraph},
 };
 
 Type TypeFromName(const std::string type) {
@@ -759,7 +761,7 @@ void MKLDNNNode::prepareMemory(const PrimitiveDescInfo *selected_pd, mkldnn::pri
 
         MKLDNNMemoryPtr ptr;
         if (weightCache != nullptr) {
-            const uint64_t data_hash = weightCache->GetHashFunc().hash(
+            const uint64_t data_hash = InferenceEngine::DataHasher::hash(
                     internalBlob->buffer(), internalBlob->byteSize());
 
             const std::string string_hash = name + "_" + std::to_string(i)
@@ -7,12 +7,14 @@
 #include "mkldnn_extension_mngr.h"
 #include "mkldnn_weights_cache.hpp"
 #include "mkldnn_itt.h"
+#include "mkldnn_serialize.h"
 
 #include <legacy/net_pass.h>
 #include <threading/ie_executor_manager.hpp>
 #include <memory>
 #include <ie_plugin_config.hpp>
 #include <vector>
+#include <algorithm>
 #include <tuple>
 #include <ie_system_conf.h>
 #include <nodes/list.hpp>
@@ -22,6 +24,7 @@
 
 #include <legacy/convert_function_to_cnn_network.hpp>
 #include <legacy/transformations/convert_opset1_to_legacy/convert_opset1_to_legacy.hpp>
+#include <legacy/transformations/convert_opset1_to_legacy/convert_matmul_to_fc_or_gemm.hpp>
 #include <legacy/transformations/convert_opset1_to_legacy/convert_prior_to_ie_prior.hpp>
 #include <legacy/transformations/convert_opset1_to_legacy/reshape_fully_connected.hpp>
 #include <legacy/transformations/convert_opset1_to_legacy/convert_nms_5_to_legacy.hpp>
@@ -68,8 +71,11 @@
 #include <ngraph/opsets/opset2.hpp>
 #include <ngraph/opsets/opset3.hpp>
 #include <ngraph/opsets/opset4.hpp>
+#include <ngraph/opsets/opset5.hpp>
 #include <ngraph/op/util/op_types.hpp>
+#include <ngraph/graph_util.hpp>
 #include <ngraph/pass/manager.hpp>
+#include <ngraph/runtime/parallel.hpp>
 
 #include <transformations/common_optimizations/lin_op_sequence_fusion.hpp>
 
@@ -80,10 +86,14 @@
 #include <low_precision/convolution.hpp>
 #include <low_precision/group_convolution.hpp>
 #include <low_precision/multiply_to_group_convolution.hpp>
+#include <low_precision/recurrent_cell.hpp>
 #include <low_precision/network_helper.hpp>
 
+#include <snippets/pass/collapse_subgraph.hpp>
+
 #include "nodes/mkldnn_mvn_node.h"
 #include "nodes/mkldnn_quantize_node.h"
+#include "emitters/cpu_generator.hpp"
 
 #if !defined(__arm__) && !defined(_M_ARM) && !defined(__aarch64__) && !defined(_M_ARM64)
 # ifdef _WIN32
@@ -107,7 +117,26 @@ Engine::~Engine() {
     ExecutorManager::getInstance()->clear("CPUCallbackExecutor");
 }
 
+static std::vector<std::pair<ngraph::element::Type, ngraph::element::Type>> getConvertPrecisionList() {
+    return {
+            {ngraph::element::i64,     ngraph::element::i32},
+            {ngraph::element::u64,     ngraph::element::i32},
+            {ngraph::element::i16,     ngraph::element::i32},
+            {ngraph::element::u16,     ngraph::element::i32},
+            {ngraph::element::u32,     ngraph::element::i32},
+            {ngraph::element::f16,     ngraph::element::f32},
+            {ngraph::element::boolean, ngraph::element::u8},
+    };
+}
+
+// constant folding kernels run on the number of threads the plugin is configured for
+static size_t getFoldingThreadsLimit(const Config& conf) {
+    const int threads = conf.streamExecutorConfig._threads;
+    return static_cast<size_t>(threads > 0 ? threads : parallel_get_max_threads());
+}
+
 static void Transformation(CNNNetwork& clonedNetwork, const Config& conf) {
+    ngraph::runtime::ParallelThreadsLimit foldingThreadsLimit(getFoldingThreadsLimit(conf));
     auto nGraphFunc = clonedNetwork.getFunction();
 
     ngraph::pass::Manager manager;
@@ -119,6 +148,9 @@ static void Transformation(CNNNetwork& clonedNetwork, const Config& conf) {
     if (useLpt) {
         manager.register_pass<ngraph::pass::DisableConvertConstantFoldingOnConstPath>(
             std::vector<ngraph::element::Type>{ ngraph::element::i8, ngraph::element::u8 });
+    } else {
+        // weight-only compressed MatMul is executed by FullyConnected node which decompresses weights on the fly
+        manager.register_pass<ngraph::pass::DisableCompressedWeightsConstantFolding>();
     }
 
     // WA: ConvertPriorBox must be executed before the 1st ConstantFolding pass
@@ -137,17 +169,7 @@ static void Transformation(CNNNetwork& clonedNetwork, const Config& conf) {
     manager.register_pass<ngraph::pass::GRUCellDecomposition>();
     manager.register_pass<ngraph::pass::RNNCellDecomposition>();
 
-    std::vector<std::pair<ngraph::element::Type, ngraph::element::Type>> convert_precision_list{
-            {ngraph::element::i64,     ngraph::element::i32},
-            {ngraph::element::u64,     ngraph::element::i32},
-            {ngraph::element::i16,     ngraph::element::i32},
-            {ngraph::element::u16,     ngraph::element::i32},
-            {ngraph::element::u32,     ngraph::element::i32},
-            {ngraph::element::f16,     ngraph::element::f32},
-            {ngraph::element::boolean, ngraph::element::u8},
-    };
-
-    for (auto &precision : convert_precision_list) {
+    for (auto &precision : getConvertPrecisionList()) {
         manager.register_pass<ngraph::pass::ConvertPrecision>(precision.first, precision.second);
     }
 
@@ -269,12 +291,34 @@ static void Transformation(CNNNetwork& clonedNetwork, const Config& conf) {
                 LayerTransformation::Params(params).setPrecisionsOnActivations({ngraph::element::u8}).setSupportAsymmetricQuantization(true))
             .add<GroupConvolutionTransformation, ngraph::opset1::GroupConvolution>(
                 LayerTransformation::Params(params).setPrecisionsOnActivations({ ngraph::element::u8 }).setSupportAsymmetricQuantization(true))
+            .add<RecurrentCellTransformation, ngraph::opset5::LSTMSequence>(
+                LayerTransformation::Params(params).setPrecisionsOnActivations({ ngraph::element::u8 }))
             .addStandaloneCleanup<MultiplyToGroupConvolutionTransformation, ngraph::opset1::Multiply>(
                 LayerTransformation::Params(params).setPrecisionsOnActivations({ ngraph::element::u8 })));
 
         transformer.transform(nGraphFunc);
     }
 
+    if (conf.enableSnippets) {
+        OV_ITT_SCOPED_TASK(MKLDNNPlugin::itt::domains::MKLDNN_LT, "TokenizeSnippets");
+
+        ngraph::pass::Manager snippetsManager;
+        snippetsManager.register_pass<ngraph::snippets::pass::TokenizeSnippets>();
+        snippetsManager.get_pass_config()->set_callback<ngraph::snippets::pass::StartSubgraph,
+                                                        ngraph::snippets::pass::AttachToSubgraph>(
+                [](const std::shared_ptr<const ngraph::Node> &node) -> bool {
+                    return !CPUTargetMachine::isSupported(node);
+                });
+        snippetsManager.run_passes(nGraphFunc);
+    }
+}
+
+static void ConvertToLegacy(CNNNetwork& clonedNetwork, const Config& conf) {
+    ngraph::runtime::ParallelThreadsLimit foldingThreadsLimit(getFoldingThreadsLimit(conf));
+    auto nGraphFunc = clonedNetwork.getFunction();
+
+    using const_node_ptr = const std::shared_ptr<const ngraph::Node>;
+
     bool has_fake_quantize = ::ngraph::op::util::has_op_with_type<ngraph::op::FakeQuantize>(nGraphFunc);
 
     ngraph::pass::Manager legacyManager;
@@ -287,6 +331,8 @@ static void Transformation(CNNNetwork& clonedNetwork, const Config& conf) {
 
     auto legacyPassConfig = legacyManager.get_pass_config();
 
+    legacyPassConfig->enable<ngraph::pass::ConvertMatMulWithCompressedWeightsToFC>();
+
     legacyPassConfig->set_callback<ngraph::pass::FakeQuantizeDecomposition>([](const_node_ptr &node) -> bool {
         return !MKLDNNQuantizeNode::isNeedToDecompose(node);
     });
@@ -320,13 +366,62 @@ static void Transformation(CNNNetwork& clonedNetwork, const Config& conf) {
 
     // WA: after conversion to CNNNetwork user precision can redefine input/output precisions
     // so we need to apply additional precision conversion but only for inputs and outputs
-    for (auto & precision : convert_precision_list) {
+    for (auto & precision : getConvertPrecisionList()) {
         NetPass::ConvertIOPrecision(clonedNetwork,
             InferenceEngine::details::convertPrecision(precision.first),
             InferenceEngine::details::convertPrecision(precision.second));
     }
 }
 
+static void TrimLegacyNetwork(CNNNetwork& clonedNetwork, bool isConverted) {
+    IE_SUPPRESS_DEPRECATED_START
+    auto icnnnet = static_cast<ICNNNetwork::Ptr>(clonedNetwork);
+    IE_SUPPRESS_DEPRECATED_END
+    auto implNetwork = std::dynamic_pointer_cast<details::CNNNetworkImpl>(icnnnet);
+    if (implNetwork) {
+        OV_ITT_SCOPED_TASK(itt::domains::MKLDNN_LT, "CNNNet_based_ConstFolding");
+        // valid for CNNNetworkImpl only, while there's no API in ICNNNetwork to change network
+        ConstTransformer transformator(implNetwork.get());
+        transformator.fullTrim();
+        if (!isConverted) {
+            InferenceEngine::CNNNetwork implNetworkWrapper(implNetwork);
+            NetPass::ConvertPrecision(implNetworkWrapper, Precision::I64, Precision::I32);
+            NetPass::ConvertPrecision(implNetworkWrapper, Precision::U64, Precision::I32);
+            NetPass::ConvertPrecision(implNetworkWrapper, Precision::U32, Precision::I32);
+            NetPass::ConvertPrecision(implNetworkWrapper, Precision::FP16, Precision::FP32);
+            NetPass::ConvertPrecision(implNetworkWrapper, Precision::BOOL, Precision::U8);
+            NetPass::ConvertPrecision(implNetworkWrapper, Precision::U16, Precision::I32);
+            NetPass::ConvertPrecision(implNetworkWrapper, Precision::I16, Precision::I32);
+        }
+    }
+}
+
+// Collects bounds of inputs with dynamic shapes, only dimensions with an upper bound are supported
+static MKLDNNExecNetwork::InputBounds GetDynamicInputBounds(const ngraph::Function& function) {
+    MKLDNNExecNetwork::InputBounds bounds;
+    for (const auto& param : function.get_parameters()) {
+        const auto& shape = param->get_partial_shape();
+        if (shape.is_static())
+            continue;
+        if (shape.rank().is_dynamic()) {
+            THROW_IE_EXCEPTION << NOT_IMPLEMENTED_str << "Input " << param->get_friendly_name()
+                               << " has dynamic rank which is not supported by CPU plugin";
+        }
+
+        SizeVector lower, upper;
+        for (const auto& dim : shape) {
+            if (!dim.get_interval().has_upper_bound()) {
+                THROW_IE_EXCEPTION << NOT_IMPLEMENTED_str << "Input " << param->get_friendly_name() << " has shape " << shape
+                                   << ". CPU plugin supports only dynamic dimensions with an upper bound";
+            }
+            lower.push_back(static_cast<size_t>(std::max<int64_t>(dim.get_min_length(), 1)));
+            upper.push_back(static_cast<size_t>(dim.get_max_length()));
+        }
+        bounds[param->get_friendly_name()] = {lower, upper};
+    }
+    return bounds;
+}
+
 InferenceEngine::ExecutableNetworkInternal::Ptr
 Engine::LoadExeNetworkImpl(const InferenceEngine::CNNNetwork &network, const std::map<std::string, std::string> &config) {
     OV_ITT_SCOPED_TASK(itt::domains::MKLDNNPlugin, "Engine::LoadExeNetworkImpl");
@@ -356,39 +451,111 @@ Engine::LoadExeNetworkImpl(const InferenceEngine::CNNNetwork &network, const std
     Config conf = engConfig;
     conf.readProperties(config);
 
+    auto dynamicInputs = network.getFunction() ? GetDynamicInputBounds(*network.getFunction())
+                                               : MKLDNNExecNetwork::InputBounds{};
+    if (!dynamicInputs.empty()) {
+        if (conf.enableDynamicBatch)
+            THROW_IE_EXCEPTION << NOT_IMPLEMENTED_str << "Dynamic batch cannot be used with dynamic input shapes";
+        return CompileDynamicNetwork(network, conf, dynamicInputs);
+    }
+
+    if (conf.enableDynamicBatch) {
+        conf.batchLimit = static_cast<int>(network.getBatchSize());
+    }
+
+    return CompileNetwork(network, conf, false);
+}
+
+MKLDNNExecNetwork::Ptr Engine::CompileDynamicNetwork(const CNNNetwork& network, const Config& conf,
+                                                     const MKLDNNExecNetwork::InputBounds& dynamicInputs) {
+    OV_ITT_SCOPED_TASK(itt::domains::MKLDNNPlugin, "Engine::CompileDynamicNetwork");
+
+    // The main graph of each stream is compiled for the upper bounds of dynamic dimensions,
+    // graphs for other shapes are built on demand from the original network
+    ICNNNetwork::InputShapes upperBounds;
+    for (const auto& input : dynamicInputs) {
+        upperBounds[input.first] = input.second.second;
+    }
+    CNNNetwork staticNetwork = InferenceEngine::cloneNetwork(network);
+    staticNetwork.reshape(upperBounds);
+    auto execNetwork = CompileNetwork(staticNetwork, conf, false);
+
+    CNNNetwork dynamicNetwork = InferenceEngine::cloneNetwork(network);
+    execNetwork->setDynamicInputs(dynamicInputs, [dynamicNetwork, conf](const ICNNNetwork::InputShapes& shapes) {
+        CNNNetwork reshapedNetwork = InferenceEngine::cloneNetwork(dynamicNetwork);
+        reshapedNetwork.reshape(shapes);
+        Transformation(reshapedNetwork, conf);
+        ConvertToLegacy(reshapedNetwork, conf);
+        TrimLegacyNetwork(reshapedNetwork, true);
+        return reshapedNetwork;
+    });
+    // Export would lose the dynamic dimensions
+    execNetwork->setExportFunctionBuilder(nullptr);
+    return execNetwork;
+}
+
+InferenceEngine::ExecutableNetwork
+Engine::ImportNetworkImpl(std::istream& networkModel, const std::map<std::string, std::string>& config) {
+    OV_ITT_SCOPED_TASK(itt::domains::MKLDNNPlugin, "Engine::ImportNetworkImpl");
+    if (GetCore() == nullptr) {
+        THROW_IE_EXCEPTION << "Please, work with CPU device via InferenceEngine::Core object";
+    }
+
+    bool isTransformed = false;
+    CNNNetwork network = deserializeNetwork(networkModel, GetCore(), isTransformed);
+
+    Config conf = engConfig;
+    conf.readProperties(config);
+
     if (conf.enableDynamicBatch) {
         conf.batchLimit = static_cast<int>(network.getBatchSize());
     }
 
+    auto execNetwork = CompileNetwork(network, conf, isTransformed);
+
+    InputsDataMap networkInputs;
+    OutputsDataMap networkOutputs;
+    copyInputOutputInfo(network.getInputsInfo(), network.getOutputsInfo(), networkInputs, networkOutputs);
+    execNetwork->setNetworkInputs(networkInputs);
+    execNetwork->setNetworkOutputs(networkOutputs);
+    execNetwork->SetPointerToPlugin(shared_from_this());
+
+    return make_executable_network(execNetwork);
+}
+
+MKLDNNExecNetwork::Ptr Engine::CompileNetwork(const CNNNetwork& network, const Config& conf, bool isTransformed) {
     CNNNetwork clonedNetwork = InferenceEngine::cloneNetwork(network);
 
     bool is_transformed = false;
     if (clonedNetwork.getFunction()) {
-        Transformation(clonedNetwork, conf);
+        if (!isTransformed) {
+            Transformation(clonedNetwork, conf);
+        }
+        ConvertToLegacy(clonedNetwork, conf);
         is_transformed = true;
     }
-    IE_SUPPRESS_DEPRECATED_START
-    auto icnnnet = static_cast<ICNNNetwork::Ptr>(clonedNetwork);
-    IE_SUPPRESS_DEPRECATED_END
-    auto implNetwork = std::dynamic_pointer_cast<details::CNNNetworkImpl>(icnnnet);
-    if (implNetwork) {
-        OV_ITT_SCOPED_TASK(itt::domains::MKLDNN_LT, "CNNNet_based_ConstFolding");
-        // valid for CNNNetworkImpl only, while there's no API in ICNNNetwork to change network
-        ConstTransformer transformator(implNetwork.get());
-        transformator.fullTrim();
-        if (!is_transformed) {
-            InferenceEngine::CNNNetwork implNetworkWrapper(implNetwork);
-            NetPass::ConvertPrecision(implNetworkWrapper, Precision::I64, Precision::I32);
-            NetPass::ConvertPrecision(implNetworkWrapper, Precision::U64, Precision::I32);
-            NetPass::ConvertPrecision(implNetworkWrapper, Precision::U32, Precision::I32);
-            NetPass::ConvertPrecision(implNetworkWrapper, Precision::FP16, Precision::FP32);
-            NetPass::ConvertPrecision(implNetworkWrapper, Precision::BOOL, Precision::U8);
-            NetPass::ConvertPrecision(implNetworkWrapper, Precision::U16, Precision::I32);
-            NetPass::ConvertPrecision(implNetworkWrapper, Precision::I16, Precision::I32);
-        }
+    TrimLegacyNetwork(clonedNetwork, is_transformed);
+
+    auto execNetwork = std::make_shared<MKLDNNExecNetwork>(clonedNetwork, conf, extensionManager, weightsSharing);
+
+    // Export rebuilds the function from the original one while it is alive (e.g. during LoadNetwork with CACHE_DIR),
+    // so loaded networks don't hold a copy of the function with folded constants. Imported networks aren't exported.
+    if (network.getFunction() && !isTransformed) {
+        std::weak_ptr<ngraph::Function> original = network.getFunction();
+        execNetwork->setExportFunctionBuilder([original, conf](bool& isExportTransformed) -> std::shared_ptr<ngraph::Function> {
+            auto function = original.lock();
+            if (!function)
+                return nullptr;
+
+            // the transformed function is exported if it can be read back from IR as is,
+            // so import skips the nGraph transformation pipeline, otherwise the original one
+            CNNNetwork transformedNetwork(ngraph::clone_function(*function));
+            Transformation(transformedNetwork, conf);
+            isExportTransformed = isSerializable(transformedNetwork.getFunction(), false);
+            return isExportTransformed ? transformedNetwork.getFunction() : ngraph::clone_function(*function);
+        });
     }
-
-    return std::make_shared<MKLDNNExecNetwork>(clonedNetwork, conf, extensionManager, weightsSharing);
+    return execNetwork;
 }
 
 void Engine::SetConfig(const std::map<std::string, std::string> &config) {
@@ -431,6 +598,7 @@ Parameter Engine::GetMetric(const std::string& name, const std::map<std::string,
         metrics.push_back(METRIC_KEY(SUPPORTED_CONFIG_KEYS));
         metrics.push_back(METRIC_KEY(RANGE_FOR_ASYNC_INFER_REQUESTS));
         metrics.push_back(METRIC_KEY(RANGE_FOR_STREAMS));
+        metrics.push_back(METRIC_KEY(IMPORT_EXPORT_SUPPORT));
         IE_SET_METRIC_RETURN(SUPPORTED_METRICS, metrics);
     } else if (name == METRIC_KEY(FULL_DEVICE_NAME)) {
         std::string brand_string;
@@ -477,6 +645,8 @@ Parameter Engine::GetMetric(const std::string& name, const std::map<std::string,
     } else if (name == METRIC_KEY(RANGE_FOR_STREAMS)) {
         std::tuple<unsigned int, unsigned int> range = std::make_tuple(1, parallel_get_max_threads());
         IE_SET_METRIC_RETURN(RANGE_FOR_STREAMS, range);
+    } else if (name == METRIC_KEY(IMPORT_EXPORT_SUPPORT)) {
+        IE_SET_METRIC_RETURN(IMPORT_EXPORT_SUPPORT, true);
     } else {
         THROW_IE_EXCEPTION << "Unsupported metric key " << name;
     }
@@ -36,7 +36,15 @@ public:
     InferenceEngine::QueryNetworkResult QueryNetwork(const InferenceEngine::CNNNetwork& network,
                                                      const std::map<std::string, std::string>& config) const override;
 
+    InferenceEngine::ExecutableNetwork ImportNetworkImpl(std::istream& networkModel,
+                                                         const std::map<std::string, std::string>& config) override;
+
 private:
+    MKLDNNExecNetwork::Ptr CompileNetwork(const InferenceEngine::CNNNetwork& network, const Config& conf, bool isTransformed);
+
+    MKLDNNExecNetwork::Ptr CompileDynamicNetwork(const InferenceEngine::CNNNetwork& network, const Config& conf,
+                                                 const MKLDNNExecNetwork::InputBounds& dynamicInputs);
+
     Config engConfig;
     NumaNodesWeights weightsSharing;
     MKLDNNExtensionManager::Ptr extensionManager = std::make_shared<MKLDNNExtensionManager>();
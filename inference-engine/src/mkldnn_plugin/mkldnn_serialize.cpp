@@ -0,0 +1,241 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "mkldnn_serialize.h"
+
+#include <cpp_interfaces/exception2status.hpp>
+#include <ngraph/opsets/opset.hpp>
+#include <ngraph/op/util/sub_graph_base.hpp>
+#include <ngraph_ops/type_relaxed.hpp>
+#include <transformations/serialize.hpp>
+#include <transformations/rt_info/fused_names_attribute.hpp>
+
+#include <array>
+#include <functional>
+#include <limits>
+#include <map>
+#include <sstream>
+#include <string>
+#include <utility>
+#include <vector>
+
+using namespace InferenceEngine;
+
+namespace MKLDNNPlugin {
+
+namespace {
+
+// Version of the export format. Must be incremented on any change of the stream layout.
+constexpr std::uint32_t exportFormatVersion = 1;
+
+template <typename T>
+void write(std::ostream& stream, const T& value) {
+    stream.write(reinterpret_cast<const char*>(&value), sizeof(value));
+}
+
+void write(std::ostream& stream, const std::string& value) {
+    write(stream, static_cast<std::uint64_t>(value.size()));
+    stream.write(value.c_str(), value.size());
+}
+
+template <typename T>
+T read(std::istream& stream) {
+    T value {};
+    stream.read(reinterpret_cast<char*>(&value), sizeof(value));
+    if (!stream.good())
+        THROW_IE_EXCEPTION_WITH_STATUS(NETWORK_NOT_READ) << "Unexpected end of CPU plugin exported network";
+    return value;
+}
+
+// Checks that the stream has at least size bytes left, so corrupted lengths don't cause huge allocations
+std::uint64_t checkRemainingSize(std::istream& stream, std::uint64_t size) {
+    const auto current = stream.tellg();
+    if (current != std::istream::pos_type(-1)) {
+        stream.seekg(0, std::ios::end);
+        const auto end = stream.tellg();
+        stream.seekg(current);
+        if (end == std::istream::pos_type(-1) || static_cast<std::uint64_t>(end - current) < size)
+            THROW_IE_EXCEPTION_WITH_STATUS(NETWORK_NOT_READ) << "Unexpected end of CPU plugin exported network";
+    }
+    return size;
+}
+
+std::string readString(std::istream& stream) {
+    std::string value;
+    value.resize(static_cast<size_t>(checkRemainingSize(stream, read<std::uint64_t>(stream))));
+    stream.read(&value[0], value.size());
+    if (!stream.good())
+        THROW_IE_EXCEPTION_WITH_STATUS(NETWORK_NOT_READ) << "Unexpected end of CPU plugin exported network";
+    return value;
+}
+
+}  // namespace
+
+bool isSerializable(const std::shared_ptr<const ngraph::Function>& function, bool allowRtInfo) {
+    const std::array<std::reference_wrapper<const ngraph::OpSet>, 7> opsets = {
+        ngraph::get_opset1(), ngraph::get_opset2(), ngraph::get_opset3(),
+        ngraph::get_opset4(), ngraph::get_opset5(), ngraph::get_opset6(),
+        ngraph::get_opset7()};
+
+    for (const auto& op : function->get_ops()) {
+        // type relaxed operations have output precisions which cannot be inferred back after reading
+        if (std::dynamic_pointer_cast<ngraph::op::TypeRelaxedBase>(op))
+            return false;
+
+        bool isKnownOp = false;
+        for (const auto& opset : opsets) {
+            if (opset.get().contains_op_type(op.get())) {
+                isKnownOp = true;
+                break;
+            }
+        }
+        if (!isKnownOp)
+            return false;
+
+        if (!allowRtInfo) {
+            for (const auto& rtInfo : op->get_rt_info()) {
+                if (rtInfo.first != ngraph::VariantWrapper<ngraph::FusedNames>::type_info.name)
+                    return false;
+            }
+        }
+
+        if (const auto subGraphOp = std::dynamic_pointer_cast<const ngraph::op::util::SubGraphOp>(op)) {
+            if (!isSerializable(subGraphOp->get_function(), allowRtInfo))
+                return false;
+        }
+    }
+
+    return true;
+}
+
+void serializeNetwork(std::ostream& stream,
+                      const std::shared_ptr<ngraph::Function>& function,
+                      bool isTransformed,
+                      const InputsDataMap& inputs,
+                      const OutputsDataMap& outputs) {
+    write(stream, exportFormatVersion);
+    write(stream, static_cast<std::uint8_t>(isTransformed));
+
+    write(stream, static_cast<std::uint64_t>(inputs.size()));
+    for (const auto& input : inputs) {
+        const auto& preProcess = input.second->getPreProcess();
+        if (preProcess.getMeanVariant() == MEAN_IMAGE)
+            THROW_IE_EXCEPTION_WITH_STATUS(NOT_IMPLEMENTED) << "Export of networks with mean image is not supported";
+
+        write(stream, input.first);
+        write(stream, static_cast<std::int32_t>(input.second->getPrecision()));
+        write(stream, static_cast<std::int32_t>(input.second->getLayout()));
+        write(stream, static_cast<std::int32_t>(preProcess.getResizeAlgorithm()));
+        write(stream, static_cast<std::int32_t>(preProcess.getColorFormat()));
+        write(stream, static_cast<std::int32_t>(preProcess.getMeanVariant()));
+        write(stream, static_cast<std::uint64_t>(preProcess.getNumberOfChannels()));
+        for (size_t c = 0; c < preProcess.getNumberOfChannels(); c++) {
+            write(stream, preProcess[c]->meanValue);
+            write(stream, preProcess[c]->stdScale);
+        }
+    }
+
+    write(stream, static_cast<std::uint64_t>(outputs.size()));
+    for (const auto& output : outputs) {
+        write(stream, output.first);
+        write(stream, static_cast<std::int32_t>(output.second->getPrecision()));
+        write(stream, static_cast<std::int32_t>(output.second->getLayout()));
+    }
+
+    std::stringstream xmlFile, binFile;
+    ngraph::pass::Serialize serializer(xmlFile, binFile, ngraph::pass::Serialize::Version::IR_V10);
+    serializer.run_on_function(function);
+
+    write(stream, xmlFile.str());
+    write(stream, binFile.str());
+}
+
+CNNNetwork deserializeNetwork(std::istream& stream, const ICore* core, bool& isTransformed) {
+    if (read<std::uint32_t>(stream) != exportFormatVersion)
+        THROW_IE_EXCEPTION_WITH_STATUS(NETWORK_NOT_READ) << "Unsupported version of CPU plugin exported network";
+    isTransformed = read<std::uint8_t>(stream) != 0;
+
+    struct InputDesc {
+        Precision precision;
+        Layout layout;
+        ResizeAlgorithm resizeAlgorithm;
+        ColorFormat colorFormat;
+        MeanVariant meanVariant;
+        std::vector<std::pair<float, float>> channels;
+    };
+    std::map<std::string, InputDesc> inputDescs;
+    for (auto i = read<std::uint64_t>(stream); i > 0; i--) {
+        auto name = readString(stream);
+        auto& desc = inputDescs[name];
+        desc.precision = static_cast<Precision::ePrecision>(read<std::int32_t>(stream));
+        desc.layout = static_cast<Layout>(read<std::int32_t>(stream));
+        desc.resizeAlgorithm = static_cast<ResizeAlgorithm>(read<std::int32_t>(stream));
+        desc.colorFormat = static_cast<ColorFormat>(read<std::int32_t>(stream));
+        desc.meanVariant = static_cast<MeanVariant>(read<std::int32_t>(stream));
+        const auto channels = read<std::uint64_t>(stream);
+        constexpr std::uint64_t channelSize = 2 * sizeof(float);
+        if (channels > std::numeric_limits<std::uint64_t>::max() / channelSize)
+            THROW_IE_EXCEPTION_WITH_STATUS(NETWORK_NOT_READ) << "Unexpected end of CPU plugin exported network";
+        checkRemainingSize(stream, channels * channelSize);
+        desc.channels.resize(static_cast<size_t>(channels));
+        for (auto& channel : desc.channels) {
+            channel.first = read<float>(stream);
+            channel.second = read<float>(stream);
+        }
+    }
+
+    std::map<std::string, std::pair<Precision, Layout>> outputDescs;
+    for (auto i = read<std::uint64_t>(stream); i > 0; i--) {
+        auto name = readString(stream);
+        auto precision = static_cast<Precision::ePrecision>(read<std::int32_t>(stream));
+        auto layout = static_cast<Layout>(read<std::int32_t>(stream));
+        outputDescs[name] = {precision, layout};
+    }
+
+    auto xmlString = readString(stream);
+    Blob::Ptr weights;
+    auto weightsSize = checkRemainingSize(stream, read<std::uint64_t>(stream));
+    if (weightsSize != 0) {
+        weights = make_shared_blob<std::uint8_t>({Precision::U8, {static_cast<size_t>(weightsSize)}, C});
+        weights->allocate();
+        stream.read(weights->buffer(), weightsSize);
+        if (!stream.good())
+            THROW_IE_EXCEPTION_WITH_STATUS(NETWORK_NOT_READ) << "Unexpected end of CPU plugin exported network";
+    }
+
+    auto network = core->ReadNetwork(xmlString, weights);
+
+    for (const auto& input : network.getInputsInfo()) {
+        auto it = inputDescs.find(input.first);
+        if (it == inputDescs.end())
+            THROW_IE_EXCEPTION_WITH_STATUS(NETWORK_NOT_READ) << "Input " << input.first << " is not found in exported network";
+        const auto& desc = it->second;
+        input.second->setPrecision(desc.precision);
+        input.second->setLayout(desc.layout);
+
+        auto& preProcess = input.second->getPreProcess();
+        preProcess.setResizeAlgorithm(desc.resizeAlgorithm);
+        preProcess.setColorFormat(desc.colorFormat);
+        if (!desc.channels.empty()) {
+            preProcess.init(desc.channels.size());
+            for (size_t c = 0; c < desc.channels.size(); c++) {
+                preProcess[c]->meanValue = desc.channels[c].first;
+                preProcess[c]->stdScale = desc.channels[c].second;
+            }
+        }
+        preProcess.setVariant(desc.meanVariant);
+    }
+
+    for (const auto& output : network.getOutputsInfo()) {
+        auto it = outputDescs.find(output.first);
+        if (it == outputDescs.end())
+            THROW_IE_EXCEPTION_WITH_STATUS(NETWORK_NOT_READ) << "Output " << output.first << " is not found in exported network";
+        output.second->setPrecision(it->second.first);
+        output.second->setLayout(it->second.second);
+    }
+
+    return network;
+}
+
+}  // namespace MKLDNNPlugin
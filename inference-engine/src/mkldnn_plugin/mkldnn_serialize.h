@@ -0,0 +1,51 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <cpp/ie_cnn_network.h>
+#include <ie_icore.hpp>
+#include <ngraph/function.hpp>
+
+#include <istream>
+#include <ostream>
+#include <memory>
+
+namespace MKLDNNPlugin {
+
+/**
+ * @brief Checks that the function consists of operations from the default opsets only and therefore can be
+ *        restored from IR without any loss of information.
+ * @param function nGraph function to check
+ * @param allowRtInfo whether runtime info attributes other than fused names may be present on the nodes
+ */
+bool isSerializable(const std::shared_ptr<const ngraph::Function>& function, bool allowRtInfo);
+
+/**
+ * @brief Writes the network to the stream in the CPU plugin export format:
+ *        inputs/outputs information (precision, layout, preprocessing) followed by IR v10 xml and weights.
+ * @param stream Output stream
+ * @param function nGraph function to serialize
+ * @param isTransformed `true` if the function has already passed through the plugin nGraph transformations
+ * @param inputs Inputs information of the executable network
+ * @param outputs Outputs information of the executable network
+ */
+void serializeNetwork(std::ostream& stream,
+                      const std::shared_ptr<ngraph::Function>& function,
+                      bool isTransformed,
+                      const InferenceEngine::InputsDataMap& inputs,
+                      const InferenceEngine::OutputsDataMap& outputs);
+
+/**
+ * @brief Reads the network written by serializeNetwork
+ * @param stream Input stream
+ * @param core Core object used to read IR
+ * @param isTransformed is set to `true` if the read function has already passed through the plugin transformations
+ * @return The network with restored inputs and outputs information
+ */
+InferenceEngine::CNNNetwork deserializeNetwork(std::istream& stream,
+                                               const InferenceEngine::ICore* core,
+                                               bool& isTransformed);
+
+}  // namespace MKLDNNPlugin
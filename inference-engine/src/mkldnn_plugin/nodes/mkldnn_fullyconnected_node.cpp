@@ -7,15 +7,192 @@
 #include "mkldnn_quantize_node.h"
 
 #include <legacy/ie_layers.h>
+#include <algorithm>
+#include <cstring>
 #include <string>
 #include <vector>
 #include <mkldnn_extension_utils.h>
 #include <mkldnn.hpp>
 #include "utils/general_utils.h"
+#include "common/cpu_convert.h"
+#include "ie_hash.hpp"
+#include "ie_parallel.hpp"
+
+#include <cpu/x64/jit_generator.hpp>
 
 using namespace mkldnn;
 using namespace MKLDNNPlugin;
 using namespace InferenceEngine;
+using namespace mkldnn::impl;
+using namespace mkldnn::impl::cpu::x64;
+using namespace Xbyak;
+
+#define GET_OFF(field) offsetof(jit_fc_compressed_call_args, field)
+
+// number of source rows processed by one call of the compressed weights kernel
+static const size_t compressedRowsBlock = 4;
+
+// dst[rows][simd_w] = (src[rows][K] * (weights[K][simd_w] - zero_points)) * scales + bias
+template <cpu_isa_t isa>
+struct jit_uni_fc_compressed_kernel_f32 : public jit_uni_fc_compressed_kernel, public jit_generator {
+    DECLARE_CPU_JIT_AUX_FUNCTIONS(jit_uni_fc_compressed_kernel_f32)
+
+    explicit jit_uni_fc_compressed_kernel_f32(jit_fc_compressed_config_params jcp) : jit_uni_fc_compressed_kernel(jcp), jit_generator() {}
+
+    void create_ker() override {
+        jit_generator::create_kernel();
+        ker_ = (decltype(ker_))jit_ker();
+    }
+
+    void generate() override {
+        this->preamble();
+
+        mov(reg_src_stride, ptr[reg_params + GET_OFF(src_stride)]);
+        mov(reg_src(0), ptr[reg_params + GET_OFF(src)]);
+        for (size_t r = 1; r < jcp_.rows; r++) {
+            mov(reg_src(r), reg_src(r - 1));
+            add(reg_src(r), reg_src_stride);
+        }
+        mov(reg_weights, ptr[reg_params + GET_OFF(weights)]);
+        mov(reg_tmp, ptr[reg_params + GET_OFF(zero_points)]);
+        uni_vmovups(vmm_zero_point, ptr[reg_tmp]);
+        if (jcp_.packed_int4) {
+            mov(reg_tmp, l_table);
+            uni_vmovups(vmm_mask, ptr[reg_tmp]);
+        }
+
+        for (size_t r = 0; r < jcp_.rows; r++)
+            uni_vpxor(vmm_acc(r), vmm_acc(r), vmm_acc(r));
+
+        const size_t src_data_size = jcp_.src_prc.size();
+        const size_t src_step = jcp_.packed_int4 ? 2 : 1;
+
+        Xbyak::Label loop_label;
+        Xbyak::Label loop_end_label;
+
+        mov(reg_work_amount, jcp_.K / src_step);
+        L(loop_label);
+        {
+            cmp(reg_work_amount, 0);
+            jle(loop_end_label, T_NEAR);
+
+            if (jcp_.packed_int4) {
+                uni_vpmovzxbd(vmm_weights, ptr[reg_weights]);
+                uni_vpsrld(vmm_weights_hi, vmm_weights, 4);
+                uni_vandps(vmm_weights, vmm_weights, vmm_mask);
+                decompress(vmm_weights);
+                decompress(vmm_weights_hi);
+                for (size_t r = 0; r < jcp_.rows; r++) {
+                    load_src(vmm_src, reg_src(r), 0);
+                    fma(vmm_acc(r), vmm_weights, vmm_src);
+                    load_src(vmm_src, reg_src(r), src_data_size);
+                    fma(vmm_acc(r), vmm_weights_hi, vmm_src);
+                }
+            } else {
+                if (jcp_.wei_prc == Precision::I8)
+                    uni_vpmovsxbd(vmm_weights, ptr[reg_weights]);
+                else
+                    uni_vpmovzxbd(vmm_weights, ptr[reg_weights]);
+                decompress(vmm_weights);
+                for (size_t r = 0; r < jcp_.rows; r++) {
+                    load_src(vmm_src, reg_src(r), 0);
+                    fma(vmm_acc(r), vmm_weights, vmm_src);
+                }
+            }
+
+            add(reg_weights, simd_w);
+            for (size_t r = 0; r < jcp_.rows; r++)
+                add(reg_src(r), src_step * src_data_size);
+
+            sub(reg_work_amount, 1);
+            jmp(loop_label, T_NEAR);
+        }
+        L(loop_end_label);
+
+        mov(reg_tmp, ptr[reg_params + GET_OFF(scales)]);
+        uni_vmovups(vmm_scale, ptr[reg_tmp]);
+        mov(reg_tmp, ptr[reg_params + GET_OFF(bias)]);
+        uni_vmovups(vmm_bias, ptr[reg_tmp]);
+        mov(reg_dst, ptr[reg_params + GET_OFF(dst)]);
+        mov(reg_dst_stride, ptr[reg_params + GET_OFF(dst_stride)]);
+        for (size_t r = 0; r < jcp_.rows; r++) {
+            uni_vfmadd213ps(vmm_acc(r), vmm_scale, vmm_bias);
+            uni_vmovups(ptr[reg_dst], vmm_acc(r));
+            if (r + 1 < jcp_.rows)
+                add(reg_dst, reg_dst_stride);
+        }
+
+        this->postamble();
+
+        if (jcp_.packed_int4)
+            prepare_table();
+    }
+
+private:
+    using Vmm = typename utils::conditional3<isa == cpu::x64::sse41, Xbyak::Xmm, isa == cpu::x64::avx2,
+            Xbyak::Ymm, Xbyak::Zmm>::type;
+    const int simd_w = cpu_isa_traits<isa>::vlen / sizeof(float);
+
+    Xbyak::Reg64 reg_params = abi_param1;
+    Xbyak::Reg64 reg_weights = r12;
+    Xbyak::Reg64 reg_work_amount = r13;
+    Xbyak::Reg64 reg_src_stride = r14;
+    Xbyak::Reg64 reg_tmp = r15;
+    Xbyak::Reg64 reg_dst = rax;
+    Xbyak::Reg64 reg_dst_stride = rbx;
+
+    Xbyak::Label l_table;
+
+    inline Xbyak::Reg64 reg_src(size_t row) {
+        const Xbyak::Reg64 regs[] = {r8, r9, r10, r11};
+        return regs[row];
+    }
+
+    inline Vmm vmm_acc(size_t row) {
+        return Vmm(row);
+    }
+
+    Vmm vmm_weights = Vmm(4);
+    Vmm vmm_weights_hi = Vmm(5);
+    Vmm vmm_src = Vmm(6);
+    Vmm vmm_zero_point = Vmm(7);
+    Vmm vmm_mask = Vmm(8);
+    Vmm vmm_scale = Vmm(9);
+    Vmm vmm_bias = Vmm(10);
+
+    inline void decompress(Vmm vmm) {
+        uni_vcvtdq2ps(vmm, vmm);
+        uni_vsubps(vmm, vmm, vmm_zero_point);
+    }
+
+    inline void load_src(Vmm vmm, Xbyak::Reg64 reg, size_t offset) {
+        if (jcp_.src_prc == Precision::BF16) {
+            // bf16 value is the upper half of f32 one
+            vpbroadcastw(vmm, ptr[reg + offset]);
+            uni_vpslld(vmm, vmm, 16);
+        } else {
+            uni_vbroadcastss(vmm, ptr[reg + offset]);
+        }
+    }
+
+    // vmm_src is reloaded for each multiplication, so it can be used as a temporary register by SSE4.1 version
+    inline void fma(Vmm vmm_dst, Vmm vmm_weights_val, Vmm vmm_src_val) {
+        if (isa == cpu::x64::sse41) {
+            mulps(vmm_src_val, vmm_weights_val);
+            addps(vmm_dst, vmm_src_val);
+        } else {
+            vfmadd231ps(vmm_dst, vmm_weights_val, vmm_src_val);
+        }
+    }
+
+    void prepare_table() {
+        align(64);
+        L(l_table);
+        for (int d = 0; d < simd_w; ++d) {
+            dd(0x0000000F);
+        }
+    }
+};
 
 MKLDNNFullyConnectedNode::MKLDNNFullyConnectedNode(const InferenceEngine::CNNLayerPtr& layer, const mkldnn::engine& eng, MKLDNNWeightsSharing::Ptr &cache)
         : MKLDNNNode(layer, eng, cache), withBiases(false), baseInputsNumber(0) {
@@ -31,6 +208,8 @@ MKLDNNFullyConnectedNode::MKLDNNFullyConnectedNode(const InferenceEngine::CNNLay
     if (getCnnLayer()->type == "FullyConnected" || getCnnLayer()->type == "InnerProduct") {
         baseInputsNumber = getCnnLayer().get()->insData.size();
     }
+
+    weightsCompressed = getCnnLayer()->blobs.count("decompression_scale") != 0;
 }
 
 std::vector<memory::format_tag> MKLDNNFullyConnectedNode::getAvailableFormatsForDims(const MKLDNNDims &dims) const {
@@ -53,6 +232,23 @@ void MKLDNNFullyConnectedNode::getSupportedDescriptors() {
     if (!descs.empty())
         return;
 
+    if (weightsCompressed) {
+        auto weights = getCnnLayer()->blobs["weights"];
+        if (weights == nullptr || weights->getTensorDesc().getDims().size() != 2 ||
+                !one_of(weights->getTensorDesc().getPrecision(), Precision::U8, Precision::I8))
+            THROW_IE_EXCEPTION << "FullyConnected layer " << getName() << " has unsupported compressed weights";
+        if (getParentEdges().size() != baseInputsNumber)
+            THROW_IE_EXCEPTION << "Incorrect number of input edges for layer " << getName();
+        if (getChildEdges().empty())
+            THROW_IE_EXCEPTION << "Incorrect number of output edges for layer " << getName();
+
+        weightsDims = weights->getTensorDesc().getDims();
+        biasesDims = {weightsDims[0]};
+        if (getParentEdgeAt(0)->getDims().ndims() < 2 || getParentEdgeAt(0)->getDims()[getParentEdgeAt(0)->getDims().ndims() - 1] != weightsDims[1])
+            THROW_IE_EXCEPTION << "FullyConnected layer " << getName() << " has inconsistent data and compressed weights shapes";
+        return;
+    }
+
     InferenceEngine::Precision precision = getCnnLayer()->insData[0].lock()->getPrecision();
     auto inputDataType = MKLDNNExtensionUtils::IEPrecisionToDataType(precision);
     precision = getCnnLayer()->outData[0]->getPrecision();
@@ -128,7 +324,60 @@ void MKLDNNFullyConnectedNode::getSupportedDescriptors() {
     }
 }
 
+void MKLDNNFullyConnectedNode::initSupportedPrimitiveDescriptors() {
+    if (!weightsCompressed) {
+        MKLDNNNode::initSupportedPrimitiveDescriptors();
+        return;
+    }
+
+    if (!supportedPrimitiveDescriptors.empty())
+        return;
+
+    // BF16 activations are broadcasted by AVX512 instructions only
+    compressedSrcPrecision = getCnnLayer()->insData[0].lock()->getPrecision();
+    if (compressedSrcPrecision != Precision::BF16 || !mayiuse(avx512_core))
+        compressedSrcPrecision = Precision::FP32;
+
+    impl_desc_type impl_type;
+    if (mayiuse(cpu::x64::avx512_common)) {
+        impl_type = impl_desc_type::jit_avx512;
+    } else if (mayiuse(cpu::x64::avx2)) {
+        impl_type = impl_desc_type::jit_avx2;
+    } else if (mayiuse(cpu::x64::sse41)) {
+        impl_type = impl_desc_type::jit_sse42;
+    } else {
+        impl_type = impl_desc_type::ref;
+    }
+
+    auto planarDesc = [](Precision precision, const MKLDNNDims& dims) {
+        return MKLDNNMemoryDesc(TensorDesc(precision, dims.ToSizeVector(), TensorDesc::getLayoutByDims(dims.ToSizeVector())));
+    };
+
+    InferenceEngine::LayerConfig config;
+    config.dynBatchSupport = false;
+    config.inConfs.resize(getParentEdges().size());
+    for (size_t i = 0; i < config.inConfs.size(); i++) {
+        // the weights and decompression parameters are taken from the layer blobs, their inputs are kept as is
+        const auto precision = i == 0 ? compressedSrcPrecision : getCnnLayer()->insData[i].lock()->getPrecision();
+        config.inConfs[i].inPlace = -1;
+        config.inConfs[i].constant = i != 0;
+        config.inConfs[i].desc = planarDesc(precision, getParentEdgeAt(i)->getDims());
+    }
+    config.outConfs.resize(1);
+    config.outConfs[0].inPlace = -1;
+    config.outConfs[0].constant = false;
+    config.outConfs[0].desc = planarDesc(Precision::FP32, getChildEdgeAt(0)->getDims());
+
+    supportedPrimitiveDescriptors.push_back({config, impl_type, MKLDNNMemory::GetPlainFormat(getChildEdgeAt(0)->getDims())});
+}
+
 void MKLDNNFullyConnectedNode::createPrimitive() {
+    if (weightsCompressed) {
+        if (!compressedWeights)
+            prepareCompressedWeights();
+        return;
+    }
+
     if (prim)
         return;
 
@@ -148,6 +397,11 @@ void MKLDNNFullyConnectedNode::createPrimitive() {
 }
 
 void MKLDNNFullyConnectedNode::execute(mkldnn::stream strm) {
+    if (weightsCompressed) {
+        executeCompressed();
+        return;
+    }
+
     if (prim) {
         auto reshapeMemory = [this](int argType) {
             auto param = primArgs.find(argType);
@@ -301,6 +555,10 @@ std::shared_ptr<mkldnn::primitive_attr> MKLDNNFullyConnectedNode::initPrimitiveA
 
 void MKLDNNFullyConnectedNode::createDescriptor(const std::vector<InferenceEngine::TensorDesc> &inputDesc,
                                                 const std::vector<InferenceEngine::TensorDesc> &outputDesc) {
+    // compressed weights are not supported by oneDNN inner product
+    if (weightsCompressed)
+        return;
+
     TensorDesc inDesc = inputDesc[0], outDesc = outputDesc[0];
 
     mkldnn::memory::data_type wdt = MKLDNNExtensionUtils::IEPrecisionToDataType(inDesc.getPrecision());
@@ -397,4 +655,213 @@ InferenceEngine::Precision MKLDNNFullyConnectedNode::getRuntimePrecision() const
     return MKLDNNExtensionUtils::getMaxPrecision(inputPrecisions);
 }
 
+void MKLDNNFullyConnectedNode::prepareCompressedWeights() {
+    auto& blobs = getCnnLayer()->blobs;
+    auto weights = blobs["weights"];
+    auto scales = blobs["decompression_scale"];
+    auto zeroPoints = blobs["decompression_zero_point"];
+    if (scales == nullptr || zeroPoints == nullptr || scales->getTensorDesc().getPrecision() != Precision::FP32 ||
+            zeroPoints->getTensorDesc().getPrecision() != Precision::FP32)
+        THROW_IE_EXCEPTION << "FullyConnected layer " << getName() << " has unsupported decompression parameters";
+
+    const size_t O = weightsDims[0];
+    const size_t K = weightsDims[1];
+    if (scales->size() != O || zeroPoints->size() != O)
+        THROW_IE_EXCEPTION << "FullyConnected layer " << getName() << " has incorrect size of decompression parameters";
+
+    const auto weiPrc = weights->getTensorDesc().getPrecision();
+    const auto weightsPtr = weights->cbuffer().as<const uint8_t*>() + weights->getTensorDesc().getBlockingDesc().getOffsetPadding();
+    const auto scalesPtr = scales->cbuffer().as<const float*>();
+    const auto zeroPointsPtr = zeroPoints->cbuffer().as<const float*>();
+
+    if (mayiuse(cpu::x64::avx512_common)) {
+        compressedBlockSize = 16;
+    } else if (mayiuse(cpu::x64::avx2)) {
+        compressedBlockSize = 8;
+    } else if (mayiuse(cpu::x64::sse41)) {
+        compressedBlockSize = 4;
+    } else {
+        compressedBlockSize = 1;
+    }
+
+    // 4-bit packing halves the memory traffic for weights which fit [0, 15] or [-8, 7] ranges
+    packedInt4 = K % 2 == 0;
+    for (size_t i = 0; i < O * K && packedInt4; i++) {
+        const int value = weiPrc == Precision::I8 ? static_cast<int8_t>(weightsPtr[i]) : weightsPtr[i];
+        packedInt4 = weiPrc == Precision::I8 ? value >= -8 && value <= 7 : value <= 15;
+    }
+    const int int4Shift = packedInt4 && weiPrc == Precision::I8 ? 8 : 0;
+
+    const size_t bs = compressedBlockSize;
+    const size_t OB = MKLDNNPlugin::div_up(O, bs);
+    const size_t Kp = packedInt4 ? K / 2 : K;
+
+    decompressionScales.assign(OB * bs, 0.f);
+    decompressionZeroPoints.assign(OB * bs, 0.f);
+    compressedBias.assign(OB * bs, 0.f);
+    for (size_t o = 0; o < O; o++) {
+        decompressionScales[o] = scalesPtr[o];
+        decompressionZeroPoints[o] = zeroPointsPtr[o] + int4Shift;
+    }
+    auto biases = blobs["biases"];
+    if (biases != nullptr) {
+        if (biases->size() != O)
+            THROW_IE_EXCEPTION << "FullyConnected layer " << getName() << " has incorrect size of biases";
+        cpu_convert(biases->cbuffer().as<const uint8_t*>() + biases->getTensorDesc().getBlockingDesc().getOffsetPadding(),
+                    compressedBias.data(), biases->getTensorDesc().getPrecision(), Precision::FP32, O);
+    }
+
+    auto create = [&] () {
+        MKLDNNMemoryPtr memory = MKLDNNMemoryPtr(new MKLDNNMemory(getEngine()));
+        memory->Create({static_cast<ptrdiff_t>(OB * Kp * bs)}, memory::data_type::u8, memory::format_tag::x);
+        auto dst = reinterpret_cast<uint8_t*>(memory->GetData());
+        parallel_for2d(OB, Kp, [&](size_t ob, size_t kp) {
+            uint8_t* dstBlock = dst + (ob * Kp + kp) * bs;
+            for (size_t j = 0; j < bs; j++) {
+                const size_t o = ob * bs + j;
+                if (o >= O) {
+                    dstBlock[j] = 0;
+                } else if (packedInt4) {
+                    const uint8_t lo = static_cast<uint8_t>(weightsPtr[o * K + 2 * kp] + int4Shift) & 0x0F;
+                    const uint8_t hi = static_cast<uint8_t>(weightsPtr[o * K + 2 * kp + 1] + int4Shift) & 0x0F;
+                    dstBlock[j] = static_cast<uint8_t>(lo | (hi << 4));
+                } else {
+                    dstBlock[j] = weightsPtr[o * K + kp];
+                }
+            }
+        });
+        return memory;
+    };
+
+    if (weightCache != nullptr) {
+        const uint64_t dataHash = InferenceEngine::DataHasher::hash(weightsPtr, weights->byteSize());
+        const std::string key = getName() + "_compressed_" + std::to_string(weights->byteSize()) + "_" +
+                                std::to_string(dataHash) + "_" + std::to_string(bs);
+        compressedWeights = *weightCache->findOrCreate(key, create);
+    } else {
+        compressedWeights = create();
+    }
+
+    if (bs == 1)
+        return;
+
+    jit_fc_compressed_config_params jcp;
+    jcp.src_prc = compressedSrcPrecision;
+    jcp.wei_prc = weiPrc;
+    jcp.packed_int4 = packedInt4;
+    jcp.K = K;
+
+    const size_t M = getParentEdgeAt(0)->getDims().size() / K;
+    auto createKernel = [&](size_t rows) {
+        std::shared_ptr<jit_uni_fc_compressed_kernel> kernel;
+        jcp.rows = rows;
+        if (mayiuse(cpu::x64::avx512_common)) {
+            kernel.reset(new jit_uni_fc_compressed_kernel_f32<cpu::x64::avx512_common>(jcp));
+        } else if (mayiuse(cpu::x64::avx2)) {
+            kernel.reset(new jit_uni_fc_compressed_kernel_f32<cpu::x64::avx2>(jcp));
+        } else {
+            kernel.reset(new jit_uni_fc_compressed_kernel_f32<cpu::x64::sse41>(jcp));
+        }
+        kernel->create_ker();
+        return kernel;
+    };
+
+    if (M >= compressedRowsBlock)
+        compressedKernel = createKernel(compressedRowsBlock);
+    if (M % compressedRowsBlock != 0)
+        compressedTailKernel = createKernel(M % compressedRowsBlock);
+}
+
+void MKLDNNFullyConnectedNode::executeCompressed() {
+    const auto src = reinterpret_cast<const uint8_t*>(getParentEdgeAt(0)->getMemoryPtr()->GetPtr());
+    const auto dst = reinterpret_cast<float*>(getChildEdgeAt(0)->getMemoryPtr()->GetPtr());
+
+    const size_t O = weightsDims[0];
+    const size_t K = weightsDims[1];
+    const size_t M = getParentEdgeAt(0)->getDims().size() / K;
+    const size_t srcDataSize = compressedSrcPrecision.size();
+
+    if (!compressedKernel && !compressedTailKernel) {
+        executeCompressedReference(src, dst, M, srcDataSize);
+        return;
+    }
+
+    const size_t bs = compressedBlockSize;
+    const size_t OB = MKLDNNPlugin::div_up(O, bs);
+    const size_t Kp = packedInt4 ? K / 2 : K;
+    const auto weights = reinterpret_cast<const uint8_t*>(compressedWeights->GetData());
+
+    parallel_for2d(MKLDNNPlugin::div_up(M, compressedRowsBlock), OB, [&](size_t mb, size_t ob) {
+        const size_t rows = std::min(compressedRowsBlock, M - mb * compressedRowsBlock);
+        const size_t validOutputs = std::min(bs, O - ob * bs);
+
+        auto arg = jit_fc_compressed_call_args();
+        arg.src = src + mb * compressedRowsBlock * K * srcDataSize;
+        arg.src_stride = K * srcDataSize;
+        arg.weights = weights + ob * Kp * bs;
+        arg.scales = &decompressionScales[ob * bs];
+        arg.zero_points = &decompressionZeroPoints[ob * bs];
+        arg.bias = &compressedBias[ob * bs];
+
+        float* dstBlock = dst + mb * compressedRowsBlock * O + ob * bs;
+        if (validOutputs == bs) {
+            arg.dst = dstBlock;
+            arg.dst_stride = O * sizeof(float);
+        }
+
+        // the last block of output channels is written to a temporary buffer to not overrun the output
+        float tmp[compressedRowsBlock * 16];
+        if (validOutputs != bs) {
+            arg.dst = tmp;
+            arg.dst_stride = bs * sizeof(float);
+        }
+
+        auto& kernel = rows == compressedRowsBlock ? compressedKernel : compressedTailKernel;
+        (*kernel)(&arg);
+
+        if (validOutputs != bs) {
+            for (size_t r = 0; r < rows; r++)
+                std::copy(tmp + r * bs, tmp + r * bs + validOutputs, dstBlock + r * O);
+        }
+    });
+}
+
+void MKLDNNFullyConnectedNode::executeCompressedReference(const uint8_t* src, float* dst, size_t M, size_t srcDataSize) {
+    const size_t O = weightsDims[0];
+    const size_t K = weightsDims[1];
+    const size_t bs = compressedBlockSize;
+    const size_t Kp = packedInt4 ? K / 2 : K;
+    const bool signedWeights = !packedInt4 && getCnnLayer()->blobs["weights"]->getTensorDesc().getPrecision() == Precision::I8;
+    const auto weights = reinterpret_cast<const uint8_t*>(compressedWeights->GetData());
+
+    auto getSrc = [&](size_t m, size_t k) {
+        const uint8_t* ptr = src + (m * K + k) * srcDataSize;
+        if (compressedSrcPrecision == Precision::BF16) {
+            const uint32_t bits = static_cast<uint32_t>(*reinterpret_cast<const uint16_t*>(ptr)) << 16;
+            float value;
+            std::memcpy(&value, &bits, sizeof(value));
+            return value;
+        }
+        return *reinterpret_cast<const float*>(ptr);
+    };
+
+    auto getWeight = [&](size_t o, size_t k) {
+        const size_t ob = o / bs;
+        const size_t j = o % bs;
+        if (packedInt4) {
+            const uint8_t value = weights[(ob * Kp + k / 2) * bs + j];
+            return static_cast<float>(k % 2 ? value >> 4 : value & 0x0F);
+        }
+        const uint8_t value = weights[(ob * Kp + k) * bs + j];
+        return signedWeights ? static_cast<float>(static_cast<int8_t>(value)) : static_cast<float>(value);
+    };
+
+    parallel_for2d(M, O, [&](size_t m, size_t o) {
+        float acc = 0.f;
+        for (size_t k = 0; k < K; k++)
+            acc += getSrc(m, k) * (getWeight(o, k) - decompressionZeroPoints[o]);
+        dst[m * O + o] = acc * decompressionScales[o] + compressedBias[o];
+    });
+}
+
 REG_MKLDNN_PRIM_FOR(MKLDNNFullyConnectedNode, FullyConnected);
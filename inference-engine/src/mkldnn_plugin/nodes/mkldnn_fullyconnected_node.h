@@ -12,6 +12,41 @@
 
 namespace MKLDNNPlugin {
 
+struct jit_fc_compressed_config_params {
+    InferenceEngine::Precision src_prc;
+    InferenceEngine::Precision wei_prc;
+    bool packed_int4;   // two unsigned 4-bit weights per byte along K
+    size_t K;
+    size_t rows;        // number of source rows processed by one kernel call
+};
+
+struct jit_fc_compressed_call_args {
+    const void *src;
+    const uint8_t *weights;
+    const float *scales;
+    const float *zero_points;
+    const float *bias;
+    float *dst;
+    size_t src_stride;
+    size_t dst_stride;
+};
+
+struct jit_uni_fc_compressed_kernel {
+    void (*ker_)(const jit_fc_compressed_call_args *);
+
+    void operator()(const jit_fc_compressed_call_args *args) {
+        assert(ker_);
+        ker_(args);
+    }
+
+    explicit jit_uni_fc_compressed_kernel(jit_fc_compressed_config_params jcp) : ker_(nullptr), jcp_(jcp) {}
+    virtual ~jit_uni_fc_compressed_kernel() {}
+
+    virtual void create_ker() = 0;
+
+    jit_fc_compressed_config_params jcp_;
+};
+
 class MKLDNNFullyConnectedNode : public MKLDNNNode {
 public:
     MKLDNNFullyConnectedNode(const InferenceEngine::CNNLayerPtr& layer, const mkldnn::engine& eng, MKLDNNWeightsSharing::Ptr &cache);
@@ -19,6 +54,7 @@ public:
 
     std::vector<mkldnn::memory::format_tag> getAvailableFormatsForDims(const MKLDNNDims &dims) const override;
     void getSupportedDescriptors() override;
+    void initSupportedPrimitiveDescriptors() override;
     void createPrimitive() override;
     void execute(mkldnn::stream strm) override;
     bool created() const override;
@@ -43,6 +79,10 @@ public:
 
     InferenceEngine::Precision getRuntimePrecision() const override;
 
+    bool isWeightsCompressed() const {
+        return weightsCompressed;
+    }
+
 protected:
     std::shared_ptr<mkldnn::primitive_attr> initPrimitiveAttr();
 
@@ -55,6 +95,24 @@ private:
 
     bool withBiases;
     int baseInputsNumber;
+
+    // Weight-only compression: u8/i8 weights with per output channel scale and zero point are decompressed
+    // on the fly by a JIT kernel, activations and output stay in floating point.
+    void prepareCompressedWeights();
+    void executeCompressed();
+    void executeCompressedReference(const uint8_t* src, float* dst, size_t M, size_t srcDataSize);
+
+    bool weightsCompressed = false;
+    // weights are packed in blocks of output channels: [O / block][K][block], 4-bit values are paired along K
+    size_t compressedBlockSize = 1;
+    bool packedInt4 = false;
+    InferenceEngine::Precision compressedSrcPrecision = InferenceEngine::Precision::FP32;
+    MKLDNNMemoryPtr compressedWeights;
+    std::vector<float> decompressionScales;
+    std::vector<float> decompressionZeroPoints;
+    std::vector<float> compressedBias;
+    std::shared_ptr<jit_uni_fc_compressed_kernel> compressedKernel;
+    std::shared_ptr<jit_uni_fc_compressed_kernel> compressedTailKernel;
 };
 
 }  // namespace MKLDNNPlugin
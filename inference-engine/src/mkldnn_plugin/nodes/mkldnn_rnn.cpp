@@ -7,9 +7,13 @@
 
 #include "utils/general_utils.h"
 #include "nodes/common/cpu_memcpy.h"
+#include "nodes/common/cpu_convert.h"
 
+#include <algorithm>
+#include <cmath>
 #include <string>
 #include <utility>
+#include <vector>
 
 using namespace mkldnn;
 using namespace InferenceEngine;
@@ -84,6 +88,31 @@ void MKLDNNRNN::getSupportedDescriptors() {
         fillSeqDesc();
 }
 
+void MKLDNNRNN::initPrecisions() {
+    auto layer = getCnnLayer();
+    const auto precision = layer->insData[0].lock()->getPrecision();
+
+    if (precision == Precision::BF16) {
+        // cell state and biases are kept in f32 as bf16 primitive requires
+        in_data_type = out_data_type = weights_type = memory::data_type::bf16;
+    } else if (precision == Precision::U8) {
+        // u8 data comes from low precision transformations with the data quantization parameters in layer params,
+        // weights are quantized per output channel here, output data and states are produced in f32
+        if (is_cell || cell_type != algorithm::vanilla_lstm)
+            THROW_IE_EXCEPTION << "RNN layer '" << getName() << "' supports u8 input data only for LSTM sequence";
+        if (!layer->CheckParamPresence("rnn_data_scale"))
+            THROW_IE_EXCEPTION << "RNN layer '" << getName() << "' does not have quantization parameters of u8 input data";
+
+        in_data_type = memory::data_type::u8;
+        out_data_type = memory::data_type::f32;
+        weights_type = memory::data_type::s8;
+        data_scale = layer->GetParamAsFloat("rnn_data_scale");
+        data_shift = layer->GetParamAsFloat("rnn_data_shift", 0.f);
+    } else {
+        in_data_type = out_data_type = weights_type = memory::data_type::f32;
+    }
+}
+
 void MKLDNNRNN::fillCellDesc() {
     if (!descs.empty()) return;
     auto cellLayer = std::dynamic_pointer_cast<RNNCellBase>(getCnnLayer());
@@ -124,6 +153,8 @@ void MKLDNNRNN::fillCellDesc() {
 
     Gb = (cell_type != mkldnn::algorithm::lbr_gru) ? G : G + 1;
 
+    initPrecisions();
+
     // Expected shapes
     MKLDNNDims D_shape {N, DC}, S_shape {N, SC}, S_4D_shape {L, D, N, SC};
 
@@ -156,25 +187,26 @@ void MKLDNNRNN::fillCellDesc() {
         THROW_IE_EXCEPTION << "RNN Layer. Biases size is not correct. Expected size:" << G*SC;
 
     // Shapes and Attributes are correct. Can start internal stuff initialization.
+    // Hidden state has the data precision, cell state is always f32
     for (size_t i = 0; i < S; i++) {
-        in_states_d.emplace_back(S_4D_shape, memory::data_type::f32, memory::format_tag::ldnc);
-        out_states_d.emplace_back(S_4D_shape, memory::data_type::f32, memory::format_tag::ldnc);
+        in_states_d.emplace_back(S_4D_shape, i == 0 ? in_data_type : memory::data_type::f32, memory::format_tag::ldnc);
+        out_states_d.emplace_back(S_4D_shape, i == 0 ? out_data_type : memory::data_type::f32, memory::format_tag::ldnc);
     }
 
-    in_data_d  = {{T, N, DC}, memory::data_type::f32, memory::format_tag::tnc};;
-    out_data_d = {{T, N, SC}, memory::data_type::f32, memory::format_tag::tnc};;
+    in_data_d  = {{T, N, DC}, in_data_type, memory::format_tag::tnc};
+    out_data_d = {{T, N, SC}, out_data_type, memory::format_tag::tnc};
 
-    w_data_d   = {{L, D, DC, G, SC}, memory::data_type::f32, memory::format_tag::ldigo};
-    w_state_d  = {{L, D, SC, G, SC}, memory::data_type::f32, memory::format_tag::ldigo};
+    w_data_d   = {{L, D, DC, G, SC}, weights_type, memory::format_tag::ldigo};
+    w_state_d  = {{L, D, SC, G, SC}, weights_type, memory::format_tag::ldigo};
 
     if (bias)
         w_bias_d = {{L, D, Gb, SC}, memory::data_type::f32, memory::format_tag::ldgo};
 
     std::vector<TensorDesc> in_candidate, out_candidate;
     std::vector<memory::format_tag> outputFormats;
-    in_candidate.emplace_back(MKLDNNMemoryDesc {D_shape, memory::data_type::f32, memory::format_tag::nc});
-    in_candidate.emplace_back(MKLDNNMemoryDesc {S_shape, memory::data_type::f32, memory::format_tag::nc});
-    out_candidate.emplace_back(MKLDNNMemoryDesc {S_shape, memory::data_type::f32, memory::format_tag::nc});
+    in_candidate.emplace_back(MKLDNNMemoryDesc {D_shape, in_data_type, memory::format_tag::nc});
+    in_candidate.emplace_back(MKLDNNMemoryDesc {S_shape, in_data_type, memory::format_tag::nc});
+    out_candidate.emplace_back(MKLDNNMemoryDesc {S_shape, out_data_type, memory::format_tag::nc});
     outputFormats.emplace_back(memory::format_tag::nc);
 
     if (S == 2) {
@@ -243,6 +275,10 @@ void MKLDNNRNN::fillSeqDesc() {
 
     Gb = (cell_type != mkldnn::algorithm::lbr_gru) ? G : G + 1;
 
+    initPrecisions();
+    // u8 initial hidden state is quantized by the node, so its input port stays in f32
+    const auto in_h_state_port_type = in_data_type == memory::data_type::u8 ? memory::data_type::f32 : in_data_type;
+
     MKLDNNDims ID_shape {T, N, DC}, OD_shape {T, N, SC}, S_shape {N, SC}, S_4D_shape {L, D, N, SC};
 
     if (out_data_dims != OD_shape)
@@ -254,13 +290,13 @@ void MKLDNNRNN::fillSeqDesc() {
     for (int i = 1; i < ins.size(); i++) {
         if (getParentEdgeAt(i)->getDims() != S_shape)
             THROW_IE_EXCEPTION << "Incorrect shape of state ports for layer " << getName();
-        in_states_d[i - 1] = {S_4D_shape, memory::data_type::f32, memory::format_tag::ldnc};
+        in_states_d[i - 1] = {S_4D_shape, i == 1 ? in_data_type : memory::data_type::f32, memory::format_tag::ldnc};
     }
 
     for (int i = 1; i < outs.size(); i++) {
         if (getChildEdgeAt(i)->getDims() != S_shape)
             THROW_IE_EXCEPTION << "Incorrect shape of state ports for layer " << getName();
-        out_states_d[i - 1] = {S_4D_shape, memory::data_type::f32, memory::format_tag::ldnc};
+        out_states_d[i - 1] = {S_4D_shape, i == 1 ? out_data_type : memory::data_type::f32, memory::format_tag::ldnc};
     }
 
     auto blobs = rnnLayer->blobs;
@@ -274,8 +310,8 @@ void MKLDNNRNN::fillSeqDesc() {
     if (weights->size() != G*SC*(SC+DC))
         THROW_IE_EXCEPTION << "RNN Layer. Weights size is not correct. Expected size:" << G*SC*(SC+DC);
 
-    w_data_d  = {{L, D, DC, G, SC}, memory::data_type::f32, memory::format_tag::ldigo};
-    w_state_d = {{L, D, SC, G, SC}, memory::data_type::f32, memory::format_tag::ldigo};
+    w_data_d  = {{L, D, DC, G, SC}, weights_type, memory::format_tag::ldigo};
+    w_state_d = {{L, D, SC, G, SC}, weights_type, memory::format_tag::ldigo};
 
     if (bias && bias->size() != Gb*SC)
         THROW_IE_EXCEPTION << "RNN Layer. Biases size is not correct. Expected size:" << G*SC;
@@ -284,27 +320,29 @@ void MKLDNNRNN::fillSeqDesc() {
         w_bias_d = {{L, D, Gb, SC}, memory::data_type::f32, memory::format_tag::ldgo};
 
     // Try to create descriptor and corresponding configuration
-    in_data_d = {in_data_dims, memory::data_type::f32, memory::format_tag::tnc};
-    out_data_d = {out_data_dims, memory::data_type::f32, memory::format_tag::tnc};
+    in_data_d = {in_data_dims, in_data_type, memory::format_tag::tnc};
+    out_data_d = {out_data_dims, out_data_type, memory::format_tag::tnc};
 
     std::vector<TensorDesc> in_candidate;
     if (nativeOrder)
         in_candidate.push_back(in_data_d);
     else
-        in_candidate.push_back(MKLDNNMemoryDesc{{N, T, DC}, memory::data_type::f32, memory::format_tag::ntc});
+        in_candidate.push_back(MKLDNNMemoryDesc{{N, T, DC}, in_data_type, memory::format_tag::ntc});
 
     for (int i = 1; i < ins.size(); i++)
-        in_candidate.emplace_back(MKLDNNMemoryDesc {S_shape, memory::data_type::f32, memory::format_tag::nc});
+        in_candidate.emplace_back(MKLDNNMemoryDesc {S_shape, i == 1 ? in_h_state_port_type : memory::data_type::f32,
+                                                    memory::format_tag::nc});
 
     std::vector<TensorDesc> out_candidate;
     if (nativeOrder) {
         out_candidate.push_back(out_data_d);
     } else {
-        out_candidate.push_back(MKLDNNMemoryDesc{{N, T, SC}, memory::data_type::f32, memory::format_tag::ntc});
+        out_candidate.push_back(MKLDNNMemoryDesc{{N, T, SC}, out_data_type, memory::format_tag::ntc});
     }
 
     for (int i = 1; i < outs.size(); i++) {
-        out_candidate.emplace_back(MKLDNNMemoryDesc{S_shape, memory::data_type::f32, memory::format_tag::nc});
+        out_candidate.emplace_back(MKLDNNMemoryDesc{S_shape, i == 1 ? out_data_type : memory::data_type::f32,
+                                                    memory::format_tag::nc});
     }
 
     createDescriptor(in_candidate, out_candidate);
@@ -402,11 +440,6 @@ void MKLDNNRNN::createPrimitive() {
             && getCnnLayer()->blobs["biases"]->getTensorDesc().getPrecision() != Precision::FP32)
         THROW_IE_EXCEPTION << errorPrefix << " has invalid biases precision: " << getCnnLayer()->blobs["biases"]->getTensorDesc().getPrecision();
 
-    auto pd = descs[0].createPrimitiveDescriptorIterator(getEngine());
-
-    auto src_data_mem = getParentEdgeAt(0)->getMemoryPtr();
-    auto dst_data_mem = getChildEdgeAt(0)->getMemoryPtr();
-
     // create weight blobs (data and state part)
     auto w_data_mem = std::make_shared<MKLDNNMemory>(getEngine());
     w_data_mem->Create(w_data_d);
@@ -421,16 +454,7 @@ void MKLDNNRNN::createPrimitive() {
     internalBlobMemory.push_back(w_bias_mem);
 
     {
-        /* Copy Weight data
-         * IE format:
-         *   W - [gates, out_state_size, in_data_size + in_state_size]
-         *   B - [gates, out_state_size]
-         *
-         * MKLDNN format:
-         *   W - [1, 1, in_date_size,  gates, out_state_size]
-         *   R - [1, 1, in_state_size, gates, out_state_size]
-         *   B - [gates, out_state_size]
-         *
+        /*
          *   Gate order
          *   ====== LSTM ======
          *   Caffe - IFOC, ONNX   - IOFC
@@ -473,41 +497,113 @@ void MKLDNNRNN::createPrimitive() {
             }
         }
 
-        auto ie_w_ptr = getCnnLayer()->blobs["weights"]->buffer().as<const float*>();
-        auto w_ptr = static_cast<float*>(w_data_mem->GetData());
-        auto r_ptr = static_cast<float*>(w_state_mem->GetData());
-        const int step = SC * G;
-
-        for (int g = 0; g < G; g++) {
-            for (int out_i = 0; out_i < SC; out_i++) {
-                float *l_w_ptr = w_ptr + gate_map[g]*SC + out_i;
-                float *l_r_ptr = r_ptr + gate_map[g]*SC+ out_i;
-                for (int in_i = 0; in_i < DC; in_i++) {
-                    *l_w_ptr = *ie_w_ptr;
-                    ie_w_ptr++;
-                    l_w_ptr += step;
-                }
-
-                for (int in_i = 0; in_i < SC; in_i++) {
-                    *l_r_ptr = *ie_w_ptr;
-                    ie_w_ptr++;
-                    l_r_ptr += step;
-                }
+        fillWeights(gate_map);
+    }
+
+    mkldnn::primitive_attr attr;
+    if (weights_type == memory::data_type::s8) {
+        attr.set_rnn_data_qparams(data_scale, data_shift);
+        // scales are set per gate and output channel, i.e. dims 3 and 4 of ldigo weights
+        attr.set_rnn_weights_qparams((1 << 3) | (1 << 4), weights_scales);
+
+        if (in_states_d[0]) {
+            in_h_state_u8_mem = std::make_shared<MKLDNNMemory>(getEngine());
+            in_h_state_u8_mem->Create(in_states_d[0]);
+        }
+    }
+
+    auto pd = descs[0].createPrimitiveDescriptorIterator(getEngine(), attr);
+    prim.reset(new mkldnn::primitive(pd));
+}
+
+void MKLDNNRNN::fillWeights(const int *gate_map) {
+    /* Copy Weight data
+     * IE format:
+     *   W - [gates, out_state_size, in_data_size + in_state_size]
+     *   B - [gates, out_state_size]
+     *
+     * MKLDNN format:
+     *   W - [1, 1, in_date_size,  gates, out_state_size]
+     *   R - [1, 1, in_state_size, gates, out_state_size]
+     *   B - [gates, out_state_size]
+     */
+    std::vector<float> w_data(DC * G * SC);
+    std::vector<float> w_state(SC * G * SC);
+
+    auto ie_w_ptr = getCnnLayer()->blobs["weights"]->buffer().as<const float*>();
+    auto w_ptr = w_data.data();
+    auto r_ptr = w_state.data();
+    const int step = SC * G;
+
+    for (int g = 0; g < G; g++) {
+        for (int out_i = 0; out_i < SC; out_i++) {
+            float *l_w_ptr = w_ptr + gate_map[g]*SC + out_i;
+            float *l_r_ptr = r_ptr + gate_map[g]*SC+ out_i;
+            for (int in_i = 0; in_i < DC; in_i++) {
+                *l_w_ptr = *ie_w_ptr;
+                ie_w_ptr++;
+                l_w_ptr += step;
+            }
+
+            for (int in_i = 0; in_i < SC; in_i++) {
+                *l_r_ptr = *ie_w_ptr;
+                ie_w_ptr++;
+                l_r_ptr += step;
             }
         }
+    }
 
-        if (w_bias_d) {
-            auto ie_b_ptr = getCnnLayer()->blobs["biases"]->buffer().as<const float*>();
-            auto b_ptr = static_cast<float*>(w_bias_mem->GetData());
-            for (int g = 0; g < Gb; g++) {
-                float *l_b_ptr = b_ptr + gate_map[g]*SC;
-                const float *l_ie_b_ptr = ie_b_ptr + g * SC;
-                cpu_memcpy(l_b_ptr, l_ie_b_ptr, SC * sizeof(float));
+    const auto &w_data_mem = internalBlobMemory[0];
+    const auto &w_state_mem = internalBlobMemory[1];
+    const auto &w_bias_mem = internalBlobMemory[2];
+
+    if (weights_type == memory::data_type::s8) {
+        // Symmetric quantization per gate and output channel. Both weights parts share the scales in the primitive,
+        // so the scale is computed over the whole [in_data_size + in_state_size] input range of the channel.
+        const size_t channels = step;
+        std::vector<float> abs_max(channels, 0.f);
+        for (size_t i = 0; i < w_data.size(); i++)
+            abs_max[i % channels] = std::max(abs_max[i % channels], std::abs(w_data[i]));
+        for (size_t i = 0; i < w_state.size(); i++)
+            abs_max[i % channels] = std::max(abs_max[i % channels], std::abs(w_state[i]));
+
+        weights_scales.resize(channels);
+        for (size_t c = 0; c < channels; c++)
+            weights_scales[c] = abs_max[c] != 0.f ? 127.f / abs_max[c] : 1.f;
+
+        auto quantize = [&](const std::vector<float> &src, int8_t *dst) {
+            for (size_t i = 0; i < src.size(); i++) {
+                const float value = std::nearbyint(src[i] * weights_scales[i % channels]);
+                dst[i] = static_cast<int8_t>(std::min(std::max(value, -127.f), 127.f));
             }
+        };
+        quantize(w_data, static_cast<int8_t*>(w_data_mem->GetData()));
+        quantize(w_state, static_cast<int8_t*>(w_state_mem->GetData()));
+    } else {
+        const auto precision = MKLDNNExtensionUtils::DataTypeToIEPrecision(weights_type);
+        cpu_convert(w_data.data(), w_data_mem->GetData(), Precision::FP32, precision, w_data.size());
+        cpu_convert(w_state.data(), w_state_mem->GetData(), Precision::FP32, precision, w_state.size());
+    }
+
+    // Biases are f32 for all supported precisions
+    if (w_bias_d) {
+        auto ie_b_ptr = getCnnLayer()->blobs["biases"]->buffer().as<const float*>();
+        auto b_ptr = static_cast<float*>(w_bias_mem->GetData());
+        for (int g = 0; g < Gb; g++) {
+            float *l_b_ptr = b_ptr + gate_map[g]*SC;
+            const float *l_ie_b_ptr = ie_b_ptr + g * SC;
+            cpu_memcpy(l_b_ptr, l_ie_b_ptr, SC * sizeof(float));
         }
     }
+}
 
-    prim.reset(new mkldnn::primitive(pd));
+void MKLDNNRNN::quantizeHiddenState() {
+    const auto src = reinterpret_cast<const float*>(getParentEdgeAt(1)->getMemoryPtr()->GetPtr());
+    auto dst = reinterpret_cast<uint8_t*>(in_h_state_u8_mem->GetPtr());
+    for (ptrdiff_t i = 0; i < N * SC; i++) {
+        const float value = std::nearbyint(src[i] * data_scale + data_shift);
+        dst[i] = static_cast<uint8_t>(std::min(std::max(value, 0.f), 255.f));
+    }
 }
 
 void MKLDNNRNN::execute(mkldnn::stream strm) {
@@ -535,6 +631,11 @@ void MKLDNNRNN::execute(mkldnn::stream strm) {
         args[state_i_tags[s]] = getParentEdgeAt(s+1)->getMemoryPtr()->GetPrimitive();
     }
 
+    if (in_h_state_u8_mem) {
+        quantizeHiddenState();
+        args[DNNL_ARG_SRC_ITER] = in_h_state_u8_mem->GetPrimitive();
+    }
+
     if (is_cell) {
         for (size_t s = 0; s < S; s++) {
             args[state_o_tags[s]] = getChildEdgesAtPort(s)[0]->getMemoryPtr()->GetPrimitive();
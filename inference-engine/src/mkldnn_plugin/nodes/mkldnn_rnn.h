@@ -26,8 +26,11 @@ public:
     void execute(mkldnn::stream strm) override;
 
 private:
+    void initPrecisions();
     void fillCellDesc();
     void fillSeqDesc();
+    void fillWeights(const int* gate_map);
+    void quantizeHiddenState();
 
 private:
     /** Specify mode Cell or Seq. true - Cell, false - Seq */
@@ -56,6 +59,21 @@ private:
     const ptrdiff_t L = 1;   /**< What is it??. Constant for mkldnn impl */
     const ptrdiff_t D = 1;   /**< Num of direction. 1 or 2 */
 
+    /** Precision of input data and hidden state: f32, bf16 or u8 */
+    mkldnn::memory::data_type in_data_type = mkldnn::memory::data_type::f32;
+    /** Precision of output data and hidden state: f32 or bf16 */
+    mkldnn::memory::data_type out_data_type = mkldnn::memory::data_type::f32;
+    /** Precision of weights: f32, bf16 or s8 */
+    mkldnn::memory::data_type weights_type = mkldnn::memory::data_type::f32;
+
+    /** Quantization parameters of u8 data and hidden state: u8 = f32 * data_scale + data_shift */
+    float data_scale = 1.f;
+    float data_shift = 0.f;
+    /** Per gate and output channel scales of s8 weights */
+    std::vector<float> weights_scales;
+    /** Initial hidden state quantized to u8, the input port of the state stays in f32 */
+    MKLDNNMemoryPtr in_h_state_u8_mem;
+
     MKLDNNMemoryDesc in_data_d;
     MKLDNNMemoryDesc out_data_d;
 
@@ -0,0 +1,232 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "mkldnn_snippet_node.h"
+
+#include <ie_parallel.hpp>
+#include <cpu/x64/cpu_isa_traits.hpp>
+#include <ngraph/runtime/host_tensor.hpp>
+#include <mkldnn_extension_utils.h>
+
+#include "common/tensor_desc_creator.h"
+#include "emitters/cpu_generator.hpp"
+
+#include <algorithm>
+#include <functional>
+#include <numeric>
+
+#define THROW_ERROR THROW_IE_EXCEPTION << getTypeStr() << " layer with name '" << getName() <<"' ERROR: "
+
+using namespace mkldnn;
+using namespace MKLDNNPlugin;
+using namespace InferenceEngine;
+using namespace mkldnn::impl::cpu::x64;
+
+namespace {
+
+// Minimal number of innermost elements processed by a single kernel call
+constexpr size_t minInnerBlock = 256;
+
+ngraph::Shape padShape(const SizeVector& dims, size_t rank) {
+    ngraph::Shape shape(rank - std::min(rank, dims.size()), 1);
+    shape.insert(shape.end(), dims.begin(), dims.end());
+    return shape;
+}
+
+}  // namespace
+
+MKLDNNSnippetNode::MKLDNNSnippetNode(const InferenceEngine::CNNLayerPtr& layer, const mkldnn::engine& eng, MKLDNNWeightsSharing::Ptr &cache)
+        : MKLDNNNode(layer, eng, cache) {
+    snippet = ngraph::as_type_ptr<ngraph::snippets::op::Subgraph>(layer->getNode());
+    if (!snippet)
+        THROW_ERROR << "doesn't have ngraph Subgraph operation";
+}
+
+void MKLDNNSnippetNode::getSupportedDescriptors() {
+    if (getParentEdges().size() != snippet->get_input_size())
+        THROW_ERROR << "has incorrect number of input edges";
+    if (getChildEdges().empty())
+        THROW_ERROR << "has incorrect number of output edges";
+}
+
+void MKLDNNSnippetNode::initSupportedPrimitiveDescriptors() {
+    if (!supportedPrimitiveDescriptors.empty())
+        return;
+
+    const auto& creator = TensorDescCreator::getCommonCreators().at(TensorDescCreatorTypes::ncsp);
+
+    InferenceEngine::LayerConfig config;
+    config.dynBatchSupport = false;
+    for (size_t i = 0; i < inDims.size(); i++) {
+        DataConfig dataConfig;
+        dataConfig.inPlace = -1;
+        dataConfig.constant = false;
+        dataConfig.desc = creator->createDesc(Precision::FP32, inDims[i].ToSizeVector());
+        config.inConfs.push_back(dataConfig);
+    }
+    for (size_t i = 0; i < outDims.size(); i++) {
+        DataConfig dataConfig;
+        dataConfig.inPlace = -1;
+        dataConfig.constant = false;
+        dataConfig.desc = creator->createDesc(Precision::FP32, outDims[i].ToSizeVector());
+        config.outConfs.push_back(dataConfig);
+    }
+
+    impl_desc_type implType = mayiuse(avx512_common) ? impl_desc_type::jit_avx512 :
+                              mayiuse(avx2) ? impl_desc_type::jit_avx2 : impl_desc_type::ref;
+    supportedPrimitiveDescriptors.emplace_back(config, implType, MKLDNNMemoryDesc(config.outConfs.front().desc).getFormat());
+}
+
+void MKLDNNSnippetNode::createPrimitive() {
+    for (size_t i = 0; i < getParentEdges().size(); i++) {
+        auto& srcMemPtr = getParentEdgeAt(i)->getMemoryPtr();
+        if (!srcMemPtr || !srcMemPtr->GetPrimitivePtr())
+            THROW_ERROR << "has not allocated input memory";
+    }
+    for (size_t i = 0; i < outDims.size(); i++) {
+        auto& dstMemPtr = getChildEdgesAtPort(i)[0]->getMemoryPtr();
+        if (!dstMemPtr || !dstMemPtr->GetPrimitivePtr())
+            THROW_ERROR << "has not allocated output memory";
+    }
+    if (getSelectedPrimitiveDescriptor() == nullptr)
+        THROW_ERROR << "has unset preferable primitive descriptor";
+
+    useJit = generate();
+}
+
+bool MKLDNNSnippetNode::generate() {
+    // sse41 is not used since emitters reserve Xmm0 as a mask register, while register allocation of snippets doesn't
+    cpu_isa_t isa = mayiuse(avx512_common) ? avx512_common : mayiuse(avx2) ? avx2 : isa_any;
+    if (isa == isa_any || inDims.size() + outDims.size() > SNIPPETS_MAX_IO_COUNT)
+        return false;
+
+    const auto planar = [](const SizeVector& dims) {
+        ngraph::AxisVector order(dims.size());
+        std::iota(order.begin(), order.end(), 0);
+        return ngraph::snippets::op::Subgraph::BlockedShape{ngraph::Shape(dims), order, ngraph::element::f32};
+    };
+    ngraph::snippets::op::Subgraph::BlockedShapeVector inputShapes, outputShapes;
+    for (const auto& dims : inDims)
+        inputShapes.push_back(planar(dims.ToSizeVector()));
+    for (const auto& dims : outDims)
+        outputShapes.push_back(planar(dims.ToSizeVector()));
+
+    try {
+        snippetCanonical = snippet->make_canonical_from_this();
+        snippetCanonical->set_generator(std::make_shared<CPUGenerator>(isa));
+        schedule = snippetCanonical->generate(outputShapes, inputShapes);
+    } catch (const std::exception&) {
+        snippetCanonical.reset();
+        return false;
+    }
+
+    const auto& work = schedule.work_size;
+    const size_t rank = work.size();
+    for (const auto& dims : outDims) {
+        if (dims.ndims() > rank || padShape(dims.ToSizeVector(), rank) != work)
+            return false;
+    }
+
+    std::vector<ngraph::Shape> shapes;
+    for (const auto& dims : inDims) {
+        if (dims.ndims() > rank)
+            return false;
+        shapes.push_back(padShape(dims.ToSizeVector(), rank));
+    }
+    shapes.insert(shapes.end(), outDims.size(), work);
+
+    // the kernel advances only tensors which are not broadcasted over the innermost dimension
+    innerAdvanced.clear();
+    for (const auto& shape : shapes)
+        innerAdvanced.push_back(shape.back() == work.back());
+
+    size_t outerRank = rank - 1;
+    innerDim = work.back();
+    while (outerRank > 0) {
+        const size_t d = outerRank - 1;
+        bool collapsible = true;
+        for (size_t t = 0; t < shapes.size(); t++) {
+            if (work[d] != 1 && shapes[t][d] != (innerAdvanced[t] ? work[d] : 1))
+                collapsible = false;
+        }
+        if (!collapsible)
+            break;
+        innerDim *= work[d];
+        outerRank--;
+    }
+
+    outerDims.assign(work.begin(), work.begin() + outerRank);
+    outerStrides.assign(shapes.size(), std::vector<size_t>(outerRank, 0));
+    for (size_t t = 0; t < shapes.size(); t++) {
+        size_t stride = std::accumulate(shapes[t].begin() + outerRank, shapes[t].end(), size_t(1), std::multiplies<size_t>());
+        for (int d = static_cast<int>(outerRank) - 1; d >= 0; d--) {
+            outerStrides[t][d] = shapes[t][d] == 1 ? 0 : stride;
+            stride *= shapes[t][d];
+        }
+    }
+
+    // split the innermost dimension between threads if outer ones aren't enough to load all of them
+    const size_t outerWork = ngraph::shape_size(outerDims);
+    const size_t nthr = static_cast<size_t>(parallel_get_max_threads());
+    const size_t innerChunks = outerWork >= nthr ? 1 : (nthr + outerWork - 1) / outerWork;
+    innerBlock = std::max(minInnerBlock, (innerDim + innerChunks - 1) / innerChunks);
+
+    return true;
+}
+
+void MKLDNNSnippetNode::execute(mkldnn::stream strm) {
+    if (!useJit) {
+        executeReference();
+        return;
+    }
+
+    std::vector<const uint8_t*> ptrs;
+    for (size_t i = 0; i < inDims.size(); i++)
+        ptrs.push_back(reinterpret_cast<const uint8_t*>(getParentEdgeAt(i)->getMemoryPtr()->GetPtr()));
+    for (size_t i = 0; i < outDims.size(); i++)
+        ptrs.push_back(reinterpret_cast<const uint8_t*>(getChildEdgesAtPort(i)[0]->getMemoryPtr()->GetPtr()));
+
+    auto ker = reinterpret_cast<void (*)(const jit_snippets_call_args*)>(const_cast<uint8_t*>(schedule.ptr));
+    const size_t outerWork = ngraph::shape_size(outerDims);
+    const size_t innerBlocks = (innerDim + innerBlock - 1) / innerBlock;
+
+    parallel_for2d(outerWork, innerBlocks, [&](size_t outer, size_t block) {
+        const size_t innerStart = block * innerBlock;
+
+        jit_snippets_call_args args;
+        args.work_amount = std::min(innerBlock, innerDim - innerStart);
+        for (size_t t = 0; t < ptrs.size(); t++) {
+            size_t offset = innerAdvanced[t] ? innerStart : 0;
+            size_t idx = outer;
+            for (int d = static_cast<int>(outerDims.size()) - 1; d >= 0; d--) {
+                offset += (idx % outerDims[d]) * outerStrides[t][d];
+                idx /= outerDims[d];
+            }
+            args.ptrs[t] = ptrs[t] + offset * sizeof(float);
+        }
+
+        ker(&args);
+    });
+}
+
+void MKLDNNSnippetNode::executeReference() {
+    ngraph::HostTensorVector inputs, outputs;
+    for (size_t i = 0; i < inDims.size(); i++) {
+        inputs.push_back(std::make_shared<ngraph::HostTensor>(ngraph::element::f32, ngraph::Shape(inDims[i].ToSizeVector()),
+                                                              getParentEdgeAt(i)->getMemoryPtr()->GetPtr()));
+    }
+    for (size_t i = 0; i < outDims.size(); i++) {
+        outputs.push_back(std::make_shared<ngraph::HostTensor>(ngraph::element::f32, ngraph::Shape(outDims[i].ToSizeVector()),
+                                                               getChildEdgesAtPort(i)[0]->getMemoryPtr()->GetPtr()));
+    }
+
+    if (!snippet->evaluate(outputs, inputs))
+        THROW_ERROR << "can't be evaluated";
+}
+
+bool MKLDNNSnippetNode::created() const {
+    return getType() == Subgraph;
+}
+
+REG_MKLDNN_PRIM_FOR(MKLDNNSnippetNode, Subgraph);
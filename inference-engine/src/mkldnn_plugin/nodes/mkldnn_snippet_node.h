@@ -0,0 +1,55 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <ie_common.h>
+#include <mkldnn_node.h>
+#include <snippets/op/subgraph.hpp>
+
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace MKLDNNPlugin {
+
+/**
+ * Executes a subgraph of elementwise operations tokenized by snippets as a single pass over the memory.
+ * The subgraph body is compiled to a JIT kernel by CPUGenerator, if it can't be compiled body is evaluated by reference.
+ */
+class MKLDNNSnippetNode : public MKLDNNNode {
+public:
+    MKLDNNSnippetNode(const InferenceEngine::CNNLayerPtr& layer, const mkldnn::engine& eng, MKLDNNWeightsSharing::Ptr &cache);
+    ~MKLDNNSnippetNode() override = default;
+
+    void getSupportedDescriptors() override;
+    void initSupportedPrimitiveDescriptors() override;
+    void createPrimitive() override;
+    void execute(mkldnn::stream strm) override;
+    bool created() const override;
+    bool canBeInPlace() const override {
+        return false;
+    }
+
+private:
+    // Compiles the subgraph and prepares execution domain, returns false if the subgraph should be evaluated by reference
+    bool generate();
+    void executeReference();
+
+    std::shared_ptr<ngraph::snippets::op::Subgraph> snippet;
+    // canonical copy of the snippet owning the generator and compiled code
+    std::shared_ptr<ngraph::snippets::op::Subgraph> snippetCanonical;
+    ngraph::snippets::Schedule schedule;
+    bool useJit = false;
+
+    // Execution domain. Innermost dimensions with the same broadcasting pattern over all tensors are collapsed into
+    // a single one processed by a kernel call, strides of outer dimensions are in elements and are zero for broadcasted ones
+    std::vector<size_t> outerDims;
+    size_t innerDim = 1;
+    size_t innerBlock = 1;
+    std::vector<std::vector<size_t>> outerStrides;
+    std::vector<bool> innerAdvanced;
+};
+
+}  // namespace MKLDNNPlugin
@@ -254,19 +254,16 @@ void MKLDNNSplitNode::createPrimitive() {
             canUseOptimizedNspc2Ncsp = false;
     }
 
-    if (!isOptimized()) {
-        initializeDstMemPtrs();
-        if (!canUseOptimizedNspc2Ncsp)
-            prepareOptimizedParams();
-    }
+    if (!isOptimized() && !canUseOptimizedNspc2Ncsp)
+        prepareOptimizedParams();
 }
 
 void MKLDNNSplitNode::execute(mkldnn::stream strm) {
     if (isOptimized())
         return;
 
-    if (dstMemPtrs.empty())
-        THROW_ERROR << "Output data pointers have not been initialized.";
+    // memory of child edges may be rebound between executions (e.g. by TensorIterator), so pointers are taken each time
+    initializeDstMemPtrs();
 
     int MB = batchToProcess();
 
@@ -9,6 +9,7 @@
 #include <string>
 #include <vector>
 #include <map>
+#include <set>
 #include <mkldnn_types.h>
 #include <mkldnn_extension_utils.h>
 
@@ -47,10 +48,84 @@ static InferenceEngine::LayerConfig make_plain_config(const InferenceEngine::CNN
     return config;
 }
 
+/**
+ * Collects memory objects of all body edges which share the buffer of specified body port tensor.
+ * The buffer may be substituted only if it belongs to a single output of a node and isn't shared
+ * with in-place nodes or views with offset, otherwise empty list is returned.
+ * Substitution relies on body nodes taking data pointers of their output memory on each execution.
+ */
+static std::vector<mkldnn::memory> get_substitutable_views(MKLDNNGraph &graph, const MKLDNNMemoryPtr &mem) {
+    const auto begin = static_cast<uint8_t *>(mem->GetData());
+    const auto end = begin + mem->GetSize();
+
+    std::vector<mkldnn::memory> views;
+    MKLDNNNodePtr parent;
+    int parent_port = -1;
+    for (auto &edge : graph.GetEdges()) {
+        const auto &edge_mem = edge->getMemoryPtr();
+        const auto edge_begin = static_cast<uint8_t *>(edge_mem->GetData());
+        const auto edge_end = edge_begin + edge_mem->GetSize();
+        if (edge_end <= begin || edge_begin >= end)
+            continue;
+
+        if (edge_begin != begin || edge_mem->GetDescriptor().data.offset0 != 0)
+            return {};
+
+        if (!parent) {
+            parent = edge->getParent();
+            parent_port = edge->getInputNum();
+        } else if (edge->getParent() != parent || edge->getInputNum() != parent_port) {
+            return {};
+        }
+
+        views.push_back(edge_mem->GetPrimitive());
+    }
+
+    if (!parent)
+        return {};
+
+    const auto *selected_pd = parent->getSelectedPrimitiveDescriptor();
+    if (selected_pd == nullptr || selected_pd->getConfig().outConfs[parent_port].inPlace >= 0)
+        return {};
+
+    return views;
+}
+
+/**
+ * Checks that the chunk of full tensor and the body port tensor have the same placement of data in memory,
+ * so the body may access the chunk directly
+ */
+static bool is_same_data_placement(const mkldnn::memory::desc &chunk_desc, const mkldnn::memory::desc &part_desc) {
+    const auto &chunk = chunk_desc.data;
+    const auto &part = part_desc.data;
+
+    if (chunk.format_kind != dnnl_blocked || part.format_kind != dnnl_blocked ||
+        chunk.format_desc.blocking.inner_nblks != 0 || part.format_desc.blocking.inner_nblks != 0)
+        return false;
+
+    if (chunk.data_type != part.data_type || chunk.ndims != part.ndims || chunk.offset0 != 0 || part.offset0 != 0)
+        return false;
+
+    for (int i = 0; i < chunk.ndims; i++) {
+        if (chunk.dims[i] != part.dims[i] || chunk.padded_dims[i] != chunk.dims[i] || part.padded_dims[i] != part.dims[i])
+            return false;
+        // strides of unit dimensions don't affect the placement
+        if (chunk.dims[i] != 1 && chunk.format_desc.blocking.strides[i] != part.format_desc.blocking.strides[i])
+            return false;
+    }
+    return true;
+}
+
+/**
+ * Moves the chunk of full tensor to or from the body port tensor on each iteration.
+ * If the body allows to substitute the port tensor buffer and the chunk has the same data placement,
+ * body accesses the chunk in place: only data handles of the port tensor are updated (zero copy mode).
+ */
 class PortIteratorHelper : public PortMapHelper {
 public:
     PortIteratorHelper(const MKLDNNMemoryPtr &from, const MKLDNNMemoryPtr &to, bool sliced_src,
-                       const InferenceEngine::TensorIterator::PortMap &slice_rule, const mkldnn::engine& eng)
+                       const InferenceEngine::TensorIterator::PortMap &slice_rule, const mkldnn::engine& eng,
+                       const std::vector<mkldnn::memory> &part_views = {})
                        : sliced_src(sliced_src) {
         const auto &full_blob = sliced_src ? from : to;
         const auto &part_blob = !sliced_src ? from : to;
@@ -84,6 +159,11 @@ public:
         chunk_offset_in_byte = sign_of_stride < 0 ? (iter_count - 1) * chunk_stride_in_byte : 0;
         chunk_stride_in_byte *= sign_of_stride;
 
+        if (!part_views.empty() && is_same_data_placement(chunk_desc, part_blob->GetDescriptor())) {
+            views = part_views;
+            return;
+        }
+
         if (sliced_src) {
             mem_holder_src = chunk_mem;
             mem_holder_dst = to->GetPrimitive();
@@ -94,12 +174,28 @@ public:
         reorder = {mem_holder_src, mem_holder_dst};
     }
 
+    /**
+     * In zero copy mode the body port tensor has to be rebound before the body execution
+     * even for output port
+     */
+    bool isZeroCopy() const {
+        return !views.empty();
+    }
+
     void execute(mkldnn::stream strm, int iter) override {
         IE_ASSERT(iter >= 0 && iter < iter_count);
 
+        const auto chunk_ptr = static_cast<uint8_t *>(full_mem.get_data_handle()) +
+                chunk_offset_in_byte + chunk_stride_in_byte * iter;
+
+        if (isZeroCopy()) {
+            for (auto &view : views)
+                view.set_data_handle(chunk_ptr);
+            return;
+        }
+
         auto &chunk_mem = sliced_src ? mem_holder_src : mem_holder_dst;
-        chunk_mem.set_data_handle(static_cast<uint8_t *>(full_mem.get_data_handle()) +
-                chunk_offset_in_byte + chunk_stride_in_byte * iter);
+        chunk_mem.set_data_handle(chunk_ptr);
 
         reorder.execute(strm, mem_holder_src, mem_holder_dst);
     }
@@ -110,6 +206,7 @@ private:
 
     bool sliced_src;
     mkldnn::memory full_mem;
+    std::vector<mkldnn::memory> views;
 
     int iter_count;
 };
@@ -129,6 +226,33 @@ public:
     }
 };
 
+/**
+ * Replaces copying of back edge data by swapping of two buffers between the body output and input:
+ * iteration i reads the input from buffer i % 2 and writes the output to buffer (i + 1) % 2.
+ */
+class BackEdgeSwapHelper : public PortMapHelper {
+public:
+    BackEdgeSwapHelper(const std::vector<mkldnn::memory> &from_views, const std::vector<mkldnn::memory> &to_views)
+            : from_views(from_views), to_views(to_views) {
+        buffers[0] = to_views.front().get_data_handle();
+        buffers[1] = from_views.front().get_data_handle();
+    }
+
+    void execute(mkldnn::stream strm, int iter) override {
+        IE_ASSERT(iter >= 0);
+
+        for (auto &view : to_views)
+            view.set_data_handle(buffers[iter % 2]);
+        for (auto &view : from_views)
+            view.set_data_handle(buffers[(iter + 1) % 2]);
+    }
+
+private:
+    std::vector<mkldnn::memory> from_views;
+    std::vector<mkldnn::memory> to_views;
+    void *buffers[2];
+};
+
 class IterCountPortHelper : public PortMapHelper {
 public:
     IterCountPortHelper(const MKLDNNMemoryPtr &to, const mkldnn::engine& eng) {
@@ -231,6 +355,20 @@ void MKLDNNTensorIteratorNode::createPrimitive() {
 
     const auto &eng = getEngine();
 
+    // Buffers of the body which are substituted by port helpers. Several ports may refer to the same buffer,
+    // but it may be rebound by one helper only. Back edge buffers are reserved for swapping.
+    std::set<const void *> rebound_buffers;
+    for (auto map_rule : ti->back_edges) {
+        rebound_buffers.insert(output_mem[map_rule.from]->GetData());
+        rebound_buffers.insert(input_mem[map_rule.to]->GetData());
+    }
+
+    auto get_views = [&](const MKLDNNMemoryPtr &mem) -> std::vector<mkldnn::memory> {
+        if (!rebound_buffers.insert(mem->GetData()).second)
+            return {};
+        return get_substitutable_views(sub_graph, mem);
+    };
+
     for (auto map_rule : ti->input_port_map) {
         auto &from_mem = getParentEdgesAtPort(map_rule.from)[0]->getMemoryPtr();
         auto &to_mem = input_mem[map_rule.to];
@@ -238,23 +376,43 @@ void MKLDNNTensorIteratorNode::createPrimitive() {
         if (map_rule.axis == -1)
             first_mappers.emplace_back(new BackEdgePortHelper(from_mem, to_mem, eng));
         else
-            before_mappers.emplace_back(new PortIteratorHelper(from_mem, to_mem, true, map_rule, eng));
+            before_mappers.emplace_back(new PortIteratorHelper(from_mem, to_mem, true, map_rule, eng, get_views(to_mem)));
     }
 
     for (auto map_rule : ti->output_port_map) {
         auto &to_mem = getChildEdgesAtPort(map_rule.from)[0]->getMemoryPtr();
         auto &from_mem = output_mem[map_rule.to];
 
-        if (map_rule.axis == -1)
+        if (map_rule.axis == -1) {
             last_mappers.emplace_back(new BackEdgePortHelper(from_mem, to_mem, eng));
-        else
-            after_mappers.emplace_back(new PortIteratorHelper(from_mem, to_mem, false, map_rule, eng));
+        } else {
+            std::shared_ptr<PortIteratorHelper> mapper(
+                    new PortIteratorHelper(from_mem, to_mem, false, map_rule, eng, get_views(from_mem)));
+            if (mapper->isZeroCopy())
+                before_mappers.push_back(mapper);
+            else
+                after_mappers.push_back(mapper);
+        }
     }
 
+    std::set<const void *> swapped_buffers;
     for (auto map_rule : ti->back_edges) {
         auto from_mem = output_mem[map_rule.from];
         auto to_mem = input_mem[map_rule.to];
 
+        // buffers may be swapped only if both tensors have the same descriptor and aren't involved into another back edge
+        if (from_mem->GetData() != to_mem->GetData() && from_mem->GetDesc() == to_mem->GetDesc() &&
+                swapped_buffers.insert(from_mem->GetData()).second && swapped_buffers.insert(to_mem->GetData()).second) {
+            auto from_views = get_substitutable_views(sub_graph, from_mem);
+            auto to_views = get_substitutable_views(sub_graph, to_mem);
+            if (!from_views.empty() && !to_views.empty()) {
+                std::shared_ptr<PortMapHelper> mapper(new BackEdgeSwapHelper(from_views, to_views));
+                reset_mappers.push_back(mapper);
+                before_mappers.push_back(mapper);
+                continue;
+            }
+        }
+
         before_mappers.emplace_back(new BackEdgePortHelper(from_mem, to_mem, eng));
     }
 
@@ -301,6 +459,9 @@ void MKLDNNTensorIteratorNode::execute(mkldnn::stream strm) {
     bool continue_cond = initial_cond_check->getStatus();
     int max_num_iter = trip_count_check->getStatus();
 
+    for (auto &mapper : reset_mappers)
+        mapper->execute(strm, 0);
+
     for (auto &mapper : first_mappers)
         mapper->execute(strm);
 
@@ -64,6 +64,7 @@ private:
     std::vector<MKLDNNMemoryPtr> input_mem, output_mem;
 
     std::vector<std::shared_ptr<PortMapHelper>>
+        reset_mappers,   /// < Applied once before loop to restore initial buffers of the body
         first_mappers,   /// < Applied once before loop
         last_mappers,    /// < Applied once after loop
         before_mappers,  /// < Applied before each iteration
@@ -3,6 +3,8 @@
 //
 
 ///////////////////////////////////////////////////////////////////////////////////////////////////
+#include <algorithm>
+#include <limits>
 #include <mutex>
 #include <string>
 #include <vector>
@@ -57,8 +59,12 @@ MultiDeviceExecutableNetwork::MultiDeviceExecutableNetwork(const DeviceMap<Infer
     _devicePrioritiesInitial{networkDevices},
     _networksPerDevice{networksPerDevice},
     _config{config},
-    _needPerfCounters{needPerfCounters} {
+    _needPerfCounters{needPerfCounters},
+    _loadTime{std::chrono::steady_clock::now()} {
     _taskExecutor.reset();
+    auto itPolicy = _config.find(MultiDeviceConfigParams::KEY_MULTI_SCHEDULING_POLICY);
+    if (itPolicy != _config.end() && itPolicy->second.as<std::string>() == MultiDeviceConfigParams::MULTI_THROUGHPUT)
+        _schedulingPolicy = SchedulingPolicy::Throughput;
     for (auto&& networkValue : _networksPerDevice) {
         auto& device  = networkValue.first;
         auto& network = networkValue.second;
@@ -80,6 +86,7 @@ MultiDeviceExecutableNetwork::MultiDeviceExecutableNetwork(const DeviceMap<Infer
         auto& idleWorkerRequests = _idleWorkerRequests[device];
         workerRequests.resize(numRequests);
         _inferPipelineTasksDeviceSpecific[device] = std::unique_ptr<ThreadSafeQueue<Task>>(new ThreadSafeQueue<Task>);
+        _deviceStatistics[device] = std::unique_ptr<DeviceStatistics>(new DeviceStatistics);
         auto* idleWorkerRequestsPtr = &(idleWorkerRequests);
         idleWorkerRequests.set_capacity(numRequests);
         for (auto&& workerRequest : workerRequests) {
@@ -90,6 +97,7 @@ MultiDeviceExecutableNetwork::MultiDeviceExecutableNetwork(const DeviceMap<Infer
                 [workerRequestPtr, this, device, idleWorkerRequestsPtr] (InferRequest , StatusCode status) mutable {
                     IdleGuard idleGuard{workerRequestPtr, *idleWorkerRequestsPtr};
                     workerRequestPtr->_status = status;
+                    OnWorkerRequestCompleted(device, workerRequestPtr);
                     {
                         auto capturedTask = std::move(workerRequestPtr->_task);
                         capturedTask();
@@ -99,9 +107,10 @@ MultiDeviceExecutableNetwork::MultiDeviceExecutableNetwork(const DeviceMap<Infer
                         // let's try to pop a task, as we know there is at least one idle request, schedule if succeeded
                         // if no device-agnostic tasks, let's try pop the device specific task, schedule if succeeded
                         Task t;
-                        if (_inferPipelineTasks.try_pop(t))
+                        if (_inferPipelineTasks.try_pop(t)) {
+                            --_numQueuedTasks;
                             ScheduleToWorkerInferRequest(std::move(t));
-                        else if (_inferPipelineTasksDeviceSpecific[device]->try_pop(t))
+                        } else if (_inferPipelineTasksDeviceSpecific[device]->try_pop(t))
                             ScheduleToWorkerInferRequest(std::move(t), device);
                     }
                 });
@@ -114,27 +123,106 @@ void MultiDeviceExecutableNetwork::ScheduleToWorkerInferRequest(Task inferPipeli
         std::lock_guard<std::mutex> lock(_mutex);
         return _devicePriorities;
     }();
-    for (auto&& device : devices) {
+    std::vector<std::pair<DeviceInformation, bool>> candidates;
+    if (_schedulingPolicy.load() == SchedulingPolicy::Throughput && preferred_device.empty()) {
+        candidates = SortByCompletionTime(devices);
+    } else {
+        for (auto&& device : devices)
+            candidates.emplace_back(device, true);
+    }
+    for (auto&& candidate : candidates) {
+        auto& device = candidate.first;
         if (!preferred_device.empty() && (device.deviceName != preferred_device))
             continue;
+        // the request is queued only if none of the devices has idle requests
+        if (!candidate.second)
+            continue;
         WorkerInferRequest* workerRequestPtr = nullptr;
         NotBusyWorkerRequests& idleWorkerRequests = _idleWorkerRequests[device.deviceName];
         if (idleWorkerRequests.try_pop(workerRequestPtr)) {
             IdleGuard idleGuard{workerRequestPtr, idleWorkerRequests};
             _thisWorkerInferRequest = workerRequestPtr;
-            {
+            workerRequestPtr->_startTime = std::chrono::steady_clock::now();
+            auto& statistics = *_deviceStatistics.at(device.deviceName);
+            ++statistics._numBusy;
+            try {
                 auto capturedTask = std::move(inferPipelineTask);
                 capturedTask();
+            } catch (...) {
+                --statistics._numBusy;
+                throw;
             }
             idleGuard.Release();
             return;
         }
     }
     // no vacant requests this time, storing the task to the respective queue
-    if (!preferred_device.empty())
+    if (!preferred_device.empty()) {
         _inferPipelineTasksDeviceSpecific[preferred_device]->push(std::move(inferPipelineTask));
-    else
+    } else {
+        ++_numQueuedTasks;
         _inferPipelineTasks.push(std::move(inferPipelineTask));
+    }
+}
+
+std::vector<std::pair<DeviceInformation, bool>>
+MultiDeviceExecutableNetwork::SortByCompletionTime(const std::vector<DeviceInformation>& devices) {
+    struct Estimation {
+        DeviceInformation   device;
+        bool                idle;
+        double              completionTime;
+    };
+    std::vector<Estimation> estimations;
+    const auto numQueued = std::max(0, _numQueuedTasks.load());
+    for (auto&& device : devices) {
+        const auto numWorkers = _workerRequests.at(device.deviceName).size();
+        if (numWorkers == 0)
+            continue;
+        auto& statistics = *_deviceStatistics.at(device.deviceName);
+        double latency = 0.0;
+        std::uint64_t numCompleted = 0;
+        {
+            std::lock_guard<std::mutex> lock(statistics._mutex);
+            latency = statistics._averageLatency;
+            numCompleted = statistics._numCompleted;
+        }
+        const auto numBusy = statistics._numBusy.load();
+        const bool idle = numBusy < numWorkers;
+        double completionTime = latency;
+        if (numCompleted == 0) {
+            // a single request probes the latency of the device without statistics,
+            // the other ones go to the devices with known latency while it is running
+            completionTime = numBusy == 0 ? 0.0 : std::numeric_limits<double>::max();
+        } else if (!idle) {
+            // the request waits for the queued ones, the busy device releases numWorkers requests per its latency
+            completionTime = latency * (1.0 + static_cast<double>(numQueued + 1) / numWorkers);
+        }
+        estimations.push_back({device, idle, completionTime});
+    }
+    // the stable sort keeps the priority order for the devices without statistics yet
+    std::stable_sort(estimations.begin(), estimations.end(), [](const Estimation& l, const Estimation& r) {
+        return l.completionTime < r.completionTime;
+    });
+    std::vector<std::pair<DeviceInformation, bool>> result;
+    for (auto&& estimation : estimations)
+        result.emplace_back(estimation.device, estimation.idle);
+    return result;
+}
+
+void MultiDeviceExecutableNetwork::OnWorkerRequestCompleted(const DeviceName& device, WorkerInferRequest* workerRequestPtr) {
+    const double latency = std::chrono::duration<double, std::milli>(
+        std::chrono::steady_clock::now() - workerRequestPtr->_startTime).count();
+    auto& statistics = *_deviceStatistics.at(device);
+    {
+        std::lock_guard<std::mutex> lock(statistics._mutex);
+        // exponential moving average reacts to the device load changes while smoothing single outliers
+        const double alpha = 0.2;
+        statistics._averageLatency = statistics._numCompleted == 0 ?
+                                     latency : (1.0 - alpha) * statistics._averageLatency + alpha * latency;
+        statistics._busyTime += latency;
+        statistics._numCompleted++;
+    }
+    --statistics._numBusy;
 }
 
 void MultiDeviceExecutableNetwork::run(Task inferPipelineTask) {
@@ -208,12 +296,31 @@ IInferRequest::Ptr MultiDeviceExecutableNetwork::CreateInferRequest() {
 
 void MultiDeviceExecutableNetwork::SetConfig(const std::map<std::string, InferenceEngine::Parameter> &config) {
     auto priorities = config.find(MultiDeviceConfigParams::KEY_MULTI_DEVICE_PRIORITIES);
-    if (priorities == config.end() || config.size() > 1) {
-        THROW_IE_EXCEPTION << "The only config supported for the Network's SetConfig is MultiDeviceConfigParams::KEY_MULTI_DEVICE_PRIORITIES";
-    } else {
+    auto policy = config.find(MultiDeviceConfigParams::KEY_MULTI_SCHEDULING_POLICY);
+    const size_t numSupported = (priorities != config.end()) + (policy != config.end());
+    if (numSupported == 0 || config.size() > numSupported) {
+        THROW_IE_EXCEPTION << "The only configs supported for the Network's SetConfig are MultiDeviceConfigParams::KEY_MULTI_DEVICE_PRIORITIES"
+                           << " and MultiDeviceConfigParams::KEY_MULTI_SCHEDULING_POLICY";
+    }
+
+    SchedulingPolicy schedulingPolicy = _schedulingPolicy;
+    if (policy != config.end()) {
+        auto value = policy->second.as<std::string>();
+        if (value == MultiDeviceConfigParams::MULTI_PRIORITY) {
+            schedulingPolicy = SchedulingPolicy::Priority;
+        } else if (value == MultiDeviceConfigParams::MULTI_THROUGHPUT) {
+            schedulingPolicy = SchedulingPolicy::Throughput;
+        } else {
+            THROW_IE_EXCEPTION << "Wrong value " << value << " for KEY_MULTI_SCHEDULING_POLICY. Expected only "
+                               << MultiDeviceConfigParams::MULTI_PRIORITY << "/" << MultiDeviceConfigParams::MULTI_THROUGHPUT;
+        }
+    }
+
+    std::vector<DeviceInformation> metaDevices;
+    if (priorities != config.end()) {
         auto multiPlugin = std::dynamic_pointer_cast<MultiDeviceInferencePlugin>(this->_plugin);
         assert(multiPlugin != nullptr);
-        auto metaDevices = multiPlugin->ParseMetaDevices(priorities->second, {});
+        metaDevices = multiPlugin->ParseMetaDevices(priorities->second, {});
 
         if (std::any_of(metaDevices.begin(), metaDevices.end(), [](const DeviceInformation& kvp) {
                 return kvp.numRequestsPerDevices != -1;
@@ -221,9 +328,11 @@ void MultiDeviceExecutableNetwork::SetConfig(const std::map<std::string, Inferen
             THROW_IE_EXCEPTION << "You can only change device priorities but not number of requests"
                      <<" with the Network's SetConfig(MultiDeviceConfigParams::KEY_MULTI_DEVICE_PRIORITIES!";
         }
+    }
 
-        {
-            std::lock_guard<std::mutex> lock{_mutex};
+    {
+        std::lock_guard<std::mutex> lock{_mutex};
+        if (priorities != config.end()) {
             for (auto && device : metaDevices) {
                 if (_networksPerDevice.find(device.deviceName) == _networksPerDevice.end()) {
                     THROW_IE_EXCEPTION << NOT_FOUND_str << "You can only change device priorities but not add new devices with"
@@ -237,6 +346,10 @@ void MultiDeviceExecutableNetwork::SetConfig(const std::map<std::string, Inferen
             // update value in config
             _config[MultiDeviceConfigParams::KEY_MULTI_DEVICE_PRIORITIES] = priorities->second;
         }
+        if (policy != config.end()) {
+            _schedulingPolicy = schedulingPolicy;
+            _config[MultiDeviceConfigParams::KEY_MULTI_SCHEDULING_POLICY] = policy->second;
+        }
     }
 }
 
@@ -273,11 +386,28 @@ InferenceEngine::Parameter MultiDeviceExecutableNetwork::GetMetric(const std::st
             METRIC_KEY(OPTIMAL_NUMBER_OF_INFER_REQUESTS),
             METRIC_KEY(SUPPORTED_METRICS),
             METRIC_KEY(NETWORK_NAME),
-            METRIC_KEY(SUPPORTED_CONFIG_KEYS)
+            METRIC_KEY(SUPPORTED_CONFIG_KEYS),
+            MULTI_METRIC_KEY(DEVICE_STATISTICS)
         });
     } else if (name == METRIC_KEY(SUPPORTED_CONFIG_KEYS)) {
-        std::vector<std::string> configKeys = { MultiDeviceConfigParams::KEY_MULTI_DEVICE_PRIORITIES };
+        std::vector<std::string> configKeys = { MultiDeviceConfigParams::KEY_MULTI_DEVICE_PRIORITIES,
+                                                MultiDeviceConfigParams::KEY_MULTI_SCHEDULING_POLICY };
         IE_SET_METRIC_RETURN(SUPPORTED_CONFIG_KEYS, configKeys);
+    } else if (name == MULTI_METRIC_KEY(DEVICE_STATISTICS)) {
+        const double elapsed = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - _loadTime).count();
+        std::map<std::string, std::map<std::string, double>> result;
+        for (auto&& item : _deviceStatistics) {
+            const auto numWorkers = _workerRequests.at(item.first).size();
+            auto& statistics = *item.second;
+            auto& deviceResult = result[item.first];
+            std::lock_guard<std::mutex> lock(statistics._mutex);
+            deviceResult["AVERAGE_LATENCY_MS"] = statistics._averageLatency;
+            deviceResult["COMPLETED_REQUESTS"] = static_cast<double>(statistics._numCompleted);
+            deviceResult["BUSY_REQUESTS"] = statistics._numBusy;
+            deviceResult["UTILIZATION"] = (elapsed > 0.0 && numWorkers > 0) ?
+                                          std::min(1.0, statistics._busyTime / (elapsed * numWorkers)) : 0.0;
+        }
+        IE_SET_METRIC_RETURN(MULTI_DEVICE_STATISTICS, result);
     } else {
         THROW_IE_EXCEPTION << "Unsupported Network metric: " << name;
     }
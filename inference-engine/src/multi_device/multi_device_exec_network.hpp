@@ -6,12 +6,15 @@
 #pragma once
 
 #include <atomic>
+#include <chrono>
+#include <memory>
 #include <mutex>
 #include <queue>
 #include <unordered_map>
 #include <map>
 #include <vector>
 #include <string>
+#include <utility>
 
 #include <cpp_interfaces/impl/ie_executable_network_thread_safe_default.hpp>
 #include <ie_parallel.hpp>
@@ -98,13 +101,28 @@ class MultiDeviceExecutableNetwork : public InferenceEngine::ExecutableNetworkTh
                                      public InferenceEngine::ITaskExecutor {
 public:
     using Ptr = std::shared_ptr<MultiDeviceExecutableNetwork>;
+    using Time = std::chrono::steady_clock::time_point;
     struct WorkerInferRequest {
         InferenceEngine::InferRequest   _inferRequest;
         InferenceEngine::Task           _task;
         InferenceEngine::StatusCode     _status = InferenceEngine::StatusCode::OK;
+        Time                            _startTime;
     };
     using NotBusyWorkerRequests = ThreadSafeBoundedQueue<WorkerInferRequest*>;
 
+    enum class SchedulingPolicy {
+        Priority,
+        Throughput,
+    };
+
+    struct DeviceStatistics {
+        std::mutex                  _mutex;
+        double                      _averageLatency = 0.0;  // milliseconds
+        double                      _busyTime = 0.0;        // milliseconds
+        std::uint64_t               _numCompleted = 0;
+        std::atomic<unsigned int>   _numBusy = {0};
+    };
+
     explicit MultiDeviceExecutableNetwork(const DeviceMap<InferenceEngine::ExecutableNetwork>&                  networksPerDevice,
                                           const std::vector<DeviceInformation>&                                 networkDevices,
                                           const std::unordered_map<std::string, InferenceEngine::Parameter>&    config,
@@ -122,6 +140,13 @@ public:
 
     void ScheduleToWorkerInferRequest(InferenceEngine::Task, DeviceName preferred_device = "");
 
+    /**
+     * @brief Orders the devices by the expected completion time of a new request. Devices without idle requests
+     *        are marked, as a request scheduled to them has to wait in the queue
+     */
+    std::vector<std::pair<DeviceInformation, bool>> SortByCompletionTime(const std::vector<DeviceInformation>& devices);
+    void OnWorkerRequestCompleted(const DeviceName& device, WorkerInferRequest* workerRequestPtr);
+
     static thread_local WorkerInferRequest*                     _thisWorkerInferRequest;
     // have to use the const char* ptr rather than std::string due to a bug in old gcc versions,
     // the bug is e.g. manifesting on the old CentOS (and it's 4.8.x gcc) used in our testing
@@ -138,6 +163,10 @@ public:
     std::unordered_map<std::string, InferenceEngine::Parameter> _config;
     bool                                                        _needPerfCounters = false;
     std::atomic_size_t                                          _numRequestsCreated = {0};
+    std::atomic<SchedulingPolicy>                               _schedulingPolicy = {SchedulingPolicy::Priority};
+    DeviceMap<std::unique_ptr<DeviceStatistics>>                _deviceStatistics;
+    std::atomic<int>                                            _numQueuedTasks = {0};
+    const Time                                                  _loadTime;
 };
 
 }  // namespace MultiDevicePlugin
@@ -271,10 +271,20 @@ protected:
             auto it = _preProcData.find(input.first);
             if (it != _preProcData.end()) {
                 _preProcData[input.first]->execute(input.second, _networkInputs[input.first]->getPreProcess(), serial,
-                                                   m_curBatch);
+                                                   m_curBatch, isNormalizationFused(input.first));
             }
         }
     }
+    /**
+     * @brief Checks if per-channel mean values and scales of an input are applied during input data pre-processing
+     * @note A plugin which returns `true` must not apply them on its own and must provide FP32 pre-processed blob
+     * @param name A name of input blob
+     * @return `False` by default, so mean values and scales are left to a plugin
+     */
+    virtual bool isNormalizationFused(const std::string& name) const {
+        (void)name;
+        return false;
+    }
     /**
      * @brief Helper function to find input or output blob by name
      * @param name A name of input or output blob.
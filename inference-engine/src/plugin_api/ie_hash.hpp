@@ -0,0 +1,96 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+/**
+ * @brief A header file with fast non-cryptographic hashing of binary data
+ * @file ie_hash.hpp
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <type_traits>
+
+#include "ie_api.h"
+
+namespace InferenceEngine {
+
+/**
+ * @brief Incremental 64-bit hash of a byte sequence, implements the xxHash64 algorithm.
+ * @ingroup ie_dev_api_memory
+ *
+ * Data is consumed in 32-byte stripes by four independent accumulators, so the hashing speed
+ * is bounded by memory bandwidth rather than by the dependency chain of a byte-wise CRC.
+ * Splitting the input into several update() calls gives the same result as a single call.
+ */
+class INFERENCE_ENGINE_API_CLASS(DataHasher) {
+public:
+    /**
+     * @brief Creates a hasher initialized with the given seed
+     * @param seed A seed value
+     */
+    explicit DataHasher(uint64_t seed = 0);
+
+    /**
+     * @brief Drops the consumed data and reinitializes the hasher with a new seed
+     * @param seed A seed value
+     */
+    void reset(uint64_t seed = 0);
+
+    /**
+     * @brief Consumes a chunk of data
+     * @param data A pointer to the data
+     * @param size A size of the data in bytes
+     * @return A reference to the hasher
+     */
+    DataHasher& update(const void* data, size_t size);
+
+    /**
+     * @brief Consumes a string together with its length, so concatenations of different strings are distinguished
+     * @param str A string to consume
+     * @return A reference to the hasher
+     */
+    DataHasher& update(const std::string& str) {
+        update(static_cast<uint64_t>(str.size()));
+        return update(str.data(), str.size());
+    }
+
+    /**
+     * @brief Consumes a binary representation of an arithmetic or enumeration value
+     * @param value A value to consume
+     * @return A reference to the hasher
+     */
+    template <typename T, typename = typename std::enable_if<std::is_arithmetic<T>::value || std::is_enum<T>::value>::type>
+    DataHasher& update(const T& value) {
+        return update(&value, sizeof(T));
+    }
+
+    /**
+     * @brief Computes the hash of the data consumed so far. The hasher state is not changed.
+     * @return A hash value
+     */
+    uint64_t digest() const;
+
+    /**
+     * @brief Computes the hash of a single chunk of data
+     * @param data A pointer to the data
+     * @param size A size of the data in bytes
+     * @param seed A seed value
+     * @return A hash value
+     */
+    static uint64_t hash(const void* data, size_t size, uint64_t seed = 0);
+
+private:
+    static constexpr size_t stripeSize = 32;
+
+    uint64_t _seed;
+    uint64_t _acc[4];
+    uint64_t _totalSize;
+    uint8_t _buffer[stripeSize];
+    size_t _bufferSize;
+};
+
+}  // namespace InferenceEngine
@@ -12,6 +12,7 @@
 #include <ie_api.h>
 
 #include <cstddef>
+#include <cstdint>
 #include <type_traits>
 #include <limits>
 #include <algorithm>
@@ -77,6 +78,33 @@ namespace InferenceEngine {
  */
 using ie_fp16 = short;
 
+/**
+ * @brief A type definition for BF16 data type. Holds raw bits of a bfloat16 value and is a distinct
+ * type, so that BF16 and FP16 values of the same size can't be mixed up
+ * @ingroup ie_dev_api_precision
+ */
+struct ie_bf16 {
+    uint16_t bits;  //!< Raw bits of a bfloat16 value
+
+    /**
+     * @brief Compares raw bits of two bfloat16 values
+     * @param rhs A value to compare with
+     * @return `true` if values have the same bits, `false` otherwise
+     */
+    bool operator==(const ie_bf16& rhs) const {
+        return bits == rhs.bits;
+    }
+
+    /**
+     * @brief Compares raw bits of two bfloat16 values
+     * @param rhs A value to compare with
+     * @return `true` if values have different bits, `false` otherwise
+     */
+    bool operator!=(const ie_bf16& rhs) const {
+        return bits != rhs.bits;
+    }
+};
+
 /**
  * @brief Namespace for precision utilities
  * @ingroup ie_dev_api_precision
@@ -103,7 +131,9 @@ INFERENCE_ENGINE_API_CPP(float) f16tof32(ie_fp16 x);
 
 /**
  * @brief      Converts a half-precision floating point array to single-precision floating point array
- * 	           and applies `scale` and `bias` is needed
+ * 	           and applies `scale` and `bias` is needed. Conversion is vectorized for the current CPU and
+ *             large arrays are processed in parallel, results are the same as of f16tof32 up to rounding of
+ *             fused `scale` and `bias` application
  * @ingroup    ie_dev_api_precision
  *
  * @param      dst    A destination array of single-precision floating point values
@@ -117,7 +147,9 @@ f16tof32Arrays(float* dst, const ie_fp16* src, size_t nelem, float scale = 1.f,
 
 /**
  * @brief      Converts a single-precision floating point array to a half-precision floating point array
- *             and applies `scale` and `bias` if needed 
+ *             and applies `scale` and `bias` if needed. Conversion is vectorized for the current CPU and
+ *             large arrays are processed in parallel, results are the same as of f32tof16 up to rounding of
+ *             fused `scale` and `bias` application
  * @ingroup    ie_dev_api_precision
  *
  * @param      dst    A destination array of half-precision floating point values
@@ -129,6 +161,53 @@ f16tof32Arrays(float* dst, const ie_fp16* src, size_t nelem, float scale = 1.f,
 INFERENCE_ENGINE_API_CPP(void)
 f32tof16Arrays(ie_fp16* dst, const float* src, size_t nelem, float scale = 1.f, float bias = 0.f);
 
+/**
+ * @brief      Converts a single-precision floating point value to a bfloat16 value
+ *             rounding to nearest even, NaN values are kept quiet NaN
+ * @ingroup    ie_dev_api_precision
+ *
+ * @param[in]  x     A single-precision floating point value
+ * @return     A bfloat16 value
+ */
+INFERENCE_ENGINE_API_CPP(ie_bf16) f32tobf16(float x);
+
+/**
+ * @brief      Converts a bfloat16 value to a single-precision floating point value
+ * @ingroup    ie_dev_api_precision
+ *
+ * @param[in]  x     A bfloat16 value
+ * @return     A single-precision floating point value
+ */
+INFERENCE_ENGINE_API_CPP(float) bf16tof32(ie_bf16 x);
+
+/**
+ * @brief      Converts a bfloat16 array to single-precision floating point array
+ *             and applies `scale` and `bias` if needed
+ * @ingroup    ie_dev_api_precision
+ *
+ * @param      dst    A destination array of single-precision floating point values
+ * @param[in]  src    A source array of bfloat16 values
+ * @param[in]  nelem  A number of elements in arrays
+ * @param[in]  scale  An optional scale parameter
+ * @param[in]  bias   An optional bias parameter
+ */
+INFERENCE_ENGINE_API_CPP(void)
+bf16tof32Arrays(float* dst, const ie_bf16* src, size_t nelem, float scale = 1.f, float bias = 0.f);
+
+/**
+ * @brief      Converts a single-precision floating point array to a bfloat16 array
+ *             and applies `scale` and `bias` if needed
+ * @ingroup    ie_dev_api_precision
+ *
+ * @param      dst    A destination array of bfloat16 values
+ * @param[in]  src    A sources array of single-precision floating point values
+ * @param[in]  nelem  A number of elements in arrays
+ * @param[in]  scale  An optional scale parameter
+ * @param[in]  bias   An optional bias parameter
+ */
+INFERENCE_ENGINE_API_CPP(void)
+f32tobf16Arrays(ie_bf16* dst, const float* src, size_t nelem, float scale = 1.f, float bias = 0.f);
+
 #if defined(_MSC_VER)
 #pragma warning(push)
 #pragma warning(disable : 4018)
@@ -127,6 +127,27 @@ void copyRow_32F(const float in[], float out[], int length) {
     copyRow_32F_impl(in, out, length);
 }
 
+void normalizeRow_8U32F(const uint8_t in[], float out[], float mean, float scale, int length) {
+    normalizeRow_8U32F_impl(in, out, mean, scale, length);
+}
+
+void normalizeRow_32F(const float in[], float out[], float mean, float scale, int length) {
+    normalizeRow_32F_impl(in, out, mean, scale, length);
+}
+
+void calcRowCubicH_32F(const float in[], float out[], const int mapsx[], const float alpha[], int length) {
+    calcRowCubicH_32F_impl(in, out, mapsx, alpha, length);
+}
+
+void calcRowCubicV_32F(const float in[], float out[], const float beta[], int length) {
+    calcRowCubicV_32F_impl(in, out, beta, length);
+}
+
+void stackRows4_32F(const float in0[], const float in1[], const float in2[], const float in3[],
+                    float out[], int length) {
+    stackRows4_32F_impl(in0, in1, in2, in3, out, length);
+}
+
 template<int chanNum>
 CV_ALWAYS_INLINE void channels2planes_store(std::array<std::array<uint8_t*, 4>, chanNum>& dst,
                                             const uchar* src, const int width,
@@ -186,6 +186,36 @@ void copyRow_32F(const float in[],
                  float out[],
                  int length);
 
+void normalizeRow_8U32F(const uint8_t in[],
+                        float out[],
+                        float mean,
+                        float scale,
+                        int length);
+
+void normalizeRow_32F(const float in[],
+                      float out[],
+                      float mean,
+                      float scale,
+                      int length);
+
+void calcRowCubicH_32F(const float in[],
+                       float out[],
+                       const int mapsx[],
+                       const float alpha[],
+                       int length);
+
+void calcRowCubicV_32F(const float in[],
+                       float out[],
+                       const float beta[],
+                       int length);
+
+void stackRows4_32F(const float in0[],
+                    const float in1[],
+                    const float in2[],
+                    const float in3[],
+                    float out[],
+                    int length);
+
 }  // namespace neon
 }  // namespace kernels
 }  // namespace gapi
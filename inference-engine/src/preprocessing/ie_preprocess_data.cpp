@@ -11,6 +11,7 @@
 #include <ie_input_info.hpp>
 
 #include <memory>
+#include <vector>
 
 namespace InferenceEngine {
 
@@ -34,7 +35,8 @@ public:
 
     Blob::Ptr getRoiBlob() const override;
 
-    void execute(Blob::Ptr &preprocessedBlob, const PreProcessInfo &info, bool serial, int batchSize = -1) override;
+    void execute(Blob::Ptr &preprocessedBlob, const PreProcessInfo &info, bool serial, int batchSize = -1,
+                 bool normalize = false) override;
 
     void isApplicable(const Blob::Ptr &src, const Blob::Ptr &dst) override;
 };
@@ -54,7 +56,7 @@ Blob::Ptr PreProcessData::getRoiBlob() const {
 }
 
 void PreProcessData::execute(Blob::Ptr &preprocessedBlob, const PreProcessInfo &info, bool serial,
-        int batchSize) {
+        int batchSize, bool normalize) {
     OV_ITT_SCOPED_TASK(itt::domains::IEPreproc, "Preprocessing");
 
     auto algorithm = info.getResizeAlgorithm();
@@ -70,7 +72,19 @@ void PreProcessData::execute(Blob::Ptr &preprocessedBlob, const PreProcessInfo &
         _preproc.reset(new PreprocEngine);
     }
 
-    _preproc->preprocessWithGAPI(_userBlob, preprocessedBlob, algorithm, fmt, serial, batchSize);
+    std::vector<float> mean, scale;
+    if (normalize) {
+        if (info.getMeanVariant() != MEAN_VALUE) {
+            THROW_IE_EXCEPTION << "Input pre-processing can apply only per-channel mean values, got mean variant "
+                               << info.getMeanVariant();
+        }
+        for (size_t c = 0; c < info.getNumberOfChannels(); c++) {
+            mean.push_back(info[c]->meanValue);
+            scale.push_back(info[c]->stdScale);
+        }
+    }
+
+    _preproc->preprocessWithGAPI(_userBlob, preprocessedBlob, algorithm, fmt, serial, batchSize, mean, scale);
 }
 
 void PreProcessData::isApplicable(const Blob::Ptr &src, const Blob::Ptr &dst) {
@@ -53,8 +53,11 @@ public:
      * @param info pre-processing info that specifies resize algorithm and color format.
      * @param serial disable OpenMP threading if the value set to true.
      * @param batchSize batch size for pre-processing.
+     * @param normalize apply per-channel mean values and scales from the pre-processing info in the same pass,
+     * requires MEAN_VALUE mean variant and FP32 pre-processed blob.
      */
-    virtual void execute(Blob::Ptr &preprocessedBlob, const PreProcessInfo& info, bool serial, int batchSize = -1) = 0;
+    virtual void execute(Blob::Ptr &preprocessedBlob, const PreProcessInfo& info, bool serial, int batchSize = -1,
+                         bool normalize = false) = 0;
 
     //FIXME: rename to verifyAplicable
     virtual void isApplicable(const Blob::Ptr &src, const Blob::Ptr &dst) = 0;
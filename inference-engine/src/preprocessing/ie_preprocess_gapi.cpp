@@ -5,7 +5,9 @@
 #include <utility>
 #include <vector>
 #include <algorithm>
+#include <cmath>
 #include <cstdlib>
+#include <cstring>
 #include <tuple>
 #include <string>
 #include <unordered_map>
@@ -25,6 +27,7 @@
 #include "debug.h"
 
 #include "ie_parallel.hpp"
+#include "blob_factory.hpp"
 
 #include <opencv2/gapi/fluid/gfluidkernel.hpp>  // GFluidOutputRois
 
@@ -544,13 +547,84 @@ convertColorPlanar(const std::vector<cv::GMat>& inputs,
     return planes;
 }
 
+// RESIZE_LETTERBOX resizes the image into the largest centered rectangle of the output
+// which keeps the image's aspect ratio
+cv::gapi::own::Rect letterbox_rect(int in_w, int in_h, int out_w, int out_h) {
+    const double ratio = std::min(static_cast<double>(out_w) / in_w, static_cast<double>(out_h) / in_h);
+    const int w = std::max(1, std::min(out_w, static_cast<int>(std::lround(in_w * ratio))));
+    const int h = std::max(1, std::min(out_h, static_cast<int>(std::lround(in_h * ratio))));
+    return cv::gapi::own::Rect{(out_w - w) / 2, (out_h - h) / 2, w, h};
+}
+
+// 0123 == NCHW
+cv::gapi::own::Rect letterbox_rect(const SizeVector &in, const SizeVector &out) {
+    return letterbox_rect(static_cast<int>(in[3]), static_cast<int>(in[2]),
+                          static_cast<int>(out[3]), static_cast<int>(out[2]));
+}
+
+// Fills the part of the plane outside of rect with the given pixel value
+void fill_border(cv::gapi::own::Mat &plane, const cv::gapi::own::Rect &rect, const std::vector<uint8_t> &pixel) {
+    const auto pixel_size = pixel.size();
+    const auto fill = [&](uint8_t *dst, int count) {
+        for (int i = 0; i < count; i++) {
+            std::copy(pixel.begin(), pixel.end(), dst + i * pixel_size);
+        }
+    };
+
+    for (int y = 0; y < plane.rows; y++) {
+        uint8_t *row = plane.ptr(y);
+        if (y < rect.y || y >= rect.y + rect.height) {
+            fill(row, plane.cols);
+        } else {
+            fill(row, rect.x);
+            fill(row + (rect.x + rect.width) * pixel_size, plane.cols - rect.x - rect.width);
+        }
+    }
+}
+
+// Pads output planes around the letterbox rect with zero pixels (normalized if mean values are
+// given) and leaves only the rect for the graph to write to
+void letterbox_output(std::vector<std::vector<cv::gapi::own::Mat>> &batched_planes,
+                      const cv::gapi::own::Rect &rect, Precision prec,
+                      const std::vector<float> &mean, const std::vector<float> &scale) {
+    const auto pixel_bytes = [&](size_t c) {
+        std::vector<uint8_t> bytes(prec.size(), 0);
+        if (!mean.empty()) {
+            IE_ASSERT(prec == Precision::FP32);
+            const float value = (0.f - mean[c]) * scale[c];
+            std::memcpy(bytes.data(), &value, sizeof(value));
+        }
+        return bytes;
+    };
+
+    for (auto &planes : batched_planes) {
+        for (size_t p = 0; p < planes.size(); p++) {
+            std::vector<uint8_t> pixel;
+            if (planes.size() == 1) {
+                // interleaved
+                for (int c = 0; c < planes[p].channels(); c++) {
+                    const auto bytes = pixel_bytes(c);
+                    pixel.insert(pixel.end(), bytes.begin(), bytes.end());
+                }
+            } else {
+                pixel = pixel_bytes(p);
+            }
+
+            fill_border(planes[p], rect, pixel);
+            planes[p] = planes[p](rect);
+        }
+    }
+}
+
 cv::GComputation buildGraph(const G::Desc &in_desc,
                             const G::Desc &out_desc,
                             Layout in_layout,
                             Layout out_layout,
                             ResizeAlgorithm algorithm,
                             ColorFormat input_color_format,
-                            ColorFormat output_color_format) {
+                            ColorFormat output_color_format,
+                            const std::vector<float> &mean,
+                            const std::vector<float> &scale) {
     // perform basic validation to ensure our assumptions about input and output are correct
     validateColorFormats(in_desc, out_desc, in_layout, out_layout, input_color_format,
         output_color_format);
@@ -564,7 +638,7 @@ cv::GComputation buildGraph(const G::Desc &in_desc,
 
     // specific pre-processing case:
     // 1. Requires interleaved image of type CV_8UC3/CV_8UC4 (except for NV12/I420 input)
-    // 2. Supports bilinear resize only
+    // 2. Supports bilinear resize only (letterbox resize is bilinear too)
     // 3. Supports NV12/I420 -> RGB/BGR color transformations
     const bool nv12_input = (input_color_format == ColorFormat::NV12);
     const bool i420_input = (input_color_format == ColorFormat::I420);
@@ -573,10 +647,12 @@ cv::GComputation buildGraph(const G::Desc &in_desc,
     const auto io_color_formats = std::make_tuple(input_color_format, output_color_format);
     const bool drop_channel = (io_color_formats == std::make_tuple(ColorFormat::RGBX, ColorFormat::RGB)) ||
                               (io_color_formats == std::make_tuple(ColorFormat::BGRX, ColorFormat::BGR));
-    const bool specific_case_of_preproc = ((in_layout == NHWC || specific_yuv420_input_handling)
+    const bool normalize = !mean.empty();
+    const bool specific_case_of_preproc = !normalize
+                                        && ((in_layout == NHWC || specific_yuv420_input_handling)
                                         && (in_desc.d.C == 3 || specific_yuv420_input_handling || drop_channel)
                                         && ((in_desc.prec == CV_8U) && (in_desc.prec == out_desc.prec))
-                                        && (algorithm == RESIZE_BILINEAR)
+                                        && (algorithm == RESIZE_BILINEAR || algorithm == RESIZE_LETTERBOX)
                                         && (input_color_format == ColorFormat::RAW
                                             || input_color_format == output_color_format
                                             || drop_channel
@@ -633,7 +709,9 @@ cv::GComputation buildGraph(const G::Desc &in_desc,
 
     std::vector<cv::GMat> outputs;
     const bool resize_needed = (algorithm != NO_RESIZE);
-    const bool need_tmp_prec_conv = resize_needed && (in_desc.prec != CV_8U) && (in_desc.prec != CV_32F);
+    // bicubic resize is implemented for 32F planes only
+    const bool need_tmp_prec_conv = resize_needed && (in_desc.prec != CV_32F)
+                                 && (in_desc.prec != CV_8U || algorithm == RESIZE_BICUBIC);
 
     if (resize_needed) {
         // resize every plane
@@ -641,8 +719,10 @@ cv::GComputation buildGraph(const G::Desc &in_desc,
         out_planes.reserve(planes.size());
         const int interp_type = [](const ResizeAlgorithm &ar) {
             switch (ar) {
-            case RESIZE_AREA:     return cv::INTER_AREA;
-            case RESIZE_BILINEAR: return cv::INTER_LINEAR;
+            case RESIZE_AREA:      return cv::INTER_AREA;
+            case RESIZE_BILINEAR:  return cv::INTER_LINEAR;
+            case RESIZE_BICUBIC:   return cv::INTER_CUBIC;
+            case RESIZE_LETTERBOX: return cv::INTER_LINEAR;
             default: THROW_IE_EXCEPTION << "Unsupported resize operation";
             }
         } (algorithm);
@@ -665,7 +745,17 @@ cv::GComputation buildGraph(const G::Desc &in_desc,
         outputs = planes;
     }
 
-    if ((in_desc.prec != out_desc.prec) || need_tmp_prec_conv) {
+    if (normalize) {
+        // mean and scale are applied in the same pass as the conversion to the output precision
+        if (mean.size() != outputs.size() || scale.size() != outputs.size()) {
+            THROW_IE_EXCEPTION << "[G-API] internal error: number of mean values and scales "
+                               << "!= network's expected number of channels: "
+                               << mean.size() << ", " << scale.size() << " != " << outputs.size();
+        }
+        for (size_t i = 0; i < outputs.size(); i++) {
+            outputs[i] = gapi::NormalizePlane::on(outputs[i], mean[i], scale[i], out_desc.prec);
+        }
+    } else if ((in_desc.prec != out_desc.prec) || need_tmp_prec_conv) {
         auto convert_prec = [](const std::vector<cv::GMat> & src_gmats, int dst_precision) {
             std::vector<cv::GMat> dst_gmats;
             std::transform(src_gmats.begin(), src_gmats.end(), std::back_inserter(dst_gmats), [&](cv::GMat const& m){
@@ -685,7 +775,7 @@ cv::GComputation buildGraph(const G::Desc &in_desc,
 }
 }  // anonymous namespace
 
-PreprocEngine::PreprocEngine() : _lastComp(parallel_get_max_threads()) {}
+PreprocEngine::PreprocEngine(bool serial) : _lastComp(serial ? 1 : parallel_get_max_threads()), _serial(serial) {}
 
 PreprocEngine::Update PreprocEngine::needUpdate(const CallDesc &newCallOrig) const {
     // Given our knowledge about Fluid, full graph rebuild is required
@@ -696,6 +786,8 @@ PreprocEngine::Update PreprocEngine::needUpdate(const CallDesc &newCallOrig) con
     // 3. algorithm has changed (affects kernel version)
     // 4. dimensions have changed from downscale to upscale or vice-versa if interpolation is AREA
     // 5. color format has changed (affects graph topology)
+    // 6. mean values or scales have changed (passed to kernels as parameters)
+    // 7. letterbox rect has changed if interpolation is LETTERBOX (rect size is a kernel parameter)
     if (!_lastCall) {
         return Update::REBUILD;
     }
@@ -703,13 +795,15 @@ PreprocEngine::Update PreprocEngine::needUpdate(const CallDesc &newCallOrig) con
     BlobDesc last_in;
     BlobDesc last_out;
     ResizeAlgorithm last_algo = ResizeAlgorithm::NO_RESIZE;
-    std::tie(last_in, last_out, last_algo) = *_lastCall;
+    NormDesc last_norm;
+    std::tie(last_in, last_out, last_algo, last_norm) = *_lastCall;
 
     CallDesc newCall = newCallOrig;
     BlobDesc new_in;
     BlobDesc new_out;
     ResizeAlgorithm new_algo = ResizeAlgorithm::NO_RESIZE;
-    std::tie(new_in, new_out, new_algo) = newCall;
+    NormDesc new_norm;
+    std::tie(new_in, new_out, new_algo, new_norm) = newCall;
 
     // Declare two empty vectors per each call
     SizeVector last_in_size;
@@ -725,7 +819,7 @@ PreprocEngine::Update PreprocEngine::needUpdate(const CallDesc &newCallOrig) con
     new_out_size.swap(std::get<2>(new_out));
 
     // If anything (except input sizes) changes, rebuild is required
-    if (last_in != new_in || last_out != new_out || last_algo != new_algo) {
+    if (last_in != new_in || last_out != new_out || last_algo != new_algo || last_norm != new_norm) {
         return Update::REBUILD;
     }
 
@@ -749,7 +843,17 @@ PreprocEngine::Update PreprocEngine::needUpdate(const CallDesc &newCallOrig) con
         }
     }
 
-    // If only sizes changes (considering the above exception),
+    // If interpolation is LETTERBOX, resize output size depends on
+    // the input size
+    if (last_algo == RESIZE_LETTERBOX) {
+        const auto old_rect = letterbox_rect(last_in_size, last_out_size);
+        const auto new_rect = letterbox_rect(new_in_size, new_out_size);
+        if (old_rect.width != new_rect.width || old_rect.height != new_rect.height) {
+            return Update::REBUILD;
+        }
+    }
+
+    // If only sizes changes (considering the above exceptions),
     // reshape is enough
     if (last_in_size != new_in_size) {
         return Update::RESHAPE;
@@ -761,9 +865,13 @@ PreprocEngine::Update PreprocEngine::needUpdate(const CallDesc &newCallOrig) con
 void PreprocEngine::checkApplicabilityGAPI(const Blob::Ptr &src, const Blob::Ptr &dst) {
     // Note: src blob is the ROI blob, dst blob is the network's input blob
 
+    // regions of a batched ROI blob are cut from a single image, check the image type
+    const auto batched_rois = as<BatchedROIBlob>(src);
+    const auto &image = batched_rois ? batched_rois->getImage() : src;
+
     // src is either a memory blob, an NV12, or an I420 blob
-    const bool yuv420_blob = src->is<NV12Blob>() || src->is<I420Blob>();
-    if (!src->is<MemoryBlob>() && !yuv420_blob) {
+    const bool yuv420_blob = image->is<NV12Blob>() || image->is<I420Blob>();
+    if (!image->is<MemoryBlob>() && !yuv420_blob) {
         THROW_IE_EXCEPTION  << "Unsupported input blob type: expected MemoryBlob, NV12Blob or I420Blob";
     }
 
@@ -799,7 +907,17 @@ int PreprocEngine::getCorrectBatchSize(int batch, const Blob::Ptr& blob) {
         THROW_IE_EXCEPTION << "Input pre-processing is called with invalid batch size " << batch;
     }
 
-    if (blob->is<CompoundBlob>()) {
+    if (auto batched_rois = as<BatchedROIBlob>(blob)) {
+        // every region is a batch item
+        const int rois_num = static_cast<int>(batched_rois->size());
+        if (batch > rois_num) {
+            THROW_IE_EXCEPTION  << "Provided batch size " << batch
+                                << " is greater than number of ROIs " << rois_num;
+        }
+        if (batch < 0) {
+            batch = rois_num;
+        }
+    } else if (blob->is<CompoundBlob>()) {
         // batch size must always be 1 in compound blob case
         if (batch > 1) {
             THROW_IE_EXCEPTION  << "Provided input blob batch size " << batch
@@ -820,6 +938,7 @@ void PreprocEngine::executeGraph(Opt<cv::GComputation>& lastComputation,
     Update update) {
 
     const int thread_num =
+        _serial ? 1 :       // the engine processes a single item of a parallel batch
 #if IE_THREAD == IE_THREAD_OMP
         omp_serial ? 1 :    // disable threading for OpenMP if was asked for
 #endif
@@ -898,7 +1017,7 @@ void PreprocEngine::executeGraph(Opt<cv::GComputation>& lastComputation,
 template<typename BlobTypePtr>
 void PreprocEngine::preprocessBlob(const BlobTypePtr &inBlob, MemoryBlob::Ptr &outBlob,
     ResizeAlgorithm algorithm, ColorFormat in_fmt, ColorFormat out_fmt, bool omp_serial,
-    int batch_size) {
+    int batch_size, const NormDesc &norm) {
 
     validateBlob(inBlob);
 
@@ -940,13 +1059,28 @@ void PreprocEngine::preprocessBlob(const BlobTypePtr &inBlob, MemoryBlob::Ptr &o
                                             out_layout,
                                             out_desc_ie.getDims(),
                                             out_fmt },
-                                  algorithm };
+                                  algorithm,
+                                  norm };
 
-    if (algorithm == NO_RESIZE && std::get<0>(thisCall) == std::get<1>(thisCall)) {
+    const bool normalize = !std::get<0>(norm).empty();
+    if (normalize && out_desc_ie.getPrecision() != Precision::FP32) {
+        THROW_IE_EXCEPTION  << "Mean values and scales can be applied only to FP32 network's input, "
+                            << "got " << out_desc_ie.getPrecision();
+    }
+
+    if (algorithm == NO_RESIZE && !normalize && std::get<0>(thisCall) == std::get<1>(thisCall)) {
         //if requested output parameters match input blob no need to do anything
         THROW_IE_EXCEPTION  << "No job to do in the PreProcessing ?";
     }
 
+    // letterbox: the graph resizes into a rect of the output, the rest of the output is padding
+    const bool letterbox = algorithm == RESIZE_LETTERBOX;
+    const auto out_rect = letterbox ? letterbox_rect(in_desc.d.W, in_desc.d.H, out_desc.d.W, out_desc.d.H)
+                                    : cv::gapi::own::Rect{0, 0, out_desc.d.W, out_desc.d.H};
+    G::Desc graph_out_desc = out_desc;
+    graph_out_desc.d.W = out_rect.width;
+    graph_out_desc.d.H = out_rect.height;
+
     const Update update = needUpdate(thisCall);
 
     Opt<cv::GComputation> _lastComputation;
@@ -960,32 +1094,123 @@ void PreprocEngine::preprocessBlob(const BlobTypePtr &inBlob, MemoryBlob::Ptr &o
             auto custom_desc = getGDesc(in_desc, inBlob);
             _lastComputation = cv::util::make_optional(
                 buildGraph(custom_desc,
-                           out_desc,
+                           graph_out_desc,
                            in_layout,
                            out_layout,
                            algorithm,
                            in_fmt,
-                           out_fmt));
+                           out_fmt,
+                           std::get<0>(norm),
+                           std::get<1>(norm)));
         }
     }
 
     auto batched_input_plane_mats  = bind_to_blob(inBlob,  batch_size);
     auto batched_output_plane_mats = bind_to_blob(outBlob, batch_size);
+    if (letterbox) {
+        letterbox_output(batched_output_plane_mats, out_rect, out_desc_ie.getPrecision(),
+                         std::get<0>(norm), std::get<1>(norm));
+    }
 
     executeGraph(_lastComputation, batched_input_plane_mats, batched_output_plane_mats, batch_size,
         omp_serial, update);
 }
 
+void PreprocEngine::preprocessROIs(const BatchedROIBlob::Ptr &inBlob, MemoryBlob::Ptr &outBlob,
+        ResizeAlgorithm algorithm, ColorFormat in_fmt, bool omp_serial, int batch_size,
+        const std::vector<float> &mean, const std::vector<float> &scale) {
+    const auto& out_desc = outBlob->getTensorDesc();
+    const auto& out_dims = out_desc.getDims();
+    validateTensorDesc(out_desc);
+
+    // according to the IE's current design, input blob batch size _must_ match networks's expected
+    // batch size, even if the actual processing batch size (set on infer request) is different.
+    if (inBlob->size() != out_dims[0]) {
+        THROW_IE_EXCEPTION  << "Number of ROIs is invalid: (input blob) "
+                            << inBlob->size() << " != " << out_dims[0] << " (expected by network)";
+    }
+
+    // if batch size is unspecified, process all regions
+    if (batch_size < 0) {
+        batch_size = static_cast<int>(out_dims[0]);
+    }
+
+    // sanity check batch size
+    if (batch_size > static_cast<int>(out_dims[0])) {
+        THROW_IE_EXCEPTION  << "Provided batch size is invalid: (provided)"
+                            << batch_size << " > " << out_dims[0] << " (expected by network)";
+    }
+
+    if (algorithm == NO_RESIZE) {
+        for (const auto& roi : inBlob->getROIs()) {
+            if (roi.sizeY != out_dims[2] || roi.sizeX != out_dims[3]) {
+                THROW_IE_EXCEPTION  << "ROI size " << roi.sizeX << "x" << roi.sizeY
+                                    << " doesn't match network's input size " << out_dims[3] << "x" << out_dims[2]
+                                    << ", resize algorithm must be set";
+            }
+        }
+    }
+
+    OV_ITT_SCOPED_TASK(itt::domains::IEPreproc, _perf_exec_rois);
+
+    // every region is resized into its own batch item of the output blob, items are views
+    // on the output memory, so no intermediate copies are made
+    const TensorDesc item_desc(out_desc.getPrecision(), {1, out_dims[1], out_dims[2], out_dims[3]},
+                               out_desc.getLayout());
+    const auto item_stride = out_desc.getBlockingDesc().getStrides()[0] * out_desc.getPrecision().size();
+    auto out_mem = outBlob->wmap();
+    auto out_ptr = out_mem.as<uint8_t*>() + out_desc.getBlockingDesc().getOffsetPadding() * out_desc.getPrecision().size();
+
+    const int thread_num =
+#if IE_THREAD == IE_THREAD_OMP
+        omp_serial ? 1 :    // disable threading for OpenMP if was asked for
+#endif
+        std::min(parallel_get_max_threads(), batch_size);
+
+    // to suppress unused warnings
+    (void)(omp_serial);
+
+    // regions are processed in parallel, each one by a serial engine of the thread,
+    // as the graph of a single region is usually too small to be split into row tiles
+    if (_roiEngines.size() < static_cast<size_t>(thread_num)) {
+        _roiEngines.resize(thread_num);
+    }
+    for (auto& engine : _roiEngines) {
+        if (!engine) {
+            engine.reset(new PreprocEngine(true));
+        }
+    }
+
+    parallel_nt_static(thread_num, [&, this](int ithr, int nthr) {
+        int start = 0, end = 0;
+        splitter(batch_size, nthr, ithr, start, end);
+
+        auto& engine = _roiEngines[ithr];
+        for (int i = start; i < end; ++i) {
+            Blob::Ptr item = make_blob_with_precision(item_desc, out_ptr + i * item_stride);
+            engine->preprocessWithGAPI(inBlob->getBlob(i), item, algorithm, in_fmt, true, 1, mean, scale);
+        }
+    });
+}
+
 void PreprocEngine::preprocessWithGAPI(const Blob::Ptr &inBlob, Blob::Ptr &outBlob,
-        const ResizeAlgorithm& algorithm, ColorFormat in_fmt, bool omp_serial, int batch_size) {
+        const ResizeAlgorithm& algorithm, ColorFormat in_fmt, bool omp_serial, int batch_size,
+        const std::vector<float> &mean, const std::vector<float> &scale) {
     const auto out_fmt = (in_fmt == ColorFormat::RAW) ? ColorFormat::RAW : ColorFormat::BGR;  // FIXME: get expected color format from network
 
+    const NormDesc norm{mean, scale};
+
     // output is always a memory blob
     auto outMemoryBlob = as<MemoryBlob>(outBlob);
     if (!outMemoryBlob) {
         THROW_IE_EXCEPTION  << "Unsupported network's input blob type: expected MemoryBlob";
     }
 
+    if (auto inBatchedROIBlob = as<BatchedROIBlob>(inBlob)) {
+        return preprocessROIs(inBatchedROIBlob, outMemoryBlob, algorithm, in_fmt, omp_serial,
+            batch_size, mean, scale);
+    }
+
     // FIXME: refactor the code below. there must be a better way to handle the difference
 
     // if input color format is not NV12, a MemoryBlob is expected. otherwise, NV12Blob is expected
@@ -997,7 +1222,7 @@ void PreprocEngine::preprocessWithGAPI(const Blob::Ptr &inBlob, Blob::Ptr &outBl
                                 << ": expected NV12Blob";
         }
         return preprocessBlob(inNV12Blob, outMemoryBlob, algorithm, in_fmt, out_fmt, omp_serial,
-            batch_size);
+            batch_size, norm);
     }
     case ColorFormat::I420: {
         auto inI420Blob = as<I420Blob>(inBlob);
@@ -1006,7 +1231,7 @@ void PreprocEngine::preprocessWithGAPI(const Blob::Ptr &inBlob, Blob::Ptr &outBl
                                 << ": expected I420Blob";
         }
         return preprocessBlob(inI420Blob, outMemoryBlob, algorithm, in_fmt, out_fmt, omp_serial,
-            batch_size);
+            batch_size, norm);
     }
 
     default:
@@ -1016,7 +1241,7 @@ void PreprocEngine::preprocessWithGAPI(const Blob::Ptr &inBlob, Blob::Ptr &outBl
                                 << ": expected MemoryBlob";
         }
         return preprocessBlob(inMemoryBlob, outMemoryBlob, algorithm, in_fmt, out_fmt, omp_serial,
-            batch_size);
+            batch_size, norm);
     }
 }
 }  // namespace InferenceEngine
@@ -8,6 +8,7 @@
 #include "ie_compound_blob.h"
 #include "ie_input_info.hpp"
 
+#include <memory>
 #include <tuple>
 #include <vector>
 #include <opencv2/gapi/gcompiled.hpp>
@@ -22,16 +23,23 @@ namespace InferenceEngine {
 
 class PreprocEngine {
     using BlobDesc = std::tuple<Precision, Layout, SizeVector, ColorFormat>;
-    using CallDesc = std::tuple<BlobDesc, BlobDesc, ResizeAlgorithm>;
+    using NormDesc = std::tuple<std::vector<float>, std::vector<float>>;  // per-channel means and scales
+    using CallDesc = std::tuple<BlobDesc, BlobDesc, ResizeAlgorithm, NormDesc>;
     template<typename T> using Opt = cv::util::optional<T>;
 
     Opt<CallDesc> _lastCall;
     std::vector<cv::GCompiled> _lastComp;
 
+    // engine executes its graphs in the calling thread only
+    const bool _serial;
+    // per-thread engines to process BatchedROIBlob items in parallel
+    std::vector<std::unique_ptr<PreprocEngine>> _roiEngines;
+
     openvino::itt::handle_t _perf_graph_building = openvino::itt::handle("Preproc Graph Building");
     openvino::itt::handle_t _perf_exec_tile = openvino::itt::handle("Preproc Calc Tile");
     openvino::itt::handle_t _perf_exec_graph = openvino::itt::handle("Preproc Exec Graph");
     openvino::itt::handle_t _perf_graph_compiling = openvino::itt::handle("Preproc Graph compiling");
+    openvino::itt::handle_t _perf_exec_rois = openvino::itt::handle("Preproc Exec ROIs");
 
     enum class Update { REBUILD, RESHAPE, NOTHING };
     Update needUpdate(const CallDesc &newCall) const;
@@ -46,14 +54,26 @@ class PreprocEngine {
     template<typename BlobTypePtr>
     void preprocessBlob(const BlobTypePtr &inBlob, MemoryBlob::Ptr &outBlob,
         ResizeAlgorithm algorithm, ColorFormat in_fmt, ColorFormat out_fmt, bool omp_serial,
-        int batch_size);
+        int batch_size, const NormDesc &norm);
+
+    void preprocessROIs(const BatchedROIBlob::Ptr &inBlob, MemoryBlob::Ptr &outBlob,
+        ResizeAlgorithm algorithm, ColorFormat in_fmt, bool omp_serial, int batch_size,
+        const std::vector<float> &mean, const std::vector<float> &scale);
 
 public:
-    PreprocEngine();
+    explicit PreprocEngine(bool serial = false);
     static void checkApplicabilityGAPI(const Blob::Ptr &src, const Blob::Ptr &dst);
     static int getCorrectBatchSize(int batch_size, const Blob::Ptr& roiBlob);
+    /**
+     * @brief Resizes and color converts the input blob into the output blob
+     * @note If the input is a BatchedROIBlob, every region is resized into its own item of the output
+     *       batch, items are processed in parallel
+     * @note If `mean` is not empty, (value - mean[c]) * scale[c] is also computed for every channel in the same
+     *       pass, the output blob must be FP32 then
+     */
     void preprocessWithGAPI(const Blob::Ptr &inBlob, Blob::Ptr &outBlob, const ResizeAlgorithm &algorithm,
-        ColorFormat in_fmt, bool omp_serial, int batch_size = -1);
+        ColorFormat in_fmt, bool omp_serial, int batch_size = -1,
+        const std::vector<float> &mean = {}, const std::vector<float> &scale = {});
 };
 
 }  // namespace InferenceEngine
@@ -814,10 +814,36 @@ G_TYPED_KERNEL(ScalePlaneArea32f, <cv::GMat(cv::GMat, Size, int)>, "com.intel.ie
     }
 };
 
+// Bi-cubic resize is separable: a horizontal pass, then a vertical pass over 4 stacked rows.
+// Fluid resize kernels only see the rows the (bi)linear window covers, so the vertical
+// neighbours are gathered by a filter kernel which interleaves rows y-1, y, y+1, y+2.
+G_TYPED_KERNEL(ScalePlaneCubicH32f, <cv::GMat(cv::GMat, Size, int)>, "com.intel.ie.scale_plane_cubic_h_32f") {
+    static cv::GMatDesc outMeta(const cv::GMatDesc &in, const Size &sz, int) {
+        GAPI_DbgAssert(in.depth == CV_32F && in.chan == 1);
+        GAPI_DbgAssert(in.size.height == sz.height);
+        return in.withSize(sz);
+    }
+};
+
+G_TYPED_KERNEL(StackRows4_32f, <cv::GMat(cv::GMat)>, "com.intel.ie.stack_rows4_32f") {
+    static cv::GMatDesc outMeta(const cv::GMatDesc &in) {
+        GAPI_DbgAssert(in.depth == CV_32F && in.chan == 1);
+        return in.withType(CV_32F, 4);
+    }
+};
+
+G_TYPED_KERNEL(ScalePlaneCubicV32f, <cv::GMat(cv::GMat, Size, int)>, "com.intel.ie.scale_plane_cubic_v_32f") {
+    static cv::GMatDesc outMeta(const cv::GMatDesc &in, const Size &sz, int) {
+        GAPI_DbgAssert(in.depth == CV_32F && in.chan == 4);
+        GAPI_DbgAssert(in.size.width == sz.width);
+        return in.withType(CV_32F, 1).withSize(sz);
+    }
+};
+
 GAPI_COMPOUND_KERNEL(FScalePlane, ScalePlane) {
     static cv::GMat expand(cv::GMat in, int type, const Size& szIn, const Size& szOut, int interp) {
         GAPI_DbgAssert(CV_8UC1 == type || CV_32FC1 == type);
-        GAPI_DbgAssert(cv::INTER_AREA == interp || cv::INTER_LINEAR == interp);
+        GAPI_DbgAssert(cv::INTER_AREA == interp || cv::INTER_LINEAR == interp || cv::INTER_CUBIC == interp);
 
         if (cv::INTER_AREA == interp) {
             bool upscale = szIn.width < szOut.width || szIn.height < szOut.height;
@@ -844,6 +870,18 @@ GAPI_COMPOUND_KERNEL(FScalePlane, ScalePlane) {
             }
         }
 
+        // 8U input is converted to 32F by the caller
+        if (cv::INTER_CUBIC == interp && CV_32FC1 == type) {
+            cv::GMat out = in;
+            if (szIn.width != szOut.width || szIn.height == szOut.height) {
+                out = ScalePlaneCubicH32f::on(out, Size{szOut.width, szIn.height}, interp);
+            }
+            if (szIn.height != szOut.height) {
+                out = ScalePlaneCubicV32f::on(StackRows4_32f::on(out), szOut, interp);
+            }
+            return out;
+        }
+
         GAPI_Assert(!"unsupported parameters");
         return {};
     }
@@ -2189,6 +2227,296 @@ GAPI_FLUID_KERNEL(FScalePlaneArea8u, ScalePlaneArea8u, true) {
     }
 };
 
+//----------------------------------------------------------------------
+
+namespace cubic {
+// Coefficients of the cubic convolution with A = -0.75, the same as cv::resize uses
+static inline void coeffs(float x, float c[4]) {
+    const float A = -0.75f;
+
+    c[0] = ((A*(x + 1) - 5*A)*(x + 1) + 8*A)*(x + 1) - 4*A;
+    c[1] = ((A + 2)*x - (A + 3))*x*x + 1;
+    c[2] = ((A + 2)*(1 - x) - (A + 3))*(1 - x)*(1 - x) + 1;
+    c[3] = 1.f - c[0] - c[1] - c[2];
+}
+
+// Maps output coordinate to the first of 4 input taps. Taps falling outside [0, inSz) are
+// replicated from the border, so their weights are folded into the taps which exist. With
+// inSz >= 4 all 4 taps are inside the row, otherwise only the first inSz weights are non-zero.
+static inline int map(double ratio, int inSz, int outCoord, float w[4]) {
+    const double f = (outCoord + 0.5) * ratio - 0.5;
+    const int sx = static_cast<int>(std::floor(f));
+
+    float c[4];
+    coeffs(static_cast<float>(f - sx), c);
+
+    const int base = (std::max)(0, (std::min)(sx - 1, inSz - 4));
+    w[0] = w[1] = w[2] = w[3] = 0.f;
+    for (int k = 0; k < 4; k++) {
+        const int tap = (std::max)(0, (std::min)(sx - 1 + k, inSz - 1));
+        w[tap - base] += c[k];
+    }
+    return base;
+}
+
+struct scratchDescH {
+    int*   mapsx;
+    float* alpha;
+
+    scratchDescH(int outW, void* data) {
+        mapsx = reinterpret_cast<int*>(data);
+        alpha = reinterpret_cast<float*>(mapsx + outW);
+    }
+
+    static int bufSize(int outW) {
+        return static_cast<int>(outW * sizeof(int) + 4 * outW * sizeof(float));
+    }
+};
+
+struct scratchDescV {
+    int*   mapsy;
+    float* beta;
+
+    scratchDescV(int outH, void* data) {
+        mapsy = reinterpret_cast<int*>(data);
+        beta  = reinterpret_cast<float*>(mapsy + outH);
+    }
+
+    static int bufSize(int outH) {
+        return static_cast<int>(outH * sizeof(int) + 4 * outH * sizeof(float));
+    }
+};
+
+static void initScratchBuffer(int size, cv::gapi::fluid::Buffer& scratch) {
+    cv::GMatDesc desc;
+    desc.chan = 1;
+    desc.depth = CV_8UC1;
+    desc.size = Size{size, 1};
+
+    cv::gapi::fluid::Buffer buffer(desc);
+    scratch = std::move(buffer);
+}
+}  // namespace cubic
+
+static void cubicRowH(const float in[], float out[], const int mapsx[], const float alpha[],
+                      int inW, int length) {
+    // vectorized code reads all 4 taps, which requires at least 4 pixels in the input row
+    if (inW >= 4) {
+#ifdef HAVE_AVX512
+        if (with_cpu_x86_avx512f()) {
+            avx512::calcRowCubicH_32F(in, out, mapsx, alpha, length);
+            return;
+        }
+#endif  // HAVE_AVX512
+
+#ifdef HAVE_AVX2
+        if (with_cpu_x86_avx2()) {
+            avx::calcRowCubicH_32F(in, out, mapsx, alpha, length);
+            return;
+        }
+#endif  // HAVE_AVX2
+
+#ifdef HAVE_SSE
+        if (with_cpu_x86_sse42()) {
+            calcRowCubicH_32F(in, out, mapsx, alpha, length);
+            return;
+        }
+#endif  // HAVE_SSE
+
+#ifdef HAVE_NEON
+        neon::calcRowCubicH_32F(in, out, mapsx, alpha, length);
+        return;
+#endif  // HAVE_NEON
+    }
+
+    for (int x = 0; x < length; x++) {
+        float sum = 0.f;
+        for (int k = 0; k < 4; k++) {
+            sum += in[(std::min)(mapsx[x] + k, inW - 1)] * alpha[k*length + x];
+        }
+        out[x] = sum;
+    }
+}
+
+static void cubicRowV(const float in[], float out[], const float beta[], int length) {
+#ifdef HAVE_AVX512
+    if (with_cpu_x86_avx512f()) {
+        avx512::calcRowCubicV_32F(in, out, beta, length);
+        return;
+    }
+#endif  // HAVE_AVX512
+
+#ifdef HAVE_AVX2
+    if (with_cpu_x86_avx2()) {
+        avx::calcRowCubicV_32F(in, out, beta, length);
+        return;
+    }
+#endif  // HAVE_AVX2
+
+#ifdef HAVE_SSE
+    if (with_cpu_x86_sse42()) {
+        calcRowCubicV_32F(in, out, beta, length);
+        return;
+    }
+#endif  // HAVE_SSE
+
+#ifdef HAVE_NEON
+    neon::calcRowCubicV_32F(in, out, beta, length);
+    return;
+#endif  // HAVE_NEON
+
+    for (int x = 0; x < length; x++) {
+        out[x] = in[4*x] * beta[0] + in[4*x + 1] * beta[1] + in[4*x + 2] * beta[2] + in[4*x + 3] * beta[3];
+    }
+}
+
+static void stackRows4(const float in0[], const float in1[], const float in2[], const float in3[],
+                       float out[], int length) {
+#ifdef HAVE_AVX512
+    if (with_cpu_x86_avx512f()) {
+        avx512::stackRows4_32F(in0, in1, in2, in3, out, length);
+        return;
+    }
+#endif  // HAVE_AVX512
+
+#ifdef HAVE_AVX2
+    if (with_cpu_x86_avx2()) {
+        avx::stackRows4_32F(in0, in1, in2, in3, out, length);
+        return;
+    }
+#endif  // HAVE_AVX2
+
+#ifdef HAVE_SSE
+    if (with_cpu_x86_sse42()) {
+        stackRows4_32F(in0, in1, in2, in3, out, length);
+        return;
+    }
+#endif  // HAVE_SSE
+
+#ifdef HAVE_NEON
+    neon::stackRows4_32F(in0, in1, in2, in3, out, length);
+    return;
+#endif  // HAVE_NEON
+
+    for (int x = 0; x < length; x++) {
+        out[4*x]     = in0[x];
+        out[4*x + 1] = in1[x];
+        out[4*x + 2] = in2[x];
+        out[4*x + 3] = in3[x];
+    }
+}
+
+GAPI_FLUID_KERNEL(FScalePlaneCubicH32f, ScalePlaneCubicH32f, true) {
+    static const int Window = 1;
+    static const int LPI = 4;
+    static const auto Kind = cv::GFluidKernel::Kind::Resize;
+
+    static void initScratch(const cv::GMatDesc& in,
+                            Size outSz, int /*interp*/,
+                            cv::gapi::fluid::Buffer &scratch) {
+        GAPI_DbgAssert(in.depth == CV_32F && in.chan == 1);
+
+        cubic::initScratchBuffer(cubic::scratchDescH::bufSize(outSz.width), scratch);
+        cubic::scratchDescH scr(outSz.width, scratch.OutLineB());
+
+        const double hRatio = ratio(in.size.width, outSz.width);
+        for (int x = 0; x < outSz.width; x++) {
+            float w[4];
+            scr.mapsx[x] = cubic::map(hRatio, in.size.width, x, w);
+            for (int k = 0; k < 4; k++) {
+                scr.alpha[k*outSz.width + x] = w[k];
+            }
+        }
+    }
+
+    static void resetScratch(cv::gapi::fluid::Buffer& /*scratch*/) {
+    }
+
+    static void run(const cv::gapi::fluid::View& in, Size /*sz*/, int /*interp*/,
+                    cv::gapi::fluid::Buffer& out, cv::gapi::fluid::Buffer &scratch) {
+        const int inW = in.meta().size.width;
+        const int length = out.length();
+        GAPI_DbgAssert(length == out.meta().size.width);
+
+        cubic::scratchDescH scr(length, scratch.OutLineB());
+
+        // input and output heights are equal, so the window holds exactly the lines to produce
+        for (int l = 0; l < out.lpi(); l++) {
+            cubicRowH(in.InLine<float>(l), out.OutLine<float>(l), scr.mapsx, scr.alpha, inW, length);
+        }
+    }
+};
+
+GAPI_FLUID_KERNEL(FStackRows4_32f, StackRows4_32f, false) {
+    static const int Window = 5;
+
+    static void run(const cv::gapi::fluid::View& in, cv::gapi::fluid::Buffer& out) {
+        stackRows4(in.InLine<float>(-1), in.InLine<float>(0), in.InLine<float>(1), in.InLine<float>(2),
+                   out.OutLine<float>(), in.length());
+    }
+
+    static cv::gapi::fluid::Border getBorder(const cv::GMatDesc& /*in*/) {
+        return {cv::BORDER_REPLICATE, {}};
+    }
+};
+
+GAPI_FLUID_KERNEL(FScalePlaneCubicV32f, ScalePlaneCubicV32f, true) {
+    static const int Window = 1;
+    static const int LPI = 4;
+    static const auto Kind = cv::GFluidKernel::Kind::Resize;
+
+    static void initScratch(const cv::GMatDesc& in,
+                            Size outSz, int /*interp*/,
+                            cv::gapi::fluid::Buffer &scratch) {
+        GAPI_DbgAssert(in.depth == CV_32F && in.chan == 4);
+
+        cubic::initScratchBuffer(cubic::scratchDescV::bufSize(outSz.height), scratch);
+        cubic::scratchDescV scr(outSz.height, scratch.OutLineB());
+
+        const int inH = in.size.height;
+        const double vRatio = ratio(inH, outSz.height);
+        for (int y = 0; y < outSz.height; y++) {
+            const double f = (y + 0.5) * vRatio - 0.5;
+            const int sy = static_cast<int>(std::floor(f));
+
+            float c[4];
+            cubic::coeffs(static_cast<float>(f - sy), c);
+
+            // Stacked row r holds input rows r-1..r+2 (replicated at borders). Pick the row
+            // centered at sy, but not before the first line of the fluid resize window.
+            const int windowStart = vRatio >= 1.0 ? static_cast<int>(y * vRatio + 1e-3)
+                                                  : (std::max)(0, static_cast<int>(f));
+            const int r = (std::max)(windowStart, (std::max)(0, (std::min)(sy, inH - 1)));
+            scr.mapsy[y] = r;
+
+            float *beta = &scr.beta[4*y];
+            beta[0] = beta[1] = beta[2] = beta[3] = 0.f;
+            for (int k = 0; k < 4; k++) {
+                // the only tap which may fall out of the stacked row has a negligible weight
+                const int tap = (std::max)(0, (std::min)(sy - 1 + k, inH - 1));
+                beta[(std::max)(0, (std::min)(tap - r + 1, 3))] += c[k];
+            }
+        }
+    }
+
+    static void resetScratch(cv::gapi::fluid::Buffer& /*scratch*/) {
+    }
+
+    static void run(const cv::gapi::fluid::View& in, Size /*sz*/, int /*interp*/,
+                    cv::gapi::fluid::Buffer& out, cv::gapi::fluid::Buffer &scratch) {
+        const int outY = out.y();
+        const int inY = in.y();
+        const int length = out.length();
+
+        cubic::scratchDescV scr(out.meta().size.height, scratch.OutLineB());
+
+        for (int l = 0; l < out.lpi(); l++) {
+            const int y = outY + l;
+            cubicRowV(in.InLine<float>(scr.mapsy[y] - inY), out.OutLine<float>(l), &scr.beta[4*y], length);
+        }
+    }
+};
+
 static const int ITUR_BT_601_CY = 1220542;
 static const int ITUR_BT_601_CUB = 2116026;
 static const int ITUR_BT_601_CUG = -409993;
@@ -2416,6 +2744,89 @@ GAPI_FLUID_KERNEL(FConvertDepth, ConvertDepth, false) {
     }
 };
 
+template<typename T>
+static void normalizeRow(const T* in, float* out, float mean, float scale, int length) {
+#ifdef HAVE_AVX512
+    if (with_cpu_x86_avx512f()) {
+        if (std::is_same<T, uint8_t>::value) {
+            avx512::normalizeRow_8U32F(reinterpret_cast<const uint8_t*>(in), out, mean, scale, length);
+            return;
+        }
+
+        if (std::is_same<T, float>::value) {
+            avx512::normalizeRow_32F(reinterpret_cast<const float*>(in), out, mean, scale, length);
+            return;
+        }
+    }
+#endif  // HAVE_AVX512
+
+#ifdef HAVE_AVX2
+    if (with_cpu_x86_avx2()) {
+        if (std::is_same<T, uint8_t>::value) {
+            avx::normalizeRow_8U32F(reinterpret_cast<const uint8_t*>(in), out, mean, scale, length);
+            return;
+        }
+
+        if (std::is_same<T, float>::value) {
+            avx::normalizeRow_32F(reinterpret_cast<const float*>(in), out, mean, scale, length);
+            return;
+        }
+    }
+#endif  // HAVE_AVX2
+
+#ifdef HAVE_SSE
+    if (with_cpu_x86_sse42()) {
+        if (std::is_same<T, uint8_t>::value) {
+            normalizeRow_8U32F(reinterpret_cast<const uint8_t*>(in), out, mean, scale, length);
+            return;
+        }
+
+        if (std::is_same<T, float>::value) {
+            normalizeRow_32F(reinterpret_cast<const float*>(in), out, mean, scale, length);
+            return;
+        }
+    }
+#endif  // HAVE_SSE
+
+#ifdef HAVE_NEON
+    if (std::is_same<T, uint8_t>::value) {
+        neon::normalizeRow_8U32F(reinterpret_cast<const uint8_t*>(in), out, mean, scale, length);
+        return;
+    }
+
+    if (std::is_same<T, float>::value) {
+        neon::normalizeRow_32F(reinterpret_cast<const float*>(in), out, mean, scale, length);
+        return;
+    }
+#endif  // HAVE_NEON
+
+    for (int i = 0; i < length; i++) {
+        out[i] = (static_cast<float>(in[i]) - mean) * scale;
+    }
+}
+
+GAPI_FLUID_KERNEL(FNormalizePlane, NormalizePlane, false) {
+    static const int Window = 1;
+
+    static void run(const cv::gapi::fluid::View& src, float mean, float scale, int /*depth*/,
+                    cv::gapi::fluid::Buffer& dst) {
+        GAPI_Assert(src.meta().chan == 1);
+        GAPI_Assert(dst.meta().chan == 1);
+        GAPI_Assert(dst.meta().depth == CV_32F);
+        GAPI_Assert(src.length() == dst.length());
+
+        auto *out = dst.OutLine<float>();
+        const auto length = dst.length();
+
+        switch (src.meta().depth) {
+            case CV_8U:  normalizeRow(src.InLine<uint8_t>(0),  out, mean, scale, length); break;
+            case CV_16U: normalizeRow(src.InLine<uint16_t>(0), out, mean, scale, length); break;
+            case CV_32F: normalizeRow(src.InLine<float>(0),    out, mean, scale, length); break;
+            default: GAPI_Assert(!"not supported depth");
+        }
+    }
+};
+
 }  // namespace kernels
 
 //----------------------------------------------------------------------
@@ -2434,6 +2845,9 @@ cv::gapi::GKernelPackage preprocKernels() {
         , FUpscalePlaneArea32f
         , FScalePlaneArea8u
         , FScalePlaneArea32f
+        , FScalePlaneCubicH32f
+        , FStackRows4_32f
+        , FScalePlaneCubicV32f
         , FMerge2
         , FMerge3
         , FMerge4
@@ -2443,6 +2857,7 @@ cv::gapi::GKernelPackage preprocKernels() {
         , FNV12toRGB
         , FI420toRGB
         , FConvertDepth
+        , FNormalizePlane
         >();
 }
 
@@ -152,6 +152,16 @@ namespace gapi {
         }
     };
 
+    // Computes (in - mean) * scale, performing the precision conversion in the same pass
+    G_TYPED_KERNEL(NormalizePlane, <cv::GMat(cv::GMat, float, float, int)>, "com.intel.ie.normalize_plane") {
+        static cv::GMatDesc outMeta(const cv::GMatDesc& in, float, float, int depth) {
+            GAPI_Assert(in.depth == CV_8U || in.depth == CV_16U || in.depth == CV_32F);
+            GAPI_Assert(in.chan == 1);
+            GAPI_Assert(depth == CV_32F);
+
+            return in.withDepth(depth);
+        }
+    };
 
 
     cv::gapi::GKernelPackage preprocKernels();
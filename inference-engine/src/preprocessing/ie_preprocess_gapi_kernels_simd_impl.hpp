@@ -787,6 +787,152 @@ inline void copyRow_32F_impl(const float in[], float out[], int length) {
     }
 }
 
+// Normalization: out = (in - mean) * scale
+inline void normalizeRow_8U32F_impl(const uint8_t in[], float out[], float mean, float scale, int length) {
+    int l = 0;
+
+#if MANUAL_SIMD
+    const int nlanes = v_float32::nlanes;
+    const v_float32 vmean = vx_setall_f32(mean);
+    const v_float32 vscale = vx_setall_f32(scale);
+
+    cycle:
+    for (; l <= length - nlanes; l += nlanes) {
+        v_float32 r = v_cvt_f32(v_reinterpret_as_s32(vx_load_expand_q(&in[l])));
+        vx_store(&out[l], (r - vmean) * vscale);
+    }
+
+    if (l < length && length >= nlanes) {
+        l = length - nlanes;
+        goto cycle;
+    }
+#endif
+
+    for (; l < length; l++) {
+        out[l] = (static_cast<float>(in[l]) - mean) * scale;
+    }
+}
+
+inline void normalizeRow_32F_impl(const float in[], float out[], float mean, float scale, int length) {
+    int l = 0;
+
+#if MANUAL_SIMD
+    const int nlanes = v_float32::nlanes;
+    const v_float32 vmean = vx_setall_f32(mean);
+    const v_float32 vscale = vx_setall_f32(scale);
+
+    // in-place processing isn't expected, so the tail may be safely recalculated
+    cycle:
+    for (; l <= length - nlanes; l += nlanes) {
+        vx_store(&out[l], (vx_load(&in[l]) - vmean) * vscale);
+    }
+
+    if (l < length && length >= nlanes) {
+        l = length - nlanes;
+        goto cycle;
+    }
+#endif
+
+    for (; l < length; l++) {
+        out[l] = (in[l] - mean) * scale;
+    }
+}
+
+// Resize (bi-cubic, 32FC1), horizontal pass: taps in[mapsx[x] + k] are weighted with alpha[k*length + x]
+inline void calcRowCubicH_32F_impl(const float in[], float out[], const int mapsx[], const float alpha[],
+                                   int length) {
+    const float *alpha0 = alpha;
+    const float *alpha1 = alpha + length;
+    const float *alpha2 = alpha + 2 * length;
+    const float *alpha3 = alpha + 3 * length;
+
+    int x = 0;
+
+#if MANUAL_SIMD
+    const int nlanes = v_float32::nlanes;
+
+    cycle:
+    for (; x <= length - nlanes; x += nlanes) {
+        v_int32 idx = vx_load(&mapsx[x]);
+        v_float32 r = v_lut(in, idx) * vx_load(&alpha0[x]);
+        r = v_fma(v_lut(in + 1, idx), vx_load(&alpha1[x]), r);
+        r = v_fma(v_lut(in + 2, idx), vx_load(&alpha2[x]), r);
+        r = v_fma(v_lut(in + 3, idx), vx_load(&alpha3[x]), r);
+        vx_store(&out[x], r);
+    }
+
+    if (x < length && length >= nlanes) {
+        x = length - nlanes;
+        goto cycle;
+    }
+#endif
+
+    for (; x < length; x++) {
+        const float *src = &in[mapsx[x]];
+        out[x] = src[0] * alpha0[x] + src[1] * alpha1[x] + src[2] * alpha2[x] + src[3] * alpha3[x];
+    }
+}
+
+// Resize (bi-cubic, 32FC1), vertical pass: taps are interleaved in[4*x + k] and weighted with beta[k]
+inline void calcRowCubicV_32F_impl(const float in[], float out[], const float beta[], int length) {
+    int x = 0;
+
+#if MANUAL_SIMD
+    const int nlanes = v_float32::nlanes;
+    const v_float32 beta0 = vx_setall_f32(beta[0]);
+    const v_float32 beta1 = vx_setall_f32(beta[1]);
+    const v_float32 beta2 = vx_setall_f32(beta[2]);
+    const v_float32 beta3 = vx_setall_f32(beta[3]);
+
+    cycle:
+    for (; x <= length - nlanes; x += nlanes) {
+        v_float32 s0, s1, s2, s3;
+        v_load_deinterleave(&in[4*x], s0, s1, s2, s3);
+        v_float32 r = s0 * beta0;
+        r = v_fma(s1, beta1, r);
+        r = v_fma(s2, beta2, r);
+        r = v_fma(s3, beta3, r);
+        vx_store(&out[x], r);
+    }
+
+    if (x < length && length >= nlanes) {
+        x = length - nlanes;
+        goto cycle;
+    }
+#endif
+
+    for (; x < length; x++) {
+        out[x] = in[4*x] * beta[0] + in[4*x + 1] * beta[1] + in[4*x + 2] * beta[2] + in[4*x + 3] * beta[3];
+    }
+}
+
+// Interleaves 4 adjacent rows for the vertical pass of bi-cubic resize
+inline void stackRows4_32F_impl(const float in0[], const float in1[], const float in2[], const float in3[],
+                                float out[], int length) {
+    int x = 0;
+
+#if MANUAL_SIMD
+    const int nlanes = v_float32::nlanes;
+
+    cycle:
+    for (; x <= length - nlanes; x += nlanes) {
+        v_store_interleave(&out[4*x], vx_load(&in0[x]), vx_load(&in1[x]), vx_load(&in2[x]), vx_load(&in3[x]));
+    }
+
+    if (x < length && length >= nlanes) {
+        x = length - nlanes;
+        goto cycle;
+    }
+#endif
+
+    for (; x < length; x++) {
+        out[4*x]     = in0[x];
+        out[4*x + 1] = in1[x];
+        out[4*x + 2] = in2[x];
+        out[4*x + 3] = in3[x];
+    }
+}
+
 // Resize (bi-linear, 32FC1)
 static inline void calcRowLinear_32FC1(float *dst[],
                                        const float *src0[],
@@ -4,6 +4,7 @@
 
 #include <gtest/gtest.h>
 
+#include <algorithm>
 #include <random>
 #include <chrono>
 
@@ -288,7 +289,7 @@ std::vector<BatchNum> BlobCopy_BatchNum = {
 };
 
 std::vector<ChannelNum > BlobCopy_ChannelNum = {
-        3, 7,
+        1, 3, 7, 16,
 };
 
 std::vector<Dims> BlobCopy_Dims = {
@@ -322,6 +323,50 @@ INSTANTIATE_TEST_CASE_P(accuracy, BlobCopyTest,
                            ::testing::ValuesIn(BlobCopy_Dims),
                            ::testing::ValuesIn(BlobCopy_PrecisionParams)));
 
+// Benchmark behind the layout conversion timings of blob_copy, disabled by default.
+// Reports the best of several runs, pin the process to a single core (e.g. taskset -c 0)
+// to get single-thread numbers.
+using BlobCopyPerfTest = ::testing::TestWithParam <std::tuple<IsInterleaved, ChannelNum, PrecisionType >>;
+
+TEST_P(BlobCopyPerfTest, DISABLED_BlobCopy) {
+    IsInterleaved srcIsInterleaved = get<0>(GetParam());
+    ChannelNum channelNum = get<1>(GetParam());
+    PrecisionType precisionType = get<2>(GetParam());
+
+    Dims dims = {480, 641};
+    SizeVector blobDims = SetDimVector(1, channelNum, dims);
+
+    Blob::Ptr srcBlob = createBlob(precisionType, blobDims, setLayout(srcIsInterleaved, dims.size()));
+    Blob::Ptr dstBlob = createBlob(precisionType, blobDims, setLayout(!srcIsInterleaved, dims.size()));
+
+    srcBlob->allocate();
+    dstBlob->allocate();
+
+    FillBlob(srcBlob);
+
+    const int iterations = 50;
+    blob_copy(srcBlob, dstBlob);
+    auto best = std::chrono::microseconds::max();
+    for (int i = 0; i < iterations; ++i) {
+        auto start = std::chrono::high_resolution_clock::now();
+        blob_copy(srcBlob, dstBlob);
+        auto finish = std::chrono::high_resolution_clock::now();
+        best = std::min(best, std::chrono::duration_cast<std::chrono::microseconds>(finish - start));
+    }
+
+    PrintParams(srcBlob->getTensorDesc().getLayout(), blobDims, "src", precisionType);
+    std::cout << "Blob_copy best execution time of " << iterations << " runs : " << best.count() << " micros" << std::endl;
+
+    ASSERT_TRUE(IsCorrectBlobCopy(srcBlob, dstBlob)) << "'blob_copy' function is not correct";
+}
+
+INSTANTIATE_TEST_CASE_P(performance, BlobCopyPerfTest,
+                        ::testing::Combine(::testing::Values(true, false),
+                           ::testing::Values(1, 2, 3, 4, 7, 16),
+                           ::testing::Values(InferenceEngine::Precision::FP32,
+                                             InferenceEngine::Precision::FP16,
+                                             InferenceEngine::Precision::U8)));
+
 namespace {
 
 template <typename T>
@@ -337,6 +337,37 @@ TEST_P(CachingTest, TestLoad) {
     }
 }
 
+TEST_P(CachingTest, TestCacheStatistics) {
+    EXPECT_CALL(*mockPlugin, GetMetric(METRIC_KEY(SUPPORTED_METRICS), _)).Times(AnyNumber());
+    EXPECT_CALL(*mockPlugin, GetMetric(METRIC_KEY(IMPORT_EXPORT_SUPPORT), _)).Times(AnyNumber());
+    EXPECT_CALL(*mockPlugin, GetMetric(METRIC_KEY(DEVICE_ARCHITECTURE), _)).Times(AnyNumber());
+    EXPECT_CALL(*mockPlugin, LoadExeNetworkImpl(_, _, _)).Times(AnyNumber());
+    EXPECT_CALL(*mockPlugin, LoadExeNetworkImpl(_, _)).Times(AnyNumber());
+    EXPECT_CALL(*mockPlugin, ImportNetworkImpl(_, _, _)).Times(AnyNumber());
+    EXPECT_CALL(*mockPlugin, ImportNetworkImpl(_, _)).Times(AnyNumber());
+    EXPECT_CALL(*net, ExportImpl(_)).Times(AnyNumber());
+    using Statistics = std::map<std::string, uint64_t>;
+    testLoad([&](Core &ie) {
+        EXPECT_TRUE(ie.GetMetric({}, METRIC_KEY(CACHE_STATISTICS)).as<Statistics>().empty());
+        ie.SetConfig({{CONFIG_KEY(CACHE_DIR), m_cacheDir}});
+        m_testFunction(ie);
+        auto stats = ie.GetMetric({}, METRIC_KEY(CACHE_STATISTICS)).as<Statistics>();
+        EXPECT_EQ(1u, stats["MISSES"]);
+        EXPECT_EQ(1u, stats["WRITES"]);
+        EXPECT_EQ(0u, stats["HITS"]);
+        EXPECT_LT(0u, stats["SIZE"]);
+    });
+
+    testLoad([&](Core &ie) {
+        ie.SetConfig({{CONFIG_KEY(CACHE_DIR), m_cacheDir}});
+        m_testFunction(ie);
+        auto stats = ie.GetMetric(deviceName, METRIC_KEY(CACHE_STATISTICS)).as<Statistics>();
+        EXPECT_EQ(0u, stats["MISSES"]);
+        EXPECT_EQ(0u, stats["WRITES"]);
+        EXPECT_EQ(1u, stats["HITS"]);
+    });
+}
+
 TEST_P(CachingTest, TestLoadCustomImportExport) {
     const int customNumber = 1234;
     EXPECT_CALL(*mockPlugin, GetMetric(METRIC_KEY(SUPPORTED_METRICS), _)).Times(AnyNumber());
@@ -0,0 +1,144 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "layer_transformation.hpp"
+
+#include <memory>
+#include <string>
+#include <gtest/gtest.h>
+
+#include <ngraph/opsets/opset5.hpp>
+#include <ngraph/variant.hpp>
+#include <low_precision/recurrent_cell.hpp>
+
+#include "simple_low_precision_transformer.hpp"
+#include "lpt_ngraph_functions/common/builders.hpp"
+#include "lpt_ngraph_functions/common/dequantization_operations.hpp"
+#include "lpt_ngraph_functions/common/fake_quantize_on_weights.hpp"
+
+using namespace testing;
+using namespace ngraph::pass;
+using namespace ngraph::builder::subgraph;
+
+namespace {
+
+std::shared_ptr<ngraph::Function> getLSTMSequence(const DequantizationOperations& dequantization) {
+    const size_t batch = 1ul, seqLength = 4ul, inputSize = 16ul, hiddenSize = 32ul;
+    const auto input = std::make_shared<ngraph::opset1::Parameter>(ngraph::element::u8, ngraph::Shape{ batch, seqLength, inputSize });
+    const auto data = makeDequantization(input, dequantization);
+
+    const auto initialHidden = ngraph::opset1::Constant::create(ngraph::element::f32, ngraph::Shape{ batch, 1ul, hiddenSize }, { 0.f });
+    const auto initialCell = ngraph::opset1::Constant::create(ngraph::element::f32, ngraph::Shape{ batch, 1ul, hiddenSize }, { 0.f });
+    const auto sequenceLengths = ngraph::opset1::Constant::create(ngraph::element::i32, ngraph::Shape{ batch }, { seqLength });
+
+    const FakeQuantizeOnWeights fqOnWeights{ 255ul, {}, {-1.27f}, {1.27f}, {-1.27f}, {1.27f} };
+    const auto weights = makeFakeQuantize(
+        ngraph::opset1::Constant::create(ngraph::element::f32, ngraph::Shape{ 1ul, 4ul * hiddenSize, inputSize }, { 0.5f }),
+        ngraph::element::f32,
+        fqOnWeights);
+    const auto recurrentWeights = makeFakeQuantize(
+        ngraph::opset1::Constant::create(ngraph::element::f32, ngraph::Shape{ 1ul, 4ul * hiddenSize, hiddenSize }, { -0.25f }),
+        ngraph::element::f32,
+        fqOnWeights);
+    const auto bias = ngraph::opset1::Constant::create(ngraph::element::f32, ngraph::Shape{ 1ul, 4ul * hiddenSize }, { 0.1f });
+
+    const auto sequence = std::make_shared<ngraph::opset5::LSTMSequence>(
+        data, initialHidden, initialCell, sequenceLengths, weights, recurrentWeights, bias,
+        hiddenSize, ngraph::op::RecurrentSequenceDirection::FORWARD);
+    sequence->set_friendly_name("sequence");
+
+    return std::make_shared<ngraph::Function>(sequence->outputs(), ngraph::ParameterVector{ input });
+}
+
+std::shared_ptr<ngraph::Function> getGRUSequence(const DequantizationOperations& dequantization) {
+    const size_t batch = 1ul, seqLength = 4ul, inputSize = 16ul, hiddenSize = 32ul;
+    const auto input = std::make_shared<ngraph::opset1::Parameter>(ngraph::element::u8, ngraph::Shape{ batch, seqLength, inputSize });
+    const auto data = makeDequantization(input, dequantization);
+
+    const auto initialHidden = ngraph::opset1::Constant::create(ngraph::element::f32, ngraph::Shape{ batch, 1ul, hiddenSize }, { 0.f });
+    const auto sequenceLengths = ngraph::opset1::Constant::create(ngraph::element::i32, ngraph::Shape{ batch }, { seqLength });
+    const auto weights = ngraph::opset1::Constant::create(ngraph::element::f32, ngraph::Shape{ 1ul, 3ul * hiddenSize, inputSize }, { 0.5f });
+    const auto recurrentWeights = ngraph::opset1::Constant::create(ngraph::element::f32, ngraph::Shape{ 1ul, 3ul * hiddenSize, hiddenSize }, { -0.25f });
+    const auto bias = ngraph::opset1::Constant::create(ngraph::element::f32, ngraph::Shape{ 1ul, 3ul * hiddenSize }, { 0.1f });
+
+    const auto sequence = std::make_shared<ngraph::opset5::GRUSequence>(
+        data, initialHidden, sequenceLengths, weights, recurrentWeights, bias,
+        hiddenSize, ngraph::op::RecurrentSequenceDirection::FORWARD);
+    sequence->set_friendly_name("sequence");
+
+    return std::make_shared<ngraph::Function>(sequence->outputs(), ngraph::ParameterVector{ input });
+}
+
+std::shared_ptr<ngraph::Node> getSequence(const std::shared_ptr<ngraph::Function>& function) {
+    for (const auto& op : function->get_ops()) {
+        if (ngraph::is_type<ngraph::opset5::LSTMSequence>(op) || ngraph::is_type<ngraph::opset5::GRUSequence>(op)) {
+            return op;
+        }
+    }
+    return nullptr;
+}
+
+std::string getRtInfoValue(const std::shared_ptr<ngraph::Node>& node, const std::string& name) {
+    const auto& rtInfo = node->get_rt_info();
+    const auto it = rtInfo.find(name);
+    if (it == rtInfo.end()) {
+        return "";
+    }
+    return ngraph::as_type_ptr<ngraph::VariantWrapper<std::string>>(it->second)->get();
+}
+
+}  // namespace
+
+TEST(LPT, RecurrentCellTransformationU8) {
+    auto function = getLSTMSequence(DequantizationOperations{ ngraph::element::f32, {128.f}, {0.02f} });
+
+    SimpleLowPrecisionTransformer transformer;
+    transformer.add<low_precision::RecurrentCellTransformation, ngraph::opset5::LSTMSequence>(LayerTransformation::createParamsU8I8());
+    transformer.transform(function);
+
+    const auto sequence = getSequence(function);
+    ASSERT_NE(nullptr, sequence);
+    ASSERT_TRUE(ngraph::is_type<ngraph::opset1::Parameter>(sequence->get_input_node_shared_ptr(0)));
+    ASSERT_EQ(ngraph::element::u8, sequence->get_input_element_type(0));
+    ASSERT_TRUE(ngraph::is_type<ngraph::opset1::Constant>(sequence->get_input_node_shared_ptr(4)));
+    ASSERT_TRUE(ngraph::is_type<ngraph::opset1::Constant>(sequence->get_input_node_shared_ptr(5)));
+    for (size_t i = 0; i < sequence->get_output_size(); ++i) {
+        ASSERT_EQ(ngraph::element::f32, sequence->get_output_element_type(i));
+    }
+
+    ASSERT_EQ(50.f, std::stof(getRtInfoValue(sequence, low_precision::RecurrentCellTransformation::dataScaleAttribute)));
+    ASSERT_EQ(128.f, std::stof(getRtInfoValue(sequence, low_precision::RecurrentCellTransformation::dataShiftAttribute)));
+}
+
+TEST(LPT, RecurrentCellTransformationNarrowIntervalU8) {
+    // quantization interval doesn't cover hidden state values: only weights are folded
+    auto function = getLSTMSequence(DequantizationOperations{ ngraph::element::f32, {128.f}, {0.001f} });
+
+    SimpleLowPrecisionTransformer transformer;
+    transformer.add<low_precision::RecurrentCellTransformation, ngraph::opset5::LSTMSequence>(LayerTransformation::createParamsU8I8());
+    transformer.transform(function);
+
+    const auto sequence = getSequence(function);
+    ASSERT_NE(nullptr, sequence);
+    ASSERT_TRUE(ngraph::is_type<ngraph::opset1::Multiply>(sequence->get_input_node_shared_ptr(0)));
+    ASSERT_EQ(ngraph::element::f32, sequence->get_input_element_type(0));
+    ASSERT_TRUE(ngraph::is_type<ngraph::opset1::Constant>(sequence->get_input_node_shared_ptr(4)));
+    ASSERT_TRUE(ngraph::is_type<ngraph::opset1::Constant>(sequence->get_input_node_shared_ptr(5)));
+    ASSERT_TRUE(getRtInfoValue(sequence, low_precision::RecurrentCellTransformation::dataScaleAttribute).empty());
+}
+
+TEST(LPT, RecurrentCellTransformationGRUIsNotTransformed) {
+    // plugins don't execute GRU sequences in low precision, so dequantization stays before the operation
+    auto function = getGRUSequence(DequantizationOperations{ ngraph::element::f32, {128.f}, {0.02f} });
+
+    SimpleLowPrecisionTransformer transformer;
+    transformer.add<low_precision::RecurrentCellTransformation, ngraph::opset5::LSTMSequence>(LayerTransformation::createParamsU8I8());
+    transformer.transform(function);
+
+    const auto sequence = getSequence(function);
+    ASSERT_NE(nullptr, sequence);
+    ASSERT_TRUE(ngraph::is_type<ngraph::opset1::Multiply>(sequence->get_input_node_shared_ptr(0)));
+    ASSERT_EQ(ngraph::element::f32, sequence->get_input_element_type(0));
+    ASSERT_TRUE(getRtInfoValue(sequence, low_precision::RecurrentCellTransformation::dataScaleAttribute).empty());
+}
@@ -0,0 +1,241 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstring>
+#include <functional>
+#include <iostream>
+#include <limits>
+#include <random>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include <precision_utils.h>
+
+using namespace ::testing;
+using namespace InferenceEngine;
+
+namespace {
+
+enum class Conversion {
+    F16toF32,
+    F32toF16,
+    BF16toF32,
+    F32toBF16,
+};
+
+using ArraySize = size_t;
+using ScaleBias = std::pair<float, float>;
+
+std::ostream& operator<<(std::ostream& os, Conversion conversion) {
+    switch (conversion) {
+        case Conversion::F16toF32: return os << "F16toF32";
+        case Conversion::F32toF16: return os << "F32toF16";
+        case Conversion::BF16toF32: return os << "BF16toF32";
+        case Conversion::F32toBF16: return os << "F32toBF16";
+    }
+    return os;
+}
+
+uint32_t asUint(float f) {
+    uint32_t u;
+    std::memcpy(&u, &f, sizeof(u));
+    return u;
+}
+
+float asFloat(uint32_t u) {
+    float f;
+    std::memcpy(&f, &u, sizeof(f));
+    return f;
+}
+
+// Random bit patterns covering all exponents, specials and values around the FP16 range
+std::vector<float> GenerateFloats(size_t size) {
+    std::mt19937 gen(0);
+    std::vector<float> values(size);
+    for (size_t i = 0; i < size; i++) {
+        const uint32_t sign = gen() & 0x80000000u;
+        values[i] = i % 2 ? asFloat(gen()) : asFloat(sign | (0x30000000u + gen() % 0x18000000u));
+    }
+    const std::vector<float> special = {0.f, -0.f, std::numeric_limits<float>::infinity(),
+                                        -std::numeric_limits<float>::infinity(), std::numeric_limits<float>::quiet_NaN(),
+                                        65504.f, 65520.f, 6.1e-5f, 3e-5f, 1e-40f};
+    std::copy_n(special.begin(), std::min(special.size(), size), values.begin());
+    return values;
+}
+
+std::vector<ie_fp16> GenerateHalfs(size_t size) {
+    std::vector<ie_fp16> values(size);
+    for (size_t i = 0; i < size; i++) {
+        values[i] = static_cast<ie_fp16>(i * 7919);
+    }
+    return values;
+}
+
+std::vector<ie_bf16> GenerateBFloats(size_t size) {
+    std::vector<ie_bf16> values(size);
+    for (size_t i = 0; i < size; i++) {
+        values[i] = ie_bf16{static_cast<uint16_t>(i * 7919)};
+    }
+    return values;
+}
+
+// Checks that array conversion result is equal to the scalar one. With unit scale and zero bias results
+// must be bit-exact, otherwise vectorized code applies scale and bias with a fused multiply-add, so the result
+// may differ by the rounding of x * scale and, for half-precision destination, by one unit in the last place.
+void ExpectNear(float ref, float value, float x, const ScaleBias& scaleBias, float ulp, float minNormal, size_t i) {
+    if (scaleBias.first == 1.f && scaleBias.second == 0.f) {
+        ASSERT_EQ(asUint(ref), asUint(value)) << "element " << i;
+        return;
+    }
+    if (std::isnan(ref) || std::isinf(ref)) {
+        ASSERT_EQ(std::isnan(ref), std::isnan(value)) << "element " << i;
+        ASSERT_TRUE(std::isnan(ref) || ref == value) << "element " << i << ": " << ref << " vs " << value;
+        return;
+    }
+    const float productError = std::ldexp(std::fabs(x * scaleBias.first) + std::fabs(scaleBias.second), -22);
+    const float tolerance = ulp * std::fabs(ref) + productError + minNormal;
+    ASSERT_LE(std::fabs(ref - value), tolerance) << "element " << i << ": " << ref << " vs " << value;
+}
+
+}  // namespace
+
+using PrecisionUtilsArraysTest = ::testing::TestWithParam<std::tuple<Conversion, ArraySize, ScaleBias>>;
+
+// Compares vectorized and multithreaded array conversion with the scalar one
+TEST_P(PrecisionUtilsArraysTest, ConversionIsEqualToScalar) {
+    Conversion conversion = get<0>(GetParam());
+    ArraySize size = get<1>(GetParam());
+    ScaleBias scaleBias = get<2>(GetParam());
+    const float scale = scaleBias.first, bias = scaleBias.second;
+
+    const auto floats = GenerateFloats(size);
+    const auto halfs = GenerateHalfs(size);
+    const auto bfloats = GenerateBFloats(size);
+    std::vector<float> floatsDst(size);
+    std::vector<ie_fp16> halfsDst(size);
+    std::vector<ie_bf16> bfloatsDst(size);
+
+    // scalar references apply zero bias as well, so that zeros have the same sign
+    switch (conversion) {
+        case Conversion::F16toF32:
+            PrecisionUtils::f16tof32Arrays(floatsDst.data(), halfs.data(), size, scale, bias);
+            for (size_t i = 0; i < size; i++) {
+                const float x = PrecisionUtils::f16tof32(halfs[i]);
+                ExpectNear(x * scale + bias, floatsDst[i], x, scaleBias, std::ldexp(1.f, -23), 0.f, i);
+            }
+            break;
+        case Conversion::F32toF16:
+            PrecisionUtils::f32tof16Arrays(halfsDst.data(), floats.data(), size, scale, bias);
+            for (size_t i = 0; i < size; i++) {
+                const float ref = PrecisionUtils::f16tof32(PrecisionUtils::f32tof16(floats[i] * scale + bias));
+                ExpectNear(ref, PrecisionUtils::f16tof32(halfsDst[i]), floats[i], scaleBias,
+                           std::ldexp(1.f, -10), std::ldexp(1.f, -14), i);
+            }
+            break;
+        case Conversion::BF16toF32:
+            PrecisionUtils::bf16tof32Arrays(floatsDst.data(), bfloats.data(), size, scale, bias);
+            for (size_t i = 0; i < size; i++) {
+                const float x = PrecisionUtils::bf16tof32(bfloats[i]);
+                ExpectNear(x * scale + bias, floatsDst[i], x, scaleBias, std::ldexp(1.f, -23), 0.f, i);
+            }
+            break;
+        case Conversion::F32toBF16:
+            PrecisionUtils::f32tobf16Arrays(bfloatsDst.data(), floats.data(), size, scale, bias);
+            for (size_t i = 0; i < size; i++) {
+                const float ref = PrecisionUtils::bf16tof32(PrecisionUtils::f32tobf16(floats[i] * scale + bias));
+                ExpectNear(ref, PrecisionUtils::bf16tof32(bfloatsDst[i]), floats[i], scaleBias,
+                           std::ldexp(1.f, -7), 0.f, i);
+            }
+            break;
+    }
+}
+
+namespace {
+
+std::vector<Conversion> PrecisionUtils_Conversions = {
+        Conversion::F16toF32,
+        Conversion::F32toF16,
+        Conversion::BF16toF32,
+        Conversion::F32toBF16,
+};
+
+// sizes with tails for all vector widths and sizes large enough to be converted in parallel
+std::vector<ArraySize> PrecisionUtils_Sizes = {
+        1, 15, 37, 65536 + 7, 4 * 1024 * 1024 + 3,
+};
+
+std::vector<ScaleBias> PrecisionUtils_ScaleBias = {
+        {1.f, 0.f},
+        {1.5f, -0.25f},
+        {-0.01f, 3.f},
+};
+
+}  // namespace
+
+INSTANTIATE_TEST_CASE_P(accuracy, PrecisionUtilsArraysTest,
+                        ::testing::Combine(::testing::ValuesIn(PrecisionUtils_Conversions),
+                                           ::testing::ValuesIn(PrecisionUtils_Sizes),
+                                           ::testing::ValuesIn(PrecisionUtils_ScaleBias)));
+
+using PrecisionUtilsArraysPerfTest = ::testing::TestWithParam<Conversion>;
+
+// Benchmark of array conversions against the scalar loop, disabled by default
+TEST_P(PrecisionUtilsArraysPerfTest, DISABLED_Conversion) {
+    Conversion conversion = GetParam();
+    const size_t size = 16 * 1024 * 1024;
+
+    const auto floats = GenerateFloats(size);
+    const auto halfs = GenerateHalfs(size);
+    std::vector<float> floatsDst(size);
+    std::vector<ie_fp16> halfsDst(size);
+    std::vector<ie_bf16> bfloatsDst(size);
+
+    auto measureMicros = [](const std::function<void()>& convert) {
+        auto start = std::chrono::high_resolution_clock::now();
+        convert();
+        auto finish = std::chrono::high_resolution_clock::now();
+        return std::chrono::duration_cast<std::chrono::microseconds>(finish - start).count();
+    };
+
+    long long arrayTime = 0, scalarTime = 0;
+    switch (conversion) {
+        case Conversion::F16toF32:
+            arrayTime = measureMicros([&] { PrecisionUtils::f16tof32Arrays(floatsDst.data(), halfs.data(), size); });
+            scalarTime = measureMicros([&] {
+                for (size_t i = 0; i < size; i++) floatsDst[i] = PrecisionUtils::f16tof32(halfs[i]);
+            });
+            break;
+        case Conversion::F32toF16:
+            arrayTime = measureMicros([&] { PrecisionUtils::f32tof16Arrays(halfsDst.data(), floats.data(), size); });
+            scalarTime = measureMicros([&] {
+                for (size_t i = 0; i < size; i++) halfsDst[i] = PrecisionUtils::f32tof16(floats[i]);
+            });
+            break;
+        case Conversion::BF16toF32:
+            PrecisionUtils::f32tobf16Arrays(bfloatsDst.data(), floats.data(), size);
+            arrayTime = measureMicros([&] { PrecisionUtils::bf16tof32Arrays(floatsDst.data(), bfloatsDst.data(), size); });
+            scalarTime = measureMicros([&] {
+                for (size_t i = 0; i < size; i++) floatsDst[i] = PrecisionUtils::bf16tof32(bfloatsDst[i]);
+            });
+            break;
+        case Conversion::F32toBF16:
+            arrayTime = measureMicros([&] { PrecisionUtils::f32tobf16Arrays(bfloatsDst.data(), floats.data(), size); });
+            scalarTime = measureMicros([&] {
+                for (size_t i = 0; i < size; i++) bfloatsDst[i] = PrecisionUtils::f32tobf16(floats[i]);
+            });
+            break;
+    }
+
+    std::cout << conversion << " of " << size << " elements execution time : " << arrayTime
+              << " micros, scalar : " << scalarTime << " micros" << std::endl;
+}
+
+INSTANTIATE_TEST_CASE_P(performance, PrecisionUtilsArraysPerfTest,
+                        ::testing::ValuesIn(PrecisionUtils_Conversions));
@@ -272,4 +272,79 @@ TEST(TransformationTests, ConvertMatMulDynamic) {
         m.register_pass<ngraph::pass::ConvertMatMulToGemm>();
         m.register_pass<ngraph::pass::ReshapeFullyConnected>();
         ASSERT_NO_THROW(m.run_passes(f));
-}
\ No newline at end of file
+}
+TEST(TransformationTests, ConvertMatMulWithCompressedWeightsTest1) {
+    std::shared_ptr<ngraph::Function> f(nullptr), f_ref(nullptr);
+    {
+        auto input1 = std::make_shared<ngraph::opset1::Parameter>(ngraph::element::f32, ngraph::Shape{2, 3});
+        auto weights = ngraph::opset1::Constant::create(ngraph::element::u8, ngraph::Shape{4, 3}, {1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12});
+        auto convert = std::make_shared<ngraph::opset1::Convert>(weights, ngraph::element::f32);
+        auto subtract = std::make_shared<ngraph::opset1::Subtract>(convert,
+            ngraph::opset1::Constant::create(ngraph::element::f32, ngraph::Shape{4, 1}, {1, 2, 3, 4}));
+        auto multiply = std::make_shared<ngraph::opset1::Multiply>(subtract,
+            ngraph::opset1::Constant::create(ngraph::element::f32, ngraph::Shape{4, 1}, {0.5f, 0.25f, 1.f, 2.f}));
+        auto matmul = std::make_shared<ngraph::opset1::MatMul>(input1, multiply, false, true);
+
+        f = std::make_shared<ngraph::Function>(ngraph::NodeVector{matmul}, ngraph::ParameterVector{input1});
+
+        ngraph::pass::Manager m;
+        m.register_pass<ngraph::pass::InitNodeInfo>();
+        m.register_pass<ngraph::pass::DisableCompressedWeightsConstantFolding>();
+        m.register_pass<ngraph::pass::ConstantFolding>();
+        m.register_pass<ngraph::pass::ConvertMatMulWithCompressedWeightsToFC>();
+        m.run_passes(f);
+        ASSERT_NO_THROW(check_rt_info(f));
+    }
+
+    {
+        auto input1 = std::make_shared<ngraph::opset1::Parameter>(ngraph::element::f32, ngraph::Shape{2, 3});
+        auto weights = ngraph::opset1::Constant::create(ngraph::element::u8, ngraph::Shape{4, 3}, {1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12});
+        auto bias = ngraph::opset1::Constant::create(ngraph::element::f32, ngraph::Shape{4}, {0, 0, 0, 0});
+        auto scale = ngraph::opset1::Constant::create(ngraph::element::f32, ngraph::Shape{4}, {0.5f, 0.25f, 1.f, 2.f});
+        auto zero_point = ngraph::opset1::Constant::create(ngraph::element::f32, ngraph::Shape{4}, {1, 2, 3, 4});
+        auto fc = std::make_shared<ngraph::op::FullyConnected>(input1, weights, bias, scale, zero_point, ngraph::Shape{2, 4});
+
+        f_ref = std::make_shared<ngraph::Function>(ngraph::NodeVector{fc}, ngraph::ParameterVector{input1});
+    }
+
+    auto res = compare_functions(f, f_ref, true);
+    ASSERT_TRUE(res.first) << res.second;
+}
+
+TEST(TransformationTests, ConvertMatMulWithCompressedWeightsTest2) {
+    std::shared_ptr<ngraph::Function> f(nullptr), f_ref(nullptr);
+    {
+        auto input1 = std::make_shared<ngraph::opset1::Parameter>(ngraph::element::f32, ngraph::Shape{1, 5, 3});
+        auto weights = ngraph::opset1::Constant::create(ngraph::element::i8, ngraph::Shape{3, 2}, {-1, 2, -3, 4, -5, 6});
+        auto convert = std::make_shared<ngraph::opset1::Convert>(weights, ngraph::element::f32);
+        auto multiply = std::make_shared<ngraph::opset1::Multiply>(convert,
+            ngraph::opset1::Constant::create(ngraph::element::f32, ngraph::Shape{1, 2}, {0.5, 0.25}));
+        auto add = std::make_shared<ngraph::opset1::Add>(multiply,
+            ngraph::opset1::Constant::create(ngraph::element::f32, ngraph::Shape{1, 2}, {1, 1}));
+        auto matmul = std::make_shared<ngraph::opset1::MatMul>(input1, add, false, false);
+
+        f = std::make_shared<ngraph::Function>(ngraph::NodeVector{matmul}, ngraph::ParameterVector{input1});
+
+        ngraph::pass::Manager m;
+        m.register_pass<ngraph::pass::InitNodeInfo>();
+        m.register_pass<ngraph::pass::DisableCompressedWeightsConstantFolding>();
+        m.register_pass<ngraph::pass::ConstantFolding>();
+        m.register_pass<ngraph::pass::ConvertMatMulWithCompressedWeightsToFC>();
+        m.run_passes(f);
+        ASSERT_NO_THROW(check_rt_info(f));
+    }
+
+    {
+        auto input1 = std::make_shared<ngraph::opset1::Parameter>(ngraph::element::f32, ngraph::Shape{1, 5, 3});
+        auto weights = ngraph::opset1::Constant::create(ngraph::element::i8, ngraph::Shape{2, 3}, {-1, -3, -5, 2, 4, 6});
+        auto bias = ngraph::opset1::Constant::create(ngraph::element::f32, ngraph::Shape{2}, {0, 0});
+        auto scale = ngraph::opset1::Constant::create(ngraph::element::f32, ngraph::Shape{2}, {0.5, 0.25});
+        auto zero_point = ngraph::opset1::Constant::create(ngraph::element::f32, ngraph::Shape{2}, {-2, -4});
+        auto fc = std::make_shared<ngraph::op::FullyConnected>(input1, weights, bias, scale, zero_point, ngraph::Shape{1, 5, 2});
+
+        f_ref = std::make_shared<ngraph::Function>(ngraph::NodeVector{fc}, ngraph::ParameterVector{input1});
+    }
+
+    auto res = compare_functions(f, f_ref, true);
+    ASSERT_TRUE(res.first) << res.second;
+}
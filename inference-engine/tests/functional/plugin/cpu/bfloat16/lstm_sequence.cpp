@@ -0,0 +1,114 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "bfloat16_helpers.hpp"
+
+#include <memory>
+#include <tuple>
+#include <vector>
+#include <string>
+#include <map>
+#include <functional>
+#include <utility>
+
+#include <ie_core.hpp>
+#include <ie_plugin_config.hpp>
+
+#include "common_test_utils/common_utils.hpp"
+
+#include "ngraph/opsets/opset1.hpp"
+#include "ngraph/opsets/opset5.hpp"
+
+using namespace std;
+using namespace ngraph;
+using namespace InferenceEngine;
+
+namespace LayerTestsDefinitions {
+
+class LSTMSequence_multiply : public BasicBF16Test {
+protected:
+    std::shared_ptr<ngraph::Function> createGraph(InferenceEngine::Precision netPrecision) override {
+//                Input (FP32)
+//                   |
+//                Mul (BF16)
+//                   |
+//           LSTMSequence (BF16)
+//                   |
+//                Mul (BF16)
+
+        ngraph::element::Type ntype = (netPrecision == Precision::FP32) ? ngraph::element::f32 : ngraph::element::bf16;
+        auto createConstant = [&](const Shape& shape, const float value) {
+            if (netPrecision == Precision::FP32) {
+                return opset1::Constant::create(ntype, shape, { value });
+            }
+            return opset1::Constant::create(ntype, shape, { bfloat16::from_bits(FuncTestUtils::Bf16TestUtils::reducePrecisionBitwiseS(value)) });
+        };
+
+        // inputShapes: batch, sequence length, input size
+        const size_t batch = inputShapes[0];
+        const size_t inputSize = inputShapes[2];
+        const size_t hiddenSize = 32;
+
+        auto input1 = std::make_shared<opset1::Parameter>(ntype, ngraph::Shape{inputShapes});
+        input1->set_friendly_name("Input_1");
+
+        auto mulNode0 = std::make_shared<opset1::Multiply>(input1, createConstant(Shape{1}, 0.5f));
+        mulNode0->set_friendly_name("Mul_0");
+
+        auto initialHidden = createConstant(Shape{batch, 1, hiddenSize}, 0.f);
+        auto initialCell = createConstant(Shape{batch, 1, hiddenSize}, 0.f);
+        auto sequenceLengths = opset1::Constant::create(ngraph::element::i32, Shape{batch}, { inputShapes[1] });
+        auto weights = createConstant(Shape{1, 4 * hiddenSize, inputSize}, 0.0625f);
+        auto recurrentWeights = createConstant(Shape{1, 4 * hiddenSize, hiddenSize}, -0.03125f);
+        auto bias = createConstant(Shape{1, 4 * hiddenSize}, 0.125f);
+
+        auto lstmNode = std::make_shared<opset5::LSTMSequence>(
+            mulNode0, initialHidden, initialCell, sequenceLengths, weights, recurrentWeights, bias,
+            hiddenSize, ngraph::op::RecurrentSequenceDirection::FORWARD);
+        lstmNode->set_friendly_name("LSTMSequence_1");
+
+        auto mulNode1 = std::make_shared<opset1::Multiply>(lstmNode->output(0), createConstant(Shape{1}, 2.f));
+        mulNode1->set_friendly_name("Mul_1");
+
+        return std::make_shared<ngraph::Function>(mulNode1, ngraph::ParameterVector{input1});
+    }
+    void SetUp() override {
+        std::tie(inputPrecision, netPrecision, inputShapes, newInputShapes, targetDevice) = this->GetParam();
+        fnPtr = createGraph(netPrecision);
+
+        // STAGE2: set up safe threshold <= 5% from maximum value of output tensor
+        threshold = 0.05f;  // LSTM output is bounded by 1, the last multiply scales it by 2
+
+        // STAGE3:
+        // filling of expected precision of layer execution defined by precisoin of input tensor to the primitive and reflected in
+        // performance counters
+        // the sequence is executed under the name generated by the legacy conversion, so only eltwises are checked by name
+
+        expectedPrecisions["Mul_0"] = "BF16";
+        expectedPrecisions["Mul_1"] = "BF16";
+    }
+};
+
+TEST_P(LSTMSequence_multiply, CompareWithRefImpl) {
+    test();
+};
+
+INSTANTIATE_TEST_CASE_P(smoke_BF16_bfloat16_NoReshape, LSTMSequence_multiply,
+                        ::testing::Combine(
+                                ::testing::Values(Precision::FP32),
+                                ::testing::Values(Precision::BF16),
+                                ::testing::Values(SizeVector({1, 10, 16}), SizeVector({4, 5, 64})),
+                                ::testing::Values(SizeVector()),
+                                ::testing::Values(CommonTestUtils::DEVICE_CPU)),
+                        LSTMSequence_multiply::getTestCaseName);
+
+INSTANTIATE_TEST_CASE_P(smoke_FP32_bfloat16_NoReshape, LSTMSequence_multiply,
+                        ::testing::Combine(
+                                ::testing::Values(Precision::FP32),
+                                ::testing::Values(Precision::FP32),
+                                ::testing::Values(SizeVector({1, 10, 16}), SizeVector({4, 5, 64})),
+                                ::testing::Values(SizeVector()),
+                                ::testing::Values(CommonTestUtils::DEVICE_CPU)),
+                        LSTMSequence_multiply::getTestCaseName);
+}  // namespace LayerTestsDefinitions
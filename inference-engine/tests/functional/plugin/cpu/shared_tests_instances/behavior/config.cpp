@@ -3,6 +3,7 @@
 //
 
 #include "multi-device/multi_device_config.hpp"
+#include "cpu/cpu_config.hpp"
 
 #include "behavior/config.hpp"
 
@@ -24,7 +25,12 @@ namespace {
             {{InferenceEngine::PluginConfigParams::KEY_CPU_THROUGHPUT_STREAMS, "8"}},
             {{InferenceEngine::PluginConfigParams::KEY_CPU_BIND_THREAD, InferenceEngine::PluginConfigParams::NO}},
             {{InferenceEngine::PluginConfigParams::KEY_CPU_BIND_THREAD, InferenceEngine::PluginConfigParams::YES}},
-            {{InferenceEngine::PluginConfigParams::KEY_DYN_BATCH_LIMIT, "10"}}
+            {{InferenceEngine::PluginConfigParams::KEY_DYN_BATCH_LIMIT, "10"}},
+            {{InferenceEngine::CPUConfigParams::KEY_CPU_INTER_OP_PARALLELISM, InferenceEngine::PluginConfigParams::YES}},
+            {{InferenceEngine::CPUConfigParams::KEY_CPU_INTER_OP_PARALLELISM, InferenceEngine::PluginConfigParams::NO}},
+            {{InferenceEngine::CPUConfigParams::KEY_CPU_MEMORY_REUSE_STRATEGY, InferenceEngine::CPUConfigParams::CPU_FIRST_FIT}},
+            {{InferenceEngine::CPUConfigParams::KEY_CPU_MEMORY_REUSE_STRATEGY, InferenceEngine::CPUConfigParams::CPU_BEST_FIT}},
+            {{InferenceEngine::CPUConfigParams::KEY_CPU_MEMORY_REUSE_STRATEGY, InferenceEngine::CPUConfigParams::CPU_AUTO}}
     };
 
     const std::vector<std::map<std::string, std::string>> MultiConfigs = {
@@ -39,7 +45,11 @@ namespace {
             {{InferenceEngine::MultiDeviceConfigParams::KEY_MULTI_DEVICE_PRIORITIES , CommonTestUtils::DEVICE_CPU},
                     {InferenceEngine::PluginConfigParams::KEY_CPU_BIND_THREAD, InferenceEngine::PluginConfigParams::YES}},
             {{InferenceEngine::MultiDeviceConfigParams::KEY_MULTI_DEVICE_PRIORITIES , CommonTestUtils::DEVICE_CPU},
-                    {InferenceEngine::PluginConfigParams::KEY_DYN_BATCH_LIMIT, "10"}}
+                    {InferenceEngine::PluginConfigParams::KEY_DYN_BATCH_LIMIT, "10"}},
+            {{InferenceEngine::MultiDeviceConfigParams::KEY_MULTI_DEVICE_PRIORITIES , CommonTestUtils::DEVICE_CPU},
+                    {InferenceEngine::MultiDeviceConfigParams::KEY_MULTI_SCHEDULING_POLICY, InferenceEngine::MultiDeviceConfigParams::MULTI_PRIORITY}},
+            {{InferenceEngine::MultiDeviceConfigParams::KEY_MULTI_DEVICE_PRIORITIES , CommonTestUtils::DEVICE_CPU},
+                    {InferenceEngine::MultiDeviceConfigParams::KEY_MULTI_SCHEDULING_POLICY, InferenceEngine::MultiDeviceConfigParams::MULTI_THROUGHPUT}}
     };
 
     INSTANTIATE_TEST_CASE_P(smoke_BehaviorTests, CorrectConfigTests,
@@ -59,7 +69,9 @@ namespace {
     const std::vector<std::map<std::string, std::string>> inconfigs = {
             {{InferenceEngine::PluginConfigParams::KEY_CPU_THROUGHPUT_STREAMS, "OFF"}},
             {{InferenceEngine::PluginConfigParams::KEY_CPU_BIND_THREAD, "OFF"}},
-            {{InferenceEngine::PluginConfigParams::KEY_DYN_BATCH_LIMIT, "NAN"}}
+            {{InferenceEngine::PluginConfigParams::KEY_DYN_BATCH_LIMIT, "NAN"}},
+            {{InferenceEngine::CPUConfigParams::KEY_CPU_INTER_OP_PARALLELISM, "OFF"}},
+            {{InferenceEngine::CPUConfigParams::KEY_CPU_MEMORY_REUSE_STRATEGY, "OPTIMAL"}}
     };
 
     const std::vector<std::map<std::string, std::string>> multiinconfigs = {
@@ -68,7 +80,9 @@ namespace {
             {{InferenceEngine::MultiDeviceConfigParams::KEY_MULTI_DEVICE_PRIORITIES , CommonTestUtils::DEVICE_CPU},
                     {InferenceEngine::PluginConfigParams::KEY_CPU_BIND_THREAD, "OFF"}},
             {{InferenceEngine::MultiDeviceConfigParams::KEY_MULTI_DEVICE_PRIORITIES , CommonTestUtils::DEVICE_CPU},
-                    {InferenceEngine::PluginConfigParams::KEY_DYN_BATCH_LIMIT, "NAN"}}
+                    {InferenceEngine::PluginConfigParams::KEY_DYN_BATCH_LIMIT, "NAN"}},
+            {{InferenceEngine::MultiDeviceConfigParams::KEY_MULTI_DEVICE_PRIORITIES , CommonTestUtils::DEVICE_CPU},
+                    {InferenceEngine::MultiDeviceConfigParams::KEY_MULTI_SCHEDULING_POLICY, "FASTEST"}}
     };
 
     const std::vector<std::map<std::string, std::string>> multiconf = {
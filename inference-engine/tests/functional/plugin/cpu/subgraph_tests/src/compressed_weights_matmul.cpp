@@ -0,0 +1,258 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <map>
+#include <memory>
+#include <sstream>
+#include <string>
+#include <tuple>
+#include <vector>
+
+#include <gtest/gtest.h>
+#include <ie_plugin_config.hpp>
+#include <ie_system_conf.h>
+#include <exec_graph_info.hpp>
+#include <ngraph/opsets/opset1.hpp>
+#include <ngraph/variant.hpp>
+
+#include "common_test_utils/test_common.hpp"
+#include "common_test_utils/test_constants.hpp"
+#include "common_test_utils/common_utils.hpp"
+#include "functional_test_utils/plugin_cache.hpp"
+#include "functional_test_utils/blob_utils.hpp"
+#include "functional_test_utils/skip_tests_config.hpp"
+#include "ngraph_functions/builders.hpp"
+
+using namespace InferenceEngine;
+
+namespace CPUSubgraphTestsDefinitions {
+
+enum class WeightsRange {
+    Int4,   // values fit into 4 bits, so the weights are packed two per byte
+    Int8,
+};
+
+// input shape {..., K} and number of output channels O
+typedef std::tuple<SizeVector, size_t> MatMulShape;
+
+// weights precision, weights values range, shapes, transpose_b, activations precision
+typedef std::tuple<Precision, WeightsRange, MatMulShape, bool, Precision> CompressedWeightsMatMulParams;
+
+/* MatMul with u8/i8 weights decompressed per output channel, executed by FullyConnected with compressed weights
+
+    Parameter   Constant u8/i8
+        |           |
+       Relu      Convert
+        |           |
+        |       Subtract (zero point)
+        |           |
+        |       Multiply (scale)
+         \         /
+           MatMul
+             |
+           Result
+
+   The reference is the same network with the weights dequantized to FP32 constant
+*/
+class CompressedWeightsMatMulTest : public testing::WithParamInterface<CompressedWeightsMatMulParams>,
+                                    public CommonTestUtils::TestsCommon {
+public:
+    static std::string getTestCaseName(const testing::TestParamInfo<CompressedWeightsMatMulParams> &obj) {
+        Precision weightsPrecision, activationsPrecision;
+        WeightsRange range;
+        MatMulShape shape;
+        bool transposeB;
+        std::tie(weightsPrecision, range, shape, transposeB, activationsPrecision) = obj.param;
+        std::ostringstream result;
+        result << "W=" << weightsPrecision.name() << "_";
+        result << (range == WeightsRange::Int4 ? "Int4" : "Int8") << "_";
+        result << "IS=" << CommonTestUtils::vec2str(std::get<0>(shape)) << "_";
+        result << "O=" << std::get<1>(shape) << "_";
+        result << "transposeB=" << transposeB << "_";
+        result << "A=" << activationsPrecision.name();
+        return result.str();
+    }
+
+protected:
+    std::shared_ptr<ngraph::Function> function;
+    std::shared_ptr<ngraph::Function> referenceFunction;
+    Precision activationsPrecision;
+    SizeVector inputShape;
+
+    void SetUp() override {
+        Precision weightsPrecision;
+        WeightsRange range;
+        MatMulShape shape;
+        bool transposeB;
+        std::tie(weightsPrecision, range, shape, transposeB, activationsPrecision) = GetParam();
+        inputShape = std::get<0>(shape);
+        const size_t K = inputShape.back();
+        const size_t O = std::get<1>(shape);
+
+        const bool isSigned = weightsPrecision == Precision::I8;
+        const int levels = range == WeightsRange::Int4 ? 16 : 256;
+        const int lowValue = isSigned ? -levels / 2 : 0;
+
+        // per output channel zero points around the middle of the range and scales keeping the output about [-8, 8]
+        std::vector<float> zeroPoints(O), scales(O);
+        for (size_t o = 0; o < O; o++) {
+            zeroPoints[o] = static_cast<float>(lowValue + levels / 2 - 2 + static_cast<int>(o % 5));
+            scales[o] = static_cast<float>(1 + o % 7) / static_cast<float>(levels * K);
+        }
+
+        // weights cover the whole range, e.g. both -8 and 7 for 4-bit signed values
+        const ngraph::Shape weightsShape = transposeB ? ngraph::Shape{O, K} : ngraph::Shape{K, O};
+        std::vector<int> weights(O * K);
+        std::vector<float> dequantizedWeights(O * K);
+        for (size_t i = 0; i < weights.size(); i++) {
+            const size_t o = transposeB ? i / K : i % O;
+            weights[i] = lowValue + static_cast<int>((i * 37 + o) % levels);
+            dequantizedWeights[i] = (static_cast<float>(weights[i]) - zeroPoints[o]) * scales[o];
+        }
+
+        const ngraph::Shape channelShape = transposeB ? ngraph::Shape{O, 1} : ngraph::Shape{1, O};
+        const auto elementType = isSigned ? ngraph::element::i8 : ngraph::element::u8;
+        const auto compressed = ngraph::opset1::Constant::create(elementType, weightsShape, weights);
+        const auto convert = std::make_shared<ngraph::opset1::Convert>(compressed, ngraph::element::f32);
+        const auto subtract = std::make_shared<ngraph::opset1::Subtract>(
+                convert, ngraph::opset1::Constant::create(ngraph::element::f32, channelShape, zeroPoints));
+        const auto multiply = std::make_shared<ngraph::opset1::Multiply>(
+                subtract, ngraph::opset1::Constant::create(ngraph::element::f32, channelShape, scales));
+
+        function = makeFunction(multiply, transposeB);
+        referenceFunction = makeFunction(ngraph::opset1::Constant::create(ngraph::element::f32, weightsShape, dequantizedWeights),
+                                         transposeB);
+    }
+
+    // Relu keeps the MatMul input inside the network, so that its precision is changed by enforced BF16
+    std::shared_ptr<ngraph::Function> makeFunction(const std::shared_ptr<ngraph::Node>& weights, bool transposeB) const {
+        auto param = std::make_shared<ngraph::opset1::Parameter>(ngraph::element::f32, ngraph::Shape(inputShape));
+        param->set_friendly_name("input");
+        const auto relu = std::make_shared<ngraph::opset1::Relu>(param);
+        relu->set_friendly_name("relu");
+        const auto matMul = std::make_shared<ngraph::opset1::MatMul>(relu, weights, false, transposeB);
+        matMul->set_friendly_name("matMul");
+        auto result = std::make_shared<ngraph::opset1::Result>(matMul);
+        return std::make_shared<ngraph::Function>(ngraph::ResultVector{result}, ngraph::ParameterVector{param}, "CompressedWeightsMatMul");
+    }
+
+    bool isSupported() const {
+        return activationsPrecision != Precision::BF16 || with_cpu_x86_avx512_core();
+    }
+
+    std::map<std::string, std::string> getConfig() const {
+        if (activationsPrecision == Precision::BF16) {
+            return {{PluginConfigParams::KEY_ENFORCE_BF16, PluginConfigParams::YES}};
+        }
+        return {{PluginConfigParams::KEY_ENFORCE_BF16, PluginConfigParams::NO}};
+    }
+
+    // BF16 activations lose 8 bits of mantissa, the output stays FP32 in both modes
+    float getThreshold() const {
+        return activationsPrecision == Precision::BF16 ? 0.05f : 1e-4f;
+    }
+
+    Blob::Ptr createInput() const {
+        return FuncTestUtils::createAndFillBlobFloat(TensorDesc(Precision::FP32, inputShape, TensorDesc::getLayoutByDims(inputShape)),
+                                                     3, -1, 100);
+    }
+
+    // weights, bias and decompression parameters are FullyConnected blobs, so the node has the only data input.
+    // Decompression is done inside FullyConnected, if no Convert or Eltwise node is left on the weights path.
+    static void checkCompressedFullyConnected(ExecutableNetwork& execNetwork, Precision expectedPrecision) {
+        auto execFunction = execNetwork.GetExecGraphInfo().getFunction();
+        ASSERT_NE(nullptr, execFunction);
+        auto getExecValue = [](const std::shared_ptr<ngraph::Node>& node, const std::string& name) {
+            const auto& rtInfo = node->get_rt_info();
+            auto it = rtInfo.find(name);
+            IE_ASSERT(rtInfo.end() != it);
+            auto value = std::dynamic_pointer_cast<ngraph::VariantImpl<std::string>>(it->second);
+            IE_ASSERT(nullptr != value);
+            return value->get();
+        };
+        size_t fullyConnectedCount = 0;
+        for (const auto& node : execFunction->get_ops()) {
+            const auto layerType = getExecValue(node, ExecGraphInfoSerialization::LAYER_TYPE);
+            ASSERT_NE("Convert", layerType) << "weights are decompressed outside of FullyConnected";
+            if (layerType == "Eltwise") {
+                ASSERT_EQ("relu", node->get_friendly_name()) << "weights are decompressed outside of FullyConnected";
+            }
+            if (layerType == "FullyConnected") {
+                fullyConnectedCount++;
+                ASSERT_EQ(1, node->get_input_size());
+                ASSERT_EQ(expectedPrecision, Precision::FromStr(getExecValue(node, ExecGraphInfoSerialization::RUNTIME_PRECISION)));
+            }
+        }
+        ASSERT_EQ(1, fullyConnectedCount);
+    }
+};
+
+TEST_P(CompressedWeightsMatMulTest, CompareWithFP32) {
+    SKIP_IF_CURRENT_TEST_IS_DISABLED()
+
+    if (!isSupported()) {
+        GTEST_SKIP();
+    }
+
+    auto ie = PluginCache::get().ie();
+    CNNNetwork network(function);
+    const auto input = createInput();
+
+    auto execNetwork = ie->LoadNetwork(network, CommonTestUtils::DEVICE_CPU, getConfig());
+    checkCompressedFullyConnected(execNetwork, activationsPrecision);
+    auto request = execNetwork.CreateInferRequest();
+    request.SetBlob("input", input);
+    request.Infer();
+    const auto actual = request.GetBlob(network.getOutputsInfo().begin()->first);
+
+    CNNNetwork referenceNetwork(referenceFunction);
+    auto referenceRequest = ie->LoadNetwork(referenceNetwork, CommonTestUtils::DEVICE_CPU,
+                                            {{PluginConfigParams::KEY_ENFORCE_BF16, PluginConfigParams::NO}}).CreateInferRequest();
+    referenceRequest.SetBlob("input", input);
+    referenceRequest.Infer();
+    const auto expected = referenceRequest.GetBlob(referenceNetwork.getOutputsInfo().begin()->first);
+
+    ASSERT_EQ(expected->getTensorDesc().getDims(), actual->getTensorDesc().getDims());
+    FuncTestUtils::compareRawBuffers(actual->cbuffer().as<const float*>(), expected->cbuffer().as<const float*>(),
+                                     actual->size(), expected->size(), FuncTestUtils::CompareType::ABS, getThreshold());
+}
+
+namespace {
+
+const std::vector<Precision> weightsPrecisions = {
+        Precision::U8,
+        Precision::I8,
+};
+
+const std::vector<WeightsRange> weightsRanges = {
+        WeightsRange::Int4,
+        WeightsRange::Int8,
+};
+
+// rows are not multiple of 4 rows kernel block, output channels are not multiple of SIMD width, odd K disables 4-bit packing
+const std::vector<MatMulShape> shapes = {
+        MatMulShape{{1, 16}, 37},
+        MatMulShape{{3, 15}, 17},
+        MatMulShape{{5, 64}, 5},
+        MatMulShape{{8, 33}, 48},
+        MatMulShape{{2, 3, 32}, 31},
+        MatMulShape{{7, 128}, 64},
+};
+
+const std::vector<Precision> activationsPrecisions = {
+        Precision::FP32,
+        Precision::BF16,
+};
+
+INSTANTIATE_TEST_CASE_P(smoke_CompressedWeightsMatMul, CompressedWeightsMatMulTest,
+                        ::testing::Combine(
+                                ::testing::ValuesIn(weightsPrecisions),
+                                ::testing::ValuesIn(weightsRanges),
+                                ::testing::ValuesIn(shapes),
+                                ::testing::Values(true, false),
+                                ::testing::ValuesIn(activationsPrecisions)),
+                        CompressedWeightsMatMulTest::getTestCaseName);
+
+}  // namespace
+}  // namespace CPUSubgraphTestsDefinitions
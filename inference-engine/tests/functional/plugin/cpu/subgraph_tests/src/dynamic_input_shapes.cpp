@@ -0,0 +1,175 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <algorithm>
+#include <map>
+#include <string>
+#include <vector>
+#include <memory>
+
+#include <gtest/gtest.h>
+#include <ie_plugin_config.hpp>
+#include <ngraph/opsets/opset1.hpp>
+
+#include "common_test_utils/test_common.hpp"
+#include "common_test_utils/test_constants.hpp"
+#include "common_test_utils/data_utils.hpp"
+#include "functional_test_utils/plugin_cache.hpp"
+#include "functional_test_utils/blob_utils.hpp"
+#include "functional_test_utils/skip_tests_config.hpp"
+
+using namespace InferenceEngine;
+
+namespace CPUSubgraphTestsDefinitions {
+
+typedef std::map<std::string, std::string> DynamicInputShapesParams;
+
+/* Sequence of variable length with the upper bound of the length
+
+        Parameter [1, 1..64, 16]
+            |
+         MatMul [16, 32]
+            |
+           Add [32]
+            |
+          Relu
+*/
+class DynamicInputShapesTest : public testing::WithParamInterface<DynamicInputShapesParams>,
+                               public CommonTestUtils::TestsCommon {
+public:
+    static std::string getTestCaseName(const testing::TestParamInfo<DynamicInputShapesParams> &obj) {
+        std::ostringstream result;
+        result << "config";
+        for (const auto& item : obj.param) {
+            result << "_" << item.first << "=" << item.second;
+        }
+        return result.str();
+    }
+
+protected:
+    const size_t maxLength = 64;
+    const size_t inputSize = 16;
+    const size_t outputSize = 32;
+    std::vector<float> weights;
+    std::vector<float> biases;
+    std::shared_ptr<ngraph::Function> function;
+
+    void SetUp() override {
+        weights = CommonTestUtils::generate_float_numbers(inputSize * outputSize, -1.f, 1.f);
+        biases = CommonTestUtils::generate_float_numbers(outputSize, -1.f, 1.f);
+
+        auto param = std::make_shared<ngraph::opset1::Parameter>(ngraph::element::f32,
+            ngraph::PartialShape{1, ngraph::Dimension(1, maxLength), static_cast<int64_t>(inputSize)});
+        param->set_friendly_name("input");
+        auto weightsNode = ngraph::opset1::Constant::create(ngraph::element::f32, {inputSize, outputSize}, weights);
+        auto matMul = std::make_shared<ngraph::opset1::MatMul>(param, weightsNode);
+        auto biasesNode = ngraph::opset1::Constant::create(ngraph::element::f32, {outputSize}, biases);
+        auto add = std::make_shared<ngraph::opset1::Add>(matMul, biasesNode);
+        auto relu = std::make_shared<ngraph::opset1::Relu>(add);
+        relu->set_friendly_name("output");
+
+        function = std::make_shared<ngraph::Function>(ngraph::ResultVector{std::make_shared<ngraph::opset1::Result>(relu)},
+                                                      ngraph::ParameterVector{param}, "DynamicInputShapes");
+    }
+
+    std::vector<float> reference(const float* input, size_t length) const {
+        std::vector<float> output(length * outputSize);
+        for (size_t t = 0; t < length; t++) {
+            for (size_t o = 0; o < outputSize; o++) {
+                float sum = biases[o];
+                for (size_t i = 0; i < inputSize; i++) {
+                    sum += input[t * inputSize + i] * weights[i * outputSize + o];
+                }
+                output[t * outputSize + o] = std::max(sum, 0.f);
+            }
+        }
+        return output;
+    }
+};
+
+TEST_P(DynamicInputShapesTest, InferVariableLength) {
+    SKIP_IF_CURRENT_TEST_IS_DISABLED()
+
+    auto ie = PluginCache::get().ie();
+    CNNNetwork network(function);
+    auto execNetwork = ie->LoadNetwork(network, CommonTestUtils::DEVICE_CPU, GetParam());
+    auto request = execNetwork.CreateInferRequest();
+
+    // Default blobs are allocated for the upper bound
+    ASSERT_EQ((SizeVector{1, maxLength, inputSize}), request.GetBlob("input")->getTensorDesc().getDims());
+
+    // Repeated lengths reuse graphs compiled for them before
+    for (size_t length : {maxLength, size_t(10), size_t(33), size_t(10), maxLength, size_t(1)}) {
+        auto input = FuncTestUtils::createAndFillBlobFloat(TensorDesc(Precision::FP32, {1, length, inputSize}, Layout::CHW));
+        request.SetBlob("input", input);
+        request.Infer();
+
+        auto output = request.GetBlob("output");
+        ASSERT_EQ((SizeVector{1, length, outputSize}), output->getTensorDesc().getDims());
+
+        auto expected = reference(input->cbuffer().as<const float*>(), length);
+        FuncTestUtils::compareRawBuffers(output->cbuffer().as<const float*>(), expected.data(),
+                                         output->size(), expected.size(), 1e-3f);
+    }
+}
+
+TEST_P(DynamicInputShapesTest, AsyncRequestsShareGraphs) {
+    SKIP_IF_CURRENT_TEST_IS_DISABLED()
+
+    auto ie = PluginCache::get().ie();
+    CNNNetwork network(function);
+    auto execNetwork = ie->LoadNetwork(network, CommonTestUtils::DEVICE_CPU, GetParam());
+
+    // Requests running concurrently on different streams use the same and different shapes
+    const std::vector<size_t> lengths = {10, 33, 10, maxLength, 33, 1, 10, 1};
+    std::vector<InferRequest> requests;
+    std::vector<Blob::Ptr> inputs;
+    for (size_t iteration = 0; iteration < 2; iteration++) {
+        requests.clear();
+        inputs.clear();
+        for (auto length : lengths) {
+            requests.push_back(execNetwork.CreateInferRequest());
+            inputs.push_back(FuncTestUtils::createAndFillBlobFloat(TensorDesc(Precision::FP32, {1, length, inputSize}, Layout::CHW)));
+            requests.back().SetBlob("input", inputs.back());
+        }
+        for (auto& request : requests) {
+            request.StartAsync();
+        }
+        for (size_t i = 0; i < requests.size(); i++) {
+            ASSERT_EQ(StatusCode::OK, requests[i].Wait(IInferRequest::WaitMode::RESULT_READY));
+
+            auto output = requests[i].GetBlob("output");
+            ASSERT_EQ((SizeVector{1, lengths[i], outputSize}), output->getTensorDesc().getDims());
+
+            auto expected = reference(inputs[i]->cbuffer().as<const float*>(), lengths[i]);
+            FuncTestUtils::compareRawBuffers(output->cbuffer().as<const float*>(), expected.data(),
+                                             output->size(), expected.size(), 1e-3f);
+        }
+    }
+}
+
+TEST_P(DynamicInputShapesTest, ThrowsOnShapeOutOfBounds) {
+    SKIP_IF_CURRENT_TEST_IS_DISABLED()
+
+    auto ie = PluginCache::get().ie();
+    CNNNetwork network(function);
+    auto request = ie->LoadNetwork(network, CommonTestUtils::DEVICE_CPU, GetParam()).CreateInferRequest();
+
+    auto input = FuncTestUtils::createAndFillBlobFloat(TensorDesc(Precision::FP32, {1, maxLength + 1, inputSize}, Layout::CHW));
+    ASSERT_THROW(request.SetBlob("input", input), details::InferenceEngineException);
+}
+
+namespace {
+
+const std::vector<DynamicInputShapesParams> configs = {
+        {},
+        {{PluginConfigParams::KEY_CPU_THROUGHPUT_STREAMS, "2"}}
+};
+
+INSTANTIATE_TEST_CASE_P(smoke_DynamicInputShapes, DynamicInputShapesTest,
+                        ::testing::ValuesIn(configs),
+                        DynamicInputShapesTest::getTestCaseName);
+
+}  // namespace
+}  // namespace CPUSubgraphTestsDefinitions
@@ -0,0 +1,101 @@
+// Copyright (C) 2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <tuple>
+#include <string>
+#include <vector>
+#include <memory>
+
+#include "cpu/cpu_config.hpp"
+#include "shared_test_classes/base/layer_test_utils.hpp"
+#include "ngraph_functions/utils/ngraph_helpers.hpp"
+#include "ngraph_functions/builders.hpp"
+#include "functional_test_utils/skip_tests_config.hpp"
+
+using namespace InferenceEngine;
+
+namespace CPUSubgraphTestsDefinitions {
+
+typedef std::tuple<
+        size_t,                             // Number of branches
+        std::map<std::string, std::string>  // Configuration
+> InterOpParallelismParams;
+
+/* Independent branches that share the input tensor. The eltwise nodes may work in-place,
+   so the scheduler has to keep them ordered with the other readers of the same memory.
+
+                        Parameter
+               /          |            \
+        Conv+Relu     Conv+Relu  ...  Conv+Relu
+           |              |               |
+          Add            Add     ...     Add   <- Parameter
+               \          |            /
+                          Concat
+*/
+class InterOpParallelismTest : public testing::WithParamInterface<InterOpParallelismParams>,
+                               virtual public LayerTestsUtils::LayerTestsCommon {
+public:
+    static std::string getTestCaseName(const testing::TestParamInfo<InterOpParallelismParams> &obj) {
+        size_t branches;
+        std::map<std::string, std::string> config;
+        std::tie(branches, config) = obj.param;
+
+        std::ostringstream result;
+        result << "Branches=" << branches;
+        for (const auto& item : config) {
+            result << "_" << item.first << "=" << item.second;
+        }
+        return result.str();
+    }
+
+protected:
+    void SetUp() override {
+        targetDevice = CommonTestUtils::DEVICE_CPU;
+        size_t branches;
+        std::tie(branches, configuration) = this->GetParam();
+
+        const std::vector<size_t> inputShape = {1, 8, 16, 16};
+        auto ngPrc = ngraph::element::f32;
+        auto params = ngraph::builder::makeParams(ngPrc, {inputShape});
+
+        ngraph::OutputVector concatInputs;
+        for (size_t i = 0; i < branches; i++) {
+            auto conv = ngraph::builder::makeConvolution(params[0], ngPrc, {3, 3}, {1, 1}, {1, 1}, {1, 1}, {1, 1},
+                                                         ngraph::op::PadType::EXPLICIT, inputShape[1]);
+            auto relu = std::make_shared<ngraph::opset1::Relu>(conv);
+            auto add = std::make_shared<ngraph::opset1::Add>(relu, params[0]);
+            concatInputs.push_back(add);
+        }
+        auto concat = std::make_shared<ngraph::opset1::Concat>(concatInputs, 1);
+
+        ngraph::ResultVector results{std::make_shared<ngraph::opset1::Result>(concat)};
+        function = std::make_shared<ngraph::Function>(results, params, "InterOpParallelism");
+    }
+};
+
+TEST_P(InterOpParallelismTest, CompareWithRefs) {
+    SKIP_IF_CURRENT_TEST_IS_DISABLED()
+
+    Run();
+}
+
+namespace {
+
+const std::vector<size_t> branches = {1, 2, 4};
+
+const std::vector<std::map<std::string, std::string>> configs = {
+        {{CPUConfigParams::KEY_CPU_INTER_OP_PARALLELISM, PluginConfigParams::NO}},
+        {{CPUConfigParams::KEY_CPU_INTER_OP_PARALLELISM, PluginConfigParams::YES}},
+        {{CPUConfigParams::KEY_CPU_INTER_OP_PARALLELISM, PluginConfigParams::YES},
+         {PluginConfigParams::KEY_CPU_THROUGHPUT_STREAMS, "2"}}
+};
+
+INSTANTIATE_TEST_CASE_P(smoke_InterOpParallelism, InterOpParallelismTest,
+                        ::testing::Combine(
+                                ::testing::ValuesIn(branches),
+                                ::testing::ValuesIn(configs)),
+                        InterOpParallelismTest::getTestCaseName);
+
+}  // namespace
+}  // namespace CPUSubgraphTestsDefinitions
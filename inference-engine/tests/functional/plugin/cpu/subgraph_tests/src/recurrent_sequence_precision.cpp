@@ -0,0 +1,269 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <chrono>
+#include <iostream>
+#include <map>
+#include <memory>
+#include <sstream>
+#include <string>
+#include <tuple>
+#include <vector>
+
+#include <gtest/gtest.h>
+#include <ie_plugin_config.hpp>
+#include <ie_system_conf.h>
+#include <cpp_interfaces/interface/ie_internal_plugin_config.hpp>
+#include <exec_graph_info.hpp>
+#include <ngraph/opsets/opset1.hpp>
+#include <ngraph/opsets/opset5.hpp>
+#include <ngraph/variant.hpp>
+
+#include "common_test_utils/test_common.hpp"
+#include "common_test_utils/test_constants.hpp"
+#include "common_test_utils/common_utils.hpp"
+#include "functional_test_utils/plugin_cache.hpp"
+#include "functional_test_utils/blob_utils.hpp"
+#include "functional_test_utils/skip_tests_config.hpp"
+#include "ngraph_functions/builders.hpp"
+
+using namespace InferenceEngine;
+
+namespace CPUSubgraphTestsDefinitions {
+
+enum class SequenceType {
+    LSTM,
+    GRU,
+};
+
+enum class ExecutionMode {
+    BF16,       // network is executed with enforced BF16
+    Quantized,  // data and weights are quantized with FakeQuantize
+};
+
+// sequence type, execution mode, {batch, sequence length, input size}
+typedef std::tuple<SequenceType, ExecutionMode, SizeVector> RecurrentSequencePrecisionParams;
+
+/* Recurrent sequence with optionally quantized data and weights
+
+    Parameter
+        |
+   [FakeQuantize]   Constant
+        |              |
+        |        [FakeQuantize]
+         \            /
+      LSTMSequence / GRUSequence
+              |
+            Result
+*/
+class RecurrentSequencePrecisionTest : public testing::WithParamInterface<RecurrentSequencePrecisionParams>,
+                                       public CommonTestUtils::TestsCommon {
+public:
+    static std::string getTestCaseName(const testing::TestParamInfo<RecurrentSequencePrecisionParams> &obj) {
+        SequenceType sequenceType;
+        ExecutionMode mode;
+        SizeVector shape;
+        std::tie(sequenceType, mode, shape) = obj.param;
+        std::ostringstream result;
+        result << (sequenceType == SequenceType::LSTM ? "LSTMSequence" : "GRUSequence") << "_";
+        result << (mode == ExecutionMode::BF16 ? "BF16" : "Quantized") << "_";
+        result << "IS=" << CommonTestUtils::vec2str(shape);
+        return result.str();
+    }
+
+protected:
+    static constexpr size_t hiddenSize = 32;
+    // recurrent primitives produce values in [-1, 1], so the absolute error is checked
+    static constexpr float threshold = 0.05f;
+
+    std::shared_ptr<ngraph::Function> function;
+    SequenceType sequenceType;
+    ExecutionMode mode;
+    SizeVector shape;
+
+    void SetUp() override {
+        std::tie(sequenceType, mode, shape) = GetParam();
+        function = makeFunction(sequenceType, mode == ExecutionMode::Quantized, shape);
+    }
+
+    // LSTM sequences are executed with u8 data after quantized data, other sequences stay in FP32
+    Precision getExpectedRuntimePrecision() const {
+        if (mode == ExecutionMode::BF16) {
+            return Precision::BF16;
+        }
+        return sequenceType == SequenceType::LSTM ? Precision::U8 : Precision::FP32;
+    }
+
+    // weights in [-0.25, 0.25] keep gates out of saturation
+    static std::shared_ptr<ngraph::Node> makeWeights(const SizeVector& weightsShape, bool quantized) {
+        std::vector<float> values(ngraph::shape_size(weightsShape));
+        for (size_t i = 0; i < values.size(); i++) {
+            values[i] = static_cast<float>(static_cast<int>(i * 37 % 21) - 10) / 40.f;
+        }
+        const auto weights = ngraph::builder::makeConstant(ngraph::element::f32, weightsShape, values);
+        if (!quantized) {
+            return weights;
+        }
+        return ngraph::builder::makeFakeQuantize(weights, ngraph::element::f32, 255, {}, {-0.25f}, {0.25f}, {-0.25f}, {0.25f});
+    }
+
+    static std::shared_ptr<ngraph::Function> makeFunction(SequenceType sequenceType, bool quantized, const SizeVector& shape) {
+        const size_t batch = shape[0], inputSize = shape[2];
+        const size_t gates = sequenceType == SequenceType::LSTM ? 4 : 3;
+
+        auto param = std::make_shared<ngraph::opset1::Parameter>(ngraph::element::f32, ngraph::Shape(shape));
+        param->set_friendly_name("input");
+        ngraph::Output<ngraph::Node> data = param;
+        if (quantized) {
+            // u8 interval covers the hidden state values, as the data quantization is reused for the hidden state
+            data = ngraph::builder::makeFakeQuantize(param, ngraph::element::f32, 256, {}, {-1.28f}, {1.27f}, {-1.28f}, {1.27f});
+        }
+
+        const auto initialState = ngraph::opset1::Constant::create(ngraph::element::f32, {batch, 1, hiddenSize}, {0.f});
+        const auto sequenceLengths = ngraph::opset1::Constant::create(ngraph::element::i32, {batch}, {shape[1]});
+        const auto weights = makeWeights({1, gates * hiddenSize, inputSize}, quantized);
+        const auto recurrentWeights = makeWeights({1, gates * hiddenSize, hiddenSize}, quantized);
+        const auto bias = ngraph::opset1::Constant::create(ngraph::element::f32, {1, gates * hiddenSize}, {0.1f});
+
+        std::shared_ptr<ngraph::Node> sequence;
+        if (sequenceType == SequenceType::LSTM) {
+            sequence = std::make_shared<ngraph::opset5::LSTMSequence>(
+                data, initialState, initialState, sequenceLengths, weights, recurrentWeights, bias,
+                hiddenSize, ngraph::op::RecurrentSequenceDirection::FORWARD);
+        } else {
+            sequence = std::make_shared<ngraph::opset5::GRUSequence>(
+                data, initialState, sequenceLengths, weights, recurrentWeights, bias,
+                hiddenSize, ngraph::op::RecurrentSequenceDirection::FORWARD);
+        }
+        sequence->set_friendly_name("sequence");
+
+        auto result = std::make_shared<ngraph::opset1::Result>(sequence->output(0));
+        return std::make_shared<ngraph::Function>(ngraph::ResultVector{result}, ngraph::ParameterVector{param}, "RecurrentSequence");
+    }
+
+    bool isSupported() const {
+        return mode != ExecutionMode::BF16 || with_cpu_x86_avx512_core();
+    }
+
+    std::map<std::string, std::string> getConfig() const {
+        if (mode == ExecutionMode::BF16) {
+            return {{PluginConfigParams::KEY_ENFORCE_BF16, PluginConfigParams::YES}};
+        }
+        return {{PluginConfigParams::KEY_ENFORCE_BF16, PluginConfigParams::NO}};
+    }
+
+    // FP32 execution without low precision transformations
+    static std::map<std::string, std::string> getReferenceConfig() {
+        return {{PluginConfigParams::KEY_ENFORCE_BF16, PluginConfigParams::NO},
+                {PluginConfigInternalParams::KEY_LP_TRANSFORMS_MODE, PluginConfigParams::NO}};
+    }
+
+    Blob::Ptr createInput() const {
+        return FuncTestUtils::createAndFillBlobFloat(TensorDesc(Precision::FP32, shape, Layout::CHW), 2, -1, 100);
+    }
+
+    static Precision getSequenceRuntimePrecision(ExecutableNetwork& execNetwork) {
+        auto execFunction = execNetwork.GetExecGraphInfo().getFunction();
+        IE_ASSERT(nullptr != execFunction);
+        auto getExecValue = [](const std::shared_ptr<ngraph::Node>& node, const std::string& name) {
+            const auto& rtInfo = node->get_rt_info();
+            auto it = rtInfo.find(name);
+            IE_ASSERT(rtInfo.end() != it);
+            auto value = std::dynamic_pointer_cast<ngraph::VariantImpl<std::string>>(it->second);
+            IE_ASSERT(nullptr != value);
+            return value->get();
+        };
+        for (const auto& node : execFunction->get_ops()) {
+            if (getExecValue(node, ExecGraphInfoSerialization::LAYER_TYPE) == "RNNSeq") {
+                return Precision::FromStr(getExecValue(node, ExecGraphInfoSerialization::RUNTIME_PRECISION));
+            }
+        }
+        return Precision::UNSPECIFIED;
+    }
+};
+
+TEST_P(RecurrentSequencePrecisionTest, CompareWithFP32) {
+    SKIP_IF_CURRENT_TEST_IS_DISABLED()
+
+    if (!isSupported()) {
+        GTEST_SKIP();
+    }
+
+    auto ie = PluginCache::get().ie();
+    CNNNetwork network(function);
+    const auto input = createInput();
+
+    auto execNetwork = ie->LoadNetwork(network, CommonTestUtils::DEVICE_CPU, getConfig());
+    ASSERT_EQ(getExpectedRuntimePrecision(), getSequenceRuntimePrecision(execNetwork));
+    auto request = execNetwork.CreateInferRequest();
+    request.SetBlob("input", input);
+    request.Infer();
+    const std::string output = network.getOutputsInfo().begin()->first;
+    const auto actual = request.GetBlob(output);
+
+    auto referenceRequest = ie->LoadNetwork(network, CommonTestUtils::DEVICE_CPU, getReferenceConfig()).CreateInferRequest();
+    referenceRequest.SetBlob("input", input);
+    referenceRequest.Infer();
+    const auto expected = referenceRequest.GetBlob(output);
+
+    ASSERT_EQ(expected->getTensorDesc().getDims(), actual->getTensorDesc().getDims());
+    FuncTestUtils::compareRawBuffers(actual->cbuffer().as<const float*>(), expected->cbuffer().as<const float*>(),
+                                     actual->size(), expected->size(), FuncTestUtils::CompareType::ABS, threshold);
+}
+
+// Benchmark of the sequence against FP32 execution, disabled by default
+TEST_P(RecurrentSequencePrecisionTest, DISABLED_Performance) {
+    if (!isSupported()) {
+        GTEST_SKIP();
+    }
+
+    auto ie = PluginCache::get().ie();
+    CNNNetwork network(function);
+    const auto input = createInput();
+
+    auto measureMicros = [&](const std::map<std::string, std::string>& config) {
+        auto request = ie->LoadNetwork(network, CommonTestUtils::DEVICE_CPU, config).CreateInferRequest();
+        request.SetBlob("input", input);
+        request.Infer();
+
+        const int iterations = 100;
+        auto start = std::chrono::high_resolution_clock::now();
+        for (int i = 0; i < iterations; i++) {
+            request.Infer();
+        }
+        auto finish = std::chrono::high_resolution_clock::now();
+        return std::chrono::duration_cast<std::chrono::microseconds>(finish - start).count() / iterations;
+    };
+
+    std::cout << "Sequence average execution time : " << measureMicros(getConfig())
+              << " micros, FP32 : " << measureMicros(getReferenceConfig()) << " micros" << std::endl;
+}
+
+namespace {
+
+const std::vector<SequenceType> sequenceTypes = {
+        SequenceType::LSTM,
+        SequenceType::GRU,
+};
+
+const std::vector<ExecutionMode> modes = {
+        ExecutionMode::BF16,
+        ExecutionMode::Quantized,
+};
+
+const std::vector<SizeVector> shapes = {
+        {1, 10, 16},
+        {4, 5, 64},
+        {1, 25, 125},
+};
+
+INSTANTIATE_TEST_CASE_P(smoke_RecurrentSequencePrecision, RecurrentSequencePrecisionTest,
+                        ::testing::Combine(
+                                ::testing::ValuesIn(sequenceTypes),
+                                ::testing::ValuesIn(modes),
+                                ::testing::ValuesIn(shapes)),
+                        RecurrentSequencePrecisionTest::getTestCaseName);
+
+}  // namespace
+}  // namespace CPUSubgraphTestsDefinitions
@@ -0,0 +1,194 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <map>
+#include <string>
+#include <tuple>
+#include <vector>
+#include <memory>
+
+#include <gtest/gtest.h>
+#include <ie_plugin_config.hpp>
+#include <cpp_interfaces/interface/ie_internal_plugin_config.hpp>
+#include <exec_graph_info.hpp>
+#include <ngraph/opsets/opset1.hpp>
+#include <ngraph/variant.hpp>
+
+#include "common_test_utils/test_common.hpp"
+#include "common_test_utils/test_constants.hpp"
+#include "common_test_utils/common_utils.hpp"
+#include "functional_test_utils/plugin_cache.hpp"
+#include "functional_test_utils/blob_utils.hpp"
+#include "functional_test_utils/skip_tests_config.hpp"
+
+using namespace InferenceEngine;
+
+namespace CPUSubgraphTestsDefinitions {
+
+// first input shape, second input shape broadcasted to the first one
+typedef std::tuple<SizeVector, SizeVector> SnippetsEltwiseParams;
+
+/* Branching elementwise subgraph tokenized into a single snippet with two outputs
+
+    Parameter   Parameter
+         \       /
+           Add      Constant
+          /    \       /
+       Relu    Multiply
+        |         |
+     Result     Clamp
+                  |
+                Result
+*/
+class SnippetsEltwiseTest : public testing::WithParamInterface<SnippetsEltwiseParams>,
+                            public CommonTestUtils::TestsCommon {
+public:
+    static std::string getTestCaseName(const testing::TestParamInfo<SnippetsEltwiseParams> &obj) {
+        SizeVector shape0, shape1;
+        std::tie(shape0, shape1) = obj.param;
+        std::ostringstream result;
+        result << "IS0=" << CommonTestUtils::vec2str(shape0) << "_";
+        result << "IS1=" << CommonTestUtils::vec2str(shape1);
+        return result.str();
+    }
+
+protected:
+    std::shared_ptr<ngraph::Function> function;
+
+    void SetUp() override {
+        SizeVector shape0, shape1;
+        std::tie(shape0, shape1) = GetParam();
+
+        auto param0 = std::make_shared<ngraph::opset1::Parameter>(ngraph::element::f32, ngraph::Shape(shape0));
+        param0->set_friendly_name("input0");
+        auto param1 = std::make_shared<ngraph::opset1::Parameter>(ngraph::element::f32, ngraph::Shape(shape1));
+        param1->set_friendly_name("input1");
+        auto add = std::make_shared<ngraph::opset1::Add>(param0, param1);
+        auto relu = std::make_shared<ngraph::opset1::Relu>(add);
+        relu->set_friendly_name("output0");
+        auto scale = ngraph::opset1::Constant::create(ngraph::element::f32, {1}, {0.5f});
+        auto multiply = std::make_shared<ngraph::opset1::Multiply>(add, scale);
+        auto clamp = std::make_shared<ngraph::opset1::Clamp>(multiply, -1.0, 1.0);
+        clamp->set_friendly_name("output1");
+
+        function = std::make_shared<ngraph::Function>(ngraph::ResultVector{std::make_shared<ngraph::opset1::Result>(relu),
+                                                                           std::make_shared<ngraph::opset1::Result>(clamp)},
+                                                      ngraph::ParameterVector{param0, param1}, "SnippetsEltwise");
+    }
+
+    std::vector<Blob::Ptr> infer(const std::map<std::string, std::string>& config, const BlobMap& inputs) {
+        auto ie = PluginCache::get().ie();
+        CNNNetwork network(function);
+        auto request = ie->LoadNetwork(network, CommonTestUtils::DEVICE_CPU, config).CreateInferRequest();
+        for (const auto& input : inputs)
+            request.SetBlob(input.first, input.second);
+        request.Infer();
+        return {request.GetBlob("output0"), request.GetBlob("output1")};
+    }
+};
+
+TEST_P(SnippetsEltwiseTest, CompareWithNotTokenized) {
+    SKIP_IF_CURRENT_TEST_IS_DISABLED()
+
+    SizeVector shape0, shape1;
+    std::tie(shape0, shape1) = GetParam();
+    BlobMap inputs = {
+        {"input0", FuncTestUtils::createAndFillBlobFloat(TensorDesc(Precision::FP32, shape0, TensorDesc::getLayoutByDims(shape0)), 10, -5)},
+        {"input1", FuncTestUtils::createAndFillBlobFloat(TensorDesc(Precision::FP32, shape1, TensorDesc::getLayoutByDims(shape1)), 10, -5)}
+    };
+
+    auto actual = infer({{PluginConfigInternalParams::KEY_SNIPPETS_MODE, PluginConfigParams::YES}}, inputs);
+    auto expected = infer({{PluginConfigInternalParams::KEY_SNIPPETS_MODE, PluginConfigParams::NO}}, inputs);
+
+    ASSERT_EQ(expected.size(), actual.size());
+    for (size_t i = 0; i < actual.size(); i++) {
+        ASSERT_EQ(expected[i]->getTensorDesc().getDims(), actual[i]->getTensorDesc().getDims());
+        FuncTestUtils::compareRawBuffers(actual[i]->cbuffer().as<const float*>(), expected[i]->cbuffer().as<const float*>(),
+                                         actual[i]->size(), expected[i]->size(), 1e-5f);
+    }
+}
+
+static size_t countSubgraphs(ExecutableNetwork& execNetwork) {
+    auto function = execNetwork.GetExecGraphInfo().getFunction();
+    IE_ASSERT(nullptr != function);
+    size_t count = 0;
+    for (const auto& node : function->get_ops()) {
+        const auto& rtInfo = node->get_rt_info();
+        auto it = rtInfo.find(ExecGraphInfoSerialization::LAYER_TYPE);
+        IE_ASSERT(rtInfo.end() != it);
+        auto value = std::dynamic_pointer_cast<ngraph::VariantImpl<std::string>>(it->second);
+        IE_ASSERT(nullptr != value);
+        if (value->get() == "Subgraph")
+            count++;
+    }
+    return count;
+}
+
+/* Element-wise operations after a convolution are left to the convolution post ops
+
+    Parameter   Constant
+         \       /
+        Convolution   Constant
+               \       /
+                  Add
+                   |
+                  Relu
+                   |
+                 Result
+*/
+TEST(SnippetsTokenizationTest, PostOpsOfConvolutionAreNotTokenized) {
+    SKIP_IF_CURRENT_TEST_IS_DISABLED()
+
+    auto param = std::make_shared<ngraph::opset1::Parameter>(ngraph::element::f32, ngraph::Shape{1, 8, 10, 10});
+    auto weights = ngraph::opset1::Constant::create(ngraph::element::f32, {16, 8, 3, 3}, std::vector<float>(16 * 8 * 3 * 3, 0.1f));
+    auto conv = std::make_shared<ngraph::opset1::Convolution>(param, weights, ngraph::Strides{1, 1}, ngraph::CoordinateDiff{1, 1},
+                                                              ngraph::CoordinateDiff{1, 1}, ngraph::Strides{1, 1});
+    auto bias = ngraph::opset1::Constant::create(ngraph::element::f32, {1, 16, 1, 1}, std::vector<float>(16, -1.f));
+    auto add = std::make_shared<ngraph::opset1::Add>(conv, bias);
+    auto relu = std::make_shared<ngraph::opset1::Relu>(add);
+    auto function = std::make_shared<ngraph::Function>(ngraph::ResultVector{std::make_shared<ngraph::opset1::Result>(relu)},
+                                                       ngraph::ParameterVector{param}, "ConvolutionWithPostOps");
+
+    auto ie = PluginCache::get().ie();
+    auto execNetwork = ie->LoadNetwork(CNNNetwork(function), CommonTestUtils::DEVICE_CPU,
+                                       {{PluginConfigInternalParams::KEY_SNIPPETS_MODE, PluginConfigParams::YES}});
+    ASSERT_EQ(0u, countSubgraphs(execNetwork));
+}
+
+// Subgraph node executes snippets in FP32 only
+TEST(SnippetsTokenizationTest, IntegerOperationsAreNotTokenized) {
+    SKIP_IF_CURRENT_TEST_IS_DISABLED()
+
+    auto param0 = std::make_shared<ngraph::opset1::Parameter>(ngraph::element::i32, ngraph::Shape{1, 3, 10, 19});
+    auto param1 = std::make_shared<ngraph::opset1::Parameter>(ngraph::element::i32, ngraph::Shape{1, 3, 10, 19});
+    auto add = std::make_shared<ngraph::opset1::Add>(param0, param1);
+    auto multiply = std::make_shared<ngraph::opset1::Multiply>(add, param1);
+    auto function = std::make_shared<ngraph::Function>(ngraph::ResultVector{std::make_shared<ngraph::opset1::Result>(multiply)},
+                                                       ngraph::ParameterVector{param0, param1}, "IntegerEltwise");
+
+    auto ie = PluginCache::get().ie();
+    auto execNetwork = ie->LoadNetwork(CNNNetwork(function), CommonTestUtils::DEVICE_CPU,
+                                       {{PluginConfigInternalParams::KEY_SNIPPETS_MODE, PluginConfigParams::YES}});
+    ASSERT_EQ(0u, countSubgraphs(execNetwork));
+}
+
+namespace {
+
+const std::vector<SnippetsEltwiseParams> shapes = {
+        // same shapes, vector loop with a tail
+        {{1, 3, 10, 19}, {1, 3, 10, 19}},
+        // broadcasting over outer dimensions
+        {{2, 8, 16, 16}, {1, 8, 1, 16}},
+        // broadcasting over the innermost dimension
+        {{1, 16, 7, 7}, {1, 16, 7, 1}},
+        // inputs of different ranks
+        {{4, 33}, {33}},
+};
+
+INSTANTIATE_TEST_CASE_P(smoke_SnippetsEltwise, SnippetsEltwiseTest,
+                        ::testing::ValuesIn(shapes),
+                        SnippetsEltwiseTest::getTestCaseName);
+
+}  // namespace
+}  // namespace CPUSubgraphTestsDefinitions
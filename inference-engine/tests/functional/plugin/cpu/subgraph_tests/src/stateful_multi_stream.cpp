@@ -0,0 +1,134 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <algorithm>
+#include <map>
+#include <string>
+#include <vector>
+#include <memory>
+
+#include <gtest/gtest.h>
+#include <ie_plugin_config.hpp>
+#include <ngraph/opsets/opset3.hpp>
+
+#include "common_test_utils/test_common.hpp"
+#include "common_test_utils/test_constants.hpp"
+#include "functional_test_utils/plugin_cache.hpp"
+#include "functional_test_utils/skip_tests_config.hpp"
+
+using namespace InferenceEngine;
+
+namespace CPUSubgraphTestsDefinitions {
+
+typedef std::map<std::string, std::string> StatefulMultiStreamParams;
+
+/* Accumulates the inputs of all inferences in the variable state
+
+        Parameter [1, 16]    ReadValue "acc"
+                 \          /
+                     Add
+                   /     \
+              Assign      Relu
+              "acc"         |
+                          Result
+*/
+class StatefulMultiStreamTest : public testing::WithParamInterface<StatefulMultiStreamParams>,
+                                public CommonTestUtils::TestsCommon {
+public:
+    static std::string getTestCaseName(const testing::TestParamInfo<StatefulMultiStreamParams> &obj) {
+        std::ostringstream result;
+        result << "config";
+        for (const auto& item : obj.param) {
+            result << "_" << item.first << "=" << item.second;
+        }
+        return result.str();
+    }
+
+protected:
+    const size_t size = 16;
+    std::shared_ptr<ngraph::Function> function;
+
+    void SetUp() override {
+        ngraph::Shape shape{1, size};
+        auto input = std::make_shared<ngraph::opset3::Parameter>(ngraph::element::f32, shape);
+        input->set_friendly_name("input");
+        auto init = ngraph::opset3::Constant::create(ngraph::element::f32, shape, {0});
+        auto readValue = std::make_shared<ngraph::opset3::ReadValue>(init, "acc");
+        auto add = std::make_shared<ngraph::opset3::Add>(readValue, input);
+        auto assign = std::make_shared<ngraph::opset3::Assign>(add, "acc");
+        auto relu = std::make_shared<ngraph::opset3::Relu>(add);
+        relu->set_friendly_name("output");
+
+        // WA. Limitation of ngraph. control_dependency are required.
+        assign->add_control_dependency(readValue);
+        relu->add_control_dependency(assign);
+
+        function = std::make_shared<ngraph::Function>(ngraph::NodeVector{relu}, ngraph::ParameterVector{input},
+                                                      "StatefulMultiStream");
+    }
+
+    static void fill(const Blob::Ptr& blob, float value) {
+        auto data = blob->buffer().as<float*>();
+        std::fill(data, data + blob->size(), value);
+    }
+
+    static void check(const Blob::CPtr& blob, float expected) {
+        auto data = blob->cbuffer().as<const float*>();
+        for (size_t i = 0; i < blob->size(); i++)
+            ASSERT_NEAR(expected, data[i], 1e-5f) << "at index " << i;
+    }
+};
+
+TEST_P(StatefulMultiStreamTest, ConcurrentRequestsKeepOwnStates) {
+    SKIP_IF_CURRENT_TEST_IS_DISABLED()
+
+    auto ie = PluginCache::get().ie();
+    CNNNetwork network(function);
+    auto execNetwork = ie->LoadNetwork(network, CommonTestUtils::DEVICE_CPU, GetParam());
+
+    const size_t numRequests = 4;
+    const size_t numIterations = 3;
+    std::vector<InferRequest> requests;
+    for (size_t r = 0; r < numRequests; r++) {
+        requests.push_back(execNetwork.CreateInferRequest());
+        fill(requests.back().GetBlob("input"), static_cast<float>(r + 1));
+    }
+
+    for (size_t it = 1; it <= numIterations; it++) {
+        for (auto& request : requests)
+            request.StartAsync();
+        for (auto& request : requests)
+            request.Wait(IInferRequest::WaitMode::RESULT_READY);
+
+        for (size_t r = 0; r < numRequests; r++) {
+            float expected = static_cast<float>((r + 1) * it);
+            check(requests[r].GetBlob("output"), expected);
+            auto states = requests[r].QueryState();
+            ASSERT_EQ(1u, states.size());
+            check(states.front().GetState(), expected);
+        }
+    }
+
+    // Reset of one session doesn't affect the others
+    requests.front().QueryState().front().Reset();
+    for (auto& request : requests)
+        request.Infer();
+    check(requests[0].GetBlob("output"), 1.f);
+    check(requests[1].GetBlob("output"), 2.f * (numIterations + 1));
+}
+
+namespace {
+
+const std::vector<StatefulMultiStreamParams> configs = {
+        {},
+        {{PluginConfigParams::KEY_CPU_THROUGHPUT_STREAMS, "2"}},
+        {{PluginConfigParams::KEY_CPU_THROUGHPUT_STREAMS, "4"}}
+};
+
+INSTANTIATE_TEST_CASE_P(smoke_StatefulMultiStream, StatefulMultiStreamTest,
+                        ::testing::ValuesIn(configs),
+                        StatefulMultiStreamTest::getTestCaseName);
+
+}  // namespace
+}  // namespace CPUSubgraphTestsDefinitions
@@ -0,0 +1,261 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <map>
+#include <memory>
+#include <sstream>
+#include <string>
+#include <tuple>
+#include <vector>
+
+#include <gtest/gtest.h>
+#include <ngraph/opsets/opset5.hpp>
+#include <ngraph/variant.hpp>
+
+#include "common_test_utils/test_common.hpp"
+#include "common_test_utils/test_constants.hpp"
+#include "functional_test_utils/plugin_cache.hpp"
+#include "functional_test_utils/blob_utils.hpp"
+#include "functional_test_utils/skip_tests_config.hpp"
+
+using namespace InferenceEngine;
+
+namespace CPUSubgraphTestsDefinitions {
+
+enum class SubgraphType {
+    TensorIterator,
+    Loop,
+};
+
+enum class BodyType {
+    Plain,    // body ports are bound to the outer tensors and back edges swap buffers
+    InPlace,  // Reshape nodes share port buffers, so the body falls back to copies
+    Split,    // not in-place Split produces the back edge and the sliced outputs which are bound to the outer tensors
+};
+
+// subgraph type, reverse iteration order, number of iterations, body type
+typedef std::tuple<SubgraphType, bool, size_t, BodyType> TensorIteratorZeroCopyParams;
+
+/* TensorIterator or Loop with two back edges, the body output of the first one is also a port output
+
+    data [T, C]   h0 [1, C]   g0 [1, C]
+          \          |          /
+       ____*_________*_________*____
+      |    x         h         g    |
+      |                             |
+      |    h' = h + x               |  back edge h' -> h, port outputs: last h' and h' slices
+      |    g' = 0.5 * g + h         |  back edge g' -> g, port output: last g'
+      |    y  = x * h               |  port output: y slices
+      |_____________________________|
+
+   The in-place body slices data [1, T, C] along axis 1 and reshapes x, y and h' slices with Reshape nodes.
+   The Split body slices data [T, 2, C], state shape is [1, 1, C] and h' with y are outputs of Split:
+   h', y = Split(x + h) along axis 1.
+*/
+class TensorIteratorZeroCopyTest : public testing::WithParamInterface<TensorIteratorZeroCopyParams>,
+                                   public CommonTestUtils::TestsCommon {
+public:
+    static std::string getTestCaseName(const testing::TestParamInfo<TensorIteratorZeroCopyParams> &obj) {
+        SubgraphType subgraphType;
+        bool reverse;
+        size_t iterations;
+        BodyType bodyType;
+        std::tie(subgraphType, reverse, iterations, bodyType) = obj.param;
+        std::ostringstream result;
+        result << (subgraphType == SubgraphType::TensorIterator ? "TensorIterator" : "Loop") << "_";
+        result << (reverse ? "Reverse" : "Forward") << "_";
+        result << "iterations=" << iterations << "_";
+        result << (bodyType == BodyType::Plain ? "Plain" : bodyType == BodyType::InPlace ? "InPlace" : "Split");
+        return result.str();
+    }
+
+protected:
+    static constexpr size_t channels = 12;
+
+    std::shared_ptr<ngraph::Function> function;
+    bool reverse;
+    size_t iterations;
+    BodyType bodyType;
+    SizeVector dataShape;
+    SizeVector stateShape;
+
+    void SetUp() override {
+        SubgraphType subgraphType;
+        std::tie(subgraphType, reverse, iterations, bodyType) = GetParam();
+
+        const bool inPlace = bodyType == BodyType::InPlace;
+        const bool split = bodyType == BodyType::Split;
+        const int64_t axis = inPlace ? 1 : 0;
+        ngraph::Shape chunkShape;
+        if (inPlace) {
+            dataShape = {1, iterations, channels};
+            chunkShape = {1, 1, channels};
+            stateShape = {1, channels};
+        } else if (split) {
+            dataShape = {iterations, 2, channels};
+            chunkShape = {1, 2, channels};
+            stateShape = {1, 1, channels};
+        } else {
+            dataShape = {iterations, channels};
+            chunkShape = {1, channels};
+            stateShape = {1, channels};
+        }
+
+        auto data = std::make_shared<ngraph::opset5::Parameter>(ngraph::element::f32, ngraph::Shape(dataShape));
+        data->set_friendly_name("data");
+        auto h0 = std::make_shared<ngraph::opset5::Parameter>(ngraph::element::f32, ngraph::Shape(stateShape));
+        h0->set_friendly_name("h0");
+        auto g0 = std::make_shared<ngraph::opset5::Parameter>(ngraph::element::f32, ngraph::Shape(stateShape));
+        g0->set_friendly_name("g0");
+
+        auto bodyData = std::make_shared<ngraph::opset5::Parameter>(ngraph::element::f32, chunkShape);
+        auto bodyH = std::make_shared<ngraph::opset5::Parameter>(ngraph::element::f32, ngraph::Shape(stateShape));
+        auto bodyG = std::make_shared<ngraph::opset5::Parameter>(ngraph::element::f32, ngraph::Shape(stateShape));
+
+        auto reshape = [](const ngraph::Output<ngraph::Node>& value, const ngraph::Shape& shape) -> ngraph::Output<ngraph::Node> {
+            const auto pattern = ngraph::opset5::Constant::create(ngraph::element::i64, {shape.size()}, shape);
+            return std::make_shared<ngraph::opset5::Reshape>(value, pattern, false);
+        };
+
+        const auto x = inPlace ? reshape(bodyData, ngraph::Shape(stateShape)) : bodyData->output(0);
+        const auto halfG = std::make_shared<ngraph::opset5::Multiply>(
+                bodyG, ngraph::opset5::Constant::create(ngraph::element::f32, {1}, {0.5f}));
+        const auto g = std::make_shared<ngraph::opset5::Add>(halfG, bodyH);
+        ngraph::Output<ngraph::Node> h, y;
+        if (split) {
+            const auto sum = std::make_shared<ngraph::opset5::Add>(x, bodyH);
+            const auto splitAxis = ngraph::opset5::Constant::create(ngraph::element::i64, {}, {1});
+            const auto splitNode = std::make_shared<ngraph::opset5::Split>(sum, splitAxis, 2);
+            // the reference implementation copies data to output buffers instead of sharing the input buffer in place
+            splitNode->get_rt_info()["PrimitivesPriority"] = std::make_shared<ngraph::VariantWrapper<std::string>>("cpu:ref");
+            h = splitNode->output(0);
+            y = splitNode->output(1);
+        } else {
+            h = std::make_shared<ngraph::opset5::Add>(bodyH, x);
+            y = std::make_shared<ngraph::opset5::Multiply>(x, bodyH);
+        }
+
+        auto hResult = std::make_shared<ngraph::opset5::Result>(h);
+        auto gResult = std::make_shared<ngraph::opset5::Result>(g);
+        auto hSliceResult = inPlace ? std::make_shared<ngraph::opset5::Result>(reshape(h, chunkShape)) : hResult;
+        auto yResult = std::make_shared<ngraph::opset5::Result>(inPlace ? reshape(y, chunkShape) : y);
+
+        ngraph::ResultVector bodyResults = {hResult, gResult, yResult};
+        if (inPlace) {
+            bodyResults.push_back(hSliceResult);
+        }
+
+        std::shared_ptr<ngraph::op::util::SubGraphOp> subgraph;
+        if (subgraphType == SubgraphType::TensorIterator) {
+            subgraph = std::make_shared<ngraph::opset5::TensorIterator>();
+        } else {
+            const auto tripCount = ngraph::opset5::Constant::create(ngraph::element::i64, {}, {iterations});
+            const auto executionCondition = ngraph::opset5::Constant::create(ngraph::element::boolean, {}, {true});
+            auto loop = std::make_shared<ngraph::opset5::Loop>(tripCount, executionCondition);
+            bodyResults.push_back(std::make_shared<ngraph::opset5::Result>(
+                    ngraph::opset5::Constant::create(ngraph::element::boolean, {}, {true})));
+            loop->set_special_body_ports({-1, static_cast<int64_t>(bodyResults.size()) - 1});
+            subgraph = loop;
+        }
+        subgraph->set_friendly_name("subgraph");
+        subgraph->set_function(std::make_shared<ngraph::Function>(bodyResults, ngraph::ParameterVector{bodyData, bodyH, bodyG}));
+
+        const int64_t start = reverse ? -1 : 0;
+        const int64_t stride = reverse ? -1 : 1;
+        const int64_t end = reverse ? 0 : -1;
+        subgraph->set_sliced_input(bodyData, data, start, stride, 1, end, axis);
+        subgraph->set_merged_input(bodyH, h0, hResult);
+        subgraph->set_merged_input(bodyG, g0, gResult);
+        subgraph->get_concatenated_slices(yResult, start, stride, 1, end, axis);
+        subgraph->get_iter_value(hResult, -1);
+        subgraph->get_iter_value(gResult, -1);
+        subgraph->get_concatenated_slices(hSliceResult, start, stride, 1, end, axis);
+        subgraph->validate_and_infer_types();
+
+        ngraph::ResultVector results;
+        for (const auto& output : subgraph->outputs()) {
+            results.push_back(std::make_shared<ngraph::opset5::Result>(output));
+        }
+        function = std::make_shared<ngraph::Function>(results, ngraph::ParameterVector{data, h0, g0}, "TensorIteratorZeroCopy");
+    }
+
+    static Blob::Ptr createBlob(const SizeVector& shape, int32_t seed) {
+        return FuncTestUtils::createAndFillBlobFloat(TensorDesc(Precision::FP32, shape, TensorDesc::getLayoutByDims(shape)),
+                                                     2, -1, 100, seed);
+    }
+
+    // computes outputs of the subgraph in order of its ports: y slices, last h', last g', h' slices
+    std::vector<std::vector<float>> computeReference(const Blob::Ptr& data, const Blob::Ptr& h0, const Blob::Ptr& g0) const {
+        const auto dataPtr = data->cbuffer().as<const float*>();
+        const size_t chunkSize = bodyType == BodyType::Split ? 2 * channels : channels;
+        std::vector<float> h(h0->cbuffer().as<const float*>(), h0->cbuffer().as<const float*>() + channels);
+        std::vector<float> g(g0->cbuffer().as<const float*>(), g0->cbuffer().as<const float*>() + channels);
+        std::vector<float> ySlices(iterations * channels), hSlices(iterations * channels);
+        for (size_t i = 0; i < iterations; i++) {
+            const size_t t = reverse ? iterations - 1 - i : i;
+            for (size_t c = 0; c < channels; c++) {
+                const float x = dataPtr[t * chunkSize + c];
+                ySlices[t * channels + c] = bodyType == BodyType::Split ? dataPtr[t * chunkSize + channels + c] + h[c] : x * h[c];
+                g[c] = g[c] * 0.5f + h[c];
+                h[c] = h[c] + x;
+                hSlices[t * channels + c] = h[c];
+            }
+        }
+        return {ySlices, h, g, hSlices};
+    }
+};
+
+TEST_P(TensorIteratorZeroCopyTest, CompareWithReference) {
+    SKIP_IF_CURRENT_TEST_IS_DISABLED()
+
+    auto ie = PluginCache::get().ie();
+    CNNNetwork network(function);
+    auto request = ie->LoadNetwork(network, CommonTestUtils::DEVICE_CPU).CreateInferRequest();
+
+    // the second inference checks that buffers swapped by back edges after odd number of iterations are restored
+    for (int32_t seed : {1, 2}) {
+        const auto data = createBlob(dataShape, seed);
+        const auto h0 = createBlob(stateShape, seed + 10);
+        const auto g0 = createBlob(stateShape, seed + 20);
+        request.SetBlob("data", data);
+        request.SetBlob("h0", h0);
+        request.SetBlob("g0", g0);
+        request.Infer();
+
+        const auto expected = computeReference(data, h0, g0);
+        for (size_t i = 0; i < expected.size(); i++) {
+            const auto actual = request.GetBlob("subgraph." + std::to_string(i));
+            ASSERT_EQ(expected[i].size(), actual->size()) << "output " << i;
+            FuncTestUtils::compareRawBuffers(actual->cbuffer().as<const float*>(), expected[i].data(),
+                                             actual->size(), expected[i].size(), FuncTestUtils::CompareType::ABS, 1e-5f);
+        }
+    }
+}
+
+namespace {
+
+const std::vector<SubgraphType> subgraphTypes = {
+        SubgraphType::TensorIterator,
+        SubgraphType::Loop,
+};
+
+// odd numbers of iterations leave back edge buffers swapped after the inference
+const std::vector<size_t> iterations = {1, 4, 5};
+
+const std::vector<BodyType> bodyTypes = {
+        BodyType::Plain,
+        BodyType::InPlace,
+        BodyType::Split,
+};
+
+INSTANTIATE_TEST_CASE_P(smoke_TensorIteratorZeroCopy, TensorIteratorZeroCopyTest,
+                        ::testing::Combine(
+                                ::testing::ValuesIn(subgraphTypes),
+                                ::testing::Values(false, true),
+                                ::testing::ValuesIn(iterations),
+                                ::testing::ValuesIn(bodyTypes)),
+                        TensorIteratorZeroCopyTest::getTestCaseName);
+
+}  // namespace
+}  // namespace CPUSubgraphTestsDefinitions
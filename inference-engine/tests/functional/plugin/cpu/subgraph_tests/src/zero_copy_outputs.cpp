@@ -0,0 +1,107 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <map>
+#include <string>
+#include <vector>
+#include <memory>
+
+#include <gtest/gtest.h>
+#include <blob_factory.hpp>
+#include <ngraph/opsets/opset1.hpp>
+
+#include "common_test_utils/test_common.hpp"
+#include "common_test_utils/test_constants.hpp"
+#include "functional_test_utils/plugin_cache.hpp"
+#include "functional_test_utils/blob_utils.hpp"
+#include "functional_test_utils/skip_tests_config.hpp"
+
+using namespace InferenceEngine;
+
+namespace CPUSubgraphTestsDefinitions {
+
+/* Output blobs of matching precision are used as the memory of the graph output edges
+
+        Parameter [2, 8] (I32)
+            |
+          Add [8]
+            |
+          Result
+*/
+class ZeroCopyOutputsTest : public testing::WithParamInterface<Precision>,
+                            public CommonTestUtils::TestsCommon {
+public:
+    static std::string getTestCaseName(const testing::TestParamInfo<Precision> &obj) {
+        return std::string("netPRC=") + obj.param.name();
+    }
+
+protected:
+    const SizeVector shape = {2, 8};
+    std::shared_ptr<ngraph::Function> function;
+
+    void SetUp() override {
+        auto param = std::make_shared<ngraph::opset1::Parameter>(ngraph::element::i32, ngraph::Shape(shape));
+        param->set_friendly_name("input");
+        auto constant = ngraph::opset1::Constant::create(ngraph::element::i32, {shape[1]}, std::vector<int32_t>(shape[1], 5));
+        auto add = std::make_shared<ngraph::opset1::Add>(param, constant);
+        add->set_friendly_name("output");
+
+        function = std::make_shared<ngraph::Function>(ngraph::ResultVector{std::make_shared<ngraph::opset1::Result>(add)},
+                                                      ngraph::ParameterVector{param}, "ZeroCopyOutputs");
+    }
+
+    Blob::Ptr makeInput(int32_t start) const {
+        auto blob = make_shared_blob<int32_t>(TensorDesc(Precision::I32, shape, Layout::NC));
+        blob->allocate();
+        auto data = blob->buffer().as<int32_t*>();
+        for (size_t i = 0; i < blob->size(); i++)
+            data[i] = start + static_cast<int32_t>(i);
+        return blob;
+    }
+
+    void checkOutput(const Blob::Ptr& output, int32_t start) const {
+        for (size_t i = 0; i < output->size(); i++) {
+            auto value = output->getTensorDesc().getPrecision() == Precision::FP32 ?
+                         static_cast<int32_t>(output->cbuffer().as<const float*>()[i]) :
+                         output->cbuffer().as<const int32_t*>()[i];
+            ASSERT_EQ(start + static_cast<int32_t>(i) + 5, value) << "at index " << i;
+        }
+    }
+};
+
+TEST_P(ZeroCopyOutputsTest, RequestsOfOneStreamKeepOwnResults) {
+    SKIP_IF_CURRENT_TEST_IS_DISABLED()
+
+    auto ie = PluginCache::get().ie();
+    CNNNetwork network(function);
+    network.getInputsInfo().begin()->second->setPrecision(Precision::I32);
+    network.getOutputsInfo().begin()->second->setPrecision(GetParam());
+    auto execNetwork = ie->LoadNetwork(network, CommonTestUtils::DEVICE_CPU);
+
+    // Both requests share the graph of the single stream
+    auto request1 = execNetwork.CreateInferRequest();
+    auto request2 = execNetwork.CreateInferRequest();
+
+    auto output1 = make_blob_with_precision(TensorDesc(GetParam(), shape, Layout::NC));
+    output1->allocate();
+    request1.SetBlob("output", output1);
+
+    request1.SetBlob("input", makeInput(0));
+    request2.SetBlob("input", makeInput(100));
+    request1.Infer();
+    request2.Infer();
+
+    ASSERT_EQ(output1->buffer().as<void*>(), request1.GetBlob("output")->buffer().as<void*>());
+    checkOutput(output1, 0);
+    checkOutput(request2.GetBlob("output"), 100);
+}
+
+namespace {
+
+INSTANTIATE_TEST_CASE_P(smoke_ZeroCopyOutputs, ZeroCopyOutputsTest,
+                        ::testing::Values(Precision::I32, Precision::FP32),
+                        ZeroCopyOutputsTest::getTestCaseName);
+
+}  // namespace
+}  // namespace CPUSubgraphTestsDefinitions
@@ -0,0 +1,67 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <string>
+#include <vector>
+#include "base/multi/multi_helpers.hpp"
+#include "functional_test_utils/plugin_cache.hpp"
+
+TEST_P(MultiDevice_Test, canScheduleByThroughputAndReportStatistics) {
+    InferenceEngine::CNNNetwork net(fn_ptr);
+    auto ie = PluginCache::get().ie();
+    auto exec_net = ie->LoadNetwork(net, device_names, {
+        {MultiDeviceConfigParams::KEY_MULTI_SCHEDULING_POLICY, MultiDeviceConfigParams::MULTI_THROUGHPUT}});
+    ASSERT_EQ(MultiDeviceConfigParams::MULTI_THROUGHPUT,
+              exec_net.GetConfig(MultiDeviceConfigParams::KEY_MULTI_SCHEDULING_POLICY).as<std::string>());
+
+    const unsigned int numRequests = 2 * exec_net.GetMetric(METRIC_KEY(OPTIMAL_NUMBER_OF_INFER_REQUESTS)).as<unsigned int>();
+    const unsigned int numIterations = 3;
+    std::vector<InferRequest> requests;
+    for (unsigned int i = 0; i < numRequests; i++)
+        requests.push_back(exec_net.CreateInferRequest());
+    for (unsigned int it = 0; it < numIterations; it++) {
+        for (auto&& request : requests)
+            ASSERT_NO_THROW(request.StartAsync());
+        for (auto&& request : requests)
+            ASSERT_EQ(StatusCode::OK, request.Wait(IInferRequest::RESULT_READY));
+    }
+
+    using Statistics = std::map<std::string, std::map<std::string, double>>;
+    Statistics statistics;
+    ASSERT_NO_THROW(statistics = exec_net.GetMetric(MULTI_METRIC_KEY(DEVICE_STATISTICS)).as<Statistics>());
+    ASSERT_EQ(this->GetParam().size(), statistics.size());
+    double numCompleted = 0;
+    for (auto&& device : statistics) {
+        numCompleted += device.second.at("COMPLETED_REQUESTS");
+        EXPECT_EQ(0, device.second.at("BUSY_REQUESTS"));
+        EXPECT_LE(0, device.second.at("UTILIZATION"));
+        EXPECT_GE(1, device.second.at("UTILIZATION"));
+    }
+    EXPECT_EQ(numRequests * numIterations, numCompleted);
+}
+
+TEST_P(MultiDevice_Test, cannotLoadWithWrongSchedulingPolicy) {
+    InferenceEngine::CNNNetwork net(fn_ptr);
+    auto ie = PluginCache::get().ie();
+    ASSERT_THROW(ie->LoadNetwork(net, device_names, {{MultiDeviceConfigParams::KEY_MULTI_SCHEDULING_POLICY, "FASTEST"}}),
+                 InferenceEngine::details::InferenceEngineException);
+}
+
+TEST_P(MultiDevice_Test, canChangeSchedulingPolicyOfExecutableNetwork) {
+    InferenceEngine::CNNNetwork net(fn_ptr);
+    auto ie = PluginCache::get().ie();
+    auto exec_net = ie->LoadNetwork(net, device_names);
+    ASSERT_EQ(MultiDeviceConfigParams::MULTI_PRIORITY,
+              exec_net.GetConfig(MultiDeviceConfigParams::KEY_MULTI_SCHEDULING_POLICY).as<std::string>());
+
+    ASSERT_NO_THROW(exec_net.SetConfig({{MultiDeviceConfigParams::KEY_MULTI_SCHEDULING_POLICY,
+                                         MultiDeviceConfigParams::MULTI_THROUGHPUT}}));
+    ASSERT_EQ(MultiDeviceConfigParams::MULTI_THROUGHPUT,
+              exec_net.GetConfig(MultiDeviceConfigParams::KEY_MULTI_SCHEDULING_POLICY).as<std::string>());
+    ASSERT_THROW(exec_net.SetConfig({{MultiDeviceConfigParams::KEY_MULTI_SCHEDULING_POLICY, "FASTEST"}}),
+                 InferenceEngine::details::InferenceEngineException);
+
+    auto request = exec_net.CreateInferRequest();
+    ASSERT_NO_THROW(request.Infer());
+}
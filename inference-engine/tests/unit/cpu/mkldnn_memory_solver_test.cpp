@@ -273,3 +273,44 @@ TEST(MemSolverTest, BestSolution1) {
             ASSERT_TRUE(no_overlap(boxes[i], boxes[j])) << "Box overlapping is detected";
 }
 
+TEST(MemSolverTest, BestFitStrategy) {
+    // Boxes 2 and 3 share the space above box 1, because their live times do not intersect
+    int n = 0;
+    std::vector<Box> boxes{
+            {5, 5, 3, n++},
+            {2, 4, 4, n++},
+            {2, 3, 4, n++},
+            {4, 5, 2, n++},
+    };
+
+    using Strategy = MKLDNNPlugin::MemorySolver::Strategy;
+    MKLDNNPlugin::MemorySolver ms(boxes);
+    EXPECT_EQ(ms.solve(Strategy::BestFit), ms.maxDepth());
+
+    auto no_overlap = [&](Box box1, Box box2) -> bool {
+        int off1 = ms.getOffset(box1.id);
+        int off2 = ms.getOffset(box2.id);
+        return box1.finish < box2.start || box1.start > box2.finish ||
+               off1 + box1.size <= off2 || off1 >= off2 + box2.size;
+    };
+
+    for (int i = 0; i < n; i++)
+        for (int j = i + 1; j < n; j++)
+            ASSERT_TRUE(no_overlap(boxes[i], boxes[j])) << "Box overlapping is detected";
+}
+
+TEST(MemSolverTest, AutoStrategyKeepsSmallestSolution) {
+    using Strategy = MKLDNNPlugin::MemorySolver::Strategy;
+    std::vector<std::vector<Box>> cases {
+        {{5, 5, 3, 0}, {2, 4, 4, 1}, {2, 3, 4, 2}, {4, 5, 2, 3}},
+        {{2, 3, 1, 0}, {3, 4, 1, 1}, {4, 6, 2, 2}, {6, 7, 3, 3}},
+        {{0, 1, 2, 0}, {1, 2, 2, 1}, {2, 3, 2, 2}, {3, 4, 2, 3}},
+    };
+
+    for (const auto& boxes : cases) {
+        MKLDNNPlugin::MemorySolver ms(boxes);
+        auto firstFit = ms.solve(Strategy::FirstFit);
+        auto bestFit = ms.solve(Strategy::BestFit);
+        EXPECT_EQ(ms.solve(Strategy::Auto), std::min(firstFit, bestFit));
+    }
+}
@@ -0,0 +1,123 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+#include <chrono>
+#include <cmath>
+#include <random>
+#include <tuple>
+#include <vector>
+
+#include <gtest/gtest.h>
+#include "runtime/floatmath.h"
+
+namespace {
+
+// M, N, K
+typedef std::tuple<int, int, int> SgemmShape;
+
+class GNAFloatMathTest : public ::testing::TestWithParam<SgemmShape> {
+ protected:
+    std::vector<float> random(size_t size) {
+        std::uniform_real_distribution<float> distribution(-1.0f, 1.0f);
+        std::vector<float> data(size);
+        for (auto& value : data) {
+            value = distribution(generator);
+        }
+        return data;
+    }
+
+    static std::vector<float> reference(int M, int N, int K, const std::vector<float>& A, const std::vector<float>& B,
+                                        std::vector<float> C, const std::vector<uint32_t>& rows) {
+        for (size_t l = 0; l < rows.size(); l++) {
+            for (int j = 0; j < N; j++) {
+                double sum = C[l * N + j];
+                for (int k = 0; k < K; k++) {
+                    sum += static_cast<double>(A[rows[l] * K + k]) * B[k * N + j];
+                }
+                C[l * N + j] = static_cast<float>(sum);
+            }
+        }
+        return C;
+    }
+
+    static void compare(const std::vector<float>& expected, const std::vector<float>& actual, int K) {
+        ASSERT_EQ(expected.size(), actual.size());
+        const float threshold = 1e-5f * K;
+        for (size_t i = 0; i < expected.size(); i++) {
+            ASSERT_NEAR(expected[i], actual[i], threshold) << "at " << i;
+        }
+    }
+
+    std::mt19937 generator{42};
+};
+
+TEST_P(GNAFloatMathTest, sgemmAccumulatesIntoOutput) {
+    int M, N, K;
+    std::tie(M, N, K) = GetParam();
+    auto A = random(M * K), B = random(K * N), C = random(M * N);
+    std::vector<uint32_t> rows(M);
+    for (int i = 0; i < M; i++) {
+        rows[i] = i;
+    }
+    auto expected = reference(M, N, K, A, B, C, rows);
+
+    cblas_sgemm1(CblasRowMajor, CblasNoTrans, CblasNoTrans, M, N, K, 1.0, A.data(), K, B.data(), N, 1.0, C.data(), N);
+    compare(expected, C, K);
+}
+
+TEST_P(GNAFloatMathTest, sgemmSubsetComputesListedRows) {
+    int M, N, K;
+    std::tie(M, N, K) = GetParam();
+    auto A = random(M * K), B = random(K * N);
+    std::vector<uint32_t> rows;
+    for (int i = M - 1; i >= 0; i -= 3) {
+        rows.push_back(i);
+    }
+    const int L = static_cast<int>(rows.size());
+    auto C = random(L * N);
+    auto expected = reference(M, N, K, A, B, C, rows);
+
+    cblas_sgemm_subset(CblasRowMajor, CblasNoTrans, CblasNoTrans, M, N, K, 1.0, A.data(), K, B.data(), N, 1.0,
+                       C.data(), N, rows.data(), L);
+    compare(expected, C, K);
+}
+
+TEST_P(GNAFloatMathTest, sgemvSplitMatchesReference) {
+    int M, N, K;
+    std::tie(M, N, K) = GetParam();
+    const int K1 = K / 3, K2 = K - K1;
+    auto X = random(M * K), A = random(K), bias = random(M);
+    std::vector<uint32_t> rows(M);
+    for (int i = 0; i < M; i++) {
+        rows[i] = i;
+    }
+    auto expected = reference(M, 1, K, X, A, bias, rows);
+
+    std::vector<float> C(M);
+    sgemv_split(M, K1, K2, A.data(), A.data() + K1, X.data(), bias.data(), C.data());
+    compare(expected, C, K);
+}
+
+INSTANTIATE_TEST_CASE_P(GNAFloatMath, GNAFloatMathTest,
+    ::testing::Values(SgemmShape{1, 1, 1}, SgemmShape{3, 1, 7}, SgemmShape{5, 2, 33}, SgemmShape{17, 4, 129},
+                      SgemmShape{64, 8, 1500}, SgemmShape{512, 1, 2049}, SgemmShape{257, 3, 640}));
+
+// Micro-benchmark of the affine layer product, run with --gtest_also_run_disabled_tests
+TEST_F(GNAFloatMathTest, DISABLED_sgemmPerformance) {
+    for (auto shape : {SgemmShape{512, 1, 512}, SgemmShape{1024, 4, 1024}, SgemmShape{2048, 8, 2048}}) {
+        int M, N, K;
+        std::tie(M, N, K) = shape;
+        auto A = random(M * K), B = random(K * N), C = random(M * N);
+        const int iterations = 50;
+        auto start = std::chrono::steady_clock::now();
+        for (int i = 0; i < iterations; i++) {
+            cblas_sgemm1(CblasRowMajor, CblasNoTrans, CblasNoTrans, M, N, K, 1.0, A.data(), K, B.data(), N, 1.0,
+                         C.data(), N);
+        }
+        std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+        std::cout << "M=" << M << " N=" << N << " K=" << K << ": "
+                  << 2.0 * M * N * K * iterations / elapsed.count() * 1e-9 << " GFLOPS" << std::endl;
+    }
+}
+
+}  // namespace
@@ -0,0 +1,161 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+
+#include <chrono>
+#include <ctime>
+#include <memory>
+#include <string>
+#include <thread>
+
+#ifdef _WIN32
+# include <sys/utime.h>
+#else
+# include <utime.h>
+#endif
+
+#include "ie_cache_manager.hpp"
+#include "common_test_utils/file_utils.hpp"
+
+using namespace InferenceEngine;
+using namespace ::testing;
+using namespace std::chrono;
+
+class FileStorageCacheManagerTest : public Test {
+public:
+    std::string m_cacheDir;
+    std::shared_ptr<FileStorageCacheManager> m_manager;
+
+    void SetUp() override {
+        auto testInfo = UnitTest::GetInstance()->current_test_info();
+        std::stringstream ss;
+        ss << "cache_manager_" << testInfo->name() << "_" << std::this_thread::get_id() << "_"
+           << duration_cast<microseconds>(high_resolution_clock::now().time_since_epoch()).count();
+        m_cacheDir = ss.str();
+        FileUtils::createDirectoryRecursive(m_cacheDir);
+        m_manager = std::make_shared<FileStorageCacheManager>(m_cacheDir);
+    }
+
+    void TearDown() override {
+        m_manager.reset();
+        CommonTestUtils::removeFilesWithExt(m_cacheDir, "blob");
+        CommonTestUtils::removeFilesWithExt(m_cacheDir, "tmp");
+        CommonTestUtils::removeDir(m_cacheDir);
+    }
+
+    ICacheManager& cache() {
+        return *m_manager;
+    }
+
+    std::string blobPath(const std::string& id) const {
+        return FileUtils::makePath(m_cacheDir, id + ".blob");
+    }
+
+    void write(const std::string& id, const std::string& content) {
+        cache().writeCacheEntry(id, [&](std::ostream& stream) {
+            stream << content;
+        });
+    }
+
+    std::string read(const std::string& id) {
+        std::string content;
+        cache().readCacheEntry(id, [&](std::istream& stream) {
+            content.assign(std::istreambuf_iterator<char>(stream), std::istreambuf_iterator<char>());
+        });
+        return content;
+    }
+
+    void setLastAccess(const std::string& id, std::time_t time) {
+        struct utimbuf times;
+        times.actime = time;
+        times.modtime = time;
+        ASSERT_EQ(0, utime(blobPath(id).c_str(), &times));
+    }
+};
+
+TEST_F(FileStorageCacheManagerTest, WriteAndRead) {
+    write("entry", "content");
+    EXPECT_EQ("content", read("entry"));
+    EXPECT_TRUE(CommonTestUtils::listFilesWithExt(m_cacheDir, "tmp").empty());
+
+    auto stats = m_manager->getStatistics();
+    EXPECT_EQ(1u, stats["WRITES"]);
+    EXPECT_EQ(1u, stats["HITS"]);
+    EXPECT_EQ(0u, stats["MISSES"]);
+    EXPECT_EQ(std::string("content").size(), stats["SIZE"]);
+}
+
+TEST_F(FileStorageCacheManagerTest, RewriteReplacesEntry) {
+    write("entry", "old content");
+    write("entry", "new");
+    EXPECT_EQ("new", read("entry"));
+    EXPECT_EQ(1u, CommonTestUtils::listFilesWithExt(m_cacheDir, "blob").size());
+}
+
+TEST_F(FileStorageCacheManagerTest, ReadAbsentEntryIsMiss) {
+    bool called = false;
+    cache().readCacheEntry("absent", [&](std::istream&) {
+        called = true;
+    });
+    EXPECT_FALSE(called);
+    EXPECT_EQ(1u, m_manager->getStatistics()["MISSES"]);
+}
+
+TEST_F(FileStorageCacheManagerTest, FailedWriteLeavesNoFiles) {
+    EXPECT_THROW(cache().writeCacheEntry("entry", [](std::ostream& stream) {
+        stream << "partial";
+        THROW_IE_EXCEPTION << "Export failed";
+    }), details::InferenceEngineException);
+
+    EXPECT_FALSE(FileUtils::fileExist(blobPath("entry")));
+    EXPECT_TRUE(CommonTestUtils::listFilesWithExt(m_cacheDir, "tmp").empty());
+    EXPECT_EQ(0u, m_manager->getStatistics()["WRITES"]);
+}
+
+TEST_F(FileStorageCacheManagerTest, EvictsLeastRecentlyUsed) {
+    const std::string content(100, 'x');
+    const auto now = std::time(nullptr);
+    write("a", content);
+    write("b", content);
+    setLastAccess("a", now - 100);
+    setLastAccess("b", now - 50);
+
+    // Reading makes "a" the most recently used entry
+    EXPECT_EQ(content, read("a"));
+
+    m_manager->setSizeLimit(250);
+    write("c", content);
+
+    EXPECT_TRUE(FileUtils::fileExist(blobPath("a")));
+    EXPECT_FALSE(FileUtils::fileExist(blobPath("b")));
+    EXPECT_TRUE(FileUtils::fileExist(blobPath("c")));
+
+    auto stats = m_manager->getStatistics();
+    EXPECT_EQ(1u, stats["EVICTIONS"]);
+    EXPECT_EQ(200u, stats["SIZE"]);
+}
+
+TEST_F(FileStorageCacheManagerTest, EntryBeingReadIsNotEvicted) {
+    const std::string content(100, 'x');
+    write("a", content);
+    setLastAccess("a", std::time(nullptr) - 100);
+    m_manager->setSizeLimit(150);
+
+    cache().readCacheEntry("a", [&](std::istream&) {
+        write("b", content);
+    });
+
+    // Neither the entry being read nor the one just written is evicted, the limit is exceeded temporarily
+    EXPECT_TRUE(FileUtils::fileExist(blobPath("a")));
+    EXPECT_TRUE(FileUtils::fileExist(blobPath("b")));
+    EXPECT_EQ(0u, m_manager->getStatistics()["EVICTIONS"]);
+
+    // Once the read is finished, the least recently used entry is evicted on the next write
+    setLastAccess("a", std::time(nullptr) - 100);
+    write("b", content);
+    EXPECT_FALSE(FileUtils::fileExist(blobPath("a")));
+    EXPECT_TRUE(FileUtils::fileExist(blobPath("b")));
+    EXPECT_EQ(1u, m_manager->getStatistics()["EVICTIONS"]);
+}
@@ -326,6 +326,100 @@ TEST(NetworkContext_CNNNetwork, HashWithDifferentResults) {
               NetworkCompilationContext::computeHash(net3, {}));
 }
 
+TEST(NetworkContext_CNNNetwork, HashWithDifferentWeights) {
+    auto net1 = createNetwork();
+    auto net2 = createNetwork();
+    auto net3 = createNetwork();
+    auto updateConstant = [](CNNNetwork& cnnNet, int8_t value) {
+        for (const auto& op : cnnNet.getFunction()->get_ops()) {
+            if (auto constant = std::dynamic_pointer_cast<ngraph::opset6::Constant>(op)) {
+                auto data = const_cast<int8_t*>(constant->get_data_ptr<int8_t>());
+                data[0] = value;
+                break;
+            }
+        }
+    };
+    updateConstant(net2, 42);
+    updateConstant(net3, 42);
+    ASSERT_NE(NetworkCompilationContext::computeHash(net1, {}),
+              NetworkCompilationContext::computeHash(net2, {}));
+    ASSERT_EQ(NetworkCompilationContext::computeHash(net2, {}),
+              NetworkCompilationContext::computeHash(net3, {}));
+}
+
+namespace {
+
+// Operation with attributes of integer types which are not visited as int64_t
+class SmallIntAttributesOp : public ngraph::op::Op {
+public:
+    NGRAPH_RTTI_DECLARATION;
+
+    SmallIntAttributesOp() = default;
+    SmallIntAttributesOp(const Output<Node>& arg, uint8_t scalar, const std::vector<uint8_t>& u8,
+                         const std::vector<int16_t>& i16, const std::vector<uint32_t>& u32)
+            : Op({arg}), m_scalar(scalar), m_u8(u8), m_i16(i16), m_u32(u32) {
+        constructor_validate_and_infer_types();
+    }
+
+    void validate_and_infer_types() override {
+        set_output_type(0, get_input_element_type(0), get_input_partial_shape(0));
+    }
+
+    std::shared_ptr<Node> clone_with_new_inputs(const OutputVector& new_args) const override {
+        return std::make_shared<SmallIntAttributesOp>(new_args.at(0), m_scalar, m_u8, m_i16, m_u32);
+    }
+
+    bool visit_attributes(AttributeVisitor& visitor) override {
+        visitor.on_attribute("scalar", m_scalar);
+        visitor.on_attribute("u8", m_u8);
+        visitor.on_attribute("i16", m_i16);
+        visitor.on_attribute("u32", m_u32);
+        return true;
+    }
+
+private:
+    uint8_t m_scalar = 0;
+    std::vector<uint8_t> m_u8;
+    std::vector<int16_t> m_i16;
+    std::vector<uint32_t> m_u32;
+};
+
+NGRAPH_RTTI_DEFINITION(SmallIntAttributesOp, "SmallIntAttributesOp", 0);
+
+CNNNetwork createNetworkWithSmallIntAttributes(uint8_t scalar, const std::vector<uint8_t>& u8,
+                                               const std::vector<int16_t>& i16, const std::vector<uint32_t>& u32) {
+    auto data = std::make_shared<ngraph::opset6::Parameter>(ngraph::element::f32, ngraph::Shape{1, 2});
+    data->set_friendly_name("Parameter");
+    auto op = std::make_shared<SmallIntAttributesOp>(data, scalar, u8, i16, u32);
+    op->set_friendly_name("op");
+    auto res = std::make_shared<ngraph::opset6::Result>(op);
+    res->set_friendly_name("res");
+    return CNNNetwork(std::make_shared<ngraph::Function>(ngraph::ResultVector{res}, ngraph::ParameterVector{data}));
+}
+
+}  // namespace
+
+TEST(NetworkContext_CNNNetwork, HashWithDifferentSmallIntAttributes) {
+    auto hash = [](uint8_t scalar, const std::vector<uint8_t>& u8,
+                   const std::vector<int16_t>& i16, const std::vector<uint32_t>& u32) {
+        return NetworkCompilationContext::computeHash(createNetworkWithSmallIntAttributes(scalar, u8, i16, u32), {});
+    };
+    const auto base = hash(1, {1, 2}, {-1, 2}, {1, 2});
+    ASSERT_EQ(base, hash(1, {1, 2}, {-1, 2}, {1, 2}));
+    ASSERT_NE(base, hash(2, {1, 2}, {-1, 2}, {1, 2}));
+    ASSERT_NE(base, hash(1, {1, 3}, {-1, 2}, {1, 2}));
+    ASSERT_NE(base, hash(1, {1, 2}, {-1, 3}, {1, 2}));
+    ASSERT_NE(base, hash(1, {1, 2}, {-1, 2}, {1, 3}));
+}
+
+TEST(NetworkContext_CNNNetwork, HashWithDifferentNames) {
+    auto net1 = createNetwork();
+    auto net2 = createNetwork();
+    net2.getFunction()->get_ordered_ops().back()->set_friendly_name("other_res");
+    ASSERT_NE(NetworkCompilationContext::computeHash(net1, {}),
+              NetworkCompilationContext::computeHash(net2, {}));
+}
+
 TEST(NetworkContext_CNNNetwork, HashWithDifferentMeanValues) {
     auto updatePreprocess = [&](CNNNetwork& cnnNet) {
         auto &preProcess = cnnNet.getInputsInfo().begin()->second->getPreProcess();
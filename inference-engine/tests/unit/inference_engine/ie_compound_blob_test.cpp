@@ -425,3 +425,74 @@ TEST_F(I420BlobTests, cannotCreateI420BlobFromPlanesWithWrongHeightRatio) {
 }
 
 
+
+class BatchedROIBlobTests : public CompoundBlobTests {};
+
+TEST_F(BatchedROIBlobTests, cannotCreateBatchedROIBlobFromNullptrImage) {
+    EXPECT_THROW(make_shared_blob<BatchedROIBlob>(nullptr, std::vector<ROI>{{0, 0, 0, 2, 2}}),
+                 InferenceEngine::details::InferenceEngineException);
+}
+
+TEST_F(BatchedROIBlobTests, cannotCreateBatchedROIBlobFromEmptyROIs) {
+    Blob::Ptr image = make_shared_blob<uint8_t>(TensorDesc(Precision::U8, {1, 3, 6, 8}, NHWC));
+    image->allocate();
+    EXPECT_THROW(make_shared_blob<BatchedROIBlob>(image, std::vector<ROI>{}),
+                 InferenceEngine::details::InferenceEngineException);
+}
+
+TEST_F(BatchedROIBlobTests, cannotCreateBatchedROIBlobFromROIWithWrongId) {
+    Blob::Ptr image = make_shared_blob<uint8_t>(TensorDesc(Precision::U8, {2, 3, 6, 8}, NHWC));
+    image->allocate();
+    EXPECT_THROW(make_shared_blob<BatchedROIBlob>(image, std::vector<ROI>{{0, 0, 0, 2, 2}, {2, 0, 0, 2, 2}}),
+                 InferenceEngine::details::InferenceEngineException);
+}
+
+TEST_F(BatchedROIBlobTests, cannotCreateBatchedROIBlobFromOutOfBoundsROI) {
+    Blob::Ptr image = make_shared_blob<uint8_t>(TensorDesc(Precision::U8, {1, 3, 6, 8}, NHWC));
+    image->allocate();
+    EXPECT_THROW(make_shared_blob<BatchedROIBlob>(image, std::vector<ROI>{{0, 0, 0, 2, 2}, {0, 4, 2, 5, 2}}),
+                 InferenceEngine::details::InferenceEngineException);
+    EXPECT_THROW(make_shared_blob<BatchedROIBlob>(image, std::vector<ROI>{{0, 0, 0, 2, 0}}),
+                 InferenceEngine::details::InferenceEngineException);
+}
+
+TEST_F(BatchedROIBlobTests, canCreateBatchedROIBlobFromMemoryBlob) {
+    Blob::Ptr image = make_shared_blob<uint8_t>(TensorDesc(Precision::U8, {1, 3, 6, 8}, NHWC));
+    image->allocate();
+    const std::vector<ROI> rois = {{0, 0, 0, 8, 6}, {0, 2, 1, 3, 4}, {0, 5, 3, 3, 3}};
+    BatchedROIBlob::Ptr batched_blob = make_shared_blob<BatchedROIBlob>(image, rois);
+    verifyCompoundBlob(batched_blob);
+    ASSERT_EQ(rois.size(), batched_blob->size());
+    EXPECT_EQ(image, batched_blob->getImage());
+    EXPECT_EQ(SizeVector({3, 3, 6, 8}), batched_blob->getTensorDesc().getDims());
+    EXPECT_EQ(NHWC, batched_blob->getTensorDesc().getLayout());
+
+    // ROI blobs share the image memory
+    auto imageMem = as<MemoryBlob>(image)->rmap();
+    for (size_t i = 0; i < rois.size(); ++i) {
+        auto roiBlob = as<MemoryBlob>(batched_blob->getBlob(i));
+        ASSERT_NE(nullptr, roiBlob);
+        const auto& dims = roiBlob->getTensorDesc().getDims();
+        EXPECT_EQ(rois[i].sizeY, dims[2]);
+        EXPECT_EQ(rois[i].sizeX, dims[3]);
+        const auto offset = (rois[i].posY * 8 + rois[i].posX) * 3;
+        EXPECT_EQ(imageMem.as<const uint8_t*>() + offset, roiBlob->rmap().as<const uint8_t*>() +
+                  roiBlob->getTensorDesc().getBlockingDesc().getOffsetPadding());
+    }
+}
+
+TEST_F(BatchedROIBlobTests, canCreateBatchedROIBlobFromNV12Blob) {
+    Blob::Ptr y_blob = make_shared_blob<uint8_t>(TensorDesc(Precision::U8, {1, 1, 6, 8}, NHWC));
+    Blob::Ptr uv_blob = make_shared_blob<uint8_t>(TensorDesc(Precision::U8, {1, 2, 3, 4}, NHWC));
+    y_blob->allocate();
+    uv_blob->allocate();
+    Blob::Ptr image = make_shared_blob<NV12Blob>(y_blob, uv_blob);
+    BatchedROIBlob::Ptr batched_blob = make_shared_blob<BatchedROIBlob>(image,
+        std::vector<ROI>{{0, 0, 0, 4, 2}, {0, 2, 2, 6, 4}});
+    verifyCompoundBlob(batched_blob);
+    ASSERT_EQ(2, batched_blob->size());
+    EXPECT_EQ(SizeVector({2, 3, 6, 8}), batched_blob->getTensorDesc().getDims());
+    for (size_t i = 0; i < batched_blob->size(); ++i) {
+        EXPECT_TRUE(batched_blob->getBlob(i)->is<NV12Blob>());
+    }
+}
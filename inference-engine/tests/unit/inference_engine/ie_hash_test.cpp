@@ -0,0 +1,62 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "ie_hash.hpp"
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <string>
+#include <vector>
+
+using namespace InferenceEngine;
+
+using DataHasherTests = ::testing::Test;
+
+TEST_F(DataHasherTests, matchesReferenceValues) {
+    ASSERT_EQ(0xEF46DB3751D8E999ULL, DataHasher::hash("", 0));
+    ASSERT_EQ(0xD24EC4F1A98C6E5BULL, DataHasher::hash("a", 1));
+    ASSERT_EQ(0x44BC2CF5AD770999ULL, DataHasher::hash("abc", 3));
+}
+
+TEST_F(DataHasherTests, incrementalUpdateGivesSameResult) {
+    std::vector<uint8_t> data(1000);
+    for (size_t i = 0; i < data.size(); i++)
+        data[i] = static_cast<uint8_t>(i * 7);
+    const auto expected = DataHasher::hash(data.data(), data.size());
+
+    for (size_t step : {1, 3, 31, 32, 33, 100}) {
+        DataHasher hasher;
+        for (size_t i = 0; i < data.size(); i += step)
+            hasher.update(data.data() + i, std::min(step, data.size() - i));
+        ASSERT_EQ(expected, hasher.digest()) << "step " << step;
+    }
+}
+
+TEST_F(DataHasherTests, digestDoesNotChangeState) {
+    DataHasher hasher;
+    hasher.update(std::string("abc"));
+    const auto first = hasher.digest();
+    ASSERT_EQ(first, hasher.digest());
+    hasher.update(1);
+    ASSERT_NE(first, hasher.digest());
+}
+
+TEST_F(DataHasherTests, seedChangesResult) {
+    ASSERT_NE(DataHasher::hash("abc", 3, 0), DataHasher::hash("abc", 3, 1));
+}
+
+TEST_F(DataHasherTests, stringsAreDelimited) {
+    DataHasher hasher1, hasher2;
+    hasher1.update(std::string("ab")).update(std::string("c"));
+    hasher2.update(std::string("a")).update(std::string("bc"));
+    ASSERT_NE(hasher1.digest(), hasher2.digest());
+}
+
+TEST_F(DataHasherTests, resetRestoresInitialState) {
+    DataHasher hasher(5);
+    hasher.update(std::string("abc"));
+    hasher.reset(5);
+    ASSERT_EQ(DataHasher(5).digest(), hasher.digest());
+}
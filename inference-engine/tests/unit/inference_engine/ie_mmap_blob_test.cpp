@@ -0,0 +1,62 @@
+// Copyright (C) 2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <string>
+#include <gtest/gtest.h>
+
+#include "ie_mmap_blob.hpp"
+
+#include "common_test_utils/file_utils.hpp"
+
+using namespace InferenceEngine;
+using namespace ::testing;
+
+class MmapBlobTests : public Test {
+protected:
+    std::string fileName = "mmap_blob_test.bin";
+
+    void TearDown() override {
+        CommonTestUtils::removeFile(fileName);
+    }
+};
+
+TEST_F(MmapBlobTests, canMapFileContent) {
+    const std::string content = "0123456789abcdef";
+    CommonTestUtils::createFile(fileName, content);
+
+    auto blob = details::make_mmap_blob(fileName);
+    ASSERT_NE(nullptr, blob);
+    ASSERT_EQ(Precision::U8, blob->getTensorDesc().getPrecision());
+    ASSERT_EQ(content.size(), blob->byteSize());
+
+    auto mblob = as<MemoryBlob>(blob);
+    ASSERT_NE(nullptr, mblob);
+    auto data = mblob->rmap();
+    EXPECT_EQ(content, std::string(data.as<const char*>(), content.size()));
+}
+
+TEST_F(MmapBlobTests, writesAreNotVisibleInFile) {
+    const std::string content = "0123456789abcdef";
+    CommonTestUtils::createFile(fileName, content);
+
+    {
+        auto blob = as<MemoryBlob>(details::make_mmap_blob(fileName));
+        ASSERT_NE(nullptr, blob);
+        blob->wmap().as<char*>()[0] = 'x';
+        EXPECT_EQ('x', blob->rmap().as<const char*>()[0]);
+    }
+
+    auto blob = as<MemoryBlob>(details::make_mmap_blob(fileName));
+    ASSERT_NE(nullptr, blob);
+    EXPECT_EQ('0', blob->rmap().as<const char*>()[0]);
+}
+
+TEST_F(MmapBlobTests, returnsNullForEmptyFile) {
+    CommonTestUtils::createFile(fileName, "");
+    EXPECT_EQ(nullptr, details::make_mmap_blob(fileName));
+}
+
+TEST_F(MmapBlobTests, returnsNullForMissingFile) {
+    EXPECT_EQ(nullptr, details::make_mmap_blob("not_existing_mmap_blob_test.bin"));
+}
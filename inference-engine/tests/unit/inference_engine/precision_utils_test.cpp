@@ -6,6 +6,7 @@
 
 #include <gtest/gtest.h>
 
+#include <cmath>
 #include <limits>
 
 using namespace InferenceEngine;
@@ -46,3 +47,20 @@ TEST_F(PrecisionUtilsTests, FP32ToFP16LowestValue) {
     const auto fp16ConvertedLowestValue = InferenceEngine::PrecisionUtils::f32tof16(std::numeric_limits<float>::lowest());
     ASSERT_EQ(fp16ConvertedLowestValue, lowestNumber);
 }
+
+TEST_F(PrecisionUtilsTests, FP32ToBF16RoundsToNearestEven) {
+    // 1.0 + half of bf16 ULP is a tie rounded down to even, 1.0 + 3 halves of ULP is rounded up to even
+    ASSERT_EQ(InferenceEngine::PrecisionUtils::f32tobf16(1.00390625f).bits, 0x3F80);
+    ASSERT_EQ(InferenceEngine::PrecisionUtils::f32tobf16(1.01171875f).bits, 0x3F82);
+    ASSERT_EQ(InferenceEngine::PrecisionUtils::f32tobf16(1.005f).bits, 0x3F81);
+}
+
+TEST_F(PrecisionUtilsTests, FP32ToBF16KeepsNaN) {
+    const auto bf16ConvertedNaN = InferenceEngine::PrecisionUtils::f32tobf16(std::numeric_limits<float>::quiet_NaN());
+    ASSERT_TRUE(std::isnan(InferenceEngine::PrecisionUtils::bf16tof32(bf16ConvertedNaN)));
+}
+
+TEST_F(PrecisionUtilsTests, BF16ToFP32NegativeInfinity) {
+    const auto fp32ConvertedInf = InferenceEngine::PrecisionUtils::bf16tof32(ie_bf16{0xFF80});
+    ASSERT_EQ(fp32ConvertedInf, -1 * std::numeric_limits<float>::infinity());
+}
@@ -15,6 +15,7 @@
 #include <opencv2/gapi.hpp>
 #include <opencv2/gapi/imgproc.hpp>
 
+#include <cmath>
 #include <cstdarg>
 #include <cstdio>
 #include <ctime>
@@ -72,6 +73,7 @@ cv::String interpToString(int interp)
     {
     case cv::INTER_AREA   : return "INTER_AREA";
     case cv::INTER_LINEAR : return "INTER_LINEAR";
+    case cv::INTER_CUBIC  : return "INTER_CUBIC";
     case cv::INTER_NEAREST: return "INTER_NEAREST";
     }
     CV_Assert(!"ERROR: unsupported interpolation!");
@@ -659,6 +661,40 @@ TEST_P(ConvertDepthTestGAPI, AccuracyTest)
         EXPECT_LE(cv::norm(out_mat_ocv, out_mat_gapi, cv::NORM_INF), tolerance);
     }
 }
+
+TEST_P(NormalizeTestGAPI, AccuracyTest)
+{
+    const auto params = GetParam();
+    int in_depth      = std::get<0>(params);
+    cv::Size sz       = std::get<1>(params);
+    double tolerance  = std::get<2>(params);
+
+    const float mean  = 123.68f;
+    const float scale = 1.f / 58.4f;
+
+    initMatrixRandU(CV_MAKETYPE(in_depth,1), sz, CV_32FC1);
+
+    // G-API code //////////////////////////////////////////////////////////////
+    NormalizeComputation nc(to_test(in_mat1), to_test(out_mat_gapi), mean, scale);
+    nc.warmUp();
+
+#if PERF_TEST
+    // iterate testing, and print performance
+    test_ms([&](){ nc.apply(); },
+        400, "Normalize GAPI %s to %s %dx%d", depthToString(in_mat1.depth()).c_str(), depthToString(out_mat_gapi.depth()).c_str(), sz.width, sz.height);
+#endif
+
+    // OpenCV code /////////////////////////////////////////////////////////////
+    {
+        cv::Mat converted;
+        in_mat1.convertTo(converted, CV_32F);
+        out_mat_ocv = (converted - mean) * scale;
+    }
+    // Comparison //////////////////////////////////////////////////////////////
+    {
+        EXPECT_LE(cv::norm(out_mat_ocv, out_mat_gapi, cv::NORM_INF), tolerance);
+    }
+}
 //----------------------------------------------------------------------
 
 TEST_P(ResizeTestIE, AccuracyTest)
@@ -687,7 +723,7 @@ TEST_P(ResizeTestIE, AccuracyTest)
     int depth = CV_MAT_DEPTH(type);
     CV_Assert(CV_8U == depth || CV_32F == depth);
 
-    CV_Assert(cv::INTER_AREA == interp || cv::INTER_LINEAR == interp);
+    CV_Assert(cv::INTER_AREA == interp || cv::INTER_LINEAR == interp || cv::INTER_CUBIC == interp);
 
     ASSERT_TRUE(in_mat1.isContinuous() && out_mat.isContinuous());
 
@@ -710,7 +746,8 @@ TEST_P(ResizeTestIE, AccuracyTest)
     PreProcessDataPtr preprocess = CreatePreprocDataHelper();
     preprocess->setRoiBlob(in_blob);
 
-    ResizeAlgorithm algorithm = cv::INTER_AREA == interp ? RESIZE_AREA : RESIZE_BILINEAR;
+    ResizeAlgorithm algorithm = cv::INTER_AREA  == interp ? RESIZE_AREA
+                              : cv::INTER_CUBIC == interp ? RESIZE_BICUBIC : RESIZE_BILINEAR;
     PreProcessInfo info;
     info.setResizeAlgorithm(algorithm);
 
@@ -735,6 +772,81 @@ TEST_P(ResizeTestIE, AccuracyTest)
     }
 }
 
+TEST_P(LetterboxTestIE, AccuracyTest)
+{
+    int type = 0;
+    cv::Size sz_in, sz_out;
+    double tolerance = 0.0;
+    std::pair<cv::Size, cv::Size> sizes;
+    std::tie(type, sizes, tolerance) = GetParam();
+    std::tie(sz_in, sz_out) = sizes;
+
+    cv::Mat in_mat1(sz_in, type );
+    cv::Scalar mean = cv::Scalar::all(127);
+    cv::Scalar stddev = cv::Scalar::all(40.f);
+
+    cv::randn(in_mat1, mean, stddev);
+
+    // padding must be written by pre-processing, so pre-fill output with garbage
+    cv::Mat out_mat(sz_out, type, cv::Scalar::all(255));
+    cv::Mat out_mat_ocv(sz_out, type, cv::Scalar::all(0));
+
+    // Inference Engine code ///////////////////////////////////////////////////
+
+    size_t channels = out_mat.channels();
+    int depth = CV_MAT_DEPTH(type);
+    CV_Assert(CV_8U == depth || CV_32F == depth);
+
+    using namespace InferenceEngine;
+
+    size_t  in_height = in_mat1.rows,  in_width = in_mat1.cols;
+    size_t out_height = out_mat.rows, out_width = out_mat.cols;
+    InferenceEngine::SizeVector  in_sv = { 1, channels,  in_height,  in_width };
+    InferenceEngine::SizeVector out_sv = { 1, channels, out_height, out_width };
+
+    // HWC blob: channels are interleaved
+    Precision precision = CV_8U == depth ? Precision::U8 : Precision::FP32;
+    TensorDesc  in_desc(precision,  in_sv, Layout::NHWC);
+    TensorDesc out_desc(precision, out_sv, Layout::NHWC);
+
+    Blob::Ptr in_blob, out_blob;
+    in_blob  = make_blob_with_precision(in_desc , in_mat1.data);
+    out_blob = make_blob_with_precision(out_desc, out_mat.data);
+
+    PreProcessDataPtr preprocess = CreatePreprocDataHelper();
+    preprocess->setRoiBlob(in_blob);
+
+    PreProcessInfo info;
+    info.setResizeAlgorithm(RESIZE_LETTERBOX);
+
+    preprocess->execute(out_blob, info, false);
+
+#if PERF_TEST
+    // iterate testing, and print performance
+    test_ms([&](){ preprocess->execute(out_blob, info, false); },
+            100, "Letterbox IE %s %dx%d -> %dx%d",
+            typeToString(type).c_str(),
+            sz_in.width, sz_in.height, sz_out.width, sz_out.height);
+#endif
+
+    // OpenCV code /////////////////////////////////////////////////////////////
+    {
+        const double ratio = std::min(static_cast<double>(sz_out.width)  / sz_in.width,
+                                      static_cast<double>(sz_out.height) / sz_in.height);
+        const int w = std::max(1, std::min(sz_out.width,  static_cast<int>(std::lround(sz_in.width  * ratio))));
+        const int h = std::max(1, std::min(sz_out.height, static_cast<int>(std::lround(sz_in.height * ratio))));
+        const cv::Rect rect((sz_out.width - w) / 2, (sz_out.height - h) / 2, w, h);
+
+        cv::Mat resized;
+        cv::resize(in_mat1, resized, rect.size(), 0, 0, cv::INTER_LINEAR);
+        resized.copyTo(out_mat_ocv(rect));
+    }
+    // Comparison //////////////////////////////////////////////////////////////
+    {
+        EXPECT_LE(cv::norm(out_mat_ocv, out_mat, cv::NORM_INF), tolerance);
+    }
+}
+
 TEST_P(ColorConvertTestIE, AccuracyTest)
 {
     using namespace InferenceEngine;
@@ -930,6 +1042,172 @@ TEST_P(ColorConvertYUV420TestIE, AccuracyTest)
     }
 }
 
+TEST_P(NormalizeYUV420TestIE, AccuracyTest)
+{
+    using namespace InferenceEngine;
+    const int depth = CV_8U;
+    auto in_fmt = ColorFormat::NV12;
+    auto out_layout = Layout::ANY;
+    std::pair<cv::Size, cv::Size> sizes;
+    double tolerance = 0.0;
+    std::tie(in_fmt, out_layout, sizes, tolerance) = GetParam();
+    cv::Size sz_in, sz_out;
+    std::tie(sz_in, sz_out) = sizes;
+
+    cv::Mat in_mat_y(sz_in, CV_MAKE_TYPE(depth, 1));
+    cv::Mat in_mat_uv(cv::Size(sz_in.width / 2, sz_in.height / 2), CV_MAKE_TYPE(depth, 2));
+    cv::randn(in_mat_y, cv::Scalar::all(127), cv::Scalar::all(40.f));
+    cv::randn(in_mat_uv, cv::Scalar::all(127) / 2, cv::Scalar::all(40.f) / 2);
+
+    Blob::Ptr in_blob;
+    if (in_fmt == ColorFormat::NV12) {
+        in_blob = make_shared_blob<NV12Blob>(img2Blob<Precision::U8>(in_mat_y, Layout::NHWC),
+                                             img2Blob<Precision::U8>(in_mat_uv, Layout::NHWC));
+    } else {
+        cv::Mat in_mat_u(cv::Size(sz_in.width / 2, sz_in.height / 2), CV_MAKE_TYPE(depth, 1));
+        cv::Mat in_mat_v(cv::Size(sz_in.width / 2, sz_in.height / 2), CV_MAKE_TYPE(depth, 1));
+        std::array<cv::Mat, 2> in_uv = {in_mat_u, in_mat_v};
+        cv::split(in_mat_uv, in_uv);
+        in_blob = make_shared_blob<I420Blob>(img2Blob<Precision::U8>(in_mat_y, Layout::NHWC),
+                                             img2Blob<Precision::U8>(in_mat_u, Layout::NHWC),
+                                             img2Blob<Precision::U8>(in_mat_v, Layout::NHWC));
+    }
+
+    cv::Mat out_mat(sz_out, CV_32FC3);
+    cv::Mat out_mat_ref(sz_out, CV_32FC3);
+    auto out_blob = img2Blob<Precision::FP32>(out_mat, out_layout);
+    auto ref_blob = img2Blob<Precision::FP32>(out_mat_ref, out_layout);
+
+    // Inference Engine code ///////////////////////////////////////////////////
+    const float means[]  = {103.94f, 116.78f, 123.68f};
+    const float scales[] = {0.017f, 0.0175f, 0.0171f};
+
+    PreProcessInfo info;
+    info.setColorFormat(in_fmt);
+    info.setResizeAlgorithm(RESIZE_BILINEAR);
+    info.init(3);
+    for (size_t c = 0; c < 3; c++) {
+        info[c]->meanValue = means[c];
+        info[c]->stdScale = scales[c];
+    }
+    info.setVariant(MEAN_VALUE);
+
+    PreProcessDataPtr preprocess = CreatePreprocDataHelper();
+    preprocess->setRoiBlob(in_blob);
+
+    // test once to warm-up cache
+    preprocess->execute(out_blob, info, false, -1, true);
+
+#if PERF_TEST
+    // iterate testing, and print performance
+    test_ms([&](){ preprocess->execute(out_blob, info, false, -1, true); },
+            100, "Normalize IE %s %s %dx%d -> %dx%d",
+            colorFormatToString(in_fmt).c_str(), layoutToString(out_layout).c_str(),
+            sz_in.width, sz_in.height, sz_out.width, sz_out.height);
+#endif
+
+    // Reference: the same pre-processing without normalization, then mean and scale as a separate pass
+    PreProcessDataPtr ref_preprocess = CreatePreprocDataHelper();
+    ref_preprocess->setRoiBlob(in_blob);
+    ref_preprocess->execute(ref_blob, info, false);
+
+    Blob2Img<Precision::FP32>(out_blob, out_mat, out_layout);
+    Blob2Img<Precision::FP32>(ref_blob, out_mat_ref, out_layout);
+    out_mat_ref = (out_mat_ref - cv::Scalar(means[0], means[1], means[2])).mul(
+                   cv::Scalar(scales[0], scales[1], scales[2]));
+
+    // Comparison //////////////////////////////////////////////////////////////
+    {
+        EXPECT_LE(cv::norm(out_mat_ref, out_mat, cv::NORM_INF), tolerance);
+    }
+}
+
+TEST_P(BatchedROIsTestIE, AccuracyTest)
+{
+    using namespace InferenceEngine;
+    const int depth = CV_8U;
+    auto in_fmt = ColorFormat::NV12;
+    auto out_layout = Layout::ANY;
+    std::pair<cv::Size, cv::Size> sizes;
+    double tolerance = 0.0;
+    std::tie(in_fmt, out_layout, sizes, tolerance) = GetParam();
+    cv::Size sz_in, sz_out;
+    std::tie(sz_in, sz_out) = sizes;
+
+    cv::Mat in_mat_y(sz_in, CV_MAKE_TYPE(depth, 1));
+    cv::Mat in_mat_uv(cv::Size(sz_in.width / 2, sz_in.height / 2), CV_MAKE_TYPE(depth, 2));
+    cv::Mat in_mat_bgr(sz_in, CV_MAKE_TYPE(depth, 3));
+    cv::randn(in_mat_y, cv::Scalar::all(127), cv::Scalar::all(40.f));
+    cv::randn(in_mat_uv, cv::Scalar::all(127) / 2, cv::Scalar::all(40.f) / 2);
+    cv::randn(in_mat_bgr, cv::Scalar::all(127), cv::Scalar::all(40.f));
+
+    Blob::Ptr in_blob;
+    if (in_fmt == ColorFormat::NV12) {
+        in_blob = make_shared_blob<NV12Blob>(img2Blob<Precision::U8>(in_mat_y, Layout::NHWC),
+                                             img2Blob<Precision::U8>(in_mat_uv, Layout::NHWC));
+    } else if (in_fmt == ColorFormat::I420) {
+        cv::Mat in_mat_u(cv::Size(sz_in.width / 2, sz_in.height / 2), CV_MAKE_TYPE(depth, 1));
+        cv::Mat in_mat_v(cv::Size(sz_in.width / 2, sz_in.height / 2), CV_MAKE_TYPE(depth, 1));
+        std::array<cv::Mat, 2> in_uv = {in_mat_u, in_mat_v};
+        cv::split(in_mat_uv, in_uv);
+        in_blob = make_shared_blob<I420Blob>(img2Blob<Precision::U8>(in_mat_y, Layout::NHWC),
+                                             img2Blob<Precision::U8>(in_mat_u, Layout::NHWC),
+                                             img2Blob<Precision::U8>(in_mat_v, Layout::NHWC));
+    } else {
+        in_blob = img2Blob<Precision::U8>(in_mat_bgr, Layout::NHWC);
+    }
+
+    // regions of different sizes and aspect ratios, including the whole frame
+    const size_t w = sz_in.width, h = sz_in.height;
+    const std::vector<ROI> rois = {{0, 0, 0, w, h},
+                                   {0, w / 4 * 2, h / 4 * 2, w / 2, h / 2},
+                                   {0, 2, 4, w / 8 * 2, h / 2 * 2 - 4},
+                                   {0, w / 2 * 2 - 32, h / 2 * 2 - 32, 32, 32},
+                                   {0, w / 4 * 2, 0, w / 4 * 2, h / 8 * 2}};
+    const size_t batch = rois.size();
+
+    const SizeVector out_dims = {batch, 3, static_cast<size_t>(sz_out.height), static_cast<size_t>(sz_out.width)};
+    auto out_blob = make_shared_blob<uint8_t>(TensorDesc(Precision::U8, out_dims, out_layout));
+    out_blob->allocate();
+    Blob::Ptr out = out_blob;
+
+    // Inference Engine code ///////////////////////////////////////////////////
+    PreProcessInfo info;
+    info.setColorFormat(in_fmt);
+    info.setResizeAlgorithm(RESIZE_BILINEAR);
+
+    PreProcessDataPtr preprocess = CreatePreprocDataHelper();
+    preprocess->setRoiBlob(make_shared_blob<BatchedROIBlob>(in_blob, rois));
+
+    // test once to warm-up cache
+    preprocess->execute(out, info, false);
+
+#if PERF_TEST
+    // iterate testing, and print performance
+    test_ms([&](){ preprocess->execute(out, info, false); },
+            100, "Batched ROIs IE %s %s %dx%d -> %zux%dx%d",
+            colorFormatToString(in_fmt).c_str(), layoutToString(out_layout).c_str(),
+            sz_in.width, sz_in.height, batch, sz_out.width, sz_out.height);
+#endif
+
+    // Reference: every region pre-processed separately
+    const size_t item_size = 3 * sz_out.width * sz_out.height;
+    for (size_t i = 0; i < batch; i++) {
+        auto ref_blob = make_shared_blob<uint8_t>(TensorDesc(Precision::U8, {1, 3, out_dims[2], out_dims[3]}, out_layout));
+        ref_blob->allocate();
+        Blob::Ptr ref = ref_blob;
+
+        PreProcessDataPtr ref_preprocess = CreatePreprocDataHelper();
+        ref_preprocess->setRoiBlob(in_blob->createROI(rois[i]));
+        ref_preprocess->execute(ref, info, false);
+
+        // Comparison //////////////////////////////////////////////////////////
+        cv::Mat out_item(1, item_size, CV_8UC1, out_blob->buffer().as<uint8_t*>() + i * item_size);
+        cv::Mat ref_item(1, item_size, CV_8UC1, ref_blob->buffer().as<uint8_t*>());
+        EXPECT_LE(cv::norm(ref_item, out_item, cv::NORM_INF), tolerance) << "ROI " << i;
+    }
+}
+
 TEST_P(SplitTestIE, AccuracyTest)
 {
     const auto params = GetParam();
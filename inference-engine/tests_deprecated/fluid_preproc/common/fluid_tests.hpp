@@ -25,9 +25,15 @@ struct ConvertDepthTestGAPI: public TestParams<std::tuple<
                             cv::Size,
                             double>>   // tolerance
 {};
+struct NormalizeTestGAPI: public TestParams<std::tuple<
+                            int,       // input matrix depth
+                            cv::Size,
+                            double>>   // tolerance
+{};
 //------------------------------------------------------------------------------
 
 struct ResizeTestIE: public testing::TestWithParam<std::tuple<int, int, std::pair<cv::Size, cv::Size>, double>> {};
+struct LetterboxTestIE: public testing::TestWithParam<std::tuple<int, std::pair<cv::Size, cv::Size>, double>> {};
 
 struct SplitTestIE: public TestParams<std::tuple<int, cv::Size, double>> {};
 struct MergeTestIE: public TestParams<std::tuple<int, cv::Size, double>> {};
@@ -48,6 +54,20 @@ struct ColorConvertYUV420TestIE:
                                              double>>                       // tolerance
 {};
 
+struct NormalizeYUV420TestIE:
+    public testing::TestWithParam<std::tuple<InferenceEngine::ColorFormat,  // input color format NV12 or I420
+                                             InferenceEngine::Layout,       // output layout
+                                             std::pair<cv::Size, cv::Size>, // input and output sizes
+                                             double>>                       // tolerance
+{};
+
+struct BatchedROIsTestIE:
+    public testing::TestWithParam<std::tuple<InferenceEngine::ColorFormat,  // input color format BGR, NV12 or I420
+                                             InferenceEngine::Layout,       // output layout
+                                             std::pair<cv::Size, cv::Size>, // input and output sizes
+                                             double>>                       // tolerance
+{};
+
 struct PrecisionConvertTestIE: public TestParams<std::tuple<cv::Size,
                                                             int,     // input  matrix depth
                                                             int,     // output matrix depth
@@ -183,6 +183,11 @@ INSTANTIATE_TEST_CASE_P(ConvertDepthFluid, ConvertDepthTestGAPI,
                                        cv::Size( 320,  200)),
                                 Values(1)));
 
+INSTANTIATE_TEST_CASE_P(NormalizeFluid, NormalizeTestGAPI,
+                        Combine(Values(CV_8U, CV_16U, CV_32F),
+                                Values(TEST_SIZES),
+                                Values(1e-5)));
+
 INSTANTIATE_TEST_CASE_P(ResizeRoiTestFluid, ResizeRoiTestGAPI,
                         Combine(Values(CV_8UC1, CV_8UC3),
                                 Values(cv::INTER_LINEAR),
@@ -225,6 +230,28 @@ INSTANTIATE_TEST_CASE_P(ResizeTestFluid_F32, ResizeTestIE,
                                 Values(TEST_RESIZE_PAIRS),
                                 Values(0.05))); // error within 0.05 units
 
+INSTANTIATE_TEST_CASE_P(ResizeCubicTestFluid_U8, ResizeTestIE,
+                        Combine(Values(CV_8UC1, CV_8UC3),
+                                Values(cv::INTER_CUBIC),
+                                Values(TEST_RESIZE_PAIRS),
+                                Values(1))); // error not more than 1 unit
+
+INSTANTIATE_TEST_CASE_P(ResizeCubicTestFluid_F32, ResizeTestIE,
+                        Combine(Values(CV_32FC1, CV_32FC3),
+                                Values(cv::INTER_CUBIC),
+                                Values(TEST_RESIZE_PAIRS),
+                                Values(0.05))); // error within 0.05 units
+
+INSTANTIATE_TEST_CASE_P(LetterboxTestFluid_U8, LetterboxTestIE,
+                        Combine(Values(CV_8UC1, CV_8UC3),
+                                Values(TEST_RESIZE_PAIRS),
+                                Values(1))); // error not more than 1 unit
+
+INSTANTIATE_TEST_CASE_P(LetterboxTestFluid_F32, LetterboxTestIE,
+                        Combine(Values(CV_32FC1, CV_32FC3),
+                                Values(TEST_RESIZE_PAIRS),
+                                Values(0.05))); // error within 0.05 units
+
 INSTANTIATE_TEST_CASE_P(SplitTestFluid, SplitTestIE,
                         Combine(Values(CV_8UC2, CV_8UC3, CV_8UC4,
                                        CV_32FC2, CV_32FC3, CV_32FC4),
@@ -268,6 +295,21 @@ INSTANTIATE_TEST_CASE_P(ColorConvertYUV420Fluid, ColorConvertYUV420TestIE,
                                        cv::Size( 150,  150)),
                                 Values(0)));
 
+INSTANTIATE_TEST_CASE_P(NormalizeYUV420Fluid, NormalizeYUV420TestIE,
+                        Combine(Values(InferenceEngine::NV12, InferenceEngine::I420),
+                                Values(InferenceEngine::NHWC, InferenceEngine::NCHW),
+                                Values(std::make_pair(cv::Size(1920, 1080), cv::Size(224, 224)),
+                                       std::make_pair(cv::Size(1920, 1080), cv::Size(1920, 1080)),
+                                       std::make_pair(cv::Size( 640,  480), cv::Size( 300,  300))),
+                                Values(1e-5)));
+
+INSTANTIATE_TEST_CASE_P(BatchedROIsFluid, BatchedROIsTestIE,
+                        Combine(Values(InferenceEngine::BGR, InferenceEngine::NV12, InferenceEngine::I420),
+                                Values(InferenceEngine::NHWC, InferenceEngine::NCHW),
+                                Values(std::make_pair(cv::Size(1920, 1080), cv::Size(224, 224)),
+                                       std::make_pair(cv::Size( 640,  480), cv::Size( 300,  300))),
+                                Values(0)));
+
 INSTANTIATE_TEST_CASE_P(Reorder_HWC2CHW, ColorConvertTestIE,
                         Combine(Values(CV_8U, CV_32F),
                                 Values(InferenceEngine::ColorFormat::BGR),
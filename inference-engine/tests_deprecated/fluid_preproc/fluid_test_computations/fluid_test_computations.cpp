@@ -225,3 +225,15 @@ ConvertDepthComputation::ConvertDepthComputation(test::Mat inMat, test::Mat outM
                                })
 {}
 
+NormalizeComputation::NormalizeComputation(test::Mat inMat, test::Mat outMat, float mean, float scale)
+    : FluidComputation(new Priv{ [mean, scale, outMat]()-> cv::GComputation {
+                                    cv::GMat in;
+                                    cv::GMat out = InferenceEngine::gapi::NormalizePlane::on(in, mean, scale,
+                                                                                             CV_MAT_DEPTH(outMat.type));
+                                    return cv::GComputation(cv::GIn(in), cv::GOut(out));
+                                 }()
+                               , {to_own(inMat)}
+                               , {to_own(outMat)}
+                               })
+{}
+
@@ -104,4 +104,10 @@ public:
     ConvertDepthComputation(test::Mat inMat, test::Mat outMat, int depth);
 };
 
+class FLUID_COMPUTATION_VISIBILITY NormalizeComputation : public FluidComputation
+{
+public:
+    NormalizeComputation(test::Mat inMat, test::Mat outMat, float mean, float scale);
+};
+
 #endif // FLUID_TEST_COMPUTATIONS_HPP
@@ -63,7 +63,7 @@ namespace ngraph
                  const ParameterVector& parameters,
                  const std::string& name = "");
 
-        virtual ~Function() {}
+        virtual ~Function();
         /// Return the number of outputs for this function.
         size_t get_output_size() const;
 
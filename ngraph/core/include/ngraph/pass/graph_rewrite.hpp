@@ -117,11 +117,14 @@ namespace ngraph
         /// class.
         /// As a default algorithm graph rewrite pass traverse Function in topological order and
         /// applies
-        /// registered matcher passes for each node. But if all registered matcher passes have type
-        /// based
-        /// root node in Matcher pattern then efficient mechanism is used to execute them.
-        /// Matcher pattern root is type based if it's operation from opset or
+        /// registered matcher passes for each node. Matcher passes which have type based root node
+        /// in Matcher pattern are executed only for nodes of this type (or derived types), the
+        /// list of matchers for each node type is computed once per run. Matcher passes with
+        /// untyped root are executed for every node. Nodes replaced by previous rewrites are
+        /// skipped. Matcher pattern root is type based if it's operation from opset or
         /// pattern::op::WrapType.
+        /// When NGRAPH_PROFILE_PASS_ENABLE environment variable is set, time spent in each
+        /// matcher pass and number of successful rewrites are reported.
         /// Note: when implementing pattern for Matcher make sure that root node is an operation
         /// from opset
         /// or has ngraph::pattern::op::WrapType. That will help GraphRewrite to execute matcher
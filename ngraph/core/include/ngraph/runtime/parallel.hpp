@@ -0,0 +1,71 @@
+//*****************************************************************************
+// Copyright 2017-2021 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+#pragma once
+
+#include <cstddef>
+#include <functional>
+
+#include "ngraph/ngraph_visibility.hpp"
+
+namespace ngraph
+{
+    namespace runtime
+    {
+        /// \brief Minimal number of elements of a simple elementwise kernel worth a thread.
+        constexpr size_t parallel_elementwise_grain = 64 * 1024;
+
+        /// \brief Returns the number of threads parallel_for may split work between.
+        ///
+        /// Returns 1 outside of a ParallelThreadsLimit scope lifting the limit and when called from
+        /// a parallel_for body, as nested regions run serially.
+        NGRAPH_API
+        size_t parallel_get_max_threads();
+
+        /// \brief Limits the number of threads parallel_for calls made from the current thread
+        ///        may use while the object is alive.
+        ///
+        /// parallel_for runs serially by default, so that kernels don't compete with the threads
+        /// of the caller. Callers which know their thread budget, like a plugin running
+        /// ConstantFolding with its configured number of threads, raise the limit for their scope.
+        class NGRAPH_API ParallelThreadsLimit
+        {
+        public:
+            /// \param max_threads Maximal number of threads, 0 lifts the limit.
+            explicit ParallelThreadsLimit(size_t max_threads);
+            ~ParallelThreadsLimit();
+
+            ParallelThreadsLimit(const ParallelThreadsLimit&) = delete;
+            ParallelThreadsLimit& operator=(const ParallelThreadsLimit&) = delete;
+
+        private:
+            size_t m_outer_limit;
+        };
+
+        /// \brief Runs \p fn on disjoint chunks of [0, \p work_amount) concurrently.
+        ///
+        /// Work is split evenly between at most parallel_get_max_threads() threads, so that each
+        /// chunk holds at least \p grain items. Small amounts of work and nested calls run in the
+        /// calling thread. The first exception thrown by \p fn is rethrown in the calling thread.
+        ///
+        /// \param work_amount Number of items to process.
+        /// \param grain Minimal number of items worth a separate thread.
+        /// \param fn Functor called as fn(begin, end) for each chunk.
+        NGRAPH_API
+        void parallel_for(size_t work_amount,
+                          size_t grain,
+                          const std::function<void(size_t, size_t)>& fn);
+    }
+}
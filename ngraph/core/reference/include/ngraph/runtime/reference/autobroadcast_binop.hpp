@@ -21,6 +21,7 @@
 #include <utility>
 #include "ngraph/coordinate_transform.hpp"
 #include "ngraph/op/util/attr_types.hpp"
+#include "ngraph/runtime/parallel.hpp"
 #include "ngraph/shape_util.hpp"
 
 namespace ngraph
@@ -53,47 +54,136 @@ namespace ngraph
                     return idx < padding ? std::forward<T>(default_value) : arr[idx - padding];
                 }
 
-                template <int A0, int A1, typename T, typename U, typename Functor>
+                /// \brief Output dimensions of a numpy broadcast with element strides of both
+                ///        inputs along them (0 along broadcast dimensions).
+                ///
+                /// Unit dimensions are dropped and adjacent dimensions are merged when both inputs
+                /// are broadcast or not along them, so the innermost dimension is the longest run
+                /// an input is either contiguous or constant along.
+                struct BroadcastLoops
+                {
+                    std::vector<size_t> dims;
+                    std::vector<size_t> strides0;
+                    std::vector<size_t> strides1;
+
+                    BroadcastLoops(const Shape& arg0_shape, const Shape& arg1_shape)
+                    {
+                        const size_t rank = std::max(arg0_shape.size(), arg1_shape.size());
+                        const size_t padding0 = rank - arg0_shape.size();
+                        const size_t padding1 = rank - arg1_shape.size();
+
+                        std::vector<bool> full0, full1;
+                        for (size_t i = 0; i < rank; i++)
+                        {
+                            const size_t dim0 = value_with_padding_or(arg0_shape, padding0, i, 1);
+                            const size_t dim1 = value_with_padding_or(arg1_shape, padding1, i, 1);
+                            const size_t dim = std::max(dim0, dim1);
+                            if (dim == 1)
+                            {
+                                continue;
+                            }
+
+                            const bool is_full0 = dim0 != 1;
+                            const bool is_full1 = dim1 != 1;
+                            if (!dims.empty() && full0.back() == is_full0 &&
+                                full1.back() == is_full1)
+                            {
+                                dims.back() *= dim;
+                            }
+                            else
+                            {
+                                dims.push_back(dim);
+                                full0.push_back(is_full0);
+                                full1.push_back(is_full1);
+                            }
+                        }
+
+                        strides0.resize(dims.size());
+                        strides1.resize(dims.size());
+                        size_t size0 = 1, size1 = 1;
+                        for (size_t i = dims.size(); i-- > 0;)
+                        {
+                            strides0[i] = full0[i] ? size0 : 0;
+                            strides1[i] = full1[i] ? size1 : 0;
+                            size0 *= full0[i] ? dims[i] : 1;
+                            size1 *= full1[i] ? dims[i] : 1;
+                        }
+                    }
+                };
+
+                template <typename T, typename U, typename Functor>
                 inline void numpy_autobroadcast_binop(const T* arg0,
                                                       const T* arg1,
                                                       U* out,
-                                                      const Shape& shape0,
-                                                      const Shape& shape1,
-                                                      const size_t* strides0,
-                                                      const size_t* strides1,
-                                                      const size_t padding0,
-                                                      const size_t padding1,
-                                                      const Shape& output_shape,
-                                                      const size_t axis,
-                                                      const size_t stride,
+                                                      const Shape& arg0_shape,
+                                                      const Shape& arg1_shape,
                                                       Functor elementwise_functor)
                 {
-                    for (CoordinateIterator it(output_shape), ite = CoordinateIterator::end();;)
+                    const BroadcastLoops loops(arg0_shape, arg1_shape);
+                    if (loops.dims.empty())
                     {
-                        for (size_t i = 0; i < stride; ++i)
-                            *out++ = elementwise_functor(arg0[i * A0], arg1[i * A1]);
-
-                        arg0 += A0 ? stride : 1;
-                        arg1 += A1 ? stride : 1;
-
-                        auto p = it.advance(axis);
+                        out[0] = elementwise_functor(arg0[0], arg1[0]);
+                        return;
+                    }
 
-                        if (it == ite)
-                            break;
+                    const size_t rank = loops.dims.size();
+                    const size_t inner = loops.dims.back();
+                    const size_t inner_stride0 = loops.strides0.back();
+                    const size_t inner_stride1 = loops.strides1.back();
+                    const size_t outer = shape_size(loops.dims) / inner;
+
+                    const auto run = [&](size_t begin, size_t end) {
+                        // coordinates of the first row of the chunk in the outer dimensions
+                        std::vector<size_t> coord(rank, 0);
+                        size_t offset0 = 0, offset1 = 0;
+                        for (size_t i = rank - 1, rest = begin; i-- > 0;)
+                        {
+                            coord[i] = rest % loops.dims[i];
+                            rest /= loops.dims[i];
+                            offset0 += coord[i] * loops.strides0[i];
+                            offset1 += coord[i] * loops.strides1[i];
+                        }
 
-                        if (value_with_padding_or(shape0, padding0, p, 1) == 1)
-                            arg0 -= strides0[p];
+                        for (size_t row = begin; row < end; ++row)
+                        {
+                            const T* in0 = arg0 + offset0;
+                            const T* in1 = arg1 + offset1;
+                            U* dst = out + row * inner;
+                            if (inner_stride0 && inner_stride1)
+                            {
+                                for (size_t j = 0; j < inner; ++j)
+                                    dst[j] = elementwise_functor(in0[j], in1[j]);
+                            }
+                            else if (inner_stride0)
+                            {
+                                const T value1 = in1[0];
+                                for (size_t j = 0; j < inner; ++j)
+                                    dst[j] = elementwise_functor(in0[j], value1);
+                            }
+                            else
+                            {
+                                const T value0 = in0[0];
+                                for (size_t j = 0; j < inner; ++j)
+                                    dst[j] = elementwise_functor(value0, in1[j]);
+                            }
 
-                        if (value_with_padding_or(shape1, padding1, p, 1) == 1)
-                            arg1 -= strides1[p];
-                    }
-                }
+                            // advance outer coordinates
+                            for (size_t i = rank - 1; i-- > 0;)
+                            {
+                                offset0 += loops.strides0[i];
+                                offset1 += loops.strides1[i];
+                                if (++coord[i] < loops.dims[i])
+                                    break;
+                                offset0 -= coord[i] * loops.strides0[i];
+                                offset1 -= coord[i] * loops.strides1[i];
+                                coord[i] = 0;
+                            }
+                        }
+                    };
 
-                inline size_t calculate_fixed_axis(size_t axis, const size_t* strides)
-                {
-                    while (axis > 0 && strides[axis - 1] == 1)
-                        --axis;
-                    return axis;
+                    parallel_for(outer,
+                                 std::max<size_t>(1, parallel_elementwise_grain / inner),
+                                 run);
                 }
             }
 
@@ -126,10 +216,14 @@ namespace ngraph
                 switch (broadcast_spec.m_type)
                 {
                 case op::AutoBroadcastType::NONE:
-                    for (size_t i = 0; i < shape_size(arg0_shape); i++)
-                    {
-                        out[i] = elementwise_functor(arg0[i], arg1[i]);
-                    }
+                    parallel_for(shape_size(arg0_shape),
+                                 parallel_elementwise_grain,
+                                 [&](size_t begin, size_t end) {
+                                     for (size_t i = begin; i < end; i++)
+                                     {
+                                         out[i] = elementwise_functor(arg0[i], arg1[i]);
+                                     }
+                                 });
                     break;
                 case op::AutoBroadcastType::NUMPY:
                     // We'll be using CoordinateTransform to handle the broadcasting. The general
@@ -153,115 +247,12 @@ namespace ngraph
                     //                 Output shape
                     //                 ------------
                     //                 [ 3, 2, 6]
-                    {
-                        using namespace internal;
-
-                        size_t const shape_rank =
-                            std::max(arg0_shape.size(), arg1_shape.size()) + 1;
-
-                        // TODO: Use compiler-specific alloca() or variable-length array
-                        std::vector<size_t> tmp(shape_rank * 2);
-
-                        size_t* strides0 = tmp.data();
-                        size_t* strides1 = tmp.data() + shape_rank;
-
-                        row_major_strides(arg0_shape, strides0, shape_rank);
-                        row_major_strides(arg1_shape, strides1, shape_rank);
-
-                        size_t const padding0 = shape_rank - arg0_shape.size();
-                        size_t const padding1 = shape_rank - arg1_shape.size();
-
-                        Shape output_shape(shape_rank, 0);
-
-                        size_t axis = 0;
-
-                        for (size_t i = 0; i < shape_rank; i++)
-                        {
-                            auto const dim0 = value_with_padding_or(arg0_shape, padding0, i, 1);
-                            auto const dim1 = value_with_padding_or(arg1_shape, padding1, i, 1);
-
-                            output_shape[i] = std::max(dim0, dim1);
-
-                            if (dim0 != dim1)
-                                axis = std::max(axis, i);
-                        }
-#if 0
-                        // Universal function without optimisations
-                        CoordinateTransformBasic arg0_transform(arg0_shape);
-                        CoordinateTransformBasic arg1_transform(arg1_shape);
-                        U *dst = out;
-
-                        for(CoordinateIterator it(output_shape),
-                            ite = CoordinateIterator::end();
-                            it != ite;
-                            ++it)
-                        {
-                            const Coordinate& output_coord = *it;
-                            size_t const idx0 = arg0_transform.index(output_coord);
-                            size_t const idx1 = arg1_transform.index(output_coord);
-                            *dst++ = elementwise_functor(arg0[idx0], arg1[idx1]);
-                        }
-#else
-
-                        if (axis == 0)
-                        {
-                            for (size_t i = 0, end = strides0[0]; i < end; ++i)
-                                out[i] = elementwise_functor(arg0[i], arg1[i]);
-                        }
-                        else if (strides0[axis] == 1 &&
-                                 value_with_padding_or(arg0_shape, padding0, axis, 1) == 1)
-                        {
-                            axis = calculate_fixed_axis(axis, strides0);
-
-                            numpy_autobroadcast_binop<0, 1>(arg0,
-                                                            arg1,
-                                                            out,
-                                                            arg0_shape,
-                                                            arg1_shape,
-                                                            strides0,
-                                                            strides1,
-                                                            padding0,
-                                                            padding1,
-                                                            output_shape,
-                                                            axis,
-                                                            strides1[axis],
-                                                            elementwise_functor);
-                        }
-                        else if (strides1[axis] == 1 &&
-                                 value_with_padding_or(arg1_shape, padding1, axis, 1) == 1)
-                        {
-                            axis = calculate_fixed_axis(axis, strides1);
-
-                            numpy_autobroadcast_binop<1, 0>(arg0,
-                                                            arg1,
-                                                            out,
-                                                            arg0_shape,
-                                                            arg1_shape,
-                                                            strides0,
-                                                            strides1,
-                                                            padding0,
-                                                            padding1,
-                                                            output_shape,
-                                                            axis,
-                                                            strides0[axis],
-                                                            elementwise_functor);
-                        }
-                        else
-                            numpy_autobroadcast_binop<1, 1>(arg0,
-                                                            arg1,
-                                                            out,
-                                                            arg0_shape,
-                                                            arg1_shape,
-                                                            strides0,
-                                                            strides1,
-                                                            padding0,
-                                                            padding1,
-                                                            output_shape,
-                                                            axis,
-                                                            strides0[axis],
-                                                            elementwise_functor);
-#endif
-                    }
+                    //
+                    // Instead of iterating coordinates, the loops over the output shape are
+                    // collapsed to contiguous runs (see internal::BroadcastLoops), which are split
+                    // between threads.
+                    internal::numpy_autobroadcast_binop(
+                        arg0, arg1, out, arg0_shape, arg1_shape, elementwise_functor);
                     break;
                 case op::AutoBroadcastType::PDPD:
                     // We'll be using CoordinateTransform to handle the broadcasting. No need to
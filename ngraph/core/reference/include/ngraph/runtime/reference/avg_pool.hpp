@@ -24,6 +24,7 @@
 
 #include "ngraph/axis_vector.hpp"
 #include "ngraph/coordinate_transform.hpp"
+#include "ngraph/runtime/parallel.hpp"
 #include "ngraph/shape.hpp"
 
 namespace ngraph
@@ -134,118 +135,132 @@ namespace ngraph
             {
                 auto old_mode = std::fegetround();
                 std::fesetround(FE_TONEAREST);
-                // At the outermost level we will walk over every output coordinate O.
-                CoordinateTransform output_transform(out_shape);
-
-                for (const Coordinate& out_coord : output_transform)
-                {
-                    // Our output coordinate O will have the form:
-                    //
-                    //   (N,chan,i_1,...,i_n)
-
-                    size_t batch_index = out_coord[0];
-                    size_t channel = out_coord[1];
-
-                    // For the input data we need to iterate the coordinate:
-                    //
-                    //   I:
-                    //
-                    // over the range (noninclusive on the right):
-                    //
-                    //   (N,chan,s_1*i_1,s_2*i_2,...,s_n*i_n) ->
-                    //
-                    //     (N+1,chan+1,s_1*i_1 + window_shape_1,...,s_n*i_n + window_shape_n)
-                    //
-                    // with unit stride.
-                    //
-                    // We iterate this over the *padded* data, so below we will need to check for
-                    // coordinates that fall in the padding area.
-
-                    size_t n_spatial_dimensions = arg_shape.size() - 2;
-
-                    Coordinate input_batch_transform_start(2 + n_spatial_dimensions);
-                    Coordinate input_batch_transform_end(2 + n_spatial_dimensions);
-                    Strides input_batch_transform_source_strides(2 + n_spatial_dimensions, 1);
-                    AxisVector input_batch_transform_source_axis_order(2 + n_spatial_dimensions);
-                    CoordinateDiff input_batch_transform_padding_below(2 + n_spatial_dimensions);
-                    CoordinateDiff input_batch_transform_padding_above(2 + n_spatial_dimensions);
-
-                    input_batch_transform_start[0] = batch_index;
-                    input_batch_transform_end[0] = batch_index + 1;
-                    input_batch_transform_start[1] = channel;
-                    input_batch_transform_end[1] = channel + 1;
-                    input_batch_transform_padding_below[0] = 0;
-                    input_batch_transform_padding_below[1] = 0;
-                    input_batch_transform_padding_above[0] = 0;
-                    input_batch_transform_padding_above[1] = 0;
-
-                    for (size_t i = 2; i < n_spatial_dimensions + 2; i++)
-                    {
-                        size_t window_shape_this_dim = window_shape[i - 2];
-                        size_t movement_stride = window_movement_strides[i - 2];
-
-                        input_batch_transform_start[i] = movement_stride * out_coord[i];
-                        input_batch_transform_end[i] =
-                            input_batch_transform_start[i] + window_shape_this_dim;
-                        input_batch_transform_padding_below[i] = padding_below[i - 2];
-                        input_batch_transform_padding_above[i] = padding_above[i - 2];
-                    }
-
-                    for (size_t i = 0; i < arg_shape.size(); i++)
-                    {
-                        input_batch_transform_source_axis_order[i] = i;
-                    }
-
-                    CoordinateTransform input_batch_transform(
-                        arg_shape,
-                        input_batch_transform_start,
-                        input_batch_transform_end,
-                        input_batch_transform_source_strides,
-                        input_batch_transform_source_axis_order,
-                        input_batch_transform_padding_below,
-                        input_batch_transform_padding_above);
-
-                    // As we go, we compute the sum value:
-                    //
-                    //   output[O] := output[O] + arg[I]
-                    //
-                    // and the number of elements:
-                    //
-                    //   n_elements := n_elements + 1
-
-                    T result = 0;
-                    size_t n_elements = 0;
-
-                    for (const Coordinate& input_batch_coord : input_batch_transform)
-                    {
-                        bool in_bounds =
-                            input_batch_transform.has_source_coordinate(input_batch_coord);
-
-                        if (in_bounds || include_padding_in_avg_computation)
+                // At the outermost level we will walk over every output coordinate O. Output
+                // elements are computed independently, so they are split between threads.
+                const size_t window_size = std::max<size_t>(shape_size(window_shape), 1);
+                parallel_for(
+                    shape_size(out_shape),
+                    std::max<size_t>(1, parallel_elementwise_grain / window_size),
+                    [&](size_t begin, size_t end) {
+                        Coordinate out_coord(out_shape.size());
+                        for (size_t out_index = begin; out_index < end; ++out_index)
                         {
-                            T v = in_bounds ? arg[input_batch_transform.index(input_batch_coord)]
-                                            : static_cast<T>(0);
-                            result += v;
-                            n_elements++;
+                            for (size_t i = out_shape.size(), rest = out_index; i-- > 0;)
+                            {
+                                out_coord[i] = rest % out_shape[i];
+                                rest /= out_shape[i];
+                            }
+
+                            // Our output coordinate O will have the form:
+                            //
+                            //   (N,chan,i_1,...,i_n)
+
+                            size_t batch_index = out_coord[0];
+                            size_t channel = out_coord[1];
+
+                            // For the input data we need to iterate the coordinate:
+                            //
+                            //   I:
+                            //
+                            // over the range (noninclusive on the right):
+                            //
+                            //   (N,chan,s_1*i_1,s_2*i_2,...,s_n*i_n) ->
+                            //
+                            //     (N+1,chan+1,s_1*i_1 + window_shape_1,...,
+                            //      s_n*i_n + window_shape_n)
+                            //
+                            // with unit stride.
+                            //
+                            // We iterate this over the *padded* data, so below we will need to
+                            // check for coordinates that fall in the padding area.
+
+                            size_t n_spatial_dimensions = arg_shape.size() - 2;
+
+                            Coordinate input_batch_transform_start(arg_shape.size());
+                            Coordinate input_batch_transform_end(arg_shape.size());
+                            Strides input_batch_transform_source_strides(arg_shape.size(), 1);
+                            AxisVector input_batch_transform_source_axis_order(arg_shape.size());
+                            CoordinateDiff input_batch_transform_padding_below(arg_shape.size());
+                            CoordinateDiff input_batch_transform_padding_above(arg_shape.size());
+
+                            input_batch_transform_start[0] = batch_index;
+                            input_batch_transform_end[0] = batch_index + 1;
+                            input_batch_transform_start[1] = channel;
+                            input_batch_transform_end[1] = channel + 1;
+                            input_batch_transform_padding_below[0] = 0;
+                            input_batch_transform_padding_below[1] = 0;
+                            input_batch_transform_padding_above[0] = 0;
+                            input_batch_transform_padding_above[1] = 0;
+
+                            for (size_t i = 2; i < n_spatial_dimensions + 2; i++)
+                            {
+                                size_t window_shape_this_dim = window_shape[i - 2];
+                                size_t movement_stride = window_movement_strides[i - 2];
+
+                                input_batch_transform_start[i] = movement_stride * out_coord[i];
+                                input_batch_transform_end[i] =
+                                    input_batch_transform_start[i] + window_shape_this_dim;
+                                input_batch_transform_padding_below[i] = padding_below[i - 2];
+                                input_batch_transform_padding_above[i] = padding_above[i - 2];
+                            }
+
+                            for (size_t i = 0; i < arg_shape.size(); i++)
+                            {
+                                input_batch_transform_source_axis_order[i] = i;
+                            }
+
+                            CoordinateTransform input_batch_transform(
+                                arg_shape,
+                                input_batch_transform_start,
+                                input_batch_transform_end,
+                                input_batch_transform_source_strides,
+                                input_batch_transform_source_axis_order,
+                                input_batch_transform_padding_below,
+                                input_batch_transform_padding_above);
+
+                            // As we go, we compute the sum value:
+                            //
+                            //   output[O] := output[O] + arg[I]
+                            //
+                            // and the number of elements:
+                            //
+                            //   n_elements := n_elements + 1
+
+                            T result = 0;
+                            size_t n_elements = 0;
+
+                            for (const Coordinate& input_batch_coord : input_batch_transform)
+                            {
+                                bool in_bounds =
+                                    input_batch_transform.has_source_coordinate(input_batch_coord);
+
+                                if (in_bounds || include_padding_in_avg_computation)
+                                {
+                                    T v = in_bounds
+                                              ? arg[input_batch_transform.index(input_batch_coord)]
+                                              : static_cast<T>(0);
+                                    result += v;
+                                    n_elements++;
+                                }
+                            }
+
+                            if (n_elements == 0)
+                            {
+                                throw std::runtime_error("AvgPool elements == 0, must be non-zero");
+                            }
+
+                            if (std::is_same<T, int8_t>::value || std::is_same<T, uint8_t>::value)
+                            {
+                                out[out_index] = static_cast<T>(
+                                    std::nearbyint(static_cast<float>(result) / n_elements));
+                            }
+                            else
+                            {
+                                out[out_index] = result / n_elements;
+                            }
                         }
-                    }
-
-                    if (n_elements == 0)
-                    {
-                        throw std::runtime_error("AvgPool elements == 0, must be non-zero");
-                    }
-
-                    if (std::is_same<T, int8_t>::value || std::is_same<T, uint8_t>::value)
-                    {
-                        out[output_transform.index(out_coord)] =
-                            static_cast<T>(std::nearbyint(static_cast<float>(result) / n_elements));
-                    }
-                    else
-                    {
-                        out[output_transform.index(out_coord)] = result / n_elements;
-                    }
-                    std::fesetround(old_mode);
-                }
+                    });
+                std::fesetround(old_mode);
             }
         }
     }
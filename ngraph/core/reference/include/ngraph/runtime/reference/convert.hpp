@@ -18,6 +18,7 @@
 
 #include <cstddef>
 
+#include "ngraph/runtime/parallel.hpp"
 #include "ngraph/type/float16.hpp"
 
 namespace ngraph
@@ -30,25 +31,33 @@ namespace ngraph
             typename std::enable_if<!std::is_same<TO, char>::value>::type
                 convert(const TI* arg, TO* out, size_t count)
             {
-                for (size_t i = 0; i < count; ++i)
-                {
-                    out[i] = static_cast<TO>(arg[i]);
-                }
+                parallel_for(count, parallel_elementwise_grain, [=](size_t begin, size_t end) {
+                    for (size_t i = begin; i < end; ++i)
+                    {
+                        out[i] = static_cast<TO>(arg[i]);
+                    }
+                });
             }
 
             template <>
             void convert<uint8_t, float16>(const uint8_t* arg, float16* out, size_t count);
             template <>
             void convert<float16, float>(const float16* arg, float* out, size_t count);
+            template <>
+            void convert<uint8_t, float>(const uint8_t* arg, float* out, size_t count);
+            template <>
+            void convert<int8_t, float>(const int8_t* arg, float* out, size_t count);
 
             template <typename TI, typename TO>
             typename std::enable_if<std::is_same<TO, char>::value>::type
                 convert(const TI* arg, TO* out, size_t count)
             {
-                for (size_t i = 0; i < count; ++i)
-                {
-                    out[i] = static_cast<char>(static_cast<bool>(arg[i]));
-                }
+                parallel_for(count, parallel_elementwise_grain, [=](size_t begin, size_t end) {
+                    for (size_t i = begin; i < end; ++i)
+                    {
+                        out[i] = static_cast<char>(static_cast<bool>(arg[i]));
+                    }
+                });
             }
 
         } // namespace reference
@@ -24,6 +24,7 @@
 
 #include "ngraph/axis_vector.hpp"
 #include "ngraph/coordinate_transform.hpp"
+#include "ngraph/runtime/parallel.hpp"
 #include "ngraph/runtime/reference/concat.hpp"
 #include "ngraph/runtime/reference/helpers.hpp"
 #include "ngraph/runtime/reference/reverse.hpp"
@@ -216,17 +217,34 @@ namespace ngraph
                 const Shape filter_shape(++filters_shape.begin(), filters_shape.end());
                 const size_t filter_size = shape_size(filter_shape);
 
-                auto batch = in;
-                for (size_t batch_idx = 0; batch_idx < batches_count; ++batch_idx)
+                const size_t out_channels_count = batches_count * filters_count;
+                if (out_channels_count == 0)
                 {
-                    auto filter = f;
-                    for (size_t f_idx = 0; f_idx < filters_count; ++f_idx)
-                    {
-                        convolve_3D_channels(params, batch, batch_shape, filter, filter_shape, out);
-                        filter += filter_size;
-                    }
-                    batch += batch_size;
+                    return;
                 }
+                const size_t out_channel_size = shape_size(out_shape) / out_channels_count;
+
+                // output channels of all batches are computed independently
+                parallel_for(
+                    out_channels_count,
+                    std::max<size_t>(
+                        1,
+                        parallel_elementwise_grain /
+                            std::max<size_t>(out_channel_size * filter_size, 1)),
+                    [&](size_t begin, size_t end) {
+                        for (size_t out_ch_idx = begin; out_ch_idx < end; ++out_ch_idx)
+                        {
+                            const size_t batch_idx = out_ch_idx / filters_count;
+                            const size_t f_idx = out_ch_idx % filters_count;
+                            T* out_channel = out + out_ch_idx * out_channel_size;
+                            convolve_3D_channels(params,
+                                                 in + batch_idx * batch_size,
+                                                 batch_shape,
+                                                 f + f_idx * filter_size,
+                                                 filter_shape,
+                                                 out_channel);
+                        }
+                    });
             }
 
             // DEPRECATED, can't be removed currently due to kmb-plugin dependency (#47799)
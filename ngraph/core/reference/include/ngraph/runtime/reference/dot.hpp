@@ -16,12 +16,15 @@
 
 #pragma once
 
+#include <algorithm>
 #include <cmath>
 #include <utility>
+#include <vector>
 
 #include <cfenv>
 #include <functional>
 #include "ngraph/coordinate_transform.hpp"
+#include "ngraph/runtime/parallel.hpp"
 #include "ngraph/runtime/reference/helpers.hpp"
 #include "ngraph/shape_util.hpp"
 
@@ -56,114 +59,126 @@ namespace ngraph
                     is_quantized = true;
                 }
 
-                auto old_mode = std::fegetround();
-                std::fesetround(FE_TONEAREST);
-                // Get the sizes of the dot axes. It's easiest to pull them from arg1 because
-                // they're right up front.
-                Shape dot_axis_sizes(reduction_axes_count);
-                std::copy(arg1_shape.begin(),
-                          arg1_shape.begin() + reduction_axes_count,
-                          dot_axis_sizes.begin());
-
-                CoordinateTransform arg0_transform(arg0_shape);
-                CoordinateTransform arg1_transform(arg1_shape);
-                CoordinateTransform output_transform(out_shape);
-
-                // Create coordinate transforms for arg0 and arg1 that throw away the dotted axes.
-                size_t arg0_projected_rank = arg0_shape.size() - reduction_axes_count;
-                size_t arg1_projected_rank = arg1_shape.size() - reduction_axes_count;
-
-                Shape arg0_projected_shape(arg0_projected_rank);
-                std::copy(arg0_shape.begin(),
-                          arg0_shape.begin() + arg0_projected_rank,
-                          arg0_projected_shape.begin());
-
-                Shape arg1_projected_shape(arg1_projected_rank);
-                std::copy(arg1_shape.begin() + reduction_axes_count,
-                          arg1_shape.end(),
-                          arg1_projected_shape.begin());
-
-                CoordinateTransform arg0_projected_transform(arg0_projected_shape);
-                CoordinateTransform arg1_projected_transform(arg1_projected_shape);
-
-                // Create a coordinate transform that allows us to iterate over all possible values
-                // for the dotted axes.
-                CoordinateTransform dot_axes_transform(dot_axis_sizes);
-
-                for (const Coordinate& arg0_projected_coord : arg0_projected_transform)
+                // arg0 is a row-major [rows, dot_size] matrix, where dot_size is the product of
+                // its last reduction_axes_count dimensions, arg1 is a row-major [dot_size, cols]
+                // one and the output is [rows, cols]. The output is computed by tiles in
+                // parallel, every element accumulates products in the increasing order along the
+                // dotted axes, so blocking doesn't change results.
+                size_t rows = 1;
+                for (size_t i = 0; i < arg0_shape.size() - reduction_axes_count; ++i)
                 {
-                    for (const Coordinate& arg1_projected_coord : arg1_projected_transform)
-                    {
-                        // The output coordinate is just the concatenation of the projected
-                        // coordinates.
-                        Coordinate out_coord(arg0_projected_coord.size() +
-                                             arg1_projected_coord.size());
-
-                        auto out_coord_it = std::copy(arg0_projected_coord.begin(),
-                                                      arg0_projected_coord.end(),
-                                                      out_coord.begin());
-                        std::copy(
-                            arg1_projected_coord.begin(), arg1_projected_coord.end(), out_coord_it);
+                    rows *= arg0_shape[i];
+                }
+                size_t dot_size = 1;
+                for (size_t i = 0; i < reduction_axes_count; ++i)
+                {
+                    dot_size *= arg1_shape[i];
+                }
+                size_t cols = 1;
+                for (size_t i = reduction_axes_count; i < arg1_shape.size(); ++i)
+                {
+                    cols *= arg1_shape[i];
+                }
+                if (rows == 0 || cols == 0)
+                {
+                    return;
+                }
 
-                        // Zero out to start the sum.
-                        ACCUMULATION sum = 0;
+                constexpr size_t block_rows = 8;
+                constexpr size_t block_cols = 256;
+                constexpr size_t block_depth = 256;
+                const size_t row_tiles = (rows + block_rows - 1) / block_rows;
+                const size_t col_tiles = (cols + block_cols - 1) / block_cols;
+                const size_t tile_work = block_rows * block_cols * std::max<size_t>(dot_size, 1);
 
-                        size_t out_index = output_transform.index(out_coord);
+                const ACCUMULATION zero_point0 =
+                    is_quantized ? static_cast<ACCUMULATION>(*input0_zero_point) : 0;
+                const ACCUMULATION zero_point1 =
+                    is_quantized ? static_cast<ACCUMULATION>(*input1_zero_point) : 0;
 
-                        // Walk along the dotted axes.
-                        Coordinate arg0_coord(arg0_shape.size());
-                        Coordinate arg1_coord(arg1_shape.size());
-                        auto arg0_it = std::copy(arg0_projected_coord.begin(),
-                                                 arg0_projected_coord.end(),
-                                                 arg0_coord.begin());
-                        for (const Coordinate& dot_axis_positions : dot_axes_transform)
+                auto old_mode = std::fegetround();
+                std::fesetround(FE_TONEAREST);
+                parallel_for(
+                    row_tiles * col_tiles,
+                    std::max<size_t>(1, parallel_elementwise_grain / tile_work),
+                    [&](size_t begin, size_t end) {
+                        std::vector<ACCUMULATION> sums(block_rows * block_cols);
+                        for (size_t tile = begin; tile < end; ++tile)
                         {
-                            // In order to find the points to multiply together, we need to inject
-                            // our current positions along the dotted axes back into the projected
-                            // arg0 and arg1 coordinates.
-                            std::copy(
-                                dot_axis_positions.begin(), dot_axis_positions.end(), arg0_it);
+                            const size_t row_begin = tile / col_tiles * block_rows;
+                            const size_t col_begin = tile % col_tiles * block_cols;
+                            const size_t row_count = std::min(block_rows, rows - row_begin);
+                            const size_t col_count = std::min(block_cols, cols - col_begin);
 
-                            auto arg1_it = std::copy(dot_axis_positions.begin(),
-                                                     dot_axis_positions.end(),
-                                                     arg1_coord.begin());
-                            std::copy(
-                                arg1_projected_coord.begin(), arg1_projected_coord.end(), arg1_it);
+                            // Zero out to start the sums.
+                            std::fill(sums.begin(), sums.end(), ACCUMULATION(0));
 
-                            // Multiply and add to the sum.
-                            if (is_quantized)
+                            for (size_t k_begin = 0; k_begin < dot_size; k_begin += block_depth)
                             {
-                                sum = sum + ((static_cast<ACCUMULATION>(
-                                                  arg0[arg0_transform.index(arg0_coord)]) -
-                                              static_cast<ACCUMULATION>(*input0_zero_point)) *
-                                             (static_cast<ACCUMULATION>(
-                                                  arg1[arg1_transform.index(arg1_coord)]) -
-                                              static_cast<ACCUMULATION>(*input1_zero_point)));
+                                const size_t k_end = std::min(k_begin + block_depth, dot_size);
+                                for (size_t r = 0; r < row_count; ++r)
+                                {
+                                    const INPUT0* arg0_row = arg0 + (row_begin + r) * dot_size;
+                                    ACCUMULATION* sums_row = sums.data() + r * block_cols;
+                                    for (size_t k = k_begin; k < k_end; ++k)
+                                    {
+                                        const INPUT1* arg1_row = arg1 + k * cols + col_begin;
+                                        // Multiply and add to the sums.
+                                        if (is_quantized)
+                                        {
+                                            const ACCUMULATION value0 =
+                                                static_cast<ACCUMULATION>(arg0_row[k]) -
+                                                zero_point0;
+                                            for (size_t c = 0; c < col_count; ++c)
+                                            {
+                                                sums_row[c] =
+                                                    sums_row[c] +
+                                                    value0 *
+                                                        (static_cast<ACCUMULATION>(arg1_row[c]) -
+                                                         zero_point1);
+                                            }
+                                        }
+                                        else
+                                        {
+                                            const ACCUMULATION value0 =
+                                                static_cast<ACCUMULATION>(arg0_row[k]);
+                                            for (size_t c = 0; c < col_count; ++c)
+                                            {
+                                                sums_row[c] =
+                                                    sums_row[c] +
+                                                    value0 * static_cast<ACCUMULATION>(arg1_row[c]);
+                                            }
+                                        }
+                                    }
+                                }
                             }
-                            else
+
+                            // Write the sums back.
+                            for (size_t r = 0; r < row_count; ++r)
                             {
-                                sum = sum + (static_cast<ACCUMULATION>(
-                                                 arg0[arg0_transform.index(arg0_coord)]) *
-                                             static_cast<ACCUMULATION>(
-                                                 arg1[arg1_transform.index(arg1_coord)]));
+                                const ACCUMULATION* sums_row = sums.data() + r * block_cols;
+                                OUTPUT* out_row = out + (row_begin + r) * cols + col_begin;
+                                if (is_quantized)
+                                {
+                                    float scale = *input0_scale * *input1_scale / *output_scale;
+                                    for (size_t c = 0; c < col_count; ++c)
+                                    {
+                                        out_row[c] = static_cast<OUTPUT>(std::round(
+                                                         static_cast<float>(sums_row[c]) * scale)) +
+                                                     *output_zero_point;
+                                    }
+                                }
+                                else
+                                {
+                                    for (size_t c = 0; c < col_count; ++c)
+                                    {
+                                        out_row[c] = sums_row[c];
+                                    }
+                                }
                             }
                         }
-
-                        if (is_quantized)
-                        {
-                            float scale = *input0_scale * *input1_scale / *output_scale;
-                            // Write the sum back.
-                            out[out_index] =
-                                static_cast<OUTPUT>(std::round(static_cast<float>(sum) * scale)) +
-                                *output_zero_point;
-                        }
-                        else
-                        {
-                            out[out_index] = sum;
-                        }
-                    }
-                    std::fesetround(old_mode);
-                }
+                    });
+                std::fesetround(old_mode);
             }
         }
     }
@@ -24,6 +24,7 @@
 #include "ngraph/axis_vector.hpp"
 #include "ngraph/builder/autobroadcast.hpp"
 #include "ngraph/runtime/opt_kernel/reshape.hpp"
+#include "ngraph/runtime/parallel.hpp"
 #include "ngraph/runtime/reference/broadcast.hpp"
 #include "ngraph/runtime/reference/dot.hpp"
 #include "ngraph/shape_util.hpp"
@@ -263,16 +264,22 @@ namespace ngraph
                 const size_t arg0_offset = (arg0_rank > 2) ? shape_size(dot_arg0_shape) : 0;
                 const size_t arg1_offset = (arg1_rank > 2) ? shape_size(dot_arg1_shape) : 0;
                 const size_t output_offset = shape_size(dot_output_shape);
-                for (size_t i = 0; i < output_batch_size; i++)
-                {
-                    dot(arg0_update + i * arg0_offset,
-                        arg1_update + i * arg1_offset,
-                        out + i * output_offset,
-                        dot_arg0_shape,
-                        dot_arg1_shape,
-                        dot_output_shape,
-                        1);
-                }
+                // batches are split between threads, dot parallelizes itself when they are few
+                const size_t batch_work = output_offset * std::max<size_t>(dot_arg1_shape[0], 1);
+                parallel_for(output_batch_size,
+                             std::max<size_t>(1, parallel_elementwise_grain / batch_work),
+                             [&](size_t begin, size_t end) {
+                                 for (size_t i = begin; i < end; i++)
+                                 {
+                                     dot(arg0_update + i * arg0_offset,
+                                         arg1_update + i * arg1_offset,
+                                         out + i * output_offset,
+                                         dot_arg0_shape,
+                                         dot_arg1_shape,
+                                         dot_output_shape,
+                                         1);
+                                 }
+                             });
             }
         }
     }
@@ -15,237 +15,78 @@
 //*****************************************************************************
 
 #include <cmath>
+#include <cstring>
 #include <stdio.h>
 
 #include "ngraph/check.hpp"
 #include "ngraph/runtime/opt_kernel/reshape.hpp"
+#include "ngraph/runtime/parallel.hpp"
 
 using namespace ngraph;
 
 namespace
 {
-    void reshape_in0(const char* in,
-                     char* out,
-                     const Shape& in_shape,
-                     const AxisVector& in_axis_order,
-                     const Shape& out_shape,
-                     size_t elem_size)
+    // Output dimensions of the transposition with the input strides along them (in elements).
+    // Unit dimensions are dropped and adjacent output dimensions are merged when they are also
+    // adjacent in the input, so an identity order collapses to a single contiguous dimension.
+    struct TransposeLoops
     {
-        memcpy(out, in, elem_size);
-    }
-
-    void reshape_in1(const char* in,
-                     char* out,
-                     const Shape& in_shape,
-                     const AxisVector& in_axis_order,
-                     const Shape& out_shape,
-                     size_t elem_size)
-    {
-        size_t size[1];
-        size_t in_index[1];
-        size_t* map_index[1];
-        for (size_t i = 0; i < 1; i++)
-        {
-            size[i] = in_shape[in_axis_order[i]];
-            map_index[in_axis_order[i]] = &in_index[i];
-        }
-        for (in_index[0] = 0; in_index[0] < size[0]; ++in_index[0])
-        {
-            memcpy(out, in + *map_index[0] * elem_size, elem_size);
-            out += elem_size;
-        }
-    }
-
-    void reshape_in2(const char* in,
-                     char* out,
-                     const Shape& in_shape,
-                     const AxisVector& in_axis_order,
-                     const Shape& out_shape,
-                     size_t elem_size)
-    {
-        size_t size[2];
-        size_t in_index[2];
-        size_t* map_index[2];
-        for (size_t i = 0; i < 2; i++)
-        {
-            size[i] = in_shape[in_axis_order[i]];
-            map_index[in_axis_order[i]] = &in_index[i];
-        }
-        for (in_index[0] = 0; in_index[0] < size[0]; ++in_index[0])
-        {
-            for (in_index[1] = 0; in_index[1] < size[1]; ++in_index[1])
-            {
-                // clang-format off
-                memcpy(out,
-                       in + (*map_index[0] * in_shape[1] +
-                             *map_index[1]) * elem_size,
-                       elem_size);
-                out += elem_size;
-                // clang-format on
-            }
-        }
-    }
+        std::vector<size_t> dims;
+        std::vector<size_t> in_strides;
 
-    void reshape_in3(const char* in,
-                     char* out,
-                     const Shape& in_shape,
-                     const AxisVector& in_axis_order,
-                     const Shape& out_shape,
-                     size_t elem_size)
-    {
-        size_t size[3];
-        size_t in_index[3];
-        size_t* map_index[3];
-        for (size_t i = 0; i < 3; i++)
-        {
-            size[i] = in_shape[in_axis_order[i]];
-            map_index[in_axis_order[i]] = &in_index[i];
-        }
-        for (in_index[0] = 0; in_index[0] < size[0]; ++in_index[0])
+        TransposeLoops(const Shape& in_shape, const AxisVector& in_axis_order)
         {
-            for (in_index[1] = 0; in_index[1] < size[1]; ++in_index[1])
+            const auto strides = row_major_strides(in_shape);
+            for (size_t axis : in_axis_order)
             {
-                for (in_index[2] = 0; in_index[2] < size[2]; ++in_index[2])
+                const size_t dim = in_shape[axis];
+                if (dim == 1)
                 {
-                    // clang-format off
-                    memcpy(out,
-                           in + (*map_index[0] * in_shape[1] * in_shape[2] +
-                                 *map_index[1] * in_shape[2] +
-                                 *map_index[2]) * elem_size,
-                           elem_size);
-                    out += elem_size;
-                    // clang-format on
+                    continue;
                 }
-            }
-        }
-    }
-
-    void reshape_in4(const char* in,
-                     char* out,
-                     const Shape& in_shape,
-                     const AxisVector& in_axis_order,
-                     const Shape& out_shape,
-                     size_t elem_size)
-    {
-        size_t size[4];
-        size_t in_index[4];
-        size_t* map_index[4];
-        for (size_t i = 0; i < 4; i++)
-        {
-            size[i] = in_shape[in_axis_order[i]];
-            map_index[in_axis_order[i]] = &in_index[i];
-        }
-        for (in_index[0] = 0; in_index[0] < size[0]; ++in_index[0])
-        {
-            for (in_index[1] = 0; in_index[1] < size[1]; ++in_index[1])
-            {
-                for (in_index[2] = 0; in_index[2] < size[2]; ++in_index[2])
+                if (!dims.empty() && in_strides.back() == strides[axis] * dim)
+                {
+                    dims.back() *= dim;
+                    in_strides.back() = strides[axis];
+                }
+                else
                 {
-                    for (in_index[3] = 0; in_index[3] < size[3]; ++in_index[3])
-                    {
-                        // clang-format off
-                        memcpy(out,
-                               in + (*map_index[0] * in_shape[1] * in_shape[2] * in_shape[3] +
-                                     *map_index[1] * in_shape[2] * in_shape[3] +
-                                     *map_index[2] * in_shape[3] +
-                                     *map_index[3]) * elem_size,
-                               elem_size);
-                        out += elem_size;
-                        // clang-format on
-                    }
+                    dims.push_back(dim);
+                    in_strides.push_back(strides[axis]);
                 }
             }
         }
-    }
+    };
 
-    void reshape_in5(const char* in,
-                     char* out,
-                     const Shape& in_shape,
-                     const AxisVector& in_axis_order,
-                     const Shape& out_shape,
-                     size_t elem_size)
+    template <typename T>
+    void copy_strided(const char* in, char* out, size_t count, size_t stride)
     {
-        size_t size[5];
-        size_t in_index[5];
-        size_t* map_index[5];
-        for (size_t i = 0; i < 5; i++)
-        {
-            size[i] = in_shape[in_axis_order[i]];
-            map_index[in_axis_order[i]] = &in_index[i];
-        }
-        for (in_index[0] = 0; in_index[0] < size[0]; ++in_index[0])
+        const T* src = reinterpret_cast<const T*>(in);
+        T* dst = reinterpret_cast<T*>(out);
+        for (size_t i = 0; i < count; ++i)
         {
-            for (in_index[1] = 0; in_index[1] < size[1]; ++in_index[1])
-            {
-                for (in_index[2] = 0; in_index[2] < size[2]; ++in_index[2])
-                {
-                    for (in_index[3] = 0; in_index[3] < size[3]; ++in_index[3])
-                    {
-                        for (in_index[4] = 0; in_index[4] < size[4]; ++in_index[4])
-                        {
-                            // clang-format off
-                            memcpy(out,
-                                   in + (*map_index[0] * in_shape[1] * in_shape[2] * in_shape[3] * in_shape[4] +
-                                         *map_index[1] * in_shape[2] * in_shape[3] * in_shape[4] +
-                                         *map_index[2] * in_shape[3] * in_shape[4] +
-                                         *map_index[3] * in_shape[4] +
-                                         *map_index[4]) * elem_size,
-                                   elem_size);
-                            out += elem_size;
-                            // clang-format on
-                        }
-                    }
-                }
-            }
+            dst[i] = src[i * stride];
         }
     }
 
-    void reshape_in6(const char* in,
-                     char* out,
-                     const Shape& in_shape,
-                     const AxisVector& in_axis_order,
-                     const Shape& out_shape,
-                     size_t elem_size)
+    void copy_strided(const char* in, char* out, size_t count, size_t stride, size_t elem_size)
     {
-        size_t size[6];
-        size_t in_index[6];
-        size_t* map_index[6];
-        for (size_t i = 0; i < 6; i++)
+        switch (elem_size)
         {
-            size[i] = in_shape[in_axis_order[i]];
-            map_index[in_axis_order[i]] = &in_index[i];
-        }
-        for (in_index[0] = 0; in_index[0] < size[0]; ++in_index[0])
-        {
-            for (in_index[1] = 0; in_index[1] < size[1]; ++in_index[1])
+        case 1: copy_strided<uint8_t>(in, out, count, stride); break;
+        case 2: copy_strided<uint16_t>(in, out, count, stride); break;
+        case 4: copy_strided<uint32_t>(in, out, count, stride); break;
+        case 8: copy_strided<uint64_t>(in, out, count, stride); break;
+        default:
+            for (size_t i = 0; i < count; ++i)
             {
-                for (in_index[2] = 0; in_index[2] < size[2]; ++in_index[2])
-                {
-                    for (in_index[3] = 0; in_index[3] < size[3]; ++in_index[3])
-                    {
-                        for (in_index[4] = 0; in_index[4] < size[4]; ++in_index[4])
-                        {
-                            for (in_index[5] = 0; in_index[5] < size[5]; ++in_index[5])
-                            {
-                                // clang-format off
-                                memcpy(out,
-                                       in + (*map_index[0] * in_shape[1] * in_shape[2] * in_shape[3] * in_shape[4] * in_shape[5] +
-                                             *map_index[1] * in_shape[2] * in_shape[3] * in_shape[4] * in_shape[5] +
-                                             *map_index[2] * in_shape[3] * in_shape[4] * in_shape[5] +
-                                             *map_index[3] * in_shape[4] * in_shape[5] +
-                                             *map_index[4] * in_shape[5] +
-                                             *map_index[5]) * elem_size,
-                                       elem_size);
-                                out += elem_size;
-                                // clang-format on
-                            }
-                        }
-                    }
-                }
+                memcpy(out + i * elem_size, in + i * stride * elem_size, elem_size);
             }
+            break;
         }
     }
 }
+
 void runtime::opt_kernel::reshape(const char* in,
                                   char* out,
                                   const Shape& in_shape,
@@ -253,15 +94,59 @@ void runtime::opt_kernel::reshape(const char* in,
                                   const Shape& out_shape,
                                   size_t elem_size)
 {
-    switch (in_shape.size())
+    const size_t size = shape_size(in_shape);
+    if (size == 0)
+    {
+        return;
+    }
+
+    const TransposeLoops loops(in_shape, in_axis_order);
+    if (loops.dims.empty() || (loops.dims.size() == 1 && loops.in_strides[0] == 1))
     {
-    case 0: reshape_in0(in, out, in_shape, in_axis_order, out_shape, elem_size); break;
-    case 1: reshape_in1(in, out, in_shape, in_axis_order, out_shape, elem_size); break;
-    case 2: reshape_in2(in, out, in_shape, in_axis_order, out_shape, elem_size); break;
-    case 3: reshape_in3(in, out, in_shape, in_axis_order, out_shape, elem_size); break;
-    case 4: reshape_in4(in, out, in_shape, in_axis_order, out_shape, elem_size); break;
-    case 5: reshape_in5(in, out, in_shape, in_axis_order, out_shape, elem_size); break;
-    case 6: reshape_in6(in, out, in_shape, in_axis_order, out_shape, elem_size); break;
-    default: reference::reshape(in, out, in_shape, in_axis_order, out_shape, elem_size); break;
+        parallel_for(size * elem_size,
+                     parallel_elementwise_grain * sizeof(float),
+                     [&](size_t begin, size_t end) { memcpy(out + begin, in + begin, end - begin); });
+        return;
     }
+
+    const size_t rank = loops.dims.size();
+    const size_t inner = loops.dims.back();
+    const size_t inner_stride = loops.in_strides.back();
+    const size_t outer = size / inner;
+
+    parallel_for(
+        outer, std::max<size_t>(1, parallel_elementwise_grain / inner), [&](size_t begin, size_t end) {
+            // coordinates of the first row of the chunk in the outer output dimensions
+            std::vector<size_t> coord(rank, 0);
+            size_t in_offset = 0;
+            for (size_t i = rank - 1, rest = begin; i-- > 0;)
+            {
+                coord[i] = rest % loops.dims[i];
+                rest /= loops.dims[i];
+                in_offset += coord[i] * loops.in_strides[i];
+            }
+
+            for (size_t row = begin; row < end; ++row)
+            {
+                const char* src = in + in_offset * elem_size;
+                char* dst = out + row * inner * elem_size;
+                if (inner_stride == 1)
+                {
+                    memcpy(dst, src, inner * elem_size);
+                }
+                else
+                {
+                    copy_strided(src, dst, inner, inner_stride, elem_size);
+                }
+
+                for (size_t i = rank - 1; i-- > 0;)
+                {
+                    in_offset += loops.in_strides[i];
+                    if (++coord[i] < loops.dims[i])
+                        break;
+                    in_offset -= coord[i] * loops.in_strides[i];
+                    coord[i] = 0;
+                }
+            }
+        });
 }
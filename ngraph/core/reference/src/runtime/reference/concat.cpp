@@ -14,8 +14,10 @@
 // limitations under the License.
 //*****************************************************************************
 
+#include <algorithm>
 #include <cstring>
 
+#include "ngraph/runtime/parallel.hpp"
 #include "ngraph/runtime/reference/concat.hpp"
 
 namespace ngraph
@@ -51,23 +53,52 @@ namespace ngraph
                     steps *= out_shape[i];
                 }
 
+                if (steps == 0)
+                {
+                    return;
+                }
+
                 const auto& shape_sizes = calculate_shape_sizes(in_shapes);
 
-                size_t out_offset = 0;
-                for (size_t step = 0; step < steps; ++step)
+                if (steps == 1)
                 {
+                    // concatenation along the outermost axis: one large copy per input
+                    size_t out_offset = 0;
                     for (size_t in_index = 0; in_index < args.size(); ++in_index)
                     {
-                        const size_t size = shape_sizes[in_index] / steps;
-                        const size_t in_offset = step * size;
-
-                        std::memcpy(&out[out_offset * elem_size],
-                                    &args[in_index][in_offset * elem_size],
-                                    size * elem_size);
-
-                        out_offset += size;
+                        const char* src = args[in_index];
+                        char* dst = &out[out_offset * elem_size];
+                        parallel_for(shape_sizes[in_index] * elem_size,
+                                     parallel_elementwise_grain * sizeof(float),
+                                     [=](size_t begin, size_t end) {
+                                         std::memcpy(dst + begin, src + begin, end - begin);
+                                     });
+                        out_offset += shape_sizes[in_index];
                     }
+                    return;
                 }
+
+                const size_t out_step_size = shape_size(out_shape) / steps;
+                parallel_for(
+                    steps,
+                    std::max<size_t>(1, parallel_elementwise_grain / std::max<size_t>(1, out_step_size)),
+                    [&](size_t begin, size_t end) {
+                        size_t out_offset = begin * out_step_size;
+                        for (size_t step = begin; step < end; ++step)
+                        {
+                            for (size_t in_index = 0; in_index < args.size(); ++in_index)
+                            {
+                                const size_t size = shape_sizes[in_index] / steps;
+                                const size_t in_offset = step * size;
+
+                                std::memcpy(&out[out_offset * elem_size],
+                                            &args[in_index][in_offset * elem_size],
+                                            size * elem_size);
+
+                                out_offset += size;
+                            }
+                        }
+                    });
             }
         } // namespace reference
     }     // namespace runtime
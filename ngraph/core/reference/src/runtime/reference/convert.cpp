@@ -58,6 +58,36 @@ namespace ngraph
                     gen.vmovups(gen.yword[dst], f32vec);
                 }
 
+                template <>
+                void jit_convert_vec<uint8_t, float>(jit::Generator& gen,
+                                                     const Xbyak::RegExp& src,
+                                                     const Xbyak::RegExp& dst)
+                {
+                    auto u8vec = gen.xmm1;
+                    auto i32vec = gen.ymm2;
+                    auto f32vec = gen.ymm4;
+
+                    gen.movq(u8vec, gen.qword[src]);
+                    gen.vpmovzxbd(i32vec, u8vec);
+                    gen.vcvtdq2ps(f32vec, i32vec);
+                    gen.vmovups(gen.yword[dst], f32vec);
+                }
+
+                template <>
+                void jit_convert_vec<int8_t, float>(jit::Generator& gen,
+                                                    const Xbyak::RegExp& src,
+                                                    const Xbyak::RegExp& dst)
+                {
+                    auto i8vec = gen.xmm1;
+                    auto i32vec = gen.ymm2;
+                    auto f32vec = gen.ymm4;
+
+                    gen.movq(i8vec, gen.qword[src]);
+                    gen.vpmovsxbd(i32vec, i8vec);
+                    gen.vcvtdq2ps(f32vec, i32vec);
+                    gen.vmovups(gen.yword[dst], f32vec);
+                }
+
                 class jit_convert_array : public jit::Generator
                 {
                     typedef struct context
@@ -157,44 +187,52 @@ namespace ngraph
                         return nullptr;
                     }
                 };
+
+                // Splits the array between threads, each chunk is converted by the JIT kernel
+                template <typename src_t, typename dst_t>
+                void jit_convert(const src_t* arg, dst_t* out, size_t count)
+                {
+                    auto converter = jit_convert_array::get<src_t, dst_t>();
+
+                    parallel_for(count, parallel_elementwise_grain, [=](size_t begin, size_t end) {
+                        if (converter)
+                        {
+                            jit_convert_array::args_t args = {arg + begin, out + begin, end - begin};
+                            converter(&args);
+                        }
+                        else
+                        {
+                            for (size_t i = begin; i < end; ++i)
+                            {
+                                out[i] = static_cast<dst_t>(arg[i]);
+                            }
+                        }
+                    });
+                }
             } // namespace
 
             template <>
             void convert<uint8_t, float16>(const uint8_t* arg, float16* out, size_t count)
             {
-                auto converter = jit_convert_array::get<uint8_t, float16>();
-
-                if (converter)
-                {
-                    jit_convert_array::args_t args = {arg, out, count};
-                    converter(&args);
-                }
-                else
-                {
-                    for (size_t i = 0; i < count; ++i)
-                    {
-                        out[i] = static_cast<float16>(arg[i]);
-                    }
-                }
+                jit_convert(arg, out, count);
             }
 
             template <>
             void convert<float16, float>(const float16* arg, float* out, size_t count)
             {
-                auto converter = jit_convert_array::get<float16, float>();
+                jit_convert(arg, out, count);
+            }
 
-                if (converter)
-                {
-                    jit_convert_array::args_t args = {arg, out, count};
-                    converter(&args);
-                }
-                else
-                {
-                    for (size_t i = 0; i < count; ++i)
-                    {
-                        out[i] = static_cast<float>(arg[i]);
-                    }
-                }
+            template <>
+            void convert<uint8_t, float>(const uint8_t* arg, float* out, size_t count)
+            {
+                jit_convert(arg, out, count);
+            }
+
+            template <>
+            void convert<int8_t, float>(const int8_t* arg, float* out, size_t count)
+            {
+                jit_convert(arg, out, count);
             }
         }
     }
@@ -209,6 +209,14 @@ namespace ngraph
                 pop(rsi);
             }
 
+            template <>
+            void Generator::copy<int8_t>(const Xbyak::Reg64& dst,
+                                         const Xbyak::Reg64& src,
+                                         const Xbyak::Reg64& size)
+            {
+                copy<uint8_t>(dst, src, size);
+            }
+
             template <>
             void Generator::copy<float16>(const Xbyak::Reg64& dst,
                                           const Xbyak::Reg64& src,
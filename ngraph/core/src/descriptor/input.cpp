@@ -15,6 +15,7 @@
 //*****************************************************************************
 
 #include "ngraph/descriptor/input.hpp"
+#include "graph_version.hpp"
 #include "ngraph/descriptor/output.hpp"
 #include "ngraph/env_util.hpp"
 #include "ngraph/node.hpp"
@@ -57,6 +58,7 @@ void descriptor::Input::replace_output(Output& new_output)
     new_output.add_input(this);
     m_output = &new_output;
     m_src_node = std::shared_ptr<Node>(new_output.get_node());
+    graph_version::increment(*m_node);
 
     if (getenv_bool("NGRAPH_ENABLE_REPLACE_CHECK"))
     {
@@ -17,8 +17,11 @@
 #include <algorithm>
 #include <list>
 #include <memory>
+#include <mutex>
 #include <ngraph/ops.hpp>
+#include <unordered_map>
 
+#include "graph_version.hpp"
 #include "itt.hpp"
 #include "ngraph/function.hpp"
 #include "ngraph/graph_util.hpp"
@@ -33,6 +36,62 @@ constexpr DiscreteTypeInfo Function::type_info;
 
 atomic<size_t> Function::m_next_instance_id(0);
 
+namespace
+{
+    atomic<uint64_t> s_graph_version(0);
+
+    // Topological orders are kept outside of Function to preserve its layout. Nodes are held
+    // weakly so that a cached order never extends the lifetime of nodes removed from the graph.
+    struct OrderedOpsCacheEntry
+    {
+        uint64_t version;
+        vector<weak_ptr<Node>> ops;
+    };
+
+    mutex s_ordered_ops_mutex;
+    unordered_map<const Function*, OrderedOpsCacheEntry> s_ordered_ops;
+
+    // Changes of function parameters, results and sinks affect the order of this function only
+    void reset_ordered_ops(const Function* function)
+    {
+        lock_guard<mutex> lock(s_ordered_ops_mutex);
+        s_ordered_ops.erase(function);
+    }
+
+    // Functions sort nodes reachable from their results, sinks and parameters through inputs and
+    // control dependencies. Any other node is neither consumed nor a control dependency.
+    bool may_be_ordered(const Node& node)
+    {
+        if (op::is_output(&node) || op::is_parameter(&node) ||
+            dynamic_cast<const op::Sink*>(&node) != nullptr ||
+            !node.get_control_dependents().empty())
+        {
+            return true;
+        }
+        for (size_t i = 0; i < node.get_output_size(); ++i)
+        {
+            if (!node.get_output_target_inputs(i).empty())
+            {
+                return true;
+            }
+        }
+        return false;
+    }
+}
+
+void graph_version::increment(const Node& node)
+{
+    if (may_be_ordered(node))
+    {
+        s_graph_version.fetch_add(1, memory_order_relaxed);
+    }
+}
+
+uint64_t graph_version::get()
+{
+    return s_graph_version.load(memory_order_relaxed);
+}
+
 Function::Function(const ResultVector& results,
                    const ParameterVector& parameters,
                    const std::string& name)
@@ -155,10 +214,41 @@ void Function::validate_nodes_and_infer_types() const
             "network.");
 }
 
+Function::~Function()
+{
+    reset_ordered_ops(this);
+}
+
 std::vector<shared_ptr<Node>> Function::get_ordered_ops() const
 {
     OV_ITT_SCOPED_TASK(itt::domains::nGraph, "Function::get_ordered_ops");
 
+    const uint64_t version = graph_version::get();
+    {
+        lock_guard<mutex> lock(s_ordered_ops_mutex);
+        auto it = s_ordered_ops.find(this);
+        if (it != s_ordered_ops.end() && it->second.version == version)
+        {
+            vector<shared_ptr<Node>> ordered_ops;
+            ordered_ops.reserve(it->second.ops.size());
+            for (const auto& op : it->second.ops)
+            {
+                if (auto node = op.lock())
+                {
+                    ordered_ops.push_back(node);
+                }
+                else
+                {
+                    break;
+                }
+            }
+            if (ordered_ops.size() == it->second.ops.size())
+            {
+                return ordered_ops;
+            }
+        }
+    }
+
     vector<shared_ptr<Node>> nodes;
     for (auto& r : get_results())
     {
@@ -173,7 +263,13 @@ std::vector<shared_ptr<Node>> Function::get_ordered_ops() const
         nodes.push_back(param);
     }
 
-    return m_topological_sorter(nodes);
+    auto ordered_ops = m_topological_sorter(nodes);
+
+    lock_guard<mutex> lock(s_ordered_ops_mutex);
+    auto& entry = s_ordered_ops[this];
+    entry.version = version;
+    entry.ops.assign(ordered_ops.begin(), ordered_ops.end());
+    return ordered_ops;
 }
 
 void Function::map_unordered_ops(std::function<void(Node*)> f) const
@@ -337,11 +433,13 @@ void Function::replace_parameter(size_t parameter_index, const shared_ptr<op::Pa
                  " parameters.");
     replace_node(m_parameters[parameter_index], parameter);
     m_parameters[parameter_index] = parameter;
+    reset_ordered_ops(this);
 }
 
 void Function::set_topological_sort(topological_sort_t sorter)
 {
     m_topological_sorter = sorter;
+    reset_ordered_ops(this);
 }
 
 int64_t Function::get_parameter_index(const std::shared_ptr<op::Parameter>& parameter) const
@@ -417,6 +515,7 @@ bool Function::visit_attributes(AttributeVisitor& visitor)
 void Function::add_sinks(const SinkVector& sinks)
 {
     m_sinks.insert(m_sinks.end(), sinks.begin(), sinks.end());
+    reset_ordered_ops(this);
 }
 
 void Function::remove_sink(const std::shared_ptr<op::Sink>& sink)
@@ -425,11 +524,13 @@ void Function::remove_sink(const std::shared_ptr<op::Sink>& sink)
                                  m_sinks.end(),
                                  [&sink](std::shared_ptr<op::Sink>& s) { return s == sink; }),
                   m_sinks.end());
+    reset_ordered_ops(this);
 }
 
 void Function::add_results(const ResultVector& results)
 {
     m_results.insert(m_results.end(), results.begin(), results.end());
+    reset_ordered_ops(this);
 }
 
 void Function::remove_result(const std::shared_ptr<op::Result>& result)
@@ -439,6 +540,7 @@ void Function::remove_result(const std::shared_ptr<op::Result>& result)
                        m_results.end(),
                        [&result](std::shared_ptr<op::v0::Result>& r) { return r == result; }),
         m_results.end());
+    reset_ordered_ops(this);
 }
 
 void Function::add_parameters(const ParameterVector& params)
@@ -455,6 +557,7 @@ void Function::add_parameters(const ParameterVector& params)
         }
     }
     m_parameters.insert(m_parameters.end(), params.begin(), params.end());
+    reset_ordered_ops(this);
 }
 
 void Function::remove_parameter(const std::shared_ptr<op::Parameter>& param)
@@ -464,6 +567,7 @@ void Function::remove_parameter(const std::shared_ptr<op::Parameter>& param)
                        m_parameters.end(),
                        [&param](std::shared_ptr<op::v0::Parameter>& r) { return r == param; }),
         m_parameters.end());
+    reset_ordered_ops(this);
 }
 
 constexpr DiscreteTypeInfo AttributeAdapter<shared_ptr<Function>>::type_info;
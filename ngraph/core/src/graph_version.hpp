@@ -0,0 +1,35 @@
+//*****************************************************************************
+// Copyright 2017-2021 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#pragma once
+
+#include <cstdint>
+
+namespace ngraph
+{
+    class Node;
+
+    namespace graph_version
+    {
+        /// \brief Marks topological orders cached by functions as outdated. Called on every change
+        /// of inputs or control dependencies of \p node. Does nothing if no function may sort
+        /// the node, e.g. while the node is being constructed.
+        void increment(const Node& node);
+
+        /// \brief Returns the number of graph modifications made so far
+        uint64_t get();
+    }
+}
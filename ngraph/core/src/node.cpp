@@ -20,6 +20,7 @@
 #include <typeindex>
 #include <typeinfo>
 
+#include "graph_version.hpp"
 #include "itt.hpp"
 #include "ngraph/descriptor/input.hpp"
 #include "ngraph/graph_util.hpp"
@@ -73,6 +74,7 @@ Node& Node::operator=(const Node& node)
         input = descriptor::Input(this, input.get_index(), input.get_output());
         input.get_output().add_input(&input);
     }
+    graph_version::increment(*this);
     return *this;
 }
 
@@ -194,6 +196,8 @@ void Node::set_arguments(const NodeVector& arguments)
 
 void Node::set_arguments(const OutputVector& arguments)
 {
+    // Nodes get their first arguments while they are constructed, before any function sorts them
+    const bool had_inputs = !m_inputs.empty();
     // Add this node as a user of each argument.
     size_t i = 0;
     for (auto& output : arguments)
@@ -202,6 +206,10 @@ void Node::set_arguments(const OutputVector& arguments)
         auto& output_descriptor = output_node->m_outputs.at(output.get_index());
         m_inputs.emplace_back(this, i++, output_descriptor);
     }
+    if (had_inputs)
+    {
+        graph_version::increment(*this);
+    }
 }
 
 descriptor::Input& Node::get_input_descriptor(size_t position)
@@ -490,6 +498,7 @@ void Node::add_control_dependency(std::shared_ptr<Node> node)
         {
             node->m_control_dependents.push_back(this);
         }
+        graph_version::increment(*this);
     }
 }
 
@@ -522,6 +531,7 @@ void Node::remove_control_dependency(std::shared_ptr<Node> node)
         if (it != m_control_dependencies.end())
         {
             m_control_dependencies.erase(it);
+            graph_version::increment(*this);
         }
     }
     {
@@ -544,6 +554,7 @@ void Node::clear_control_dependencies()
         }
     }
     m_control_dependencies.clear();
+    graph_version::increment(*this);
 }
 
 void Node::clear_control_dependents()
@@ -16,64 +16,153 @@
 
 #include "ngraph/pass/constant_folding.hpp"
 #include <ngraph/op/constant.hpp>
+#include <unordered_map>
 #include "ngraph/op/util/sub_graph_base.hpp"
 #include "ngraph/rt_info.hpp"
+#include "ngraph/runtime/parallel.hpp"
 
 using namespace std;
 using namespace ngraph;
 
 NGRAPH_RTTI_DEFINITION(ngraph::pass::ConstantFolding, "ConstantFolding", 0);
 
+namespace
+{
+    // Splits topologically sorted nodes into levels of mutually independent nodes: a node goes
+    // one level after the deepest of its inputs and control dependencies.
+    std::vector<NodeVector> get_levels(const std::vector<std::shared_ptr<Node>>& ordered_ops)
+    {
+        std::vector<NodeVector> levels;
+        std::unordered_map<const Node*, size_t> node_level;
+        for (const auto& node : ordered_ops)
+        {
+            size_t level = 0;
+            for (const auto& input : node->input_values())
+            {
+                level = std::max(level, node_level.at(input.get_node()) + 1);
+            }
+            for (const auto& control_dep : node->get_control_dependencies())
+            {
+                level = std::max(level, node_level.at(control_dep.get()) + 1);
+            }
+            node_level[node.get()] = level;
+            if (levels.size() <= level)
+            {
+                levels.resize(level + 1);
+            }
+            levels[level].push_back(node);
+        }
+        return levels;
+    }
+
+    // Only evaluation of operations on constants is safe to run in parallel: it does not touch
+    // the graph and produces new Constant nodes.
+    bool is_foldable_concurrently(const std::shared_ptr<Node>& node)
+    {
+        if (node->get_input_size() == 0 || is_type<op::util::SubGraphOp>(node))
+        {
+            return false;
+        }
+        const auto inputs = node->input_values();
+        return std::all_of(inputs.begin(), inputs.end(), [](const Output<Node>& input) {
+            return is_type<op::Constant>(input.get_node());
+        });
+    }
+}
+
 bool ngraph::pass::ConstantFolding::run_on_function(std::shared_ptr<ngraph::Function> f)
 {
+    // kernels and independent nodes use as many threads as the caller allows with ParallelThreadsLimit
     bool rewritten = pre_calculated_values_folding(f);
 
-    for (const auto& node : f->get_ordered_ops())
+    for (const auto& level : get_levels(f->get_ordered_ops()))
     {
         if (rewritten)
         {
-            node->validate_and_infer_types();
+            for (const auto& node : level)
+            {
+                node->validate_and_infer_types();
+            }
         }
 
-        OutputVector replacements(node->get_output_size());
-        if (node->constant_fold(replacements, node->input_values()))
+        // Nodes of the same level don't depend on each other, so if there are enough of them to
+        // occupy all threads they are folded concurrently (kernels of every node then run
+        // single-threaded). Otherwise nodes are folded one by one with parallel kernels.
+        std::vector<OutputVector> level_replacements(level.size());
+        std::vector<size_t> candidates;
+        for (size_t i = 0; i < level.size(); ++i)
         {
-            NGRAPH_CHECK(replacements.size() == node->get_output_size(),
-                         "constant_fold_default returned incorrect number of replacements for ",
-                         node);
+            level_replacements[i].resize(level[i]->get_output_size());
+            if (is_foldable_concurrently(level[i]))
+            {
+                candidates.push_back(i);
+            }
+        }
 
-            for (size_t i = 0; i < replacements.size(); ++i)
+        std::vector<char> is_evaluated(level.size(), false);
+        std::vector<char> is_folded(level.size(), false);
+        if (candidates.size() > 1 && candidates.size() >= runtime::parallel_get_max_threads())
+        {
+            runtime::parallel_for(candidates.size(), 1, [&](size_t begin, size_t end) {
+                for (size_t c = begin; c < end; ++c)
+                {
+                    const auto& node = level[candidates[c]];
+                    is_folded[candidates[c]] =
+                        node->constant_fold(level_replacements[candidates[c]], node->input_values());
+                    is_evaluated[candidates[c]] = true;
+                }
+            });
+        }
+
+        for (size_t n = 0; n < level.size(); ++n)
+        {
+            const auto& node = level[n];
+            OutputVector& replacements = level_replacements[n];
+            if (!is_evaluated[n])
             {
-                auto node_output = node->output(i);
-                auto replacement = replacements.at(i);
-                if (replacement.get_node_shared_ptr() && (node_output != replacement))
+                is_folded[n] = node->constant_fold(replacements, node->input_values());
+            }
+
+            if (is_folded[n])
+            {
+                NGRAPH_CHECK(replacements.size() == node->get_output_size(),
+                             "constant_fold_default returned incorrect number of replacements for ",
+                             node);
+
+                for (size_t i = 0; i < replacements.size(); ++i)
                 {
-                    if (replacements.size() == 1)
-                    {
-                        replacement.get_node_shared_ptr()->set_friendly_name(
-                            node->get_friendly_name());
-                    }
-                    else
+                    auto node_output = node->output(i);
+                    auto replacement = replacements.at(i);
+                    if (replacement.get_node_shared_ptr() && (node_output != replacement))
                     {
-                        replacement.get_node_shared_ptr()->set_friendly_name(
-                            node->get_friendly_name() + "." + std::to_string(i));
-                    }
-                    node_output.replace(replacement);
-                    // Propagate runtime info attributes to replacement consumer nodes
-                    copy_runtime_info_to_target_inputs(node, replacement);
+                        if (replacements.size() == 1)
+                        {
+                            replacement.get_node_shared_ptr()->set_friendly_name(
+                                node->get_friendly_name());
+                        }
+                        else
+                        {
+                            replacement.get_node_shared_ptr()->set_friendly_name(
+                                node->get_friendly_name() + "." + std::to_string(i));
+                        }
+                        node_output.replace(replacement);
+                        // Propagate runtime info attributes to replacement consumer nodes
+                        copy_runtime_info_to_target_inputs(node, replacement);
 
-                    rewritten = true;
+                        rewritten = true;
+                    }
                 }
             }
-        }
-        else
-        {
-            // recursively constant fold operators containing subgraphs (ie: TensorIterator, Loop)
-            if (auto sub_graph_node = std::dynamic_pointer_cast<op::util::SubGraphOp>(node))
+            else
             {
-                if (const auto& sub_graph = sub_graph_node->get_function())
+                // recursively constant fold operators containing subgraphs (ie: TensorIterator,
+                // Loop)
+                if (auto sub_graph_node = std::dynamic_pointer_cast<op::util::SubGraphOp>(node))
                 {
-                    rewritten |= run_on_function(sub_graph);
+                    if (const auto& sub_graph = sub_graph_node->get_function())
+                    {
+                        rewritten |= run_on_function(sub_graph);
+                    }
                 }
             }
         }
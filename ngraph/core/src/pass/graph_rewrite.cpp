@@ -16,6 +16,7 @@
 
 #include <algorithm>
 #include <deque>
+#include <iomanip>
 #include <iostream>
 #include <ngraph/pattern/op/wrap_type.hpp>
 #include <regex>
@@ -25,8 +26,11 @@
 #include "itt.hpp"
 #include "ngraph/env_util.hpp"
 #include "ngraph/log.hpp"
+#include "ngraph/op/sink.hpp"
+#include "ngraph/op/util/op_types.hpp"
 #include "ngraph/op/util/sub_graph_base.hpp"
 #include "ngraph/pass/graph_rewrite.hpp"
+#include "ngraph/util.hpp"
 
 using namespace std;
 using namespace ngraph;
@@ -67,10 +71,45 @@ NGRAPH_RTTI_DEFINITION(ngraph::pass::GraphRewrite, "ngraph::pass::GraphRewrite",
 
 NGRAPH_RTTI_DEFINITION(ngraph::pass::MatcherPass, "ngraph::pass::MatcherPass", 0);
 
+namespace
+{
+    // Node is cut out of the graph by one of previous rewrites if none of its outputs is consumed.
+    // Parameters, Results and Sinks are kept in Function even without consumers.
+    bool is_detached(const std::shared_ptr<Node>& node)
+    {
+        if (op::is_parameter(node) || op::is_output(node) ||
+            std::dynamic_pointer_cast<op::Sink>(node))
+        {
+            return false;
+        }
+        if (node->get_output_size() == 0)
+        {
+            return false;
+        }
+        for (const auto& output : node->outputs())
+        {
+            if (!output.get_target_inputs().empty())
+            {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    // Per matcher statistics collected when NGRAPH_PROFILE_PASS_ENABLE is set
+    struct MatcherProfile
+    {
+        stopwatch timer;
+        size_t hits = 0;
+    };
+} // namespace
+
 bool pass::GraphRewrite::run_on_function(shared_ptr<Function> f)
 {
     OV_ITT_SCOPED_TASK(itt::domains::nGraph, "pass::GraphRewrite::run_on_function");
 
+    static bool profile_enabled = getenv_bool("NGRAPH_PROFILE_PASS_ENABLE");
+
     bool rewritten = false;
     const auto& pass_config = get_pass_config();
 
@@ -81,9 +120,10 @@ bool pass::GraphRewrite::run_on_function(shared_ptr<Function> f)
         nodes_to_run.emplace_back(node);
     }
 
-    // Check that all Matchers in MatcherPasses has type bases root node
-    bool all_roots_has_type = true;
+    // Split enabled matchers into ones with type based root node and ones which root type is
+    // unknown (e.g. pattern::op::Label with predicate). The latter are tried on every node.
     std::unordered_map<NodeTypeInfo, std::vector<size_t>> type_to_matcher;
+    std::vector<size_t> untyped_matchers;
     for (size_t matcher_index = 0; matcher_index < m_matchers.size(); ++matcher_index)
     {
         // Skip passes that are disabled
@@ -93,8 +133,8 @@ bool pass::GraphRewrite::run_on_function(shared_ptr<Function> f)
         auto matcher = m_matchers[matcher_index]->get_matcher();
         if (!matcher)
         {
-            all_roots_has_type = false;
-            break;
+            untyped_matchers.push_back(matcher_index);
+            continue;
         }
 
         auto root = matcher->get_pattern_value().get_node_shared_ptr();
@@ -107,8 +147,7 @@ bool pass::GraphRewrite::run_on_function(shared_ptr<Function> f)
 
         // if root is an operation from opset or has pattern::op::WrapType type then we can extract
         // it's type
-        // and use it in unordered_map as key for fast MatcherPass search. Otherwise type is unknown
-        // and default algorithm is used.
+        // and use it in unordered_map as key for fast MatcherPass search.
         if (auto p = dynamic_pointer_cast<pattern::op::Pattern>(root))
         {
             if (auto any_type = dynamic_pointer_cast<pattern::op::WrapType>(p))
@@ -120,24 +159,49 @@ bool pass::GraphRewrite::run_on_function(shared_ptr<Function> f)
             }
             else
             {
-                all_roots_has_type = false;
-                break;
+                untyped_matchers.push_back(matcher_index);
             }
         }
         else
         {
             type_to_matcher[root->get_type_info()].push_back(matcher_index);
         }
-
-        // TODO: traverse parents for root_type_info in order to register complete list of matchers
-        // including ones triggered by parent type info.
     }
 
+    // Complete list of matchers for a node type including ones registered for its parent types
+    // and untyped ones in order of the registration. Lists are built once per node type.
+    std::unordered_map<NodeTypeInfo, std::vector<size_t>> type_to_matcher_cache;
+    auto get_matchers_for_type = [&](const NodeTypeInfo& type_info) -> const std::vector<size_t>& {
+        auto cached = type_to_matcher_cache.find(type_info);
+        if (cached != type_to_matcher_cache.end())
+        {
+            return cached->second;
+        }
+
+        std::vector<size_t> matchers_to_run = untyped_matchers;
+        for (const DiscreteTypeInfo* node_type_info = &type_info; node_type_info;
+             node_type_info = node_type_info->parent)
+        {
+            auto matchers = type_to_matcher.find(*node_type_info);
+            if (matchers != type_to_matcher.end())
+            {
+                matchers_to_run.insert(
+                    matchers_to_run.end(), matchers->second.begin(), matchers->second.end());
+            }
+        }
+        std::sort(matchers_to_run.begin(), matchers_to_run.end());
+        matchers_to_run.erase(std::unique(matchers_to_run.begin(), matchers_to_run.end()),
+                              matchers_to_run.end());
+        return type_to_matcher_cache.emplace(type_info, std::move(matchers_to_run)).first->second;
+    };
+
+    std::vector<MatcherProfile> profile(profile_enabled ? m_matchers.size() : 0);
+
     // This lambda preforms execution of particular MatcherPass on given node.
     // It automatically handles nodes registered by MatcherPass during transformation and set
     // transformation callback.
-    auto run_matcher_pass = [&](std::shared_ptr<MatcherPass> m_pass,
-                                std::shared_ptr<Node> node) -> bool {
+    auto run_matcher_pass = [&](size_t matcher_index, const std::shared_ptr<Node>& node) -> bool {
+        const auto& m_pass = m_matchers[matcher_index];
         // Keep this property check for backward compatibility. In future transformation property
         // will be deprecated and removed.
         if (m_pass->get_property(PassProperty::REQUIRE_STATIC_SHAPE) && f->is_dynamic())
@@ -151,10 +215,19 @@ bool pass::GraphRewrite::run_on_function(shared_ptr<Function> f)
 
         // Apply MatcherPass. In case if it returns true no other MatcherPasses will apply
         // to this node
+        if (profile_enabled)
+        {
+            profile[matcher_index].timer.start();
+        }
         bool status = m_pass->apply(node);
+        if (profile_enabled)
+        {
+            profile[matcher_index].timer.stop();
+            profile[matcher_index].hits += status;
+        }
 
         // In case if MatcherPass registered nodes they will be added to the beginning of execution
-        // queue
+        // queue, so only nodes produced by rewrites are revisited
         const auto& new_nodes = m_pass->get_new_nodes();
         if (!new_nodes.empty())
         {
@@ -169,13 +242,15 @@ bool pass::GraphRewrite::run_on_function(shared_ptr<Function> f)
         return status;
     };
 
-    // list of matchers to run for a node; define here to keep memory allocated
-    std::vector<size_t> matcher_passes_to_run;
-
     while (!nodes_to_run.empty())
     {
         auto node = nodes_to_run.front();
         nodes_to_run.pop_front();
+        // Skip nodes which were replaced by previous rewrites
+        if (is_detached(node))
+        {
+            continue;
+        }
         // Recursive apply Matchers for sub-graph based nodes
         if (auto sub_graph_node = std::dynamic_pointer_cast<op::util::SubGraphOp>(node))
         {
@@ -189,56 +264,37 @@ bool pass::GraphRewrite::run_on_function(shared_ptr<Function> f)
         {
             node->revalidate_and_infer_types();
         }
-        // If all Matchers in MatcherPasses has type based root node then we apply efficient
-        // algorithm for finding matchers
-        if (all_roots_has_type)
+
+        for (size_t matcher_index : get_matchers_for_type(node->get_type_info()))
         {
-            const DiscreteTypeInfo* node_type_info = &node->get_type_info();
-            matcher_passes_to_run.clear();
-            while (node_type_info)
+            if (run_matcher_pass(matcher_index, node))
             {
-                auto matchers = type_to_matcher.find(*node_type_info);
-                if (matchers != type_to_matcher.end())
-                {
-                    // do not run found matchers immediately, need to collect all matchers for
-                    // parents
-                    // and sort them in order of the registration
-                    matcher_passes_to_run.insert(matcher_passes_to_run.end(),
-                                                 matchers->second.begin(),
-                                                 matchers->second.end());
-                }
-                node_type_info = node_type_info->parent;
+                rewritten = true;
+                break;
             }
+        }
+    }
 
-            std::sort(matcher_passes_to_run.begin(), matcher_passes_to_run.end());
-
-            // TODO: type_to_matcher with just collected list of matchers to enable
-            // fast processing at the next time when node with the same type will be processed
-
-            for (size_t matcher_index : matcher_passes_to_run)
+    if (profile_enabled && m_matchers.size() > 1)
+    {
+        std::vector<size_t> order;
+        for (size_t matcher_index = 0; matcher_index < profile.size(); ++matcher_index)
+        {
+            if (profile[matcher_index].timer.get_call_count() > 0)
             {
-                if (run_matcher_pass(m_matchers[matcher_index], node))
-                {
-                    rewritten = true;
-                    break;
-                }
+                order.push_back(matcher_index);
             }
         }
-        // Otherwise we use default algorithm that iterates over all registered matcher passes
-        else
+        std::sort(order.begin(), order.end(), [&](size_t lhs, size_t rhs) {
+            return profile[lhs].timer.get_total_nanoseconds() >
+                   profile[rhs].timer.get_total_nanoseconds();
+        });
+        for (size_t matcher_index : order)
         {
-            for (auto& m_pass : m_matchers)
-            {
-                // Skip passes that are disabled
-                if (pass_config->is_disabled(m_pass->get_type_info()))
-                    continue;
-
-                if (run_matcher_pass(m_pass, node))
-                {
-                    rewritten = true;
-                    break;
-                }
-            }
+            const auto& stat = profile[matcher_index];
+            cout << setw(7) << stat.timer.get_total_microseconds() << "us " << setw(7)
+                 << stat.timer.get_call_count() << " calls " << setw(5) << stat.hits << " hits  "
+                 << m_matchers[matcher_index]->get_name() << "\n";
         }
     }
     return rewritten;
@@ -0,0 +1,116 @@
+//*****************************************************************************
+// Copyright 2017-2021 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#include <algorithm>
+#include <exception>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include "ngraph/runtime/parallel.hpp"
+
+using namespace ngraph;
+
+namespace
+{
+    // 0 means no limit, kernels run serially unless the caller opts in with ParallelThreadsLimit
+    thread_local size_t threads_limit = 1;
+
+    // set in parallel_for workers, nested regions run serially whatever the limit is
+    thread_local bool in_parallel_region = false;
+}
+
+runtime::ParallelThreadsLimit::ParallelThreadsLimit(size_t max_threads)
+    : m_outer_limit(threads_limit)
+{
+    threads_limit = max_threads;
+}
+
+runtime::ParallelThreadsLimit::~ParallelThreadsLimit()
+{
+    threads_limit = m_outer_limit;
+}
+
+size_t runtime::parallel_get_max_threads()
+{
+    static const size_t max_threads = std::max(1u, std::thread::hardware_concurrency());
+    if (in_parallel_region)
+    {
+        return 1;
+    }
+    return threads_limit == 0 ? max_threads : std::min(threads_limit, max_threads);
+}
+
+void runtime::parallel_for(size_t work_amount,
+                           size_t grain,
+                           const std::function<void(size_t, size_t)>& fn)
+{
+    if (work_amount == 0)
+    {
+        return;
+    }
+
+    grain = std::max<size_t>(grain, 1);
+    const size_t nthr = std::min(parallel_get_max_threads(), (work_amount + grain - 1) / grain);
+    if (nthr <= 1)
+    {
+        fn(0, work_amount);
+        return;
+    }
+
+    std::exception_ptr error;
+    std::mutex error_mutex;
+    const auto run_chunk = [&](size_t ithr) {
+        // the first work_amount % nthr chunks take one item more
+        const size_t chunk = work_amount / nthr;
+        const size_t rest = work_amount % nthr;
+        const size_t begin = ithr * chunk + std::min(ithr, rest);
+        const size_t end = begin + chunk + (ithr < rest ? 1 : 0);
+
+        const bool outer_region = in_parallel_region;
+        in_parallel_region = true;
+        try
+        {
+            fn(begin, end);
+        }
+        catch (...)
+        {
+            std::lock_guard<std::mutex> lock(error_mutex);
+            if (!error)
+            {
+                error = std::current_exception();
+            }
+        }
+        in_parallel_region = outer_region;
+    };
+
+    std::vector<std::thread> workers;
+    workers.reserve(nthr - 1);
+    for (size_t ithr = 1; ithr < nthr; ++ithr)
+    {
+        workers.emplace_back(run_chunk, ithr);
+    }
+    run_chunk(0);
+    for (auto& worker : workers)
+    {
+        worker.join();
+    }
+
+    if (error)
+    {
+        std::rethrow_exception(error);
+    }
+}
@@ -22,6 +22,7 @@
 #include <unordered_map>
 
 #include "onnx_import/core/operator_set.hpp"
+#include "utils/tensor_external_data.hpp"
 
 namespace ngraph
 {
@@ -82,9 +83,16 @@ namespace ngraph
             ///
             void enable_opset_domain(const std::string& domain);
 
+            /// \brief      Mappings of external data files opened while importing the model.
+            ///
+            /// \note       Each file is mapped once and shared by all initializers located in it.
+            const detail::MappedMemoryHandles& get_mmap_cache() const { return m_mmap_cache; }
+
         private:
             const ONNX_NAMESPACE::ModelProto* m_model_proto;
             std::unordered_map<std::string, OperatorSet> m_opset;
+            detail::MappedMemoryHandles m_mmap_cache =
+                std::make_shared<detail::MappedMemoryHandles::element_type>();
         };
 
         inline std::ostream& operator<<(std::ostream& outs, const Model& model)
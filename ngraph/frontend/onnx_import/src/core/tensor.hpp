@@ -16,7 +16,10 @@
 
 #pragma once
 
+#include <cstdint>
+#include <cstring>
 #include <onnx/onnx_pb.h>
+#include <string>
 #include <utility>
 #include <vector>
 
@@ -107,6 +110,15 @@ namespace ngraph
                     {
                     }
                 };
+
+                struct invalid_external_data_size : ngraph_error
+                {
+                    explicit invalid_external_data_size(std::size_t size)
+                        : ngraph_error{"external data size " + std::to_string(size) +
+                                       " does not match the tensor shape"}
+                    {
+                    }
+                };
             }
         }
 
@@ -147,9 +159,13 @@ namespace ngraph
                             get_external_data(const ONNX_NAMESPACE::TensorProto& tensor)
                         {
                             const auto tensor_external_data = TensorExternalData(tensor);
-                            const auto raw_data = tensor_external_data.load_external_data();
+                            const auto buffer = tensor_external_data.load_external_data();
 
-                            return detail::__get_raw_data<T>(raw_data, tensor.data_type());
+                            const auto data_size =
+                                onnx_common::get_onnx_data_size(tensor.data_type());
+                            std::vector<T> data(buffer->size() / data_size);
+                            std::memcpy(data.data(), buffer->get_ptr(), data.size() * sizeof(T));
+                            return data;
                         }
 
                         bool has_tensor_external_data(const ONNX_NAMESPACE::TensorProto& tensor)
@@ -458,9 +474,13 @@ namespace ngraph
             };
 
             Tensor() = delete;
-            explicit Tensor(const ONNX_NAMESPACE::TensorProto& tensor)
+            /// \param[in]  tensor      The ONNX tensor representation.
+            /// \param[in]  mmap_cache  Mappings of external data files shared by the model.
+            explicit Tensor(const ONNX_NAMESPACE::TensorProto& tensor,
+                            const detail::MappedMemoryHandles& mmap_cache = nullptr)
                 : m_tensor_proto{&tensor}
                 , m_shape{std::begin(tensor.dims()), std::end(tensor.dims())}
+                , m_mmap_cache{mmap_cache}
             {
                 if (m_shape == Shape{0})
                 {
@@ -581,8 +601,16 @@ namespace ngraph
             template <typename T>
             std::shared_ptr<ngraph::op::Constant> make_ng_constant(const element::Type& type) const
             {
-                auto constant =
-                    std::make_shared<ngraph::op::Constant>(type, m_shape, get_data<T>());
+                std::shared_ptr<ngraph::op::Constant> constant;
+                if (detail::tensor::detail::has_tensor_external_data(*m_tensor_proto) &&
+                    !m_tensor_proto->has_segment())
+                {
+                    constant = make_ng_constant_from_external_data<T>(type);
+                }
+                else
+                {
+                    constant = std::make_shared<ngraph::op::Constant>(type, m_shape, get_data<T>());
+                }
                 if (m_tensor_proto->has_name())
                 {
                     constant->set_friendly_name(get_name());
@@ -590,8 +618,31 @@ namespace ngraph
                 return constant;
             }
 
+            /// \brief      Creates a Constant which shares external data with the file mapping
+            ///
+            /// \note       The data is copied only if it is not aligned to the element size
+            ///             inside of the external data file.
+            template <typename T>
+            std::shared_ptr<ngraph::op::Constant>
+                make_ng_constant_from_external_data(const element::Type& type) const
+            {
+                const auto buffer =
+                    detail::TensorExternalData(*m_tensor_proto).load_external_data(m_mmap_cache);
+                if (buffer->size() != shape_size(m_shape) * sizeof(T))
+                {
+                    throw error::tensor::invalid_external_data_size{buffer->size()};
+                }
+                if (reinterpret_cast<std::uintptr_t>(buffer->get_ptr()) % alignof(T) != 0)
+                {
+                    return std::make_shared<ngraph::op::Constant>(
+                        type, m_shape, static_cast<const void*>(buffer->get_ptr()));
+                }
+                return std::make_shared<ngraph::op::Constant>(type, m_shape, buffer);
+            }
+
             const ONNX_NAMESPACE::TensorProto* m_tensor_proto;
             Shape m_shape;
+            detail::MappedMemoryHandles m_mmap_cache;
         };
 
         inline std::ostream& operator<<(std::ostream& outs, const Tensor& tensor)
@@ -14,7 +14,21 @@
 // limitations under the License.
 //*****************************************************************************
 
-#include <fstream>
+#ifdef _WIN32
+#ifndef NOMINMAX
+#define NOMINMAX
+#endif
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+#include <algorithm>
+#include <cctype>
+#include <cstdint>
+#include <iomanip>
 #include <sstream>
 
 #include "exceptions.hpp"
@@ -28,6 +42,223 @@ namespace ngraph
     {
         namespace detail
         {
+            namespace
+            {
+                /// \brief  Streaming implementation of the SHA1 message digest (RFC 3174)
+                class Sha1
+                {
+                public:
+                    void update(const unsigned char* data, size_t size)
+                    {
+                        m_total_size += size;
+                        while (size > 0)
+                        {
+                            const size_t chunk = std::min(size, sizeof(m_block) - m_block_size);
+                            std::copy(data, data + chunk, m_block + m_block_size);
+                            m_block_size += chunk;
+                            data += chunk;
+                            size -= chunk;
+                            if (m_block_size == sizeof(m_block))
+                            {
+                                process_block();
+                                m_block_size = 0;
+                            }
+                        }
+                    }
+
+                    std::string hex_digest()
+                    {
+                        const uint64_t total_bits = m_total_size * 8;
+                        const unsigned char padding_start = 0x80;
+                        const unsigned char zero = 0;
+                        update(&padding_start, 1);
+                        while (m_block_size != 56)
+                        {
+                            update(&zero, 1);
+                        }
+                        for (int i = 7; i >= 0; --i)
+                        {
+                            const auto byte = static_cast<unsigned char>(total_bits >> (i * 8));
+                            update(&byte, 1);
+                        }
+
+                        std::stringstream digest;
+                        for (auto word : m_state)
+                        {
+                            digest << std::hex << std::setw(8) << std::setfill('0') << word;
+                        }
+                        return digest.str();
+                    }
+
+                private:
+                    static uint32_t rotate_left(uint32_t value, int bits)
+                    {
+                        return (value << bits) | (value >> (32 - bits));
+                    }
+
+                    void process_block()
+                    {
+                        uint32_t w[80];
+                        for (int i = 0; i < 16; ++i)
+                        {
+                            w[i] = (uint32_t(m_block[i * 4]) << 24) |
+                                   (uint32_t(m_block[i * 4 + 1]) << 16) |
+                                   (uint32_t(m_block[i * 4 + 2]) << 8) |
+                                   uint32_t(m_block[i * 4 + 3]);
+                        }
+                        for (int i = 16; i < 80; ++i)
+                        {
+                            w[i] = rotate_left(w[i - 3] ^ w[i - 8] ^ w[i - 14] ^ w[i - 16], 1);
+                        }
+
+                        uint32_t a = m_state[0], b = m_state[1], c = m_state[2], d = m_state[3],
+                                 e = m_state[4];
+                        for (int i = 0; i < 80; ++i)
+                        {
+                            uint32_t f, k;
+                            if (i < 20)
+                            {
+                                f = (b & c) | (~b & d);
+                                k = 0x5A827999;
+                            }
+                            else if (i < 40)
+                            {
+                                f = b ^ c ^ d;
+                                k = 0x6ED9EBA1;
+                            }
+                            else if (i < 60)
+                            {
+                                f = (b & c) | (b & d) | (c & d);
+                                k = 0x8F1BBCDC;
+                            }
+                            else
+                            {
+                                f = b ^ c ^ d;
+                                k = 0xCA62C1D6;
+                            }
+                            const uint32_t temp = rotate_left(a, 5) + f + e + k + w[i];
+                            e = d;
+                            d = c;
+                            c = rotate_left(b, 30);
+                            b = a;
+                            a = temp;
+                        }
+                        m_state[0] += a;
+                        m_state[1] += b;
+                        m_state[2] += c;
+                        m_state[3] += d;
+                        m_state[4] += e;
+                    }
+
+                    uint32_t m_state[5] = {
+                        0x67452301, 0xEFCDAB89, 0x98BADCFE, 0x10325476, 0xC3D2E1F0};
+                    unsigned char m_block[64];
+                    size_t m_block_size = 0;
+                    uint64_t m_total_size = 0;
+                };
+            }
+
+            MappedMemory::MappedMemory(const std::string& path)
+            {
+#ifdef _WIN32
+#if defined(ENABLE_UNICODE_PATH_SUPPORT)
+                const std::wstring file_path = file_util::multi_byte_char_to_wstring(path.c_str());
+                HANDLE file = CreateFileW(file_path.c_str(),
+#else
+                HANDLE file = CreateFileA(path.c_str(),
+#endif
+                                          GENERIC_READ,
+                                          FILE_SHARE_READ,
+                                          nullptr,
+                                          OPEN_EXISTING,
+                                          FILE_ATTRIBUTE_NORMAL,
+                                          nullptr);
+                if (file == INVALID_HANDLE_VALUE)
+                    return;
+
+                LARGE_INTEGER file_size;
+                if (!GetFileSizeEx(file, &file_size))
+                {
+                    CloseHandle(file);
+                    throw ngraph_error("Failed to get size of external data file: " + path);
+                }
+                if (file_size.QuadPart > 0)
+                {
+                    m_mapping = CreateFileMapping(file, nullptr, PAGE_WRITECOPY, 0, 0, nullptr);
+                    if (m_mapping != nullptr)
+                    {
+                        m_data =
+                            static_cast<char*>(MapViewOfFile(m_mapping, FILE_MAP_COPY, 0, 0, 0));
+                        m_size = static_cast<size_t>(file_size.QuadPart);
+                        m_valid = m_data != nullptr;
+                    }
+                }
+                else
+                {
+                    m_valid = file_size.QuadPart == 0;
+                }
+                // the mapping keeps its own reference to the file
+                CloseHandle(file);
+#else
+                int fd = open(path.c_str(), O_RDONLY);
+                if (fd == -1)
+                    return;
+
+                struct stat sb = {};
+                if (fstat(fd, &sb) != 0)
+                {
+                    close(fd);
+                    throw ngraph_error("Failed to get size of external data file: " + path);
+                }
+                if (sb.st_size > 0)
+                {
+                    // Writable private mapping: pages are shared with the page cache until
+                    // somebody modifies them
+                    void* data = mmap(nullptr,
+                                      static_cast<size_t>(sb.st_size),
+                                      PROT_READ | PROT_WRITE,
+                                      MAP_PRIVATE,
+                                      fd,
+                                      0);
+                    if (data != MAP_FAILED)
+                    {
+                        m_data = static_cast<char*>(data);
+                        m_size = static_cast<size_t>(sb.st_size);
+                        m_valid = true;
+                    }
+                }
+                else
+                {
+                    m_valid = sb.st_size == 0;
+                }
+                // the mapping keeps its own reference to the file
+                close(fd);
+#endif
+            }
+
+            MappedMemory::~MappedMemory()
+            {
+                if (m_data == nullptr)
+                    return;
+#ifdef _WIN32
+                UnmapViewOfFile(m_data);
+                CloseHandle(m_mapping);
+#else
+                munmap(m_data, m_size);
+#endif
+            }
+
+            const std::string& MappedMemory::get_sha1_digest()
+            {
+                if (m_sha1_digest.empty())
+                {
+                    Sha1 sha1;
+                    sha1.update(reinterpret_cast<const unsigned char*>(m_data), m_size);
+                    m_sha1_digest = sha1.hex_digest();
+                }
+                return m_sha1_digest;
+            }
+
             TensorExternalData::TensorExternalData(const ONNX_NAMESPACE::TensorProto& tensor)
             {
                 for (const auto& entry : tensor.external_data())
@@ -35,53 +266,58 @@ namespace ngraph
                     if (entry.key() == "location")
                         m_data_location = entry.value();
                     if (entry.key() == "offset")
-                        m_offset = std::stoi(entry.value());
+                        m_offset = std::stoull(entry.value());
                     if (entry.key() == "length")
-                        m_data_lenght = std::stoi(entry.value());
+                        m_data_lenght = std::stoull(entry.value());
                     if (entry.key() == "checksum")
-                        m_sha1_digest = std::stoi(entry.value());
+                        m_sha1_digest = entry.value();
                 }
             }
 
-            std::string TensorExternalData::load_external_data() const
+            std::shared_ptr<MappedBuffer>
+                TensorExternalData::load_external_data(const MappedMemoryHandles& cache) const
             {
-#if defined(ENABLE_UNICODE_PATH_SUPPORT) && defined(_WIN32)
-                std::wstring path = file_util::multi_byte_char_to_wstring(m_data_location.c_str());
-#else
-                std::string path = m_data_location;
-#endif
-                std::ifstream external_data_stream(path,
-                                                   std::ios::binary | std::ios::in | std::ios::ate);
-                if (external_data_stream.fail())
-                    throw error::invalid_external_data{*this};
-
-                std::streamsize read_data_lenght;
-                if (m_data_lenght == 0) // read entire file
-                    read_data_lenght = external_data_stream.tellg();
-                else
-                    read_data_lenght = m_data_lenght;
-
-                const auto page_size = 4096;
-                if (m_offset != 0 && m_offset % page_size != 0)
+                std::shared_ptr<MappedMemory> mapping;
+                if (cache)
                 {
-                    NGRAPH_WARN << "offset should be multiples 4096 (page size) to enable mmap "
-                                   "support, current value is "
-                                << m_offset;
+                    auto found = cache->find(m_data_location);
+                    if (found != cache->end())
+                        mapping = found->second;
                 }
-                // default value of m_offset is 0
-                external_data_stream.seekg(m_offset, std::ios::beg);
-
-                if (m_sha1_digest != 0)
+                if (!mapping)
                 {
-                    NGRAPH_WARN << "SHA1 checksum is not supported";
+                    mapping = std::make_shared<MappedMemory>(m_data_location);
+                    if (!mapping->valid())
+                        throw error::invalid_external_data{*this};
+                    if (cache)
+                        cache->emplace(m_data_location, mapping);
                 }
 
-                std::string read_data;
-                read_data.resize(read_data_lenght);
-                external_data_stream.read(&read_data[0], read_data_lenght);
-                external_data_stream.close();
+                if (m_offset > mapping->size())
+                    throw error::invalid_external_data{*this};
+                // default value of m_data_lenght is 0 which means the rest of the file
+                const uint64_t data_lenght =
+                    m_data_lenght == 0 ? mapping->size() - m_offset : m_data_lenght;
+                if (data_lenght > mapping->size() - m_offset)
+                    throw error::invalid_external_data{*this};
+
+                if (!m_sha1_digest.empty())
+                {
+                    std::string expected_digest = m_sha1_digest;
+                    std::transform(expected_digest.begin(),
+                                   expected_digest.end(),
+                                   expected_digest.begin(),
+                                   [](char c) { return static_cast<char>(std::tolower(c)); });
+                    if (mapping->get_sha1_digest() != expected_digest)
+                    {
+                        NGRAPH_WARN << "SHA1 checksum of the external data file does not match: "
+                                    << mapping->get_sha1_digest();
+                        throw error::invalid_external_data{*this};
+                    }
+                }
 
-                return read_data;
+                return std::make_shared<MappedBuffer>(
+                    mapping->data() + m_offset, static_cast<size_t>(data_lenght), mapping);
             }
 
             std::string TensorExternalData::to_string() const
@@ -91,7 +327,7 @@ namespace ngraph
                 s << "data_full_path: " << m_data_location;
                 s << ", offset: " << m_offset;
                 s << ", data_lenght: " << m_data_lenght;
-                s << ", sha1_digest: " << m_sha1_digest << ")";
+                s << ", sha1_digest: " << (m_sha1_digest.empty() ? "0" : m_sha1_digest) << ")";
                 return s.str();
             }
         }
@@ -16,7 +16,12 @@
 
 #pragma once
 
+#include <map>
+#include <memory>
 #include <onnx/onnx_pb.h>
+#include <string>
+
+#include "ngraph/runtime/shared_buffer.hpp"
 
 namespace ngraph
 {
@@ -24,20 +29,65 @@ namespace ngraph
     {
         namespace detail
         {
+            /// \brief  Copy-on-write memory mapping of a whole external data file
+            class MappedMemory
+            {
+            public:
+                /// \brief      Maps the file into memory
+                ///
+                /// \note       If the file cannot be mapped, the object is left invalid.
+                explicit MappedMemory(const std::string& path);
+                ~MappedMemory();
+
+                MappedMemory(const MappedMemory&) = delete;
+                MappedMemory& operator=(const MappedMemory&) = delete;
+
+                bool valid() const { return m_valid; }
+                char* data() const { return m_data; }
+                size_t size() const { return m_size; }
+                /// \brief      Calculates SHA1 digest of the file contents
+                ///
+                /// \note       The digest is calculated once in a single pass over the mapping.
+                ///
+                /// \return     Lowercase hexadecimal representation of the digest
+                const std::string& get_sha1_digest();
+
+            private:
+                char* m_data = nullptr;
+                size_t m_size = 0;
+                bool m_valid = false;
+                std::string m_sha1_digest;
+#ifdef _WIN32
+                void* m_mapping = nullptr;
+#endif
+            };
+
+            /// \brief  Mappings of external data files shared by all tensors of a model
+            using MappedMemoryHandles =
+                std::shared_ptr<std::map<std::string, std::shared_ptr<MappedMemory>>>;
+
+            /// \brief  Buffer which points to the tensor data inside of a file mapping
+            using MappedBuffer = runtime::SharedBuffer<std::shared_ptr<MappedMemory>>;
+
             /// \brief  Helper class used to load tensor data from external files
             class TensorExternalData
             {
             public:
                 TensorExternalData(const ONNX_NAMESPACE::TensorProto& tensor);
 
-                /// \brief      Load external data from tensor passed to constructor
+                /// \brief      Map external data from tensor passed to constructor
+                ///
+                /// \note       If mapping data from external files fails or the data
+                ///             does not match the checksum, the invalid_external_data
+                ///             exception is thrown.
                 ///
-                /// \note       If read data from external file fails,
-                /// \note       If reading data from external files fails,
-                ///             the invalid_external_data exception is thrown.
+                /// \param      cache  Mappings of files already opened for the model. If it is
+                ///                    null, the file is mapped for this tensor only.
                 ///
-                /// \return     External binary data loaded into a std::string
-                std::string load_external_data() const;
+                /// \return     Buffer pointing to external data inside of the file mapping.
+                ///             The buffer keeps the mapping alive.
+                std::shared_ptr<MappedBuffer>
+                    load_external_data(const MappedMemoryHandles& cache = nullptr) const;
 
                 /// \brief      Represets parameter of external data as string
                 ///
@@ -46,9 +96,9 @@ namespace ngraph
 
             private:
                 std::string m_data_location{};
-                int m_offset = 0;
-                int m_data_lenght = 0;
-                int m_sha1_digest = 0;
+                uint64_t m_offset = 0;
+                uint64_t m_data_lenght = 0;
+                std::string m_sha1_digest{};
             };
         }
     }
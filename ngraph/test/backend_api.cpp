@@ -19,6 +19,7 @@
 #include "ngraph/util.hpp"
 #include "runtime/backend.hpp"
 #include "util/all_close_f.hpp"
+#include "util/random.hpp"
 #include "util/test_tools.hpp"
 
 using namespace std;
@@ -58,3 +59,63 @@ TEST(backend_api, DISABLED_config_unsupported)
     EXPECT_FALSE(backend->set_config(config, error));
     EXPECT_FALSE(error == "");
 }
+
+TEST(backend_api, config_parallel_execution)
+{
+    auto backend = runtime::Backend::create("INTERPRETER");
+    string error;
+    EXPECT_TRUE(backend->set_config({{"PARALLEL_EXECUTION", "YES"}}, error));
+    EXPECT_TRUE(backend->set_config({{"PARALLEL_EXECUTION", "NO"}}, error));
+    EXPECT_FALSE(backend->set_config({{"PARALLEL_EXECUTION", "MAYBE"}}, error));
+    EXPECT_FALSE(error.empty());
+}
+
+TEST(backend_api, parallel_execution_results_equal_to_sequential)
+{
+    const Shape data_shape{2, 16, 24, 24};
+    const Shape filters_shape{32, 16, 3, 3};
+    const Shape weights_shape{32 * 11 * 11, 64};
+    auto data = make_shared<op::Parameter>(element::f32, data_shape);
+    auto filters = make_shared<op::Parameter>(element::f32, filters_shape);
+    auto weights = make_shared<op::Parameter>(element::f32, weights_shape);
+    auto conv = make_shared<op::v1::Convolution>(data,
+                                                 filters,
+                                                 Strides{1, 1},
+                                                 CoordinateDiff{0, 0},
+                                                 CoordinateDiff{0, 0},
+                                                 Strides{1, 1});
+    auto relu = make_shared<op::Relu>(conv);
+    auto pool = make_shared<op::v1::MaxPool>(
+        relu, Strides{2, 2}, Shape{0, 0}, Shape{0, 0}, Shape{2, 2}, op::RoundingType::FLOOR);
+    auto pattern = op::Constant::create(element::i64, Shape{2}, {2, 32 * 11 * 11});
+    auto reshape = make_shared<op::v1::Reshape>(pool, pattern, false);
+    auto matmul = make_shared<op::MatMul>(reshape, weights);
+    auto f = make_shared<Function>(matmul, ParameterVector{data, filters, weights});
+
+    test::Uniform<float> rng(-1.0f, 1.0f);
+    vector<vector<float>> inputs;
+    for (const auto& param : f->get_parameters())
+    {
+        vector<float> values(shape_size(param->get_shape()));
+        rng.initialize(values);
+        inputs.push_back(values);
+    }
+
+    auto execute = [&](const string& parallel_execution) {
+        auto backend = runtime::Backend::create("INTERPRETER");
+        string error;
+        EXPECT_TRUE(backend->set_config({{"PARALLEL_EXECUTION", parallel_execution}}, error));
+        vector<shared_ptr<runtime::Tensor>> input_tensors;
+        for (size_t i = 0; i < inputs.size(); ++i)
+        {
+            auto tensor = backend->create_tensor(element::f32, f->get_parameters()[i]->get_shape());
+            copy_data(tensor, inputs[i]);
+            input_tensors.push_back(tensor);
+        }
+        auto result = backend->create_tensor(element::f32, f->get_output_shape(0));
+        backend->compile(f)->call_with_validate({result}, input_tensors);
+        return read_vector<float>(result);
+    };
+
+    EXPECT_EQ(execute("YES"), execute("NO"));
+}
@@ -3168,3 +3168,75 @@ TEST(constant_folding, constant_loop)
     range_test_check(result_node_0->cast_vector<float>(), expected_0);
     range_test_check(result_node_1->cast_vector<float>(), expected_1);
 }
+
+TEST(constant_folding, large_weights_subgraphs)
+{
+    // Dequantization subgraphs of several convolution weights (decompression, zero point
+    // subtraction and per output channel scale, reordering) concatenated together. Subgraphs
+    // are independent, so they are folded concurrently, and each of them is large enough for
+    // kernels to be parallelized.
+    const size_t branches = 8;
+    const Shape weights_shape{128, 128, 3, 3};
+    const Shape channel_shape{128, 1, 1, 1};
+    const size_t weights_size = shape_size(weights_shape);
+    const size_t kernel_size = 3 * 3;
+
+    vector<float> weights(weights_size);
+    for (size_t i = 0; i < weights_size; ++i)
+    {
+        weights[i] = static_cast<float>(static_cast<int>(i % 255) - 127);
+    }
+    vector<float> zero_points(128), scales(128);
+    for (size_t c = 0; c < 128; ++c)
+    {
+        zero_points[c] = static_cast<float>(c % 16);
+        scales[c] = 1.0f / static_cast<float>(c + 1);
+    }
+
+    OutputVector dequantized;
+    for (size_t b = 0; b < branches; ++b)
+    {
+        auto data = make_shared<opset5::Constant>(
+            b % 2 ? element::f16 : element::i8, weights_shape, weights);
+        auto convert = make_shared<opset5::Convert>(data, element::f32);
+        auto zero_point = make_shared<opset5::Constant>(element::f32, channel_shape, zero_points);
+        auto subtract = make_shared<opset5::Subtract>(convert, zero_point);
+        auto scale = make_shared<opset5::Constant>(element::f32, channel_shape, scales);
+        auto multiply = make_shared<opset5::Multiply>(subtract, scale);
+        auto order = op::Constant::create(element::i64, Shape{4}, {1, 0, 2, 3});
+        dequantized.push_back(make_shared<opset5::Transpose>(multiply, order));
+    }
+    auto concat = make_shared<opset5::Concat>(dequantized, 1);
+    auto f = make_shared<Function>(concat, ParameterVector{});
+
+    pass::Manager pass_manager;
+    pass_manager.register_pass<pass::ConstantFolding>();
+    pass_manager.run_passes(f);
+
+    ASSERT_EQ(count_ops_of_type<opset5::Concat>(f), 0);
+    ASSERT_EQ(count_ops_of_type<opset5::Constant>(f), 1);
+
+    auto new_const =
+        as_type_ptr<op::Constant>(f->get_results().at(0)->input_value(0).get_node_shared_ptr());
+    ASSERT_TRUE(new_const);
+    ASSERT_EQ(new_const->get_output_shape(0), (Shape{128, 128 * branches, 3, 3}));
+
+    const auto values_out = new_const->get_vector<float>();
+    vector<float> expected(values_out.size());
+    for (size_t i = 0; i < 128; ++i)
+    {
+        for (size_t b = 0; b < branches; ++b)
+        {
+            for (size_t o = 0; o < 128; ++o)
+            {
+                for (size_t k = 0; k < kernel_size; ++k)
+                {
+                    const float weight = weights[(o * 128 + i) * kernel_size + k];
+                    expected[((i * branches + b) * 128 + o) * kernel_size + k] =
+                        (weight - zero_points[o]) * scales[o];
+                }
+            }
+        }
+    }
+    EXPECT_TRUE(test::all_close_f(values_out, expected, MIN_FLOAT_TOLERANCE_BITS));
+}
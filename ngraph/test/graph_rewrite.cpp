@@ -6,6 +6,7 @@
 #include <ngraph/opsets/opset3.hpp>
 #include <ngraph/pass/graph_rewrite.hpp>
 #include <ngraph/pass/manager.hpp>
+#include <ngraph/pattern/op/wrap_type.hpp>
 #include <util/test_tools.hpp>
 
 NGRAPH_SUPPRESS_DEPRECATED_START
@@ -267,6 +268,61 @@ TEST(GraphRewriteTest, TypeBasedMatcherPassOrder2)
     ASSERT_EQ(count_ops_of_type<opset3::Tanh>(f), 1);
 }
 
+TEST(GraphRewriteTest, MixedTypeBasedMatcherPassOrder1)
+{
+    auto f = get_derived_function();
+
+    Anchor anchor;
+    anchor.add_matcher<TypeBasedTestPassDerived>()->set_callback(get_callback());
+    anchor.add_matcher<TestPass>()->set_callback(get_callback());
+    anchor.run_on_function(f);
+
+    ASSERT_EQ(count_ops_of_type<opset3::Tanh>(f), 1);
+}
+
+TEST(GraphRewriteTest, MixedTypeBasedMatcherPassOrder2)
+{
+    auto f = get_derived_function();
+
+    Anchor anchor;
+    anchor.add_matcher<TestPass>()->set_callback(get_callback());
+    anchor.add_matcher<TypeBasedTestPassDerived>()->set_callback(get_callback());
+    anchor.run_on_function(f);
+
+    ASSERT_EQ(count_ops_of_type<opset3::Relu>(f), 1);
+}
+
+TEST(GraphRewriteTest, ReplacedNodesAreSkipped)
+{
+    auto data =
+        std::make_shared<ngraph::opset3::Parameter>(ngraph::element::f32, ngraph::Shape{3, 1, 2});
+    auto relu1 = std::make_shared<ngraph::opset3::Relu>(data);
+    auto relu2 = std::make_shared<ngraph::opset3::Relu>(relu1);
+    auto f = std::make_shared<ngraph::Function>(ngraph::NodeVector{relu2},
+                                                ngraph::ParameterVector{data});
+
+    // the first visited Relu removes its consumer which is still in the execution queue
+    std::vector<std::shared_ptr<Node>> visited;
+    auto relu_pattern = ngraph::pattern::wrap_type<opset3::Relu>();
+    auto pass = std::make_shared<pass::MatcherPass>(
+        "RemoveConsumer",
+        std::make_shared<pattern::Matcher>(relu_pattern, "RemoveConsumer"),
+        [&](const std::shared_ptr<Node>& node) {
+            visited.push_back(node);
+            if (node == relu1)
+            {
+                return replace_output_update_name(relu2->output(0), relu1->output(0));
+            }
+            return false;
+        });
+
+    pass::GraphRewrite rewrite(pass);
+    ASSERT_TRUE(rewrite.run_on_function(f));
+
+    ASSERT_EQ(visited, std::vector<std::shared_ptr<Node>>{relu1});
+    ASSERT_EQ(count_ops_of_type<opset3::Relu>(f), 1);
+}
+
 TEST(PassConfigTest, Test1)
 {
     {
@@ -14,6 +14,8 @@
 // limitations under the License.
 //*****************************************************************************
 
+#include <cstdlib>
+
 #include "default_opset.hpp"
 #include "gtest/gtest.h"
 #include "ngraph/file_util.hpp"
@@ -101,6 +103,57 @@ NGRAPH_TEST(${BACKEND_NAME}, onnx_external_two_tensors_data_in_the_same_file)
     test_case.run();
 }
 
+NGRAPH_TEST(${BACKEND_NAME}, onnx_external_two_tensors_share_file_mapping)
+{
+    auto function = onnx_import::import_onnx_model(file_util::path_join(
+        SERIALIZED_ZOO,
+        "onnx/external_data/external_data_two_tensors_data_in_the_same_file.prototxt"));
+
+    std::vector<const char*> data_ptrs;
+    for (const auto& node : function->get_ordered_ops())
+    {
+        if (const auto constant = as_type_ptr<op::Constant>(node))
+        {
+            data_ptrs.push_back(constant->get_data_ptr<char>());
+        }
+    }
+    // both initializers point into a single mapping of the file at offsets 0 and 4096
+    ASSERT_EQ(data_ptrs.size(), 2u);
+    EXPECT_EQ(std::abs(data_ptrs[1] - data_ptrs[0]), 4096);
+}
+
+NGRAPH_TEST(${BACKEND_NAME}, onnx_external_data_checksum)
+{
+    const auto function = onnx_import::import_onnx_model(
+        file_util::path_join(SERIALIZED_ZOO, "onnx/external_data/external_data_checksum.prototxt"));
+
+    auto test_case = test::TestCase<TestEngine>(function);
+    test_case.add_input<float>({1.f, 2.f, 3.f, 4.f});
+    test_case.add_expected_output<float>(Shape{2, 2}, {3.f, 6.f, 9.f, 12.f});
+
+    test_case.run();
+}
+
+NGRAPH_TEST(${BACKEND_NAME}, onnx_external_data_invalid_checksum_exception)
+{
+    try
+    {
+        auto function = onnx_import::import_onnx_model(file_util::path_join(
+            SERIALIZED_ZOO, "onnx/external_data/external_data_invalid_checksum.prototxt"));
+        FAIL() << "Incorrect checksum of external data not detected";
+    }
+    catch (const ngraph_error& error)
+    {
+        EXPECT_PRED_FORMAT2(testing::IsSubstring,
+                            std::string("sha1_digest: 0000000000000000000000000000000000000000)"),
+                            error.what());
+    }
+    catch (...)
+    {
+        FAIL() << "Importing onnx model failed for unexpected reason";
+    }
+}
+
 NGRAPH_TEST(${BACKEND_NAME}, onnx_external_invalid_external_data_exception)
 {
     try
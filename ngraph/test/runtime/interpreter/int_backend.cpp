@@ -19,6 +19,7 @@
 #include "backend_manager.hpp"
 #include "int_backend.hpp"
 #include "int_executable.hpp"
+#include "ngraph/env_util.hpp"
 #include "ngraph/except.hpp"
 #include "ngraph/runtime/host_tensor.hpp"
 #include "ngraph/util.hpp"
@@ -33,10 +34,14 @@ extern "C" INTERPRETER_BACKEND_API void ngraph_register_interpreter_backend()
     });
 }
 
-runtime::interpreter::INTBackend::INTBackend() {}
+runtime::interpreter::INTBackend::INTBackend()
+    : m_parallel_execution{getenv_bool("NGRAPH_INTERPRETER_PARALLEL")}
+{
+}
 
 runtime::interpreter::INTBackend::INTBackend(const vector<string>& unsupported_op_name_list)
     : m_unsupported_op_name_list{unsupported_op_name_list.begin(), unsupported_op_name_list.end()}
+    , m_parallel_execution{getenv_bool("NGRAPH_INTERPRETER_PARALLEL")}
 {
 }
 
@@ -68,7 +73,9 @@ shared_ptr<runtime::Executable>
     runtime::interpreter::INTBackend::compile(shared_ptr<Function> function,
                                               bool enable_performance_collection)
 {
-    return make_shared<INTExecutable>(function, enable_performance_collection);
+    auto executable = make_shared<INTExecutable>(function, enable_performance_collection);
+    executable->set_parallel_execution(m_parallel_execution);
+    return executable;
 }
 
 bool runtime::interpreter::INTBackend::is_supported(const Node& node) const
@@ -86,5 +93,18 @@ bool runtime::interpreter::INTBackend::set_config(const map<string, string>& con
         error = it->second;
         rc = true;
     }
+    it = config.find("PARALLEL_EXECUTION");
+    if (it != config.end())
+    {
+        if (it->second == "YES" || it->second == "NO")
+        {
+            m_parallel_execution = it->second == "YES";
+            rc = true;
+        }
+        else
+        {
+            error = "Unsupported PARALLEL_EXECUTION value: " + it->second;
+        }
+    }
     return rc;
 }
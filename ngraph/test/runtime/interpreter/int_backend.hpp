@@ -63,8 +63,12 @@ public:
 
     bool is_supported(const Node& node) const override;
 
+    /// \brief Supports "PARALLEL_EXECUTION" key with "YES" or "NO" value, which sets the
+    ///        execution mode of functions compiled after the call (see
+    ///        INTExecutable::set_parallel_execution).
     bool set_config(const std::map<std::string, std::string>& config, std::string& error) override;
 
 private:
     std::set<std::string> m_unsupported_op_name_list;
+    bool m_parallel_execution;
 };
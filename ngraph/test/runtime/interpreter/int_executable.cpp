@@ -20,6 +20,7 @@
 #include "evaluates_map.hpp"
 #include "ngraph/except.hpp"
 #include "ngraph/ops.hpp"
+#include "ngraph/runtime/parallel.hpp"
 #include "ngraph/type/bfloat16.hpp"
 #include "ngraph/type/float16.hpp"
 #include "ngraph/util.hpp"
@@ -42,9 +43,17 @@ runtime::interpreter::INTExecutable::INTExecutable(const shared_ptr<Function>& f
     set_parameters_and_results(*m_function);
 }
 
+void runtime::interpreter::INTExecutable::set_parallel_execution(bool enable)
+{
+    m_parallel_execution_enabled = enable;
+}
+
 bool runtime::interpreter::INTExecutable::call(const vector<shared_ptr<runtime::Tensor>>& outputs,
                                                const vector<shared_ptr<runtime::Tensor>>& inputs)
 {
+    // 0 lifts the limit
+    runtime::ParallelThreadsLimit threads_limit(m_parallel_execution_enabled ? 0 : 1);
+
     // convert inputs to HostTensor
     vector<shared_ptr<HostTensor>> func_inputs;
     for (const auto& tensor : inputs)
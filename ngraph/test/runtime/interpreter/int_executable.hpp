@@ -60,6 +60,12 @@ public:
 
     void set_nan_check(bool enable);
 
+    /// \brief Enables parallel execution of reference kernels, which split independent parts
+    ///        of output (batches, channels, matrix tiles, elements) between threads. Every output
+    ///        element is computed the same way as in sequential mode, so results don't change.
+    ///        Disabled by default, as kernels are run by the calling thread only.
+    void set_parallel_execution(bool enable);
+
     std::vector<PerformanceCounter> get_performance_data() const override;
 
     std::shared_ptr<runtime::Tensor> create_input_tensor(size_t input_index) override;
@@ -80,6 +86,7 @@ protected:
                        const HostTensorVector& inputs) const;
     bool m_is_compiled = false;
     bool m_nan_check_enabled = false;
+    bool m_parallel_execution_enabled = false;
     bool m_performance_counters_enabled = false;
     std::shared_ptr<Function> m_function;
     std::unordered_map<std::shared_ptr<const Node>, stopwatch> m_timer_map;
@@ -14,9 +14,12 @@
 // limitations under the License.
 //*****************************************************************************
 
+#include <algorithm>
 #include <fstream>
+#include <mutex>
 #include <sstream>
 #include <string>
+#include <thread>
 #include <vector>
 
 #include "gtest/gtest.h"
@@ -29,6 +32,7 @@
 #include "ngraph/opsets/opset6.hpp"
 #include "ngraph/pass/manager.hpp"
 #include "ngraph/pass/visualize_tree.hpp"
+#include "ngraph/runtime/parallel.hpp"
 #include "util/all_close.hpp"
 #include "util/ndarray.hpp"
 
@@ -737,6 +741,91 @@ TEST(util, topological_sort_replace)
     EXPECT_TRUE(custom_sorter_used);
 }
 
+TEST(util, topological_sort_cached)
+{
+    Shape shape{2, 2};
+    auto A = make_shared<op::Parameter>(element::f32, shape);
+    auto B = make_shared<op::Parameter>(element::f32, shape);
+    auto add = make_shared<op::v1::Add>(A, B);
+    auto abs = make_shared<op::Abs>(add);
+    auto f = make_shared<Function>(abs, ParameterVector{A, B});
+    size_t sorter_calls = 0;
+
+    f->set_topological_sort(
+        [&sorter_calls](const std::vector<std::shared_ptr<Node>>& root_nodes) {
+            sorter_calls++;
+            return topological_sort(root_nodes);
+        });
+
+    // order is computed once while graph is not modified
+    auto ordered = f->get_ordered_ops();
+    EXPECT_EQ(f->get_ordered_ops(), ordered);
+    EXPECT_EQ(sorter_calls, 1);
+
+    // new nodes and functions don't change the order, even if they consume nodes of the function
+    auto other = make_shared<Function>(make_shared<op::Negative>(add), ParameterVector{A, B});
+    other->add_results({make_shared<op::Result>(B)});
+    EXPECT_EQ(f->get_ordered_ops(), ordered);
+    EXPECT_EQ(sorter_calls, 1);
+
+    // replacing a node invalidates the order
+    auto mul = make_shared<op::v1::Multiply>(A, B);
+    replace_node(add, mul);
+    ordered = f->get_ordered_ops();
+    EXPECT_EQ(sorter_calls, 2);
+    EXPECT_NE(std::find(ordered.begin(), ordered.end(), mul), ordered.end());
+    EXPECT_EQ(std::find(ordered.begin(), ordered.end(), add), ordered.end());
+
+    // cached order does not keep replaced nodes alive
+    std::weak_ptr<Node> weak_add = add;
+    add.reset();
+    EXPECT_TRUE(weak_add.expired());
+
+    // control dependency adds a node to the order
+    auto neg = make_shared<op::Negative>(A);
+    abs->add_control_dependency(neg);
+    ordered = f->get_ordered_ops();
+    EXPECT_EQ(sorter_calls, 3);
+    EXPECT_NE(std::find(ordered.begin(), ordered.end(), neg), ordered.end());
+
+    // updating function results invalidates the order
+    auto result = make_shared<op::Result>(make_shared<op::Abs>(B));
+    f->add_results({result});
+    ordered = f->get_ordered_ops();
+    EXPECT_EQ(sorter_calls, 4);
+    EXPECT_NE(std::find(ordered.begin(), ordered.end(), result), ordered.end());
+}
+
+TEST(util, parallel_for_threads_limit)
+{
+    const size_t work_amount = 1024;
+    const auto caller = std::this_thread::get_id();
+    auto runs_in_caller = [&]() {
+        bool in_caller = true;
+        std::mutex mutex;
+        runtime::parallel_for(work_amount, 1, [&](size_t, size_t) {
+            std::lock_guard<std::mutex> lock(mutex);
+            in_caller = in_caller && std::this_thread::get_id() == caller;
+        });
+        return in_caller;
+    };
+
+    // serial unless the caller lifts the limit
+    EXPECT_EQ(runtime::parallel_get_max_threads(), 1u);
+    EXPECT_TRUE(runs_in_caller());
+    {
+        runtime::ParallelThreadsLimit threads_limit(0);
+        EXPECT_EQ(runtime::parallel_get_max_threads(), std::max(1u, std::thread::hardware_concurrency()));
+
+        // nested regions are serial whatever the limit is
+        runtime::parallel_for(work_amount, 1, [&](size_t, size_t) {
+            runtime::ParallelThreadsLimit nested_limit(0);
+            EXPECT_EQ(runtime::parallel_get_max_threads(), 1u);
+        });
+    }
+    EXPECT_EQ(runtime::parallel_get_max_threads(), 1u);
+}
+
 TEST(util, double_to_int_limits)
 {
     auto round_func = [](double x) { return std::round(x); };